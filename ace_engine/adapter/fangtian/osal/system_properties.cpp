@@ -203,4 +203,9 @@ int32_t SystemProperties::GetSvgMode()
     return 1;
 }
 
+bool SystemProperties::GetParallelLayoutEnabled()
+{
+    return false;
+}
+
 } // namespace OHOS::Ace
@@ -416,4 +416,11 @@ int32_t SystemProperties::GetSvgMode()
     return system::GetIntParameter<int>("persist.ace.svg.mode", 1);
 }
 
+bool SystemProperties::GetParallelLayoutEnabled()
+{
+    static bool parallelLayoutEnabled =
+        system::GetParameter("persist.ace.layout.parallel.enabled", "0") == "1";
+    return parallelLayoutEnabled;
+}
+
 } // namespace OHOS::Ace
@@ -196,4 +196,9 @@ int32_t SystemProperties::GetSvgMode()
     return 1;
 }
 
+bool SystemProperties::GetParallelLayoutEnabled()
+{
+    return false;
+}
+
 } // namespace OHOS::Ace
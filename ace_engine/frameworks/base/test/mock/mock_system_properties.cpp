@@ -45,4 +45,9 @@ float SystemProperties::GetAnimationScale()
 {
     return defaultAnimationScale;
 }
+
+bool SystemProperties::GetParallelLayoutEnabled()
+{
+    return false;
+}
 } // namespace OHOS::Ace
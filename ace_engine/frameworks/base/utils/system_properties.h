@@ -184,6 +184,8 @@ public:
 
     static int32_t GetSvgMode();
 
+    static bool GetParallelLayoutEnabled();
+
     static bool GetRosenBackendEnabled()
     {
         return rosenBackendEnabled_;
@@ -932,6 +932,13 @@ void DeclarativeFrontend::TriggerGarbageCollection()
     }
 }
 
+void DeclarativeFrontend::NotifyIdleTime(int32_t idleTime)
+{
+    if (jsEngine_) {
+        jsEngine_->NotifyIdleTime(idleTime);
+    }
+}
+
 void DeclarativeFrontend::DumpHeapSnapshot(bool isPrivate)
 {
     if (jsEngine_) {
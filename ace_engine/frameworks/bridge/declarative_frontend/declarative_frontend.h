@@ -143,6 +143,7 @@ public:
     void DumpFrontend() const override;
     std::string GetPagePath() const override;
     void TriggerGarbageCollection() override;
+    void NotifyIdleTime(int32_t idleTime) override;
     void DumpHeapSnapshot(bool isPrivate) override;
     void SetColorMode(ColorMode colorMode) override;
     void RebuildAllPages() override;
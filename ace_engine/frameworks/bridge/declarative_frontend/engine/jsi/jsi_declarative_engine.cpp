@@ -1733,6 +1733,13 @@ void JsiDeclarativeEngine::RunFullGarbageCollection()
     }
 }
 
+void JsiDeclarativeEngine::NotifyIdleTime(int32_t idleTime)
+{
+    if (engineInstance_ && engineInstance_->GetJsRuntime()) {
+        engineInstance_->GetJsRuntime()->NotifyIdleTime(idleTime);
+    }
+}
+
 void JsiDeclarativeEngine::DumpHeapSnapshot(bool isPrivate)
 {
     if (engineInstance_ && engineInstance_->GetJsRuntime()) {
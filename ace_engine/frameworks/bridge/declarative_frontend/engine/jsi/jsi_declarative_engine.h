@@ -300,6 +300,8 @@ public:
 
     void RunFullGarbageCollection() override;
 
+    void NotifyIdleTime(int32_t idleTime) override;
+
     void DumpHeapSnapshot(bool isPrivate) override;
 
     std::string GetStacktraceMessage() override;
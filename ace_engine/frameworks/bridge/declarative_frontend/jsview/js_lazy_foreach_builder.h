@@ -74,6 +74,12 @@ public:
             info.second = cachedIter->second;
             return info;
         }
+        auto recycledNode = TakeRecycledItem(key);
+        if (recycledNode) {
+            info.first = key;
+            info.second = recycledNode;
+            return info;
+        }
 
         NG::ScopedViewStackProcessor scopedViewStackProcessor;
         auto* viewStack = NG::ViewStackProcessor::GetInstance();
@@ -144,40 +144,75 @@ bool CheckJSCallbackInfo(
     return typeVerified || infoTypes.size() == 0;
 }
 
-void ParseJsScale(std::unique_ptr<JsonValue>& argsPtrItem, float& scaleX, float& scaleY, float& scaleZ,
-    Dimension& centerX, Dimension& centerY)
+// The properties of attribute objects are read directly from the js object, so that no json string is built and
+// parsed again on every attribute update.
+bool HasJsProperty(const JSRef<JSObject>& jsObj, const char* key)
+{
+    auto value = jsObj->GetProperty(key);
+    return !value->IsUndefined() && !value->IsFunction();
+}
+
+int32_t GetJsIntProperty(const JSRef<JSObject>& jsObj, const char* key, int32_t defaultValue)
+{
+    auto value = jsObj->GetProperty(key);
+    return value->IsNumber() ? value->ToNumber<int32_t>() : defaultValue;
+}
+
+bool GetJsBoolProperty(const JSRef<JSObject>& jsObj, const char* key, bool defaultValue)
+{
+    auto value = jsObj->GetProperty(key);
+    return value->IsBoolean() ? value->ToBoolean() : defaultValue;
+}
+
+std::string GetJsStringProperty(const JSRef<JSObject>& jsObj, const char* key, const std::string& defaultValue)
+{
+    auto value = jsObj->GetProperty(key);
+    return value->IsString() ? value->ToString() : defaultValue;
+}
+
+JSRef<JSObject> GetJsObjectProperty(const JSRef<JSObject>& jsObj, const char* key)
+{
+    auto value = jsObj->GetProperty(key);
+    if (value->IsObject()) {
+        return JSRef<JSObject>::Cast(value);
+    }
+    return JSRef<JSObject>::New();
+}
+
+void ParseJsScale(const JSRef<JSObject>& jsObj, float& scaleX, float& scaleY, float& scaleZ, Dimension& centerX,
+    Dimension& centerY)
 {
     double xVal = 1.0;
     double yVal = 1.0;
     double zVal = 1.0;
-    JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("x"), xVal);
-    JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("y"), yVal);
-    JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("z"), zVal);
+    JSViewAbstract::ParseJsDouble(jsObj->GetProperty("x"), xVal);
+    JSViewAbstract::ParseJsDouble(jsObj->GetProperty("y"), yVal);
+    JSViewAbstract::ParseJsDouble(jsObj->GetProperty("z"), zVal);
     scaleX = static_cast<float>(xVal);
     scaleY = static_cast<float>(yVal);
     scaleZ = static_cast<float>(zVal);
     // if specify centerX
     Dimension length;
-    if (JSViewAbstract::ParseJsonDimensionVp(argsPtrItem->GetValue("centerX"), length)) {
+    if (JSViewAbstract::ParseJsDimensionVp(jsObj->GetProperty("centerX"), length)) {
         centerX = length;
     }
     // if specify centerY
-    if (JSViewAbstract::ParseJsonDimensionVp(argsPtrItem->GetValue("centerY"), length)) {
+    if (JSViewAbstract::ParseJsDimensionVp(jsObj->GetProperty("centerY"), length)) {
         centerY = length;
     }
 }
 
 void ParseJsTranslate(
-    std::unique_ptr<JsonValue>& argsPtrItem, Dimension& translateX, Dimension& translateY, Dimension& translateZ)
+    const JSRef<JSObject>& jsObj, Dimension& translateX, Dimension& translateY, Dimension& translateZ)
 {
     Dimension length;
-    if (JSViewAbstract::ParseJsonDimensionVp(argsPtrItem->GetValue("x"), length)) {
+    if (JSViewAbstract::ParseJsDimensionVp(jsObj->GetProperty("x"), length)) {
         translateX = length;
     }
-    if (JSViewAbstract::ParseJsonDimensionVp(argsPtrItem->GetValue("y"), length)) {
+    if (JSViewAbstract::ParseJsDimensionVp(jsObj->GetProperty("y"), length)) {
         translateY = length;
     }
-    if (JSViewAbstract::ParseJsonDimensionVp(argsPtrItem->GetValue("z"), length)) {
+    if (JSViewAbstract::ParseJsDimensionVp(jsObj->GetProperty("z"), length)) {
         translateZ = length;
     }
 }
@@ -202,52 +237,121 @@ void GetDefaultRotateVector(double& dx, double& dy, double& dz)
     }
 }
 
-void ParseJsRotate(std::unique_ptr<JsonValue>& argsPtrItem, float& dx, float& dy, float& dz, Dimension& centerX,
+void ParseJsRotate(const JSRef<JSObject>& jsObj, float& dx, float& dy, float& dz, Dimension& centerX,
     Dimension& centerY, std::optional<float>& angle)
 {
     // default: dx, dy, dz (0.0, 0.0, 0.0)
     double dxVal = 0.0;
     double dyVal = 0.0;
     double dzVal = 0.0;
-    if (!argsPtrItem->Contains("x") && !argsPtrItem->Contains("y") && !argsPtrItem->Contains("z")) {
+    auto xVal = jsObj->GetProperty("x");
+    auto yVal = jsObj->GetProperty("y");
+    auto zVal = jsObj->GetProperty("z");
+    if (xVal->IsUndefined() && yVal->IsUndefined() && zVal->IsUndefined()) {
         GetDefaultRotateVector(dxVal, dyVal, dzVal);
     }
-    JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("x"), dxVal);
-    JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("y"), dyVal);
-    JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("z"), dzVal);
+    JSViewAbstract::ParseJsDouble(xVal, dxVal);
+    JSViewAbstract::ParseJsDouble(yVal, dyVal);
+    JSViewAbstract::ParseJsDouble(zVal, dzVal);
     dx = static_cast<float>(dxVal);
     dy = static_cast<float>(dyVal);
     dz = static_cast<float>(dzVal);
     // if specify centerX
     Dimension length;
-    if (JSViewAbstract::ParseJsonDimensionVp(argsPtrItem->GetValue("centerX"), length)) {
+    if (JSViewAbstract::ParseJsDimensionVp(jsObj->GetProperty("centerX"), length)) {
         centerX = length;
     }
     // if specify centerY
-    if (JSViewAbstract::ParseJsonDimensionVp(argsPtrItem->GetValue("centerY"), length)) {
+    if (JSViewAbstract::ParseJsDimensionVp(jsObj->GetProperty("centerY"), length)) {
         centerY = length;
     }
     // if specify angle
-    JSViewAbstract::GetAngle("angle", argsPtrItem, angle);
-}
-
-bool ParseMotionPath(const std::unique_ptr<JsonValue>& argsPtrItem, MotionPathOption& option)
-{
-    if (argsPtrItem && !argsPtrItem->IsNull()) {
-        auto path = argsPtrItem->GetString("path", "");
-        if (!path.empty()) {
-            option.SetPath(path);
-            double from = 0.0;
-            double to = 1.0;
-            JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("from"), from);
-            JSViewAbstract::ParseJsonDouble(argsPtrItem->GetValue("to"), to);
-            option.SetBegin(static_cast<float>(from));
-            option.SetEnd(static_cast<float>(to));
-            option.SetRotate(argsPtrItem->GetBool("rotatable", false));
-            return true;
+    JSViewAbstract::GetJsAngle("angle", jsObj, angle);
+}
+
+bool ParseJsMotionPath(const JSRef<JSObject>& jsObj, MotionPathOption& option)
+{
+    auto path = GetJsStringProperty(jsObj, "path", "");
+    if (path.empty()) {
+        return false;
+    }
+    option.SetPath(path);
+    double from = 0.0;
+    double to = 1.0;
+    JSViewAbstract::ParseJsDouble(jsObj->GetProperty("from"), from);
+    JSViewAbstract::ParseJsDouble(jsObj->GetProperty("to"), to);
+    option.SetBegin(static_cast<float>(from));
+    option.SetEnd(static_cast<float>(to));
+    option.SetRotate(GetJsBoolProperty(jsObj, "rotatable", false));
+    return true;
+}
+
+void ParseJsLinearGradientDirection(const JSRef<JSObject>& jsObj, NG::Gradient& gradient)
+{
+    auto direction = static_cast<GradientDirection>(
+        GetJsIntProperty(jsObj, "direction", static_cast<int32_t>(GradientDirection::NONE)));
+    switch (direction) {
+        case GradientDirection::LEFT:
+            gradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
+            break;
+        case GradientDirection::RIGHT:
+            gradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
+            break;
+        case GradientDirection::TOP:
+            gradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
+            break;
+        case GradientDirection::BOTTOM:
+            gradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
+            break;
+        case GradientDirection::LEFT_TOP:
+            gradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
+            gradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
+            break;
+        case GradientDirection::LEFT_BOTTOM:
+            gradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
+            gradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
+            break;
+        case GradientDirection::RIGHT_TOP:
+            gradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
+            gradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
+            break;
+        case GradientDirection::RIGHT_BOTTOM:
+            gradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
+            gradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
+            break;
+        case GradientDirection::NONE:
+        case GradientDirection::START_TO_END:
+        case GradientDirection::END_TO_START:
+        default:
+            break;
+    }
+}
+
+// Parse the gradient center, percent values are converted from [0, 1] to [0, 100].
+void ParseJsGradientCenter(
+    const JSRef<JSObject>& jsObj, std::optional<Dimension>& centerX, std::optional<Dimension>& centerY)
+{
+    auto center = jsObj->GetProperty("center");
+    if (!center->IsArray()) {
+        return;
+    }
+    auto centerArray = JSRef<JSArray>::Cast(center);
+    if (centerArray->Length() != 2) {
+        return;
+    }
+    Dimension value;
+    if (JSViewAbstract::ParseJsDimensionVp(centerArray->GetValueAt(0), value)) {
+        centerX = value;
+        if (value.Unit() == DimensionUnit::PERCENT) {
+            centerX = Dimension(value.Value() * 100.0, DimensionUnit::PERCENT);
+        }
+    }
+    if (JSViewAbstract::ParseJsDimensionVp(centerArray->GetValueAt(1), value)) {
+        centerY = value;
+        if (value.Unit() == DimensionUnit::PERCENT) {
+            centerY = Dimension(value.Value() * 100.0, DimensionUnit::PERCENT);
         }
     }
-    return false;
 }
 
 void SetBgImgPosition(const DimensionUnit& typeX, const DimensionUnit& typeY, const double valueX, const double valueY,
@@ -637,12 +741,8 @@ void JSViewAbstract::JsScale(const JSCallbackInfo& info)
     }
 
     if (info[0]->IsObject()) {
-        auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-        if (!argsPtrItem || argsPtrItem->IsNull()) {
-            LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-            return;
-        }
-        if (argsPtrItem->Contains("x") || argsPtrItem->Contains("y") || argsPtrItem->Contains("z")) {
+        auto jsObj = JSRef<JSObject>::Cast(info[0]);
+        if (HasJsProperty(jsObj, "x") || HasJsProperty(jsObj, "y") || HasJsProperty(jsObj, "z")) {
             // default: x, y, z (1.0, 1.0, 1.0)
             auto scaleX = 1.0f;
             auto scaleY = 1.0f;
@@ -650,7 +750,7 @@ void JSViewAbstract::JsScale(const JSCallbackInfo& info)
             // default centerX, centerY 50% 50%;
             Dimension centerX = 0.5_pct;
             Dimension centerY = 0.5_pct;
-            ParseJsScale(argsPtrItem, scaleX, scaleY, scaleZ, centerX, centerY);
+            ParseJsScale(jsObj, scaleX, scaleY, scaleZ, centerX, centerY);
             ViewAbstractModel::GetInstance()->SetScale(scaleX, scaleY, scaleZ);
             ViewAbstractModel::GetInstance()->SetPivot(centerX, centerY);
             return;
@@ -725,17 +825,13 @@ void JSViewAbstract::JsTranslate(const JSCallbackInfo& info)
     Dimension value;
 
     if (info[0]->IsObject()) {
-        auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-        if (!argsPtrItem || argsPtrItem->IsNull()) {
-            LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-            return;
-        }
-        if (argsPtrItem->Contains("x") || argsPtrItem->Contains("y") || argsPtrItem->Contains("z")) {
+        auto jsObj = JSRef<JSObject>::Cast(info[0]);
+        if (HasJsProperty(jsObj, "x") || HasJsProperty(jsObj, "y") || HasJsProperty(jsObj, "z")) {
             // default: x, y, z (0.0, 0.0, 0.0)
             auto translateX = Dimension(0.0);
             auto translateY = Dimension(0.0);
             auto translateZ = Dimension(0.0);
-            ParseJsTranslate(argsPtrItem, translateX, translateY, translateZ);
+            ParseJsTranslate(jsObj, translateX, translateY, translateZ);
             ViewAbstractModel::GetInstance()->SetTranslate(translateX, translateY, translateZ);
             return;
         }
@@ -782,11 +878,7 @@ void JSViewAbstract::JsRotate(const JSCallbackInfo& info)
     }
 
     if (info[0]->IsObject()) {
-        auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-        if (!argsPtrItem || argsPtrItem->IsNull()) {
-            LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-            return;
-        }
+        auto jsObj = JSRef<JSObject>::Cast(info[0]);
         float dx = 0.0f;
         float dy = 0.0f;
         float dz = 0.0f;
@@ -794,7 +886,7 @@ void JSViewAbstract::JsRotate(const JSCallbackInfo& info)
         Dimension centerX = 0.5_pct;
         Dimension centerY = 0.5_pct;
         std::optional<float> angle;
-        ParseJsRotate(argsPtrItem, dx, dy, dz, centerX, centerY, angle);
+        ParseJsRotate(jsObj, dx, dy, dz, centerX, centerY, angle);
         if (angle) {
             ViewAbstractModel::GetInstance()->SetRotate(dx, dy, dz, angle.value());
             ViewAbstractModel::GetInstance()->SetPivot(centerX, centerY);
@@ -846,34 +938,35 @@ void JSViewAbstract::JsTransform(const JSCallbackInfo& info)
     if (!CheckJSCallbackInfo("JsTransform", info, checkList)) {
         return;
     }
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Js Parse object failed. argsPtr is null. %{public}s", info[0]->ToString().c_str());
-        return;
-    }
-    auto array = argsPtrItem->GetValue("matrix4x4");
+    auto jsObj = JSRef<JSObject>::Cast(info[0]);
+    auto matrixArgs = jsObj->GetProperty("matrix4x4");
     const auto matrix4Len = Matrix4::DIMENSION * Matrix4::DIMENSION;
-    if (!array || array->IsNull() || !array->IsArray() || array->GetArraySize() != matrix4Len) {
+    if (!matrixArgs->IsArray()) {
         LOGE("Js Parse object failed, matrix4x4 is null or not Array");
         return;
     }
+    auto array = JSRef<JSArray>::Cast(matrixArgs);
+    if (static_cast<int32_t>(array->Length()) != matrix4Len) {
+        LOGE("Js Parse object failed, matrix4x4 length is not %{public}d", matrix4Len);
+        return;
+    }
     std::vector<float> matrix(matrix4Len);
     for (int32_t i = 0; i < matrix4Len; i++) {
         double value = 0.0;
-        ParseJsonDouble(array->GetArrayItem(i), value);
+        ParseJsDouble(array->GetValueAt(i), value);
         matrix[i] = static_cast<float>(value);
     }
     ViewAbstractModel::GetInstance()->SetTransformMatrix(matrix);
 }
 
-NG::TransitionOptions JSViewAbstract::ParseTransition(std::unique_ptr<JsonValue>& transitionArgs)
+NG::TransitionOptions JSViewAbstract::ParseTransition(const JSRef<JSObject>& transitionArgs)
 {
     bool hasEffect = false;
     NG::TransitionOptions transitionOption;
-    transitionOption.Type = ParseTransitionType(transitionArgs->GetString("type", "All"));
-    if (transitionArgs->Contains("opacity")) {
+    transitionOption.Type = ParseTransitionType(GetJsStringProperty(transitionArgs, "type", "All"));
+    if (HasJsProperty(transitionArgs, "opacity")) {
         double opacity = 1.0;
-        ParseJsonDouble(transitionArgs->GetValue("opacity"), opacity);
+        ParseJsDouble(transitionArgs->GetProperty("opacity"), opacity);
         if (opacity > 1.0 || LessNotEqual(opacity, 0.0)) {
             LOGW("set opacity in transition to %{public}lf, over range, use default opacity 1", opacity);
             opacity = 1.0;
@@ -881,24 +974,24 @@ NG::TransitionOptions JSViewAbstract::ParseTransition(std::unique_ptr<JsonValue>
         transitionOption.UpdateOpacity(static_cast<float>(opacity));
         hasEffect = true;
     }
-    if (transitionArgs->Contains("translate")) {
-        auto translateArgs = transitionArgs->GetObject("translate");
+    if (HasJsProperty(transitionArgs, "translate")) {
+        auto translateArgs = GetJsObjectProperty(transitionArgs, "translate");
         // default: x, y, z (0.0, 0.0, 0.0)
         NG::TranslateOptions translate;
         ParseJsTranslate(translateArgs, translate.x, translate.y, translate.z);
         transitionOption.UpdateTranslate(translate);
         hasEffect = true;
     }
-    if (transitionArgs->Contains("scale")) {
-        auto scaleArgs = transitionArgs->GetObject("scale");
+    if (HasJsProperty(transitionArgs, "scale")) {
+        auto scaleArgs = GetJsObjectProperty(transitionArgs, "scale");
         // default: x, y, z (1.0, 1.0, 1.0), centerX, centerY 50% 50%;
         NG::ScaleOptions scale(1.0f, 1.0f, 1.0f, 0.5_pct, 0.5_pct);
         ParseJsScale(scaleArgs, scale.xScale, scale.yScale, scale.zScale, scale.centerX, scale.centerY);
         transitionOption.UpdateScale(scale);
         hasEffect = true;
     }
-    if (transitionArgs->Contains("rotate")) {
-        auto rotateArgs = transitionArgs->GetObject("rotate");
+    if (HasJsProperty(transitionArgs, "rotate")) {
+        auto rotateArgs = GetJsObjectProperty(transitionArgs, "rotate");
         // default: dx, dy, dz (0.0, 0.0, 0.0), angle 0, centerX, centerY 50% 50%;
         NG::RotateOptions rotate(0.0f, 0.0f, 0.0f, 0.0f, 0.5_pct, 0.5_pct);
         std::optional<float> angle;
@@ -933,8 +1026,7 @@ void JSViewAbstract::JsTransition(const JSCallbackInfo& info)
         LOGE("arg is not Object.");
         return;
     }
-    auto transitionArgs = JsonUtil::ParseJsonString(info[0]->ToString());
-    auto options = ParseTransition(transitionArgs);
+    auto options = ParseTransition(JSRef<JSObject>::Cast(info[0]));
     ViewAbstractModel::GetInstance()->SetTransition(options);
 }
 
@@ -1450,59 +1542,52 @@ void JSViewAbstract::JsSharedTransition(const JSCallbackInfo& info)
 
     // options
     if (info.Length() > 1 && info[1]->IsObject()) {
-        auto optionsArgs = JsonUtil::ParseJsonString(info[1]->ToString());
+        JSRef<JSObject> optionsArgs = JSRef<JSObject>::Cast(info[1]);
         sharedOption = std::make_shared<SharedTransitionOption>();
         // default: duration: 1000; if not specify: duration: 0
         int32_t duration = 0;
-        auto durationValue = optionsArgs->GetValue("duration");
-        if (durationValue && durationValue->IsNumber()) {
-            duration = durationValue->GetInt();
+        auto durationValue = optionsArgs->GetProperty("duration");
+        if (durationValue->IsNumber()) {
+            duration = durationValue->ToNumber<int32_t>();
             if (duration < 0) {
                 duration = DEFAULT_DURATION;
             }
         }
         sharedOption->duration = duration;
         // default: delay: 0
-        auto delay = optionsArgs->GetInt("delay", 0);
+        auto delay = GetJsIntProperty(optionsArgs, "delay", 0);
         if (delay < 0) {
             delay = 0;
         }
         sharedOption->delay = delay;
         // default: LinearCurve
         RefPtr<Curve> curve;
-        auto curveArgs = optionsArgs->GetValue("curve");
+        auto curveArgs = optionsArgs->GetProperty("curve");
         if (curveArgs->IsString()) {
-            curve = CreateCurve(optionsArgs->GetString("curve", "linear"));
+            curve = CreateCurve(curveArgs->ToString());
         } else if (curveArgs->IsObject()) {
-            auto curveString = curveArgs->GetValue("__curveString");
-            if (!curveString) {
+            auto curveString = JSRef<JSObject>::Cast(curveArgs)->GetProperty("__curveString");
+            if (!curveString->IsString()) {
                 return;
             }
-            curve = CreateCurve(curveString->GetString());
+            curve = CreateCurve(curveString->ToString());
         } else {
             curve = AceType::MakeRefPtr<LinearCurve>();
         }
         sharedOption->curve = curve;
         // motionPath
-        if (optionsArgs->Contains("motionPath")) {
+        auto motionPathArgs = optionsArgs->GetProperty("motionPath");
+        if (motionPathArgs->IsObject()) {
             MotionPathOption motionPathOption;
-            if (ParseMotionPath(optionsArgs->GetValue("motionPath"), motionPathOption)) {
+            if (ParseJsMotionPath(JSRef<JSObject>::Cast(motionPathArgs), motionPathOption)) {
                 sharedOption->motionPathOption = motionPathOption;
             }
         }
         // zIndex
-        int32_t zIndex = 0;
-        if (optionsArgs->Contains("zIndex")) {
-            zIndex = optionsArgs->GetInt("zIndex", 0);
-        }
-        sharedOption->zIndex = zIndex;
+        sharedOption->zIndex = GetJsIntProperty(optionsArgs, "zIndex", 0);
         // type
-        SharedTransitionEffectType type = SharedTransitionEffectType::SHARED_EFFECT_EXCHANGE;
-        if (optionsArgs->Contains("type")) {
-            type = static_cast<SharedTransitionEffectType>(
-                optionsArgs->GetInt("type", static_cast<int32_t>(SharedTransitionEffectType::SHARED_EFFECT_EXCHANGE)));
-        }
-        sharedOption->type = type;
+        sharedOption->type = static_cast<SharedTransitionEffectType>(GetJsIntProperty(
+            optionsArgs, "type", static_cast<int32_t>(SharedTransitionEffectType::SHARED_EFFECT_EXCHANGE)));
     }
     ViewAbstractModel::GetInstance()->SetSharedTransition(id, sharedOption);
 }
@@ -1619,15 +1704,11 @@ void JSViewAbstract::JsBackgroundImageSize(const JSCallbackInfo& info)
         bgImgSize.SetSizeTypeX(sizeType);
         bgImgSize.SetSizeTypeY(sizeType);
     } else {
-        auto imageArgs = JsonUtil::ParseJsonString(info[0]->ToString());
-        if (imageArgs->IsNull()) {
-            LOGE("Js Parse failed. imageArgs is null.");
-            return;
-        }
+        auto imageArgs = JSRef<JSObject>::Cast(info[0]);
         Dimension width;
         Dimension height;
-        ParseJsonDimensionVp(imageArgs->GetValue("width"), width);
-        ParseJsonDimensionVp(imageArgs->GetValue("height"), height);
+        ParseJsDimensionVp(imageArgs->GetProperty("width"), width);
+        ParseJsDimensionVp(imageArgs->GetProperty("height"), height);
         double valueWidth = width.ConvertToPx();
         double valueHeight = height.ConvertToPx();
         BackgroundImageSizeType typeWidth = BackgroundImageSizeType::LENGTH;
@@ -1694,15 +1775,11 @@ void JSViewAbstract::JsBackgroundImagePosition(const JSCallbackInfo& info)
                 break;
         }
     } else {
-        auto imageArgs = JsonUtil::ParseJsonString(info[0]->ToString());
-        if (imageArgs->IsNull()) {
-            LOGE("Js Parse failed. imageArgs is null.");
-            return;
-        }
+        auto imageArgs = JSRef<JSObject>::Cast(info[0]);
         Dimension x;
         Dimension y;
-        ParseJsonDimensionVp(imageArgs->GetValue("x"), x);
-        ParseJsonDimensionVp(imageArgs->GetValue("y"), y);
+        ParseJsDimensionVp(imageArgs->GetProperty("x"), x);
+        ParseJsDimensionVp(imageArgs->GetProperty("y"), y);
         double valueX = x.Value();
         double valueY = y.Value();
         DimensionUnit typeX = DimensionUnit::PX;
@@ -2001,61 +2078,25 @@ void JSViewAbstract::ParseBorderImageDimension(
 
 void JSViewAbstract::ParseBorderImageLinearGradient(const JSRef<JSVal>& args, uint8_t& bitset)
 {
-    auto argsPtrItem = JsonUtil::ParseJsonString(args->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Parse border image linear gradient failed. argsPtr is null. %{public}s", args->ToString().c_str());
+    if (!args->IsObject()) {
+        LOGE("Parse border image linear gradient failed. args is not object.");
         return;
     }
+    auto jsObj = JSRef<JSObject>::Cast(args);
     NG::Gradient lineGradient;
     lineGradient.CreateGradientWithType(NG::GradientType::LINEAR);
     // angle
     std::optional<float> degree;
-    GetAngle("angle", argsPtrItem, degree);
+    GetJsAngle("angle", jsObj, degree);
     if (degree) {
         lineGradient.GetLinearGradient()->angle = Dimension(degree.value(), DimensionUnit::PX);
         degree.reset();
     }
     // direction
-    auto direction = static_cast<NG::GradientDirection>(
-        argsPtrItem->GetInt("direction", static_cast<int32_t>(NG::GradientDirection::NONE)));
-    switch (direction) {
-        case NG::GradientDirection::LEFT:
-            lineGradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
-            break;
-        case NG::GradientDirection::RIGHT:
-            lineGradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
-            break;
-        case NG::GradientDirection::TOP:
-            lineGradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
-            break;
-        case NG::GradientDirection::BOTTOM:
-            lineGradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
-            break;
-        case NG::GradientDirection::LEFT_TOP:
-            lineGradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
-            lineGradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
-            break;
-        case NG::GradientDirection::LEFT_BOTTOM:
-            lineGradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
-            lineGradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
-            break;
-        case NG::GradientDirection::RIGHT_TOP:
-            lineGradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
-            lineGradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
-            break;
-        case NG::GradientDirection::RIGHT_BOTTOM:
-            lineGradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
-            lineGradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
-            break;
-        case NG::GradientDirection::NONE:
-        case NG::GradientDirection::START_TO_END:
-        case NG::GradientDirection::END_TO_START:
-        default:
-            break;
-    }
-    auto repeating = argsPtrItem->GetBool("repeating", false);
+    ParseJsLinearGradientDirection(jsObj, lineGradient);
+    auto repeating = GetJsBoolProperty(jsObj, "repeating", false);
     lineGradient.SetRepeat(repeating);
-    NewGetGradientColorStops(lineGradient, argsPtrItem->GetValue("colors"));
+    NewGetJsGradientColorStops(lineGradient, jsObj->GetProperty("colors"));
     ViewAbstractModel::GetInstance()->SetBorderImageGradient(lineGradient);
     bitset |= BorderImage::GRADIENT_BIT;
 }
@@ -2346,14 +2387,11 @@ void JSViewAbstract::JsWindowBlur(const JSCallbackInfo& info)
         return;
     }
 
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-        return;
-    }
+    auto jsObj = JSRef<JSObject>::Cast(info[0]);
     double progress = 0.0;
-    ParseJsonDouble(argsPtrItem->GetValue("percent"), progress);
-    auto style = argsPtrItem->GetInt("style", static_cast<int32_t>(WindowBlurStyle::STYLE_BACKGROUND_SMALL_LIGHT));
+    ParseJsDouble(jsObj->GetProperty("percent"), progress);
+    auto style =
+        GetJsIntProperty(jsObj, "style", static_cast<int32_t>(WindowBlurStyle::STYLE_BACKGROUND_SMALL_LIGHT));
 
     progress = std::clamp(progress, 0.0, 1.0);
     style = std::clamp(style, static_cast<int32_t>(WindowBlurStyle::STYLE_BACKGROUND_SMALL_LIGHT),
@@ -3003,16 +3041,11 @@ std::pair<Dimension, Dimension> JSViewAbstract::ParseSize(const JSCallbackInfo&
     if (!CheckJSCallbackInfo("ParseSize", info, checkList)) {
         return std::pair<Dimension, Dimension>();
     }
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-        info.SetReturnValue(info.This());
-        return std::pair<Dimension, Dimension>();
-    }
+    auto jsObj = JSRef<JSObject>::Cast(info[0]);
     Dimension width;
     Dimension height;
-    if (!ParseJsonDimensionVp(argsPtrItem->GetValue("width"), width) ||
-        !ParseJsonDimensionVp(argsPtrItem->GetValue("height"), height)) {
+    if (!ParseJsDimensionVp(jsObj->GetProperty("width"), width) ||
+        !ParseJsDimensionVp(jsObj->GetProperty("height"), height)) {
         return std::pair<Dimension, Dimension>();
     }
     LOGD("JsSize width = %lf unit = %d, height = %lf unit = %d", width.Value(), width.Unit(), height.Value(),
@@ -3384,12 +3417,6 @@ void JSViewAbstract::JsLinearGradient(const JSCallbackInfo& info)
         LOGE("arg is not a object.");
         return;
     }
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-        info.ReturnSelf();
-        return;
-    }
     NG::Gradient newGradient;
     NewJsLinearGradient(info, newGradient);
     ViewAbstractModel::GetInstance()->SetLinearGradient(newGradient);
@@ -3397,56 +3424,20 @@ void JSViewAbstract::JsLinearGradient(const JSCallbackInfo& info)
 
 void JSViewAbstract::NewJsLinearGradient(const JSCallbackInfo& info, NG::Gradient& newGradient)
 {
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
+    auto jsObj = JSRef<JSObject>::Cast(info[0]);
     newGradient.CreateGradientWithType(NG::GradientType::LINEAR);
     // angle
     std::optional<float> degree;
-    GetAngle("angle", argsPtrItem, degree);
+    GetJsAngle("angle", jsObj, degree);
     if (degree) {
         newGradient.GetLinearGradient()->angle = Dimension(degree.value(), DimensionUnit::PX);
         degree.reset();
     }
     // direction
-    auto direction =
-        static_cast<GradientDirection>(argsPtrItem->GetInt("direction", static_cast<int32_t>(GradientDirection::NONE)));
-    switch (direction) {
-        case GradientDirection::LEFT:
-            newGradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
-            break;
-        case GradientDirection::RIGHT:
-            newGradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
-            break;
-        case GradientDirection::TOP:
-            newGradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
-            break;
-        case GradientDirection::BOTTOM:
-            newGradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
-            break;
-        case GradientDirection::LEFT_TOP:
-            newGradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
-            newGradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
-            break;
-        case GradientDirection::LEFT_BOTTOM:
-            newGradient.GetLinearGradient()->linearX = NG::GradientDirection::LEFT;
-            newGradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
-            break;
-        case GradientDirection::RIGHT_TOP:
-            newGradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
-            newGradient.GetLinearGradient()->linearY = NG::GradientDirection::TOP;
-            break;
-        case GradientDirection::RIGHT_BOTTOM:
-            newGradient.GetLinearGradient()->linearX = NG::GradientDirection::RIGHT;
-            newGradient.GetLinearGradient()->linearY = NG::GradientDirection::BOTTOM;
-            break;
-        case GradientDirection::NONE:
-        case GradientDirection::START_TO_END:
-        case GradientDirection::END_TO_START:
-        default:
-            break;
-    }
-    auto repeating = argsPtrItem->GetBool("repeating", false);
+    ParseJsLinearGradientDirection(jsObj, newGradient);
+    auto repeating = GetJsBoolProperty(jsObj, "repeating", false);
     newGradient.SetRepeat(repeating);
-    NewGetGradientColorStops(newGradient, argsPtrItem->GetValue("colors"));
+    NewGetJsGradientColorStops(newGradient, jsObj->GetProperty("colors"));
 }
 
 void JSViewAbstract::JsRadialGradient(const JSCallbackInfo& info)
@@ -3456,12 +3447,6 @@ void JSViewAbstract::JsRadialGradient(const JSCallbackInfo& info)
         return;
     }
 
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-        info.ReturnSelf();
-        return;
-    }
     NG::Gradient newGradient;
     NewJsRadialGradient(info, newGradient);
     ViewAbstractModel::GetInstance()->SetRadialGradient(newGradient);
@@ -3469,40 +3454,22 @@ void JSViewAbstract::JsRadialGradient(const JSCallbackInfo& info)
 
 void JSViewAbstract::NewJsRadialGradient(const JSCallbackInfo& info, NG::Gradient& newGradient)
 {
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
+    auto jsObj = JSRef<JSObject>::Cast(info[0]);
     newGradient.CreateGradientWithType(NG::GradientType::RADIAL);
     // center
-    auto center = argsPtrItem->GetValue("center");
-    if (center && !center->IsNull() && center->IsArray() && center->GetArraySize() == 2) {
-        Dimension value;
-        if (ParseJsonDimensionVp(center->GetArrayItem(0), value)) {
-            newGradient.GetRadialGradient()->radialCenterX = Dimension(value);
-            if (value.Unit() == DimensionUnit::PERCENT) {
-                // [0,1] -> [0, 100]
-                newGradient.GetRadialGradient()->radialCenterX =
-                    Dimension(value.Value() * 100.0, DimensionUnit::PERCENT);
-            }
-        }
-        if (ParseJsonDimensionVp(center->GetArrayItem(1), value)) {
-            newGradient.GetRadialGradient()->radialCenterY = Dimension(value);
-            if (value.Unit() == DimensionUnit::PERCENT) {
-                // [0,1] -> [0, 100]
-                newGradient.GetRadialGradient()->radialCenterY =
-                    Dimension(value.Value() * 100.0, DimensionUnit::PERCENT);
-            }
-        }
-    }
+    ParseJsGradientCenter(jsObj, newGradient.GetRadialGradient()->radialCenterX,
+        newGradient.GetRadialGradient()->radialCenterY);
     // radius
     Dimension radius;
-    if (ParseJsonDimensionVp(argsPtrItem->GetValue("radius"), radius)) {
+    if (ParseJsDimensionVp(jsObj->GetProperty("radius"), radius)) {
         newGradient.GetRadialGradient()->radialVerticalSize = Dimension(radius);
         newGradient.GetRadialGradient()->radialHorizontalSize = Dimension(radius);
     }
     // repeating
-    auto repeating = argsPtrItem->GetBool("repeating", false);
+    auto repeating = GetJsBoolProperty(jsObj, "repeating", false);
     newGradient.SetRepeat(repeating);
     // color stops
-    NewGetGradientColorStops(newGradient, argsPtrItem->GetValue("colors"));
+    NewGetJsGradientColorStops(newGradient, jsObj->GetProperty("colors"));
 }
 
 void JSViewAbstract::JsSweepGradient(const JSCallbackInfo& info)
@@ -3512,13 +3479,6 @@ void JSViewAbstract::JsSweepGradient(const JSCallbackInfo& info)
         return;
     }
 
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-        info.ReturnSelf();
-        return;
-    }
-
     NG::Gradient newGradient;
     NewJsSweepGradient(info, newGradient);
     ViewAbstractModel::GetInstance()->SetSweepGradient(newGradient);
@@ -3526,51 +3486,35 @@ void JSViewAbstract::JsSweepGradient(const JSCallbackInfo& info)
 
 void JSViewAbstract::NewJsSweepGradient(const JSCallbackInfo& info, NG::Gradient& newGradient)
 {
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
+    auto jsObj = JSRef<JSObject>::Cast(info[0]);
     newGradient.CreateGradientWithType(NG::GradientType::SWEEP);
     // center
-    auto center = argsPtrItem->GetValue("center");
-    if (center && !center->IsNull() && center->IsArray() && center->GetArraySize() == 2) {
-        Dimension value;
-        if (ParseJsonDimensionVp(center->GetArrayItem(0), value)) {
-            newGradient.GetSweepGradient()->centerX = Dimension(value);
-            if (value.Unit() == DimensionUnit::PERCENT) {
-                // [0,1] -> [0, 100]
-                newGradient.GetSweepGradient()->centerX = Dimension(value.Value() * 100.0, DimensionUnit::PERCENT);
-            }
-        }
-        if (ParseJsonDimensionVp(center->GetArrayItem(1), value)) {
-            newGradient.GetSweepGradient()->centerY = Dimension(value);
-            if (value.Unit() == DimensionUnit::PERCENT) {
-                // [0,1] -> [0, 100]
-                newGradient.GetSweepGradient()->centerY = Dimension(value.Value() * 100.0, DimensionUnit::PERCENT);
-            }
-        }
-    }
+    ParseJsGradientCenter(
+        jsObj, newGradient.GetSweepGradient()->centerX, newGradient.GetSweepGradient()->centerY);
     std::optional<float> degree;
     // start
-    GetAngle("start", argsPtrItem, degree);
+    GetJsAngle("start", jsObj, degree);
     if (degree) {
         newGradient.GetSweepGradient()->startAngle = Dimension(degree.value(), DimensionUnit::PX);
         degree.reset();
     }
     // end
-    GetAngle("end", argsPtrItem, degree);
+    GetJsAngle("end", jsObj, degree);
     if (degree) {
         newGradient.GetSweepGradient()->endAngle = Dimension(degree.value(), DimensionUnit::PX);
         degree.reset();
     }
     // rotation
-    GetAngle("rotation", argsPtrItem, degree);
+    GetJsAngle("rotation", jsObj, degree);
     if (degree) {
         newGradient.GetSweepGradient()->rotation = Dimension(degree.value(), DimensionUnit::PX);
         degree.reset();
     }
     // repeating
-    auto repeating = argsPtrItem->GetBool("repeating", false);
+    auto repeating = GetJsBoolProperty(jsObj, "repeating", false);
     newGradient.SetRepeat(repeating);
     // color stops
-    NewGetGradientColorStops(newGradient, argsPtrItem->GetValue("colors"));
+    NewGetJsGradientColorStops(newGradient, jsObj->GetProperty("colors"));
 }
 
 void JSViewAbstract::JsMotionPath(const JSCallbackInfo& info)
@@ -3579,9 +3523,8 @@ void JSViewAbstract::JsMotionPath(const JSCallbackInfo& info)
     if (!CheckJSCallbackInfo("JsMotionPath", info, checkList)) {
         return;
     }
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
     MotionPathOption motionPathOption;
-    if (ParseMotionPath(argsPtrItem, motionPathOption)) {
+    if (ParseJsMotionPath(JSRef<JSObject>::Cast(info[0]), motionPathOption)) {
         ViewAbstractModel::GetInstance()->SetMotionPath(motionPathOption);
     } else {
         LOGE("parse motionPath failed. %{public}s", info[0]->ToString().c_str());
@@ -3594,29 +3537,24 @@ void JSViewAbstract::JsShadow(const JSCallbackInfo& info)
     if (!CheckJSCallbackInfo("JsShadow", info, checkList)) {
         return;
     }
-    auto argsPtrItem = JsonUtil::ParseJsonString(info[0]->ToString());
-    if (!argsPtrItem || argsPtrItem->IsNull()) {
-        LOGE("Js Parse object failed. argsPtr is null. %s", info[0]->ToString().c_str());
-        info.ReturnSelf();
-        return;
-    }
+    auto jsObj = JSRef<JSObject>::Cast(info[0]);
     double radius = 0.0;
-    ParseJsonDouble(argsPtrItem->GetValue("radius"), radius);
+    ParseJsDouble(jsObj->GetProperty("radius"), radius);
     if (LessNotEqual(radius, 0.0)) {
         radius = 0.0;
     }
     std::vector<Shadow> shadows(1);
     shadows.begin()->SetBlurRadius(radius);
     Dimension offsetX;
-    if (ParseJsonDimensionVp(argsPtrItem->GetValue("offsetX"), offsetX)) {
+    if (ParseJsDimensionVp(jsObj->GetProperty("offsetX"), offsetX)) {
         shadows.begin()->SetOffsetX(offsetX.Value());
     }
     Dimension offsetY;
-    if (ParseJsonDimensionVp(argsPtrItem->GetValue("offsetY"), offsetY)) {
+    if (ParseJsDimensionVp(jsObj->GetProperty("offsetY"), offsetY)) {
         shadows.begin()->SetOffsetY(offsetY.Value());
     }
     Color color;
-    if (ParseJsonColor(argsPtrItem->GetValue("color"), color)) {
+    if (ParseJsColor(jsObj->GetProperty("color"), color)) {
         shadows.begin()->SetColor(color);
     }
     ViewAbstractModel::GetInstance()->SetBackShadow(shadows);
@@ -3954,8 +3892,7 @@ void JSViewAbstract::JsTransitionPassThrough(const JSCallbackInfo& info)
         LOGE("arg is not Object.");
         return;
     }
-    auto transitionArgs = JsonUtil::ParseJsonString(info[0]->ToString());
-    auto options = ParseTransition(transitionArgs);
+    auto options = ParseTransition(JSRef<JSObject>::Cast(info[0]));
     ViewAbstractModel::GetInstance()->SetTransition(options, true);
 }
 
@@ -4414,19 +4351,6 @@ bool JSViewAbstract::ParseJsonColor(const std::unique_ptr<JsonValue>& jsonValue,
     return true;
 }
 
-void JSViewAbstract::GetAngle(
-    const std::string& key, const std::unique_ptr<JsonValue>& jsonValue, std::optional<float>& angle)
-{
-    auto value = jsonValue->GetValue(key);
-    if (value && value->IsString()) {
-        angle = static_cast<float>(StringUtils::StringToDegree(value->GetString()));
-    } else if (value && value->IsNumber()) {
-        angle = static_cast<float>(value->GetDouble());
-    } else {
-        LOGE("Invalid value type");
-    }
-}
-
 void JSViewAbstract::GetGradientColorStops(Gradient& gradient, const std::unique_ptr<JsonValue>& colorStops)
 {
     if (!colorStops || colorStops->IsNull() || !colorStops->IsArray()) {
@@ -4462,39 +4386,56 @@ void JSViewAbstract::GetGradientColorStops(Gradient& gradient, const std::unique
     }
 }
 
-void JSViewAbstract::NewGetGradientColorStops(NG::Gradient& gradient, const std::unique_ptr<JsonValue>& colorStops)
+void JSViewAbstract::GetJsAngle(const char* key, const JSRef<JSObject>& jsObj, std::optional<float>& angle)
 {
-    if (!colorStops || colorStops->IsNull() || !colorStops->IsArray()) {
+    auto value = jsObj->GetProperty(key);
+    if (value->IsString()) {
+        angle = static_cast<float>(StringUtils::StringToDegree(value->ToString()));
+    } else if (value->IsNumber()) {
+        angle = value->ToNumber<float>();
+    } else {
+        LOGE("Invalid value type");
+    }
+}
+
+void JSViewAbstract::NewGetJsGradientColorStops(NG::Gradient& gradient, const JSRef<JSVal>& colorStops)
+{
+    if (!colorStops->IsArray()) {
         return;
     }
 
-    for (int32_t i = 0; i < colorStops->GetArraySize(); i++) {
+    auto colorStopsArray = JSRef<JSArray>::Cast(colorStops);
+    size_t length = colorStopsArray->Length();
+    for (size_t i = 0; i < length; i++) {
         NG::GradientColor gradientColor;
-        auto item = colorStops->GetArrayItem(i);
-        if (item && !item->IsNull() && item->IsArray() && item->GetArraySize() >= 1) {
-            auto colorParams = item->GetArrayItem(0);
-            // color
-            Color color;
-            if (!ParseJsonColor(colorParams, color)) {
-                LOGE("parse colorParams failed");
-                continue;
-            }
-            gradientColor.SetColor(color);
-            gradientColor.SetHasValue(false);
-            // stop value
-            if (item->GetArraySize() <= 1) {
-                continue;
-            }
-            auto stopValue = item->GetArrayItem(1);
-            double value = 0.0;
-            if (ParseJsonDouble(stopValue, value)) {
-                value = std::clamp(value, 0.0, 1.0);
-                gradientColor.SetHasValue(true);
-                //  [0, 1] -> [0, 100.0];
-                gradientColor.SetDimension(Dimension(value * 100.0, DimensionUnit::PERCENT));
-            }
-            gradient.AddColor(gradientColor);
+        auto item = colorStopsArray->GetValueAt(i);
+        if (!item->IsArray()) {
+            continue;
+        }
+        auto subArray = JSRef<JSArray>::Cast(item);
+        if (subArray->Length() < 1) {
+            continue;
+        }
+        // color
+        Color color;
+        if (!ParseJsColor(subArray->GetValueAt(0), color)) {
+            LOGE("parse colorParams failed");
+            continue;
+        }
+        gradientColor.SetColor(color);
+        gradientColor.SetHasValue(false);
+        // stop value
+        if (subArray->Length() <= 1) {
+            continue;
+        }
+        double value = 0.0;
+        if (ParseJsDouble(subArray->GetValueAt(1), value)) {
+            value = std::clamp(value, 0.0, 1.0);
+            gradientColor.SetHasValue(true);
+            //  [0, 1] -> [0, 100.0];
+            gradientColor.SetDimension(Dimension(value * 100.0, DimensionUnit::PERCENT));
         }
+        gradient.AddColor(gradientColor);
     }
 }
 
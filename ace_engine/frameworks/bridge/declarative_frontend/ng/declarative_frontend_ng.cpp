@@ -234,6 +234,13 @@ void DeclarativeFrontendNG::TriggerGarbageCollection()
     }
 }
 
+void DeclarativeFrontendNG::NotifyIdleTime(int32_t idleTime)
+{
+    if (jsEngine_) {
+        jsEngine_->NotifyIdleTime(idleTime);
+    }
+}
+
 void DeclarativeFrontendNG::DumpHeapSnapshot(bool isPrivate)
 {
     if (jsEngine_) {
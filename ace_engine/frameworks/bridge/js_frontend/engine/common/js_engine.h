@@ -183,6 +183,9 @@ public:
 
     virtual void RunFullGarbageCollection() {}
 
+    // idleTime is in milliseconds
+    virtual void NotifyIdleTime(int32_t idleTime) {}
+
     virtual void DumpHeapSnapshot(bool isPrivate) {}
 
     virtual void ClearCache() {}
@@ -178,6 +178,13 @@ void ArkJSRuntime::RunFullGC()
     JSNApi::TriggerGC(vm_, JSNApi::TRIGGER_GC_TYPE::FULL_GC);
 }
 
+void ArkJSRuntime::NotifyIdleTime(int32_t idleTime)
+{
+    JSExecutionScope executionScope(vm_);
+    LocalScope scope(vm_);
+    DFXJSNApi::NotifyIdleTime(vm_, idleTime);
+}
+
 shared_ptr<JsValue> ArkJSRuntime::NewInt32(int32_t value)
 {
     LocalScope scope(vm_);
@@ -74,6 +74,7 @@ public:
     shared_ptr<JsValue> GetGlobal() override;
     void RunGC() override;
     void RunFullGC() override;
+    void NotifyIdleTime(int32_t idleTime) override;
 
     shared_ptr<JsValue> NewNumber(double d) override;
     shared_ptr<JsValue> NewInt32(int32_t value) override;
@@ -59,6 +59,8 @@ public:
     virtual shared_ptr<JsValue> GetGlobal() = 0;
     virtual void RunGC() = 0;
     virtual void RunFullGC() {}
+    // idleTime is in milliseconds
+    virtual void NotifyIdleTime(int32_t idleTime) {}
 
     virtual shared_ptr<JsValue> NewNumber(double d) = 0;
     virtual shared_ptr<JsValue> NewInt32(int32_t value) = 0;
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "base/json/json_util.h"
+#include "bridge/js_frontend/engine/jsi/ark_js_runtime.h"
+#include "bridge/js_frontend/engine/jsi/ark_js_value.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+constexpr int32_t PARSE_COUNT = 10000;
+constexpr int32_t DURATION = 500;
+constexpr int32_t DELAY = 100;
+constexpr int32_t Z_INDEX = 2;
+constexpr int32_t TRANSITION_TYPE = 1;
+constexpr double MOTION_PATH_TO = 0.8;
+const std::string CURVE = "ease-in-out";
+const std::string MOTION_PATH = "Mstart.x start.y L300 200 L300 500 Lend.x end.y";
+
+// The options object of sharedTransition, which JSViewAbstract reads attribute by attribute.
+struct SharedTransitionArgs {
+    int32_t duration = 0;
+    int32_t delay = 0;
+    std::string curve;
+    int32_t zIndex = 0;
+    int32_t type = 0;
+    std::string path;
+    double from = 0.0;
+    double to = 1.0;
+    bool rotatable = false;
+};
+
+std::shared_ptr<JsValue> CreateOptions(const std::shared_ptr<JsRuntime>& runtime)
+{
+    auto motionPath = runtime->NewObject();
+    motionPath->SetProperty(runtime, "path", runtime->NewString(MOTION_PATH));
+    motionPath->SetProperty(runtime, "from", runtime->NewNumber(0.0));
+    motionPath->SetProperty(runtime, "to", runtime->NewNumber(MOTION_PATH_TO));
+    motionPath->SetProperty(runtime, "rotatable", runtime->NewBoolean(true));
+    auto options = runtime->NewObject();
+    options->SetProperty(runtime, "duration", runtime->NewInt32(DURATION));
+    options->SetProperty(runtime, "delay", runtime->NewInt32(DELAY));
+    options->SetProperty(runtime, "curve", runtime->NewString(CURVE));
+    options->SetProperty(runtime, "zIndex", runtime->NewInt32(Z_INDEX));
+    options->SetProperty(runtime, "type", runtime->NewInt32(TRANSITION_TYPE));
+    options->SetProperty(runtime, "motionPath", motionPath);
+    return options;
+}
+
+// What the attributes used to do: stringify the object and parse the string again.
+SharedTransitionArgs ParseFromJson(const std::shared_ptr<JsRuntime>& runtime, const std::shared_ptr<JsValue>& options)
+{
+    SharedTransitionArgs args;
+    auto optionsArgs = JsonUtil::ParseJsonString(options->GetJsonString(runtime));
+    args.duration = optionsArgs->GetInt("duration", 0);
+    args.delay = optionsArgs->GetInt("delay", 0);
+    args.curve = optionsArgs->GetString("curve", "linear");
+    args.zIndex = optionsArgs->GetInt("zIndex", 0);
+    args.type = optionsArgs->GetInt("type", 0);
+    auto motionPath = optionsArgs->GetValue("motionPath");
+    if (motionPath && motionPath->IsObject()) {
+        args.path = motionPath->GetString("path", "");
+        args.from = motionPath->GetDouble("from", 0.0);
+        args.to = motionPath->GetDouble("to", 1.0);
+        args.rotatable = motionPath->GetBool("rotatable", false);
+    }
+    return args;
+}
+
+// What they do now: read the properties of the object.
+SharedTransitionArgs ParseFromObject(const std::shared_ptr<JsRuntime>& runtime, const std::shared_ptr<JsValue>& options)
+{
+    SharedTransitionArgs args;
+    auto getInt = [&runtime](const std::shared_ptr<JsValue>& object, const std::string& key, int32_t defaultValue) {
+        auto value = object->GetProperty(runtime, key);
+        return value->IsNumber(runtime) ? value->ToInt32(runtime) : defaultValue;
+    };
+    args.duration = getInt(options, "duration", 0);
+    args.delay = getInt(options, "delay", 0);
+    auto curve = options->GetProperty(runtime, "curve");
+    args.curve = curve->IsString(runtime) ? curve->ToString(runtime) : "linear";
+    args.zIndex = getInt(options, "zIndex", 0);
+    args.type = getInt(options, "type", 0);
+    auto motionPath = options->GetProperty(runtime, "motionPath");
+    if (motionPath->IsObject(runtime)) {
+        auto path = motionPath->GetProperty(runtime, "path");
+        args.path = path->IsString(runtime) ? path->ToString(runtime) : "";
+        auto from = motionPath->GetProperty(runtime, "from");
+        args.from = from->IsNumber(runtime) ? from->ToDouble(runtime) : 0.0;
+        auto to = motionPath->GetProperty(runtime, "to");
+        args.to = to->IsNumber(runtime) ? to->ToDouble(runtime) : 1.0;
+        auto rotatable = motionPath->GetProperty(runtime, "rotatable");
+        args.rotatable = rotatable->IsBoolean(runtime) ? rotatable->ToBoolean(runtime) : false;
+    }
+    return args;
+}
+
+template<typename Parse>
+int64_t MeasureParse(Parse&& parse)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int32_t i = 0; i < PARSE_COUNT; ++i) {
+        parse();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+} // namespace
+
+class JsAttributeParseTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        runtime_ = std::make_shared<ArkJSRuntime>();
+        runtime_->Initialize("", false, 0);
+    }
+    static void TearDownTestCase()
+    {
+        runtime_->Reset();
+        runtime_.reset();
+    }
+
+    static std::shared_ptr<ArkJSRuntime> runtime_;
+};
+
+std::shared_ptr<ArkJSRuntime> JsAttributeParseTest::runtime_;
+
+/**
+ * @tc.name: JsAttributeParseTest001
+ * @tc.desc: Test reading an options object directly gives the same values as the json round trip.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsAttributeParseTest, JsAttributeParseTest001, TestSize.Level1)
+{
+    ASSERT_NE(runtime_->GetEcmaVm(), nullptr);
+    auto options = CreateOptions(runtime_);
+    auto fromJson = ParseFromJson(runtime_, options);
+    auto fromObject = ParseFromObject(runtime_, options);
+
+    EXPECT_EQ(fromObject.duration, DURATION);
+    EXPECT_EQ(fromObject.delay, DELAY);
+    EXPECT_EQ(fromObject.curve, CURVE);
+    EXPECT_EQ(fromObject.zIndex, Z_INDEX);
+    EXPECT_EQ(fromObject.type, TRANSITION_TYPE);
+    EXPECT_EQ(fromObject.path, MOTION_PATH);
+    EXPECT_DOUBLE_EQ(fromObject.to, MOTION_PATH_TO);
+    EXPECT_TRUE(fromObject.rotatable);
+
+    EXPECT_EQ(fromJson.duration, fromObject.duration);
+    EXPECT_EQ(fromJson.delay, fromObject.delay);
+    EXPECT_EQ(fromJson.curve, fromObject.curve);
+    EXPECT_EQ(fromJson.zIndex, fromObject.zIndex);
+    EXPECT_EQ(fromJson.type, fromObject.type);
+    EXPECT_EQ(fromJson.path, fromObject.path);
+    EXPECT_DOUBLE_EQ(fromJson.from, fromObject.from);
+    EXPECT_DOUBLE_EQ(fromJson.to, fromObject.to);
+    EXPECT_EQ(fromJson.rotatable, fromObject.rotatable);
+}
+
+/**
+ * @tc.name: JsAttributeParseTest002
+ * @tc.desc: Compare the cost of the json round trip with reading the options object directly.
+ * @tc.type: PERF
+ */
+HWTEST_F(JsAttributeParseTest, JsAttributeParseTest002, TestSize.Level1)
+{
+    ASSERT_NE(runtime_->GetEcmaVm(), nullptr);
+    auto options = CreateOptions(runtime_);
+    auto jsonCost = MeasureParse([&options]() { ParseFromJson(runtime_, options); });
+    auto objectCost = MeasureParse([&options]() { ParseFromObject(runtime_, options); });
+    GTEST_LOG_(INFO) << "sharedTransition options parsed " << PARSE_COUNT << " times, json round trip: " << jsonCost
+                     << " us, object properties: " << objectCost << " us";
+    EXPECT_GT(jsonCost, 0);
+    EXPECT_GT(objectCost, 0);
+}
+} // namespace OHOS::Ace::Framework
@@ -122,6 +122,7 @@ void FontManager::RemoveVariationNode(const WeakPtr<RenderNode>& node)
 
 void FontManager::NotifyVariationNodes()
 {
+    ++fontGeneration_;
 #ifndef NG_BUILD
     for (const auto& node : variationNodes_) {
         auto refNode = node.Upgrade();
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_MANAGER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_MANAGER_H
 
+#include <atomic>
 #include <list>
 #include <set>
 #include <vector>
@@ -53,8 +54,15 @@ public:
     void RemoveVariationNode(const WeakPtr<RenderNode>& node);
     void NotifyVariationNodes();
 
+    // Changes whenever fonts of the process wide font collection change, text laid out before that is stale.
+    static uint32_t GetFontGeneration()
+    {
+        return fontGeneration_;
+    }
+
 protected:
     static float fontWeightScale_;
+    static inline std::atomic<uint32_t> fontGeneration_ { 0 };
 
 private:
     std::list<RefPtr<FontLoader>> fontLoaders_;
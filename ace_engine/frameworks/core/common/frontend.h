@@ -214,6 +214,9 @@ public:
 
     virtual void TriggerGarbageCollection() {}
 
+    // Give the js engine the rest of a frame, idleTime is in milliseconds.
+    virtual void NotifyIdleTime(int32_t idleTime) {}
+
     virtual void DumpHeapSnapshot(bool isPrivate) {}
 
     virtual void RebuildAllPages() {}
@@ -440,11 +440,11 @@ void FrameNode::SetOnAreaChangeCallback(OnAreaChangedFunc&& callback)
     eventHub_->SetOnAreaChanged(std::move(callback));
 }
 
-void FrameNode::TriggerOnAreaChangeCallback()
+void FrameNode::TriggerOnAreaChangeCallback(uint64_t geometryPassId)
 {
     if (eventHub_->HasOnAreaChanged() && lastFrameRect_ && lastParentOffsetToWindow_) {
         auto currFrameRect = geometryNode_->GetFrameRect();
-        auto currParentOffsetToWindow = GetOffsetRelativeToWindow() - currFrameRect.GetOffset();
+        auto currParentOffsetToWindow = GetWindowGeometry(geometryPassId).offset - currFrameRect.GetOffset();
         if (currFrameRect != *lastFrameRect_ || currParentOffsetToWindow != *lastParentOffsetToWindow_) {
             eventHub_->FireOnAreaChanged(
                 *lastFrameRect_, *lastParentOffsetToWindow_, currFrameRect, currParentOffsetToWindow);
@@ -455,27 +455,14 @@ void FrameNode::TriggerOnAreaChangeCallback()
     pattern_->OnAreaChangedInner();
 }
 
-void FrameNode::TriggerVisibleAreaChangeCallback(std::list<VisibleCallbackInfo>& callbackInfoList)
+void FrameNode::TriggerVisibleAreaChangeCallback(
+    std::list<VisibleCallbackInfo>& callbackInfoList, uint64_t geometryPassId)
 {
     auto context = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(context);
 
-    bool curFrameIsActive = true;
-    auto parent = GetParent();
-    while (parent) {
-        auto parentFrame = AceType::DynamicCast<FrameNode>(parent);
-        if (!parentFrame) {
-            parent = parent->GetParent();
-            continue;
-        }
-        if (!parentFrame->isActive_) {
-            curFrameIsActive = false;
-            break;
-        }
-        parent = parent->GetParent();
-    }
-
-    if (!context->GetOnShow() || !IsVisible() || !curFrameIsActive) {
+    const auto& geometry = GetWindowGeometry(geometryPassId);
+    if (!context->GetOnShow() || !IsVisible() || !geometry.ancestorsActive) {
         if (!NearEqual(lastVisibleRatio_, VISIBLE_RATIO_MIN)) {
             ProcessAllVisibleCallback(callbackInfoList, VISIBLE_RATIO_MIN);
             lastVisibleRatio_ = VISIBLE_RATIO_MIN;
@@ -484,30 +471,52 @@ void FrameNode::TriggerVisibleAreaChangeCallback(std::list<VisibleCallbackInfo>&
     }
 
     auto frameRect = renderContext_->GetPaintRectWithTransform();
-    frameRect.SetOffset(GetOffsetRelativeToWindow());
-    auto visibleRect = frameRect;
-    RectF parentRect;
-    auto parentUi = GetParent();
-    while (parentUi) {
-        auto parentFrame = AceType::DynamicCast<FrameNode>(parentUi);
-        if (!parentFrame) {
-            parentUi = parentUi->GetParent();
-            continue;
-        }
-        parentRect = parentFrame->GetRenderContext()->GetPaintRectWithTransform();
-        parentRect.SetOffset(parentFrame->GetOffsetRelativeToWindow());
-        visibleRect = visibleRect.Constrain(parentRect);
-        parentUi = parentUi->GetParent();
-    }
-
-    double currentVisibleRatio =
-        std::clamp(CalculateCurrentVisibleRatio(visibleRect, frameRect), VISIBLE_RATIO_MIN, VISIBLE_RATIO_MAX);
+    frameRect.SetOffset(geometry.offset);
+    double currentVisibleRatio = std::clamp(
+        CalculateCurrentVisibleRatio(geometry.visibleRect, frameRect), VISIBLE_RATIO_MIN, VISIBLE_RATIO_MAX);
     if (!NearEqual(currentVisibleRatio, lastVisibleRatio_)) {
         ProcessAllVisibleCallback(callbackInfoList, currentVisibleRatio);
         lastVisibleRatio_ = currentVisibleRatio;
     }
 }
 
+const FrameNode::WindowGeometry& FrameNode::GetWindowGeometry(uint64_t passId)
+{
+    if (passId != 0 && windowGeometry_.passId == passId) {
+        return windowGeometry_;
+    }
+    // Every node is derived from its nearest frame ancestor, so nodes registered under the same subtree share
+    // one climb per pass instead of climbing to the root twice each.
+    OffsetF offset = GetOffsetInAncestorFrame();
+    auto visibleRect = renderContext_->GetPaintRectWithTransform();
+    bool ancestorsActive = true;
+    auto parent = GetAncestorNodeOfFrame();
+    if (parent) {
+        const auto& parentGeometry = parent->GetWindowGeometry(passId);
+        offset += parentGeometry.offset;
+        visibleRect.SetOffset(offset);
+        visibleRect = visibleRect.Constrain(parentGeometry.visibleRect);
+        ancestorsActive = parent->isActive_ && parentGeometry.ancestorsActive;
+    } else {
+        visibleRect.SetOffset(offset);
+    }
+    windowGeometry_.passId = passId;
+    windowGeometry_.offset = offset;
+    windowGeometry_.visibleRect = visibleRect;
+    windowGeometry_.ancestorsActive = ancestorsActive;
+    return windowGeometry_;
+}
+
+OffsetF FrameNode::GetOffsetInAncestorFrame() const
+{
+    if (renderContext_ && renderContext_->GetPositionProperty() &&
+        renderContext_->GetPositionProperty()->HasPosition()) {
+        return OffsetF(static_cast<float>(renderContext_->GetPositionProperty()->GetPosition()->GetX().Value()),
+            static_cast<float>(renderContext_->GetPositionProperty()->GetPosition()->GetY().Value()));
+    }
+    return geometryNode_->GetFrameOffset();
+}
+
 double FrameNode::CalculateCurrentVisibleRatio(const RectF& visibleRect, const RectF& renderRect)
 {
     if (!visibleRect.IsValid() || !renderRect.IsValid()) {
@@ -592,7 +601,7 @@ std::optional<UITask> FrameNode::CreateLayoutTask(bool forceUseMainThread)
     UpdateLayoutPropertyFlag();
     layoutWrapper = CreateLayoutWrapper();
     CHECK_NULL_RETURN_NOLOG(layoutWrapper, std::nullopt);
-    auto task = [layoutWrapper, layoutConstraint = GetLayoutConstraint(), forceUseMainThread]() {
+    auto measureAndLayout = [layoutWrapper, layoutConstraint = GetLayoutConstraint()]() {
         layoutWrapper->SetActive();
         layoutWrapper->SetRootMeasureNode();
         {
@@ -603,21 +612,24 @@ std::optional<UITask> FrameNode::CreateLayoutTask(bool forceUseMainThread)
             ACE_SCOPED_TRACE("LayoutWrapper::Layout");
             layoutWrapper->Layout();
         }
-        {
-            ACE_SCOPED_TRACE("LayoutWrapper::MountToHostOnMainThread");
-            if (forceUseMainThread || layoutWrapper->CheckShouldRunOnMain()) {
-                layoutWrapper->MountToHostOnMainThread();
-                return;
-            }
-            auto host = layoutWrapper->GetHostNode();
-            CHECK_NULL_VOID(host);
-            host->PostTask([layoutWrapper]() { layoutWrapper->MountToHostOnMainThread(); });
-        }
+    };
+    auto mountToHost = [layoutWrapper]() {
+        ACE_SCOPED_TRACE("LayoutWrapper::MountToHostOnMainThread");
+        layoutWrapper->MountToHostOnMainThread();
     };
     if (forceUseMainThread || layoutWrapper->CheckShouldRunOnMain()) {
-        return UITask(std::move(task), MAIN_TASK);
+        return UITask(
+            [measureAndLayout = std::move(measureAndLayout), mountToHost = std::move(mountToHost)]() {
+                measureAndLayout();
+                mountToHost();
+            },
+            MAIN_TASK);
     }
-    return UITask(std::move(task), layoutWrapper->CanRunOnWhichThread());
+    // Measure and layout only touch the layout wrapper tree, the dirty layout wrapper is swapped to the host by the
+    // scheduler on main thread.
+    UITask task(std::move(measureAndLayout), layoutWrapper->CanRunOnWhichThread());
+    task.SetCommitTask(std::move(mountToHost));
+    return task;
 }
 
 std::optional<UITask> FrameNode::CreateRenderTask(bool forceUseMainThread)
@@ -797,6 +809,10 @@ void FrameNode::RebuildRenderContextTree()
     std::list<RefPtr<FrameNode>> children;
     GenerateOneDepthVisibleFrame(children);
     frameChildren_ = { children.begin(), children.end() };
+    hitTestChildren_.clear();
+    if (hitTestIndex_) {
+        hitTestIndex_->Invalidate();
+    }
     renderContext_->RebuildFrame(this, children);
     pattern_->OnRebuildFrame();
     needSyncRenderTree_ = false;
@@ -1044,19 +1060,15 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
     renderContext_->GetPointWithTransform(tmp);
     const auto localPoint = tmp;
     bool consumed = false;
-    for (auto iter = frameChildren_.rbegin(); iter != frameChildren_.rend(); ++iter) {
-        if (GetHitTestMode() == HitTestMode::HTMBLOCK) {
-            break;
-        }
-
-        const auto& child = *iter;
+    // returns true if the brothers after [child] are blocked.
+    auto childTouchTest = [&](const RefPtr<FrameNode>& child) {
         auto childHitResult = child->TouchTest(globalPoint, localPoint, touchRestrict, newComingTargets, touchId);
         if (childHitResult == HitTestResult::STOP_BUBBLING) {
             preventBubbling = true;
             consumed = true;
             if ((child->GetHitTestMode() == HitTestMode::HTMDEFAULT) ||
                 (child->GetHitTestMode() == HitTestMode::HTMTRANSPARENT_SELF)) {
-                break;
+                return true;
             }
         }
 
@@ -1065,7 +1077,25 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
             ((child->GetHitTestMode() == HitTestMode::HTMDEFAULT) ||
                 (child->GetHitTestMode() == HitTestMode::HTMTRANSPARENT_SELF))) {
             consumed = true;
-            break;
+            return true;
+        }
+        return false;
+    };
+    std::vector<RefPtr<FrameNode>> candidates;
+    if (GetHitTestMode() == HitTestMode::HTMBLOCK) {
+        LOGD("TouchTest: %{public}s blocks the hit test of its children", GetTag().c_str());
+    } else if (GetHitTestCandidates(localPoint, candidates)) {
+        // children outside of their bounds would return OUT_OF_REGION, they neither block nor consume.
+        for (const auto& child : candidates) {
+            if (childTouchTest(child)) {
+                break;
+            }
+        }
+    } else {
+        for (auto iter = frameChildren_.rbegin(); iter != frameChildren_.rend(); ++iter) {
+            if (childTouchTest(*iter)) {
+                break;
+            }
         }
     }
 
@@ -1159,6 +1189,49 @@ bool FrameNode::InResponseRegionList(const PointF& parentLocalPoint, const std::
     return false;
 }
 
+std::optional<RectF> FrameNode::GetHitTestBounds()
+{
+    if (pattern_->UsResRegion()) {
+        // children out of the response region can still be hit.
+        return std::nullopt;
+    }
+    auto paintRect = renderContext_->GetPaintRectWithTransform();
+    auto bounds = paintRect;
+    for (const auto& rect : GetResponseRegionList(paintRect)) {
+        bounds = bounds.CombineRectT(rect);
+    }
+    return bounds;
+}
+
+bool FrameNode::GetHitTestCandidates(const PointF& localPoint, std::vector<RefPtr<FrameNode>>& candidates)
+{
+    if (frameChildren_.size() < HitTestIndex::MIN_CHILD_COUNT) {
+        return false;
+    }
+    if (!hitTestIndex_) {
+        hitTestIndex_ = std::make_unique<HitTestIndex>();
+    }
+    if (!hitTestIndex_->IsValid()) {
+        if (!hitTestIndex_->IsGeometryStable()) {
+            return false;
+        }
+        hitTestChildren_.assign(frameChildren_.rbegin(), frameChildren_.rend());
+        std::vector<std::optional<RectF>> bounds;
+        bounds.reserve(hitTestChildren_.size());
+        for (const auto& child : hitTestChildren_) {
+            bounds.emplace_back(child->GetHitTestBounds());
+        }
+        hitTestIndex_->Build(std::move(bounds));
+    }
+    std::vector<int32_t> indexes;
+    hitTestIndex_->Query(localPoint, indexes);
+    candidates.reserve(indexes.size());
+    for (auto index : indexes) {
+        candidates.emplace_back(hitTestChildren_[index]);
+    }
+    return true;
+}
+
 HitTestResult FrameNode::MouseTest(const PointF& globalPoint, const PointF& parentLocalPoint,
     MouseTestResult& onMouseResult, MouseTestResult& onHoverResult, RefPtr<FrameNode>& hoverNode)
 {
@@ -1182,17 +1255,28 @@ HitTestResult FrameNode::AxisTest(
     bool preventBubbling = false;
 
     const auto localPoint = parentLocalPoint - rect.GetOffset();
-    const auto& children = GetChildren();
-    for (auto iter = children.rbegin(); iter != children.rend(); ++iter) {
-        auto& child = *iter;
+    // returns true if the brothers after [child] are blocked.
+    auto childAxisTest = [&](const RefPtr<FrameNode>& child) {
         auto childHitResult = child->AxisTest(globalPoint, localPoint, onAxisResult);
         if (childHitResult == HitTestResult::STOP_BUBBLING) {
             preventBubbling = true;
         }
         // In normal process, the node block the brother node.
-        if (childHitResult == HitTestResult::BUBBLING) {
-            // TODO: add hit test mode judge.
-            break;
+        // TODO: add hit test mode judge.
+        return childHitResult == HitTestResult::BUBBLING;
+    };
+    std::vector<RefPtr<FrameNode>> candidates;
+    if (GetHitTestCandidates(localPoint, candidates)) {
+        for (const auto& child : candidates) {
+            if (childAxisTest(child)) {
+                break;
+            }
+        }
+    } else {
+        for (auto iter = frameChildren_.rbegin(); iter != frameChildren_.rend(); ++iter) {
+            if (childAxisTest(*iter)) {
+                break;
+            }
         }
     }
 
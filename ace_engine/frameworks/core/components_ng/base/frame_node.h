@@ -30,6 +30,7 @@
 #include "base/utils/utils.h"
 #include "core/components/common/layout/constants.h"
 #include "core/components_ng/base/geometry_node.h"
+#include "core/components_ng/base/hit_test_index.h"
 #include "core/components_ng/base/ui_node.h"
 #include "core/components_ng/event/event_hub.h"
 #include "core/components_ng/event/focus_hub.h"
@@ -103,6 +104,17 @@ public:
 
     RefPtr<LayoutWrapper> CreateLayoutWrapper(bool forceMeasure = false, bool forceLayout = false) override;
 
+    // Window-space geometry of the node, memoized for one visible area or area change pass.
+    struct WindowGeometry {
+        uint64_t passId = 0;
+        OffsetF offset;
+        // paint rect in window space clipped by every frame ancestor
+        RectF visibleRect;
+        bool ancestorsActive = true;
+    };
+    const WindowGeometry& GetWindowGeometry(uint64_t passId);
+    OffsetF GetOffsetInAncestorFrame() const;
+
     std::optional<UITask> CreateLayoutTask(bool forceUseMainThread = false);
 
     std::optional<UITask> CreateRenderTask(bool forceUseMainThread = false);
@@ -110,9 +122,12 @@ public:
     void SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>& dirty);
 
     void SetOnAreaChangeCallback(OnAreaChangedFunc&& callback);
-    void TriggerOnAreaChangeCallback();
+    // geometryPassId identifies one pipeline pass over the registered nodes, window geometry of shared
+    // ancestors is computed once per pass. 0 disables the memo.
+    void TriggerOnAreaChangeCallback(uint64_t geometryPassId = 0);
 
-    void TriggerVisibleAreaChangeCallback(std::list<VisibleCallbackInfo>& callbackInfoList);
+    void TriggerVisibleAreaChangeCallback(
+        std::list<VisibleCallbackInfo>& callbackInfoList, uint64_t geometryPassId = 0);
 
     const RefPtr<GeometryNode>& GetGeometryNode() const
     {
@@ -342,6 +357,11 @@ private:
     bool GetTouchable() const;
     std::vector<RectF> GetResponseRegionList(const RectF& rect);
     bool InResponseRegionList(const PointF& parentLocalPoint, const std::vector<RectF>& responseRegionList) const;
+    // Bounds of the region this node can be hit in, in the local space of its parent. std::nullopt if it may be hit
+    // anywhere.
+    std::optional<RectF> GetHitTestBounds();
+    // Frame children which may be hit at [localPoint] in hit test order, false if they have to be tested one by one.
+    bool GetHitTestCandidates(const PointF& localPoint, std::vector<RefPtr<FrameNode>>& candidates);
 
     void ProcessAllVisibleCallback(std::list<VisibleCallbackInfo>& callbackInfoList, double currentVisibleRatio);
     void OnVisibleAreaChangeCallback(
@@ -359,6 +379,9 @@ private:
     };
     // sort in ZIndex.
     std::multiset<RefPtr<FrameNode>, ZIndexComparator> frameChildren_;
+    // frameChildren_ in hit test order and the index over their bounds, only built for nodes with many children.
+    std::vector<RefPtr<FrameNode>> hitTestChildren_;
+    std::unique_ptr<HitTestIndex> hitTestIndex_;
     RefPtr<GeometryNode> geometryNode_ = MakeRefPtr<GeometryNode>();
 
     std::list<std::function<void()>> destroyCallbacks_;
@@ -384,6 +407,7 @@ private:
     bool isResponseRegion_ = false;
 
     double lastVisibleRatio_ = 0.0;
+    WindowGeometry windowGeometry_;
 
     // internal node such as Text in Button CreateWithLabel
     // should not seen by preview inspector or accessibility
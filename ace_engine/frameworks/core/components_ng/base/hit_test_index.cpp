@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/base/hit_test_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t MAX_GRID_SIZE = 64;
+// IsInRegion tolerates a small error, the buckets are a bit larger than the bounds so they never miss such a point.
+constexpr float BOUNDS_MARGIN = 1.0f;
+
+bool IsFinite(const RectF& rect)
+{
+    return std::isfinite(rect.GetX()) && std::isfinite(rect.GetY()) && std::isfinite(rect.Width()) &&
+           std::isfinite(rect.Height());
+}
+} // namespace
+
+bool HitTestIndex::IsGeometryStable()
+{
+    uint32_t generation = geometryGeneration_;
+    if (generation == lastGeneration_) {
+        return true;
+    }
+    lastGeneration_ = generation;
+    return false;
+}
+
+void HitTestIndex::Build(std::vector<std::optional<RectF>>&& bounds)
+{
+    bounds_ = std::move(bounds);
+    cells_.clear();
+    unboundedChildren_.clear();
+    columns_ = 0;
+    rows_ = 0;
+    builtGeneration_ = geometryGeneration_;
+    lastGeneration_ = builtGeneration_;
+    isBuilt_ = true;
+
+    int32_t boundedCount = 0;
+    for (int32_t i = 0; i < static_cast<int32_t>(bounds_.size()); ++i) {
+        auto& rect = bounds_[i];
+        if (!rect || !IsFinite(*rect)) {
+            rect.reset();
+            unboundedChildren_.emplace_back(i);
+            continue;
+        }
+        extent_ = boundedCount == 0 ? *rect : extent_.CombineRectT(*rect);
+        ++boundedCount;
+    }
+    if (boundedCount == 0) {
+        return;
+    }
+    extent_ = RectF(extent_.GetX() - BOUNDS_MARGIN, extent_.GetY() - BOUNDS_MARGIN,
+        extent_.Width() + BOUNDS_MARGIN * 2, extent_.Height() + BOUNDS_MARGIN * 2);
+    auto gridSize = std::clamp(static_cast<int32_t>(std::ceil(std::sqrt(boundedCount))), 1, MAX_GRID_SIZE);
+    columns_ = gridSize;
+    rows_ = gridSize;
+    cellWidth_ = extent_.Width() / static_cast<float>(columns_);
+    cellHeight_ = extent_.Height() / static_cast<float>(rows_);
+    cells_.resize(columns_ * rows_);
+    for (int32_t i = 0; i < static_cast<int32_t>(bounds_.size()); ++i) {
+        const auto& rect = bounds_[i];
+        if (!rect) {
+            continue;
+        }
+        int32_t startColumn = 0;
+        int32_t startRow = 0;
+        int32_t endColumn = 0;
+        int32_t endRow = 0;
+        GetCell(PointF(rect->Left() - BOUNDS_MARGIN, rect->Top() - BOUNDS_MARGIN), startColumn, startRow);
+        GetCell(PointF(rect->Right() + BOUNDS_MARGIN, rect->Bottom() + BOUNDS_MARGIN), endColumn, endRow);
+        for (auto row = startRow; row <= endRow; ++row) {
+            for (auto column = startColumn; column <= endColumn; ++column) {
+                cells_[row * columns_ + column].emplace_back(i);
+            }
+        }
+    }
+}
+
+bool HitTestIndex::GetCell(const PointF& point, int32_t& column, int32_t& row) const
+{
+    if (columns_ == 0 || rows_ == 0) {
+        return false;
+    }
+    bool inExtent = extent_.IsInRegion(point);
+    column = NearZero(cellWidth_) ? 0 : static_cast<int32_t>((point.GetX() - extent_.GetX()) / cellWidth_);
+    row = NearZero(cellHeight_) ? 0 : static_cast<int32_t>((point.GetY() - extent_.GetY()) / cellHeight_);
+    column = std::clamp(column, 0, columns_ - 1);
+    row = std::clamp(row, 0, rows_ - 1);
+    return inExtent;
+}
+
+void HitTestIndex::Query(const PointF& point, std::vector<int32_t>& candidates) const
+{
+    int32_t column = 0;
+    int32_t row = 0;
+    if (!GetCell(point, column, row)) {
+        candidates.insert(candidates.end(), unboundedChildren_.begin(), unboundedChildren_.end());
+        return;
+    }
+    std::vector<int32_t> hits;
+    for (auto index : cells_[row * columns_ + column]) {
+        if (bounds_[index]->IsInRegion(point)) {
+            hits.emplace_back(index);
+        }
+    }
+    std::merge(hits.begin(), hits.end(), unboundedChildren_.begin(), unboundedChildren_.end(),
+        std::back_inserter(candidates));
+}
+} // namespace OHOS::Ace::NG
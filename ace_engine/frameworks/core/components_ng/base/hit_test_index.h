@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_HIT_TEST_INDEX_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_HIT_TEST_INDEX_H
+
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "base/geometry/ng/point_t.h"
+#include "base/geometry/ng/rect_t.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::NG {
+// Grid buckets over the hit test bounds of the frame children of one node, in the local space of that node. A query
+// returns the children whose bounds may contain a point, children outside of them can not be hit and are skipped.
+// The bounds are only trusted while no paint rect, transform or response region has changed since they were taken.
+class HitTestIndex final : public NonCopyable {
+public:
+    // Nodes with fewer frame children are tested one by one, building the buckets would not pay off.
+    static constexpr size_t MIN_CHILD_COUNT = 32;
+
+    HitTestIndex() = default;
+    ~HitTestIndex() = default;
+
+    // Called whenever the geometry of any node changes, every index built before becomes stale.
+    static void MarkGeometryChanged()
+    {
+        ++geometryGeneration_;
+    }
+
+    bool IsValid() const
+    {
+        return isBuilt_ && builtGeneration_ == geometryGeneration_;
+    }
+
+    // The buckets are rebuilt only once the geometry stays the same between two hit tests, while something animates
+    // they would be stale on every test anyway.
+    bool IsGeometryStable();
+
+    // Forget the bounds, the children have changed.
+    void Invalidate()
+    {
+        isBuilt_ = false;
+    }
+
+    // [bounds] are in hit test order, std::nullopt for children which may be hit anywhere.
+    void Build(std::vector<std::optional<RectF>>&& bounds);
+    // Appends the indexes of the children whose bounds may contain [point] in ascending order.
+    void Query(const PointF& point, std::vector<int32_t>& candidates) const;
+
+private:
+    static inline std::atomic<uint32_t> geometryGeneration_ { 0 };
+
+    bool GetCell(const PointF& point, int32_t& column, int32_t& row) const;
+
+    std::vector<std::optional<RectF>> bounds_;
+    std::vector<std::vector<int32_t>> cells_;
+    std::vector<int32_t> unboundedChildren_;
+    RectF extent_;
+    int32_t columns_ = 0;
+    int32_t rows_ = 0;
+    float cellWidth_ = 0.0f;
+    float cellHeight_ = 0.0f;
+    uint32_t builtGeneration_ = 0;
+    uint32_t lastGeneration_ = 0;
+    bool isBuilt_ = false;
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_HIT_TEST_INDEX_H
@@ -22,6 +22,7 @@
 #include "base/geometry/ng/point_t.h"
 #include "base/memory/referenced.h"
 #include "core/components/common/layout/constants.h"
+#include "core/components_ng/base/hit_test_index.h"
 #include "core/components_ng/event/click_event.h"
 #include "core/components_ng/event/drag_event.h"
 #include "core/components_ng/event/long_press_event.h"
@@ -293,6 +294,7 @@ public:
     void SetResponseRegion(const std::vector<DimensionRect>& responseRegion)
     {
         responseRegion_ = responseRegion;
+        HitTestIndex::MarkGeometryChanged();
         if (!responseRegion_.empty()) {
             isResponseRegion_ = true;
         }
@@ -302,6 +304,7 @@ public:
     {
         responseRegion_.emplace_back(responseRect);
         isResponseRegion_ = true;
+        HitTestIndex::MarkGeometryChanged();
     }
 
     void RemoveLastResponseRect()
@@ -311,6 +314,7 @@ public:
             return;
         }
         responseRegion_.pop_back();
+        HitTestIndex::MarkGeometryChanged();
         if (responseRegion_.empty()) {
             isResponseRegion_ = false;
         }
@@ -133,6 +133,14 @@ public:
         return skipLayout_;
     }
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        if (!layoutAlgorithm_) {
+            return BACKGROUND_TASK;
+        }
+        return layoutAlgorithm_->CanRunOnWhichThread();
+    }
+
     const RefPtr<LayoutAlgorithm>& GetLayoutAlgorithm() const
     {
         return layoutAlgorithm_;
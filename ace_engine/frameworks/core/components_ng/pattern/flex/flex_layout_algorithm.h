@@ -65,6 +65,13 @@ public:
         isLinearLayoutFeature_ = true;
     }
 
+    // Flex layout only reads the layout wrapper tree, so it can be executed on background thread when parallel
+    // layout is enabled.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return BACKGROUND_TASK;
+    }
+
 private:
     void InitFlexProperties(LayoutWrapper* layoutWrapper);
     void TravelChildrenFlexProps(LayoutWrapper* layoutWrapper, const SizeF& realSize);
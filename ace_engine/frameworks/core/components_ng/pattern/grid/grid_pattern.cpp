@@ -15,6 +15,8 @@
 
 #include "core/components_ng/pattern/grid/grid_pattern.h"
 
+#include <limits>
+
 #include "base/geometry/axis.h"
 #include "base/utils/utils.h"
 #include "core/components_ng/pattern/grid/grid_adaptive/grid_adaptive_layout_algorithm.h"
@@ -359,6 +361,7 @@ bool GridPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dirty, c
     gridLayoutInfo_ = gridLayoutInfo;
     gridLayoutInfo_.childrenCount_ = dirty->GetTotalChildCount();
 
+    UpdateSizeIndex();
     UpdateScrollBarOffset();
     return false;
 }
@@ -763,31 +766,64 @@ void GridPattern::UpdateScrollBarOffset()
     const auto& info = gridLayoutInfo_;
     auto viewScopeSize = geometryNode->GetPaddingSize();
     auto layoutProperty = host->GetLayoutProperty<GridLayoutProperty>();
+    if (sizeIndex_->GetMeasuredCount() == 0) {
+        return;
+    }
 
-    float heightSum = 0;
-    int32_t itemCount = 0;
     auto mainGap = GridUtils::GetMainGap(layoutProperty, viewScopeSize, info.axis_);
-    for (const auto& item : info.lineHeightMap_) {
-        auto line = info.gridMatrix_.find(item.first);
-        if (line != info.gridMatrix_.end()) {
-            itemCount += static_cast<int32_t>(line->second.size());
-        } else {
-            itemCount += info.crossCount_;
-        }
-        heightSum += item.second + mainGap;
-    }
+    float estimatedHeight = sizeIndex_->GetTotalSize() - mainGap;
+    float offset = sizeIndex_->GetOffset(info.startIndex_) - info.currentOffset_;
+    Size mainSize = { viewScopeSize.Width(), viewScopeSize.Height() };
+    UpdateScrollBarRegion(offset, estimatedHeight, mainSize);
+}
 
-    float estimatedHeight = 0.f;
-    auto averageHeight_ = heightSum / itemCount;
-    if (itemCount >= (info.childrenCount_ - 1)) {
-        estimatedHeight = heightSum - mainGap;
+void GridPattern::UpdateSizeIndex()
+{
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    auto geometryNode = host->GetGeometryNode();
+    CHECK_NULL_VOID(geometryNode);
+    auto layoutProperty = host->GetLayoutProperty<GridLayoutProperty>();
+    CHECK_NULL_VOID(layoutProperty);
+    const auto& info = gridLayoutInfo_;
+    if (info.crossCount_ != sizeIndexCrossCount_) {
+        sizeIndex_->Reset(info.childrenCount_);
+        sizeIndexCrossCount_ = info.crossCount_;
     } else {
-        estimatedHeight = heightSum + (info.childrenCount_ - itemCount) * averageHeight_;
+        sizeIndex_->Resize(info.childrenCount_);
+    }
+
+    // the extent of a line goes to the first item starting in it, lines only holding items which span from the
+    // lines before are added to the previous line.
+    auto mainGap = GridUtils::GetMainGap(layoutProperty, geometryNode->GetPaddingSize(), info.axis_);
+    int32_t lastIndex = -1;
+    int32_t lineItemIndex = -1;
+    float lineSize = 0.0f;
+    for (const auto& line : info.gridMatrix_) {
+        auto lineHeight = info.lineHeightMap_.find(line.first);
+        if (lineHeight == info.lineHeightMap_.end()) {
+            break;
+        }
+        auto firstIndex = std::numeric_limits<int32_t>::max();
+        auto endIndex = lastIndex;
+        for (const auto& item : line.second) {
+            if (item.second > lastIndex) {
+                firstIndex = std::min(firstIndex, item.second);
+                endIndex = std::max(endIndex, item.second);
+            }
+        }
+        if (firstIndex != std::numeric_limits<int32_t>::max()) {
+            sizeIndex_->Update(lineItemIndex, lineSize);
+            for (auto index = firstIndex + 1; index <= endIndex; ++index) {
+                sizeIndex_->Update(index, 0.0f);
+            }
+            lineItemIndex = firstIndex;
+            lineSize = 0.0f;
+            lastIndex = endIndex;
+        }
+        lineSize += lineHeight->second + mainGap;
     }
-
-    float offset = info.startIndex_ * averageHeight_ - info.currentOffset_;
-    Size mainSize = { viewScopeSize.Width(), viewScopeSize.Height() };
-    UpdateScrollBarRegion(offset, estimatedHeight, mainSize);
+    sizeIndex_->Update(lineItemIndex, lineSize);
 }
 
 RefPtr<PaintProperty> GridPattern::CreatePaintProperty()
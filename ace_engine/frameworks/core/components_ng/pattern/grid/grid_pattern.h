@@ -27,6 +27,7 @@
 #include "core/components_ng/pattern/grid/grid_position_controller.h"
 #include "core/components_ng/pattern/pattern.h"
 #include "core/components_ng/pattern/scroll_bar/proxy/scroll_bar_proxy.h"
+#include "core/components_ng/pattern/scrollable/item_size_index.h"
 #include "core/components_ng/pattern/scrollable/scrollable_pattern.h"
 
 namespace OHOS::Ace::NG {
@@ -119,6 +120,11 @@ public:
         gridLayoutInfo_ = GridLayoutInfo();
     }
 
+    const RefPtr<ItemSizeIndex>& GetSizeIndex() const
+    {
+        return sizeIndex_;
+    }
+
     void ToJsonValue(std::unique_ptr<JsonValue>& json) const override;
 
     void OnMouseSelectAll();
@@ -170,8 +176,12 @@ private:
     RectF ComputeSelectedZone(const OffsetF& startOffset, const OffsetF& endOffset);
     void MultiSelectWithoutKeyboard(const RectF& selectedZone);
     void UpdateScrollBarOffset() override;
+    void UpdateSizeIndex();
 
     GridLayoutInfo gridLayoutInfo_;
+    // main size of every line laid out so far, kept on the first item of the line.
+    RefPtr<ItemSizeIndex> sizeIndex_ = MakeRefPtr<ItemSizeIndex>();
+    int32_t sizeIndexCrossCount_ = 0;
     RefPtr<GridPositionController> positionController_;
     RefPtr<Animator> animator_;
     float animatorOffset_ = 0.0f;
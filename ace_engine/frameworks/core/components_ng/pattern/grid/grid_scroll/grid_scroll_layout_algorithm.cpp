@@ -628,14 +628,20 @@ void GridScrollLayoutAlgorithm::SkipForwardLines(float mainSize, LayoutWrapper*
         CHECK_NULL_VOID(grid);
         auto pattern = grid->GetPattern<GridPattern>();
         CHECK_NULL_VOID(pattern);
-        auto estimatedHeight = pattern->GetScrollableDistance();
-        // no scroller
-        if (LessOrEqual(estimatedHeight, 0)) {
-            return;
+        const auto& sizeIndex = pattern->GetSizeIndex();
+        if (sizeIndex && sizeIndex->GetMeasuredCount() > 0) {
+            auto offset = sizeIndex->GetOffset(gridLayoutInfo_.startIndex_) - gridLayoutInfo_.currentOffset_;
+            gridLayoutInfo_.startIndex_ = sizeIndex->GetIndex(offset);
+        } else {
+            auto estimatedHeight = pattern->GetScrollableDistance();
+            // no scroller
+            if (LessOrEqual(estimatedHeight, 0)) {
+                return;
+            }
+            auto averageHeight = estimatedHeight / gridLayoutInfo_.childrenCount_;
+            int32_t estimatedIndex = (gridLayoutInfo_.currentOffset_) / averageHeight;
+            gridLayoutInfo_.startIndex_ = std::max(gridLayoutInfo_.startIndex_ - estimatedIndex, 0);
         }
-        auto averageHeight = estimatedHeight / gridLayoutInfo_.childrenCount_;
-        int32_t estimatedIndex = (gridLayoutInfo_.currentOffset_) / averageHeight;
-        gridLayoutInfo_.startIndex_ = std::max(gridLayoutInfo_.startIndex_ - estimatedIndex, 0);
         gridLayoutInfo_.currentOffset_ = gridLayoutInfo_.prevOffset_;
         LOGI("estimatedIndex:%{public}d", gridLayoutInfo_.startIndex_);
         grid->ChildrenUpdatedFrom(0);
@@ -673,15 +679,21 @@ void GridScrollLayoutAlgorithm::SkipBackwardLines(float mainSize, LayoutWrapper*
         CHECK_NULL_VOID(grid);
         auto pattern = grid->GetPattern<GridPattern>();
         CHECK_NULL_VOID(pattern);
-        auto estimatedHeight = pattern->GetScrollableDistance();
-        // no scroller
-        if (LessOrEqual(estimatedHeight, 0)) {
-            return;
+        const auto& sizeIndex = pattern->GetSizeIndex();
+        if (sizeIndex && sizeIndex->GetMeasuredCount() > 0) {
+            auto offset = sizeIndex->GetOffset(gridLayoutInfo_.startIndex_) - gridLayoutInfo_.currentOffset_;
+            gridLayoutInfo_.startIndex_ = sizeIndex->GetIndex(offset);
+        } else {
+            auto estimatedHeight = pattern->GetScrollableDistance();
+            // no scroller
+            if (LessOrEqual(estimatedHeight, 0)) {
+                return;
+            }
+            auto averageHeight = estimatedHeight / gridLayoutInfo_.childrenCount_;
+            int32_t estimatedIndex = (gridLayoutInfo_.currentOffset_) / averageHeight;
+            gridLayoutInfo_.startIndex_ = std::min(
+                gridLayoutInfo_.startIndex_ - estimatedIndex, gridLayoutInfo_.childrenCount_);
         }
-        auto averageHeight = estimatedHeight / gridLayoutInfo_.childrenCount_;
-        int32_t estimatedIndex = (gridLayoutInfo_.currentOffset_) / averageHeight;
-        gridLayoutInfo_.startIndex_ = std::min(
-            gridLayoutInfo_.startIndex_ - estimatedIndex, gridLayoutInfo_.childrenCount_);
         gridLayoutInfo_.currentOffset_ = gridLayoutInfo_.prevOffset_;
         LOGI("estimatedIndex:%{public}d, currentOffset_:%{public}f", gridLayoutInfo_.startIndex_,
             gridLayoutInfo_.currentOffset_);
@@ -52,6 +52,12 @@ public:
         curLayoutProp->UpdateContainerInfo(gridContainerLayoutProperty->GetContainerInfoValue());
         LinearLayoutAlgorithm::Measure(layoutWrapper);
     }
+
+    // The container info is written back to the host node during measure.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return MAIN_TASK;
+    }
 };
 } // namespace OHOS::Ace::NG
 
@@ -166,6 +166,10 @@ void ListLayoutAlgorithm::CalculateEstimateOffset()
         estimateOffset_ = 0;
         return;
     }
+    if (sizeIndex_ && sizeIndex_->GetMeasuredCount() > 0) {
+        estimateOffset_ = sizeIndex_->GetOffset(itemPosition_.begin()->first);
+        return;
+    }
     float itemsHeight = (itemPosition_.rbegin()->second.endPos - itemPosition_.begin()->second.startPos) + spaceWidth_;
     auto lines = static_cast<int32_t>(itemPosition_.size());
     if (GetLanes() > 1) {
@@ -207,7 +211,7 @@ void ListLayoutAlgorithm::MeasureList(
             jumpIndex_.value(), currentOffset_, startMainPos_, endMainPos_);
         if (scrollIndexAlignment_ == ScrollIndexAlignment::ALIGN_TOP) {
             jumpIndex_ = GetLanesFloor(layoutWrapper, jumpIndex_.value());
-            LayoutForward(layoutWrapper, layoutConstraint, axis, jumpIndex_.value(), startMainPos_);
+            LayoutForward(layoutWrapper, layoutConstraint, axis, jumpIndex_.value(), startMainPos_ - jumpOffset_);
             if (jumpIndex_.value() > 0 && GreatNotEqual(GetStartPosition(), startMainPos_)) {
                 LayoutBackward(layoutWrapper, layoutConstraint, axis, jumpIndex_.value() - 1, GetStartPosition());
             }
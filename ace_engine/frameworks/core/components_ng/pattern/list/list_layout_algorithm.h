@@ -24,6 +24,7 @@
 #include "core/components_ng/layout/layout_algorithm.h"
 #include "core/components_ng/layout/layout_wrapper.h"
 #include "core/components_ng/pattern/list/list_layout_property.h"
+#include "core/components_ng/pattern/scrollable/item_size_index.h"
 #include "core/components_v2/list/list_component.h"
 #include "core/components_v2/list/list_properties.h"
 
@@ -85,6 +86,17 @@ public:
         scrollIndexAlignment_ = align;
     }
 
+    // distance the jump target is scrolled past the top of the list, only used with ALIGN_TOP.
+    void SetJumpOffset(float jumpOffset)
+    {
+        jumpOffset_ = jumpOffset;
+    }
+
+    void SetSizeIndex(const RefPtr<ItemSizeIndex>& sizeIndex)
+    {
+        sizeIndex_ = sizeIndex;
+    }
+
     void SetCurrentDelta(float offset)
     {
         currentDelta_ = offset;
@@ -234,7 +246,9 @@ private:
     void OnSurfaceChanged(LayoutWrapper* layoutWrapper);
 
     std::optional<int32_t> jumpIndex_;
+    float jumpOffset_ = 0.0f;
     ScrollIndexAlignment scrollIndexAlignment_ = ScrollIndexAlignment::ALIGN_TOP;
+    RefPtr<ItemSizeIndex> sizeIndex_;
 
     PositionMap itemPosition_;
     float currentOffset_ = 0.0f;
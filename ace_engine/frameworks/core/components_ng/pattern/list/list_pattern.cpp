@@ -94,6 +94,7 @@ bool ListPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dirty, c
         }
         isJump = true;
         jumpIndex_.reset();
+        jumpOffset_ = 0.0f;
     }
     auto finalOffset = listLayoutAlgorithm->GetCurrentOffset();
     spaceWidth_ = listLayoutAlgorithm->GetSpaceWidth();
@@ -111,6 +112,7 @@ bool ListPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dirty, c
         lanesLayoutAlgorithm->SwapLanesItemRange(lanesItemRange_);
         lanes_ = lanesLayoutAlgorithm->GetLanes();
     }
+    UpdateSizeIndex();
     CheckScrollable();
 
     bool indexChanged =
@@ -225,7 +227,9 @@ RefPtr<LayoutAlgorithm> ListPattern::CreateLayoutAlgorithm()
     if (jumpIndex_) {
         listLayoutAlgorithm->SetIndex(jumpIndex_.value());
         listLayoutAlgorithm->SetIndexAlignment(scrollIndexAlignment_);
+        listLayoutAlgorithm->SetJumpOffset(jumpOffset_);
     }
+    listLayoutAlgorithm->SetSizeIndex(sizeIndex_);
     listLayoutAlgorithm->SetCurrentDelta(currentDelta_);
     listLayoutAlgorithm->SetItemsPosition(itemPosition_);
     listLayoutAlgorithm->SetPrevContentMainSize(contentMainSize_);
@@ -608,6 +612,18 @@ void ListPattern::ScrollTo(float position)
 {
     LOGI("ScrollTo:%{public}f", position);
     StopAnimate();
+    // a far jump starts the layout from the item at [position] instead of laying out every item in between.
+    if (GreatNotEqual(std::abs(GetTotalOffset() - position), contentMainSize_) && sizeIndex_->GetMeasuredCount() > 0) {
+        position = std::max(position, 0.0f);
+        auto index = sizeIndex_->GetIndex(position);
+        jumpIndex_ = index;
+        jumpOffset_ = position - sizeIndex_->GetOffset(index);
+        scrollIndexAlignment_ = ScrollIndexAlignment::ALIGN_TOP;
+        currentDelta_ = 0.0f;
+        SetScrollState(SCROLL_FROM_JUMP);
+        MarkDirtyNodeSelf();
+        return;
+    }
     UpdateCurrentOffset(GetTotalOffset() - position, SCROLL_FROM_JUMP);
 }
 
@@ -617,6 +633,7 @@ void ListPattern::ScrollToIndex(int32_t index, ScrollIndexAlignment align)
     StopAnimate();
     if (index >= 0 || index == ListLayoutAlgorithm::LAST_ITEM) {
         jumpIndex_ = index;
+        jumpOffset_ = 0.0f;
         scrollIndexAlignment_ = align;
         MarkDirtyNodeSelf();
     }
@@ -665,14 +682,36 @@ void ListPattern::UpdateScrollBarOffset()
     }
     SizeF ContentSize = GetContentSize();
     Size size(ContentSize.Width(), ContentSize.Height());
-    float itemsSize = itemPosition_.rbegin()->second.endPos - itemPosition_.begin()->second.startPos + spaceWidth_;
-    float currentOffset = itemsSize / itemPosition_.size() * itemPosition_.begin()->first - startMainPos_;
-    Offset scrollOffset = { currentOffset, currentOffset }; // fit for w/h switched.
-    auto estimatedHeight = itemsSize / itemPosition_.size() * (maxListItemIndex_ + 1);
+    float currentOffset = sizeIndex_->GetOffset(itemPosition_.begin()->first) - startMainPos_;
+    auto estimatedHeight = sizeIndex_->GetTotalSize();
 
     UpdateScrollBarRegion(currentOffset, estimatedHeight, size);
 }
 
+void ListPattern::UpdateSizeIndex()
+{
+    auto crossSize = GetContentSize().CrossSize(GetAxis());
+    if (lanes_ != sizeIndexLanes_ || !NearEqual(crossSize, sizeIndexCrossSize_)) {
+        sizeIndex_->Reset(maxListItemIndex_ + 1);
+        sizeIndexLanes_ = lanes_;
+        sizeIndexCrossSize_ = crossSize;
+    } else {
+        sizeIndex_->Resize(maxListItemIndex_ + 1);
+    }
+    // items in one line share the start position, the extent of the line is kept on the first of them.
+    for (auto iter = itemPosition_.begin(); iter != itemPosition_.end();) {
+        auto lineIndex = iter->first;
+        auto lineStart = iter->second.startPos;
+        auto lineEnd = iter->second.endPos;
+        for (++iter; iter != itemPosition_.end() && NearEqual(iter->second.startPos, lineStart); ++iter) {
+            lineEnd = std::max(lineEnd, iter->second.endPos);
+            sizeIndex_->Update(iter->first, 0.0f);
+        }
+        auto nextLineStart = iter != itemPosition_.end() ? iter->second.startPos : lineEnd + spaceWidth_;
+        sizeIndex_->Update(lineIndex, nextLineStart - lineStart);
+    }
+}
+
 void ListPattern::SetChainAnimation(bool enable)
 {
     if (!enable) {
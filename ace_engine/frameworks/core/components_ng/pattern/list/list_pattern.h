@@ -214,6 +214,7 @@ private:
     void FireOnScrollStart();
     void CheckRestartSpring();
     void StopAnimate();
+    void UpdateSizeIndex();
 
     // multiSelectable
     void InitMouseEvent();
@@ -239,10 +240,15 @@ private:
     float currentDelta_ = 0.0f;
 
     std::optional<int32_t> jumpIndex_;
+    float jumpOffset_ = 0.0f;
     ScrollIndexAlignment scrollIndexAlignment_ = ScrollIndexAlignment::ALIGN_TOP;
     bool scrollable_ = true;
 
     ListLayoutAlgorithm::PositionMap itemPosition_;
+    // main size of every item laid out so far, for jumps and the scroll bar.
+    RefPtr<ItemSizeIndex> sizeIndex_ = MakeRefPtr<ItemSizeIndex>();
+    int32_t sizeIndexLanes_ = 1;
+    float sizeIndexCrossSize_ = 0.0f;
     bool scrollStop_ = false;
     bool scrollAbort_ = false;
     int32_t scrollState_ = SCROLL_FROM_NONE;
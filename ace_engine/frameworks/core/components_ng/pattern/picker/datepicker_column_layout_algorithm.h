@@ -37,6 +37,12 @@ public:
     void ChangeTextStyle(uint32_t index, uint32_t showOptionCount, const SizeF& size,
         const RefPtr<LayoutWrapper>& childLayoutWrapper, LayoutWrapper* layoutWrapper);
 
+    // The picker theme comes from the current pipeline context, which is not set on the background layout thread.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return MAIN_TASK;
+    }
+
     double GetCurrentOffset() const
     {
         return currentOffset_;
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/scrollable/item_size_index.h"
+
+#include <algorithm>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+inline int32_t LowBit(int32_t value)
+{
+    return value & (-value);
+}
+} // namespace
+
+void ItemSizeIndex::Reset(int32_t count)
+{
+    sizes_.assign(std::max(count, 0), -1.0f);
+    Rebuild();
+}
+
+void ItemSizeIndex::Resize(int32_t count)
+{
+    count = std::max(count, 0);
+    if (count == GetCount()) {
+        return;
+    }
+    sizes_.resize(count, -1.0f);
+    Rebuild();
+}
+
+void ItemSizeIndex::Rebuild()
+{
+    auto count = GetCount();
+    sizeTree_.assign(count + 1, 0.0);
+    countTree_.assign(count + 1, 0);
+    measuredSize_ = 0.0;
+    measuredCount_ = 0;
+    for (int32_t i = 1; i <= count; ++i) {
+        auto size = sizes_[i - 1];
+        if (!Negative(size)) {
+            sizeTree_[i] += size;
+            countTree_[i] += 1;
+            measuredSize_ += size;
+            ++measuredCount_;
+        }
+        auto parent = i + LowBit(i);
+        if (parent <= count) {
+            sizeTree_[parent] += sizeTree_[i];
+            countTree_[parent] += countTree_[i];
+        }
+    }
+}
+
+void ItemSizeIndex::Update(int32_t index, float size)
+{
+    if (index < 0 || index >= GetCount()) {
+        return;
+    }
+    size = std::max(size, 0.0f);
+    auto oldSize = sizes_[index];
+    bool measured = !Negative(oldSize);
+    if (measured && NearEqual(oldSize, size)) {
+        return;
+    }
+    double sizeDelta = measured ? size - oldSize : size;
+    int32_t countDelta = measured ? 0 : 1;
+    sizes_[index] = size;
+    measuredSize_ += sizeDelta;
+    measuredCount_ += countDelta;
+    for (auto i = index + 1; i <= GetCount(); i += LowBit(i)) {
+        sizeTree_[i] += sizeDelta;
+        countTree_[i] += countDelta;
+    }
+}
+
+bool ItemSizeIndex::IsMeasured(int32_t index) const
+{
+    return index >= 0 && index < GetCount() && !Negative(sizes_[index]);
+}
+
+float ItemSizeIndex::GetAverageSize() const
+{
+    return measuredCount_ > 0 ? static_cast<float>(measuredSize_ / measuredCount_) : 0.0f;
+}
+
+float ItemSizeIndex::GetOffset(int32_t index) const
+{
+    index = std::clamp(index, 0, GetCount());
+    double size = 0.0;
+    int32_t measured = 0;
+    for (auto i = index; i > 0; i -= LowBit(i)) {
+        size += sizeTree_[i];
+        measured += countTree_[i];
+    }
+    return static_cast<float>(size + static_cast<double>(index - measured) * GetAverageSize());
+}
+
+float ItemSizeIndex::GetTotalSize() const
+{
+    return static_cast<float>(measuredSize_ + static_cast<double>(GetCount() - measuredCount_) * GetAverageSize());
+}
+
+int32_t ItemSizeIndex::GetIndex(float offset) const
+{
+    auto count = GetCount();
+    if (count == 0 || NonPositive(offset)) {
+        return 0;
+    }
+    double average = GetAverageSize();
+    double remain = offset;
+    int32_t step = 1;
+    while (step * 2 <= count) {
+        step *= 2;
+    }
+    // descend the trees, [pos] ends up as the number of items which end before or at [offset].
+    int32_t pos = 0;
+    for (; step > 0; step /= 2) {
+        auto next = pos + step;
+        if (next > count) {
+            continue;
+        }
+        double size = sizeTree_[next] + static_cast<double>(step - countTree_[next]) * average;
+        if (size <= remain) {
+            pos = next;
+            remain -= size;
+        }
+    }
+    return std::min(pos, count - 1);
+}
+} // namespace OHOS::Ace::NG
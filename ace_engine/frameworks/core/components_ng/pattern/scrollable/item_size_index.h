@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_SCROLLABLE_ITEM_SIZE_INDEX_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_SCROLLABLE_ITEM_SIZE_INDEX_H
+
+#include <cstdint>
+#include <vector>
+
+#include "base/memory/ace_type.h"
+
+namespace OHOS::Ace::NG {
+// Remembers the main axis extent of every item a scrollable container has ever measured, in two fenwick trees
+// (sizes and measured flags), so that the offset of an item and the item at an offset are answered in O(log n).
+// Items which have never been measured are estimated with the average size of the measured ones.
+class ItemSizeIndex : public AceType {
+    DECLARE_ACE_TYPE(ItemSizeIndex, AceType);
+
+public:
+    ItemSizeIndex() = default;
+    ~ItemSizeIndex() override = default;
+
+    // Forget every recorded size.
+    void Reset(int32_t count);
+    // Change the item count, sizes of the remaining items are kept.
+    void Resize(int32_t count);
+    // Record the extent of item [index], including the space after it.
+    void Update(int32_t index, float size);
+
+    bool IsMeasured(int32_t index) const;
+    // Estimated distance from the start of item 0 to the start of item [index].
+    float GetOffset(int32_t index) const;
+    float GetTotalSize() const;
+    // Index of the item the [offset] falls in, clamped to the valid range.
+    int32_t GetIndex(float offset) const;
+    float GetAverageSize() const;
+
+    int32_t GetCount() const
+    {
+        return static_cast<int32_t>(sizes_.size());
+    }
+
+    int32_t GetMeasuredCount() const
+    {
+        return measuredCount_;
+    }
+
+private:
+    void Rebuild();
+
+    // size of each item, negative when the item has never been measured.
+    std::vector<float> sizes_;
+    // 1-based fenwick trees over measured sizes and measured flags.
+    std::vector<double> sizeTree_;
+    std::vector<int32_t> countTree_;
+    double measuredSize_ = 0.0;
+    int32_t measuredCount_ = 0;
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_SCROLLABLE_ITEM_SIZE_INDEX_H
@@ -27,6 +27,7 @@
 #include "core/components_ng/render/drawing.h"
 #include "core/components_ng/render/drawing_prop_convertor.h"
 #include "core/components_ng/render/paragraph.h"
+#include "core/components_ng/render/paragraph_cache.h"
 #include "core/pipeline/pipeline_context.h"
 
 namespace OHOS::Ace::NG {
@@ -131,10 +132,7 @@ void SpanItem::UpdateParagraph(const RefPtr<Paragraph>& builder)
         TextStyle textStyle = CreateTextStyleUsingTheme(fontStyle, nullptr, pipelineContext->GetTheme<TextTheme>());
         builder->PushStyle(textStyle);
     }
-    auto displayText = content;
-    auto textCase = fontStyle ? fontStyle->GetTextCase().value_or(TextCase::NORMAL) : TextCase::NORMAL;
-    StringUtils::TransformStrCase(displayText, static_cast<int32_t>(textCase));
-    builder->AddText(StringUtils::Str8ToStr16(displayText));
+    builder->AddText(StringUtils::Str8ToStr16(GetDisplayText()));
     for (const auto& child : children) {
         if (child) {
             child->UpdateParagraph(builder);
@@ -144,4 +142,30 @@ void SpanItem::UpdateParagraph(const RefPtr<Paragraph>& builder)
         builder->PopStyle();
     }
 }
+
+void SpanItem::UpdateParagraphCacheKey(ParagraphCacheKey& key) const
+{
+    if (fontStyle) {
+        auto pipelineContext = PipelineContext::GetCurrentContext();
+        CHECK_NULL_VOID(pipelineContext);
+        key.PushStyle(CreateTextStyleUsingTheme(fontStyle, nullptr, pipelineContext->GetTheme<TextTheme>()));
+    }
+    key.AddText(StringUtils::Str8ToStr16(GetDisplayText()));
+    for (const auto& child : children) {
+        if (child) {
+            child->UpdateParagraphCacheKey(key);
+        }
+    }
+    if (fontStyle) {
+        key.PopStyle();
+    }
+}
+
+std::string SpanItem::GetDisplayText() const
+{
+    auto displayText = content;
+    auto textCase = fontStyle ? fontStyle->GetTextCase().value_or(TextCase::NORMAL) : TextCase::NORMAL;
+    StringUtils::TransformStrCase(displayText, static_cast<int32_t>(textCase));
+    return displayText;
+}
 } // namespace OHOS::Ace::NG
@@ -65,6 +65,7 @@ public:                                                                      \
 namespace OHOS::Ace::NG {
 
 class Paragraph;
+class ParagraphCacheKey;
 
 struct SpanItem : public Referenced {
     int32_t positon;
@@ -74,6 +75,9 @@ struct SpanItem : public Referenced {
     std::list<RefPtr<SpanItem>> children;
 
     void UpdateParagraph(const RefPtr<Paragraph>& builder);
+    // Records the same styles and texts UpdateParagraph feeds to the builder.
+    void UpdateParagraphCacheKey(ParagraphCacheKey& key) const;
+    std::string GetDisplayText() const;
 
     void ToJsonValue(std::unique_ptr<JsonValue>& json) const;
 };
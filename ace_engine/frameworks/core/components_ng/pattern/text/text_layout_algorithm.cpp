@@ -25,6 +25,7 @@
 #include "core/components_ng/pattern/text/text_layout_property.h"
 #include "core/components_ng/render/drawing_prop_convertor.h"
 #include "core/components_ng/render/font_collection.h"
+#include "core/components_ng/render/paragraph_cache.h"
 #include "core/pipeline_ng/pipeline_context.h"
 
 namespace OHOS::Ace::NG {
@@ -47,6 +48,23 @@ float GetContentOffsetY(LayoutWrapper* layoutWrapper)
     }
     return offsetY;
 }
+
+bool IsSameAdaptSearch(const AdaptFontSizeCache& lhs, const AdaptFontSizeCache& rhs)
+{
+    return lhs.content == rhs.content && lhs.textStyle == rhs.textStyle &&
+           lhs.contentConstraint == rhs.contentConstraint && NearEqual(lhs.maxFontSize, rhs.maxFontSize) &&
+           NearEqual(lhs.minFontSize, rhs.minFontSize) && NearEqual(lhs.stepSize, rhs.stepSize);
+}
+
+ParagraphStyle CreateParagraphStyle(const TextStyle& textStyle, TextDirection direction)
+{
+    return { .direction = direction,
+        .align = textStyle.GetTextAlign(),
+        .maxLines = textStyle.GetMaxLines(),
+        .fontLocale = Localization::GetInstance()->GetFontLocale(),
+        .wordBreak = textStyle.GetWordBreak(),
+        .textOverflow = textStyle.GetTextOverflow() };
+}
 } // namespace
 
 TextLayoutAlgorithm::TextLayoutAlgorithm() = default;
@@ -69,21 +87,30 @@ std::optional<SizeF> TextLayoutAlgorithm::MeasureContent(
 
     TextStyle textStyle = CreateTextStyleUsingTheme(
         textLayoutProperty->GetFontStyle(), textLayoutProperty->GetTextLineStyle(), pipeline->GetTheme<TextTheme>());
-    if (!textStyle.GetAdaptTextSize()) {
-        if (!CreateParagraphAndLayout(textStyle, textLayoutProperty->GetContent().value_or(""), contentConstraint)) {
-            return std::nullopt;
+    auto content = textLayoutProperty->GetContent().value_or("");
+    auto cacheKey = CreateParagraphCacheKey(textStyle, content, contentConstraint, pipeline);
+    paragraph_ = ParagraphCache::GetInstance().GetParagraph(cacheKey);
+    if (!paragraph_) {
+        if (!textStyle.GetAdaptTextSize()) {
+            if (!CreateParagraphAndLayout(textStyle, content, contentConstraint)) {
+                return std::nullopt;
+            }
+        } else {
+            if (!AdaptMinTextSize(textStyle, content, contentConstraint, pipeline)) {
+                return std::nullopt;
+            }
         }
-    } else {
-        if (!AdaptMinTextSize(textStyle, textLayoutProperty->GetContent().value_or(""), contentConstraint, pipeline)) {
-            return std::nullopt;
+        if (!contentConstraint.selfIdealSize.Width()) {
+            float paragraphNewWidth = std::min(GetTextWidth(), paragraph_->GetMaxWidth());
+            paragraphNewWidth =
+                std::clamp(paragraphNewWidth, contentConstraint.minSize.Width(), contentConstraint.maxSize.Width());
+            if (!NearEqual(paragraphNewWidth, paragraph_->GetMaxWidth())) {
+                paragraph_->Layout(std::ceil(paragraphNewWidth));
+            }
         }
-    }
-    if (!contentConstraint.selfIdealSize.Width()) {
-        float paragraphNewWidth = std::min(GetTextWidth(), paragraph_->GetMaxWidth());
-        paragraphNewWidth =
-            std::clamp(paragraphNewWidth, contentConstraint.minSize.Width(), contentConstraint.maxSize.Width());
-        if (!NearEqual(paragraphNewWidth, paragraph_->GetMaxWidth())) {
-            paragraph_->Layout(std::ceil(paragraphNewWidth));
+        // only a built paragraph is shareable, it is never laid out again once it is in the cache.
+        if (paragraph_->IsValid()) {
+            ParagraphCache::GetInstance().PutParagraph(cacheKey, paragraph_);
         }
     }
 
@@ -114,31 +141,65 @@ void TextLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
 
 bool TextLayoutAlgorithm::CreateParagraph(const TextStyle& textStyle, std::string content)
 {
-    ParagraphStyle paraStyle = { .direction = GetTextDirection(content),
-        .align = textStyle.GetTextAlign(),
-        .maxLines = textStyle.GetMaxLines(),
-        .fontLocale = Localization::GetInstance()->GetFontLocale(),
-        .wordBreak = textStyle.GetWordBreak(),
-        .textOverflow = textStyle.GetTextOverflow() };
-    paragraph_ = Paragraph::Create(paraStyle, FontCollection::Current());
+    auto direction = GetTextDirection(content);
+    if (!spanItemChildren_.empty()) {
+        return CreateParagraph(textStyle, direction, u"");
+    }
+    StringUtils::TransformStrCase(content, static_cast<int32_t>(textStyle.GetTextCase()));
+    return CreateParagraph(textStyle, direction, StringUtils::Str8ToStr16(content));
+}
+
+bool TextLayoutAlgorithm::CreateParagraph(
+    const TextStyle& textStyle, TextDirection direction, const std::u16string& text)
+{
+    paragraph_ = Paragraph::Create(CreateParagraphStyle(textStyle, direction), FontCollection::Current());
     CHECK_NULL_RETURN(paragraph_, false);
     paragraph_->PushStyle(textStyle);
 
+    if (spanItemChildren_.empty()) {
+        paragraph_->AddText(text);
+    } else {
+        for (const auto& child : spanItemChildren_) {
+            if (child) {
+                child->UpdateParagraph(paragraph_);
+            }
+        }
+    }
+    paragraph_->Build();
+    return true;
+}
+
+ParagraphCacheKey TextLayoutAlgorithm::CreateParagraphCacheKey(const TextStyle& textStyle, std::string content,
+    const LayoutConstraintF& contentConstraint, const RefPtr<PipelineContext>& pipeline)
+{
+    ParagraphCacheKey key(ParagraphCacheType::TEXT, CreateParagraphStyle(textStyle, GetTextDirection(content)));
+    key.AddScale(pipeline->GetDipScale());
+    key.AddScale(pipeline->GetFontScale());
+    key.AddScale(pipeline->GetLogicScale());
+    key.PushStyle(textStyle);
     if (spanItemChildren_.empty()) {
         StringUtils::TransformStrCase(content, static_cast<int32_t>(textStyle.GetTextCase()));
-        paragraph_->AddText(StringUtils::Str8ToStr16(content));
+        key.AddText(StringUtils::Str8ToStr16(content));
     } else {
         int32_t spanTextLength = 0;
         for (const auto& child : spanItemChildren_) {
             if (child) {
-                child->UpdateParagraph(paragraph_);
+                child->UpdateParagraphCacheKey(key);
                 child->positon = spanTextLength + StringUtils::ToWstring(child->content).length();
                 spanTextLength += StringUtils::ToWstring(child->content).length();
             }
         }
     }
-    paragraph_->Build();
-    return true;
+    auto maxSize = GetMaxMeasureSize(contentConstraint);
+    key.AddLayoutConstraint(maxSize.Width());
+    if (textStyle.GetAdaptTextSize()) {
+        key.AddLayoutConstraint(maxSize.Height());
+    }
+    if (!contentConstraint.selfIdealSize.Width()) {
+        key.AddLayoutConstraint(contentConstraint.minSize.Width());
+        key.AddLayoutConstraint(contentConstraint.maxSize.Width());
+    }
+    return key;
 }
 
 bool TextLayoutAlgorithm::CreateParagraphAndLayout(
@@ -153,6 +214,18 @@ bool TextLayoutAlgorithm::CreateParagraphAndLayout(
     return true;
 }
 
+bool TextLayoutAlgorithm::CreateParagraphAndLayout(const TextStyle& textStyle, TextDirection direction,
+    const std::u16string& text, const LayoutConstraintF& contentConstraint)
+{
+    if (!CreateParagraph(textStyle, direction, text)) {
+        return false;
+    }
+    CHECK_NULL_RETURN(paragraph_, false);
+    auto maxSize = GetMaxMeasureSize(contentConstraint);
+    paragraph_->Layout(maxSize.Width());
+    return true;
+}
+
 bool TextLayoutAlgorithm::AdaptMinTextSize(TextStyle& textStyle, const std::string& content,
     const LayoutConstraintF& contentConstraint, const RefPtr<PipelineContext>& pipeline)
 {
@@ -183,16 +256,81 @@ bool TextLayoutAlgorithm::AdaptMinTextSize(TextStyle& textStyle, const std::stri
             contentConstraint.maxSize.Height(), stepSize)) {
         return false;
     }
+
+    // spans carry their own content, only plain text results are cached.
+    AdaptFontSizeCache cache = { .content = content,
+        .textStyle = textStyle,
+        .contentConstraint = contentConstraint,
+        .maxFontSize = maxFontSize,
+        .minFontSize = minFontSize,
+        .stepSize = stepSize };
+    bool cacheable = spanItemChildren_.empty();
+    if (cacheable && adaptFontSizeCache_ && IsSameAdaptSearch(adaptFontSizeCache_.value(), cache)) {
+        textStyle.SetFontSize(Dimension(adaptFontSizeCache_->fontSize));
+        return CreateParagraphAndLayout(textStyle, content, contentConstraint);
+    }
+
+    // the direction and the utf-16 text do not depend on the font size, convert them once for all the candidates.
+    auto direction = GetTextDirection(content);
+    std::u16string text;
+    if (spanItemChildren_.empty()) {
+        auto transformedContent = content;
+        StringUtils::TransformStrCase(transformedContent, static_cast<int32_t>(textStyle.GetTextCase()));
+        text = StringUtils::Str8ToStr16(transformedContent);
+    }
     auto maxSize = GetMaxMeasureSize(contentConstraint);
-    while (GreatOrEqual(maxFontSize, minFontSize)) {
-        textStyle.SetFontSize(Dimension(maxFontSize));
-        if (!CreateParagraphAndLayout(textStyle, content, contentConstraint)) {
-            return false;
+    auto layoutWithFontSize = [&](double fontSize) {
+        textStyle.SetFontSize(Dimension(fontSize));
+        return CreateParagraphAndLayout(textStyle, direction, text, contentConstraint);
+    };
+
+    // candidates are maxFontSize - n * stepSize down to minFontSize, the first one that fits is searched by bisection.
+    int32_t lastStep = 0;
+    if (GreatNotEqual(stepSize, 0.0)) {
+        lastStep = static_cast<int32_t>(std::floor((maxFontSize - minFontSize) / stepSize));
+        if (GreatOrEqual(maxFontSize - (lastStep + 1) * stepSize, minFontSize)) {
+            ++lastStep;
         }
-        if (!DidExceedMaxLines(maxSize)) {
-            break;
+    }
+    // most texts fit with the max font size, try it before searching.
+    if (!layoutWithFontSize(maxFontSize)) {
+        return false;
+    }
+    int32_t fitStep = 0;
+    if (DidExceedMaxLines(maxSize)) {
+        int32_t low = 1;
+        int32_t high = lastStep;
+        RefPtr<Paragraph> fitParagraph;
+        fitStep = -1;
+        while (low < high) {
+            auto mid = low + (high - low) / 2;
+            if (!layoutWithFontSize(maxFontSize - mid * stepSize)) {
+                return false;
+            }
+            if (DidExceedMaxLines(maxSize)) {
+                low = mid + 1;
+            } else {
+                high = mid;
+                fitStep = mid;
+                fitParagraph = paragraph_;
+            }
+        }
+        // when nothing fits, the text is shown with the smallest candidate.
+        if (fitStep == high && fitParagraph) {
+            paragraph_ = fitParagraph;
+            textStyle.SetFontSize(Dimension(maxFontSize - fitStep * stepSize));
+        } else if (high > 0) {
+            fitStep = high;
+            if (!layoutWithFontSize(maxFontSize - fitStep * stepSize)) {
+                return false;
+            }
+        } else {
+            fitStep = 0;
         }
-        maxFontSize -= stepSize;
+    }
+    if (cacheable) {
+        cache.fontSize = maxFontSize - fitStep * stepSize;
+        adaptFontSizeCache_ = std::move(cache);
     }
     return true;
 }
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_TEXT_LAYOUT_ALGORITHM_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_TEXT_LAYOUT_ALGORITHM_H
 
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -25,10 +26,23 @@
 #include "core/components_ng/pattern/text/text_styles.h"
 #include "core/components_ng/render/drawing.h"
 #include "core/components_ng/render/paragraph.h"
+#include "core/components_ng/render/paragraph_cache.h"
 
 namespace OHOS::Ace::NG {
 class PipelineContext;
 
+// Result of the last adaptive font size search of a text node, valid while the content, the style and the constraint
+// it was searched with stay the same.
+struct AdaptFontSizeCache {
+    std::string content;
+    TextStyle textStyle;
+    LayoutConstraintF contentConstraint;
+    double maxFontSize = 0.0;
+    double minFontSize = 0.0;
+    double stepSize = 0.0;
+    double fontSize = 0.0;
+};
+
 // TextLayoutAlgorithm acts as the underlying text layout.
 class ACE_EXPORT TextLayoutAlgorithm : public BoxLayoutAlgorithm {
     DECLARE_ACE_TYPE(TextLayoutAlgorithm, BoxLayoutAlgorithm);
@@ -55,10 +69,26 @@ public:
     
     float GetBaselineOffset() const;
 
+    void SetAdaptFontSizeCache(const std::optional<AdaptFontSizeCache>& adaptFontSizeCache)
+    {
+        adaptFontSizeCache_ = adaptFontSizeCache;
+    }
+
+    const std::optional<AdaptFontSizeCache>& GetAdaptFontSizeCache() const
+    {
+        return adaptFontSizeCache_;
+    }
+
 private:
     bool CreateParagraph(const TextStyle& textStyle, std::string content);
+    bool CreateParagraph(const TextStyle& textStyle, TextDirection direction, const std::u16string& text);
     bool CreateParagraphAndLayout(
         const TextStyle& textStyle, const std::string& content, const LayoutConstraintF& contentConstraint);
+    bool CreateParagraphAndLayout(const TextStyle& textStyle, TextDirection direction, const std::u16string& text,
+        const LayoutConstraintF& contentConstraint);
+    // Also assigns the text positions of the span items, they are needed whether the paragraph is cached or not.
+    ParagraphCacheKey CreateParagraphCacheKey(const TextStyle& textStyle, std::string content,
+        const LayoutConstraintF& contentConstraint, const RefPtr<PipelineContext>& pipeline);
     bool AdaptMinTextSize(TextStyle& textStyle, const std::string& content, const LayoutConstraintF& contentConstraint,
         const RefPtr<PipelineContext>& pipeline);
     bool DidExceedMaxLines(const SizeF& maxSize);
@@ -69,6 +99,7 @@ private:
     std::list<RefPtr<SpanItem>> spanItemChildren_;
     RefPtr<Paragraph> paragraph_;
     float baselineOffset_ = 0.0f;
+    std::optional<AdaptFontSizeCache> adaptFontSizeCache_;
 
     ACE_DISALLOW_COPY_AND_MOVE(TextLayoutAlgorithm);
 };
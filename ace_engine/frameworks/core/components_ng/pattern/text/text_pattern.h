@@ -54,7 +54,9 @@ public:
 
     RefPtr<LayoutAlgorithm> CreateLayoutAlgorithm() override
     {
-        return MakeRefPtr<TextLayoutAlgorithm>(spanItemChildren_, paragraph_);
+        auto textLayoutAlgorithm = MakeRefPtr<TextLayoutAlgorithm>(spanItemChildren_, paragraph_);
+        textLayoutAlgorithm->SetAdaptFontSizeCache(adaptFontSizeCache_);
+        return textLayoutAlgorithm;
     }
 
     RefPtr<AccessibilityProperty> CreateAccessibilityProperty() override
@@ -121,6 +123,7 @@ private:
     std::list<RefPtr<SpanItem>> spanItemChildren_;
     std::string textForDisplay_;
     RefPtr<Paragraph> paragraph_;
+    std::optional<AdaptFontSizeCache> adaptFontSizeCache_;
     RefPtr<LongPressEvent> longPressEvent_;
     RefPtr<SelectOverlayProxy> selectOverlayProxy_;
     RefPtr<Clipboard> clipboard_;
@@ -37,9 +37,20 @@
 #include "core/components_ng/property/measure_utils.h"
 #include "core/components_ng/render/drawing_prop_convertor.h"
 #include "core/components_ng/render/font_collection.h"
+#include "core/components_ng/render/paragraph_cache.h"
 #include "core/pipeline_ng/pipeline_context.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+std::u16string GetDisplayText(const TextStyle& textStyle, std::string content, bool needObscureText)
+{
+    StringUtils::TransformStrCase(content, static_cast<int32_t>(textStyle.GetTextCase()));
+    if (!content.empty() && needObscureText) {
+        return TextFieldPattern::CreateObscuredText(static_cast<int32_t>(StringUtils::ToWstring(content).length()));
+    }
+    return StringUtils::Str8ToStr16(content);
+}
+} // namespace
 
 void TextFieldLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
 {
@@ -113,17 +124,26 @@ std::optional<SizeF> TextFieldLayoutAlgorithm::MeasureContent(
     }
     auto isPasswordType =
         textFieldLayoutProperty->GetTextInputTypeValue(TextInputType::UNSPECIFIED) == TextInputType::VISIBLE_PASSWORD;
-    CreateParagraph(textStyle, textContent, isPasswordType && pattern->GetTextObscured() && !showPlaceHolder);
-    if (textStyle.GetMaxLines() == 1 && !showPlaceHolder) {
-        // for text input case, need to measure in one line without constraint.
-        paragraph_->Layout(std::numeric_limits<double>::infinity());
+    auto needObscureText = isPasswordType && pattern->GetTextObscured() && !showPlaceHolder;
+    // for text input case, need to measure in one line without constraint.
+    // for text area or placeholder, max width is content width without password icon
+    auto layoutWidth = textStyle.GetMaxLines() == 1 && !showPlaceHolder ? std::numeric_limits<float>::infinity()
+                                                                         : idealWidth;
+    auto fitIntrinsicWidth = !pattern->IsTextArea() && !showPlaceHolder;
+    auto showPasswordIcon = textFieldLayoutProperty->GetShowPasswordIcon().value_or(true);
+    // a multi line password is laid out again for the password icon below, so it can not be shared.
+    if (!pattern->IsTextArea() && isPasswordType && showPasswordIcon && textStyle.GetMaxLines() > 1) {
+        CreateParagraph(textStyle, textContent, needObscureText);
+        LayoutParagraph(layoutWidth, fitIntrinsicWidth);
     } else {
-        // for text area or placeholder, max width is content width without password icon
-        paragraph_->Layout(idealWidth);
-    }
-    auto paragraphNewWidth = static_cast<float>(paragraph_->GetMaxIntrinsicWidth());
-    if (!NearEqual(paragraphNewWidth, paragraph_->GetMaxWidth()) && !pattern->IsTextArea() && !showPlaceHolder) {
-        paragraph_->Layout(std::ceil(paragraphNewWidth));
+        auto cacheKey =
+            CreateParagraphCacheKey(textStyle, textContent, needObscureText, layoutWidth, fitIntrinsicWidth);
+        paragraph_ = ParagraphCache::GetInstance().GetRSParagraph(cacheKey);
+        if (!paragraph_) {
+            CreateParagraph(textStyle, textContent, needObscureText);
+            LayoutParagraph(layoutWidth, fitIntrinsicWidth);
+            ParagraphCache::GetInstance().PutRSParagraph(cacheKey, paragraph_);
+        }
     }
     auto preferredHeight = static_cast<float>(paragraph_->GetHeight());
     if (textContent.empty()) {
@@ -134,7 +154,6 @@ std::optional<SizeF> TextFieldLayoutAlgorithm::MeasureContent(
         textRect_.SetSize(SizeF(idealWidth, useHeight));
         return SizeF(idealWidth, std::min(idealHeight, useHeight));
     }
-    auto showPasswordIcon = textFieldLayoutProperty->GetShowPasswordIcon().value_or(true);
     // check password image size.
     if (!showPasswordIcon || !isPasswordType) {
         textRect_.SetSize(SizeF(static_cast<float>(paragraph_->GetLongestLine()), preferredHeight));
@@ -323,19 +342,48 @@ void TextFieldLayoutAlgorithm::CreateParagraph(const TextStyle& textStyle, std::
     }
     auto builder = RSParagraphBuilder::CreateRosenBuilder(paraStyle, RSFontCollection::GetInstance(false));
     builder->PushStyle(ToRSTextStyle(PipelineContext::GetCurrentContext(), textStyle));
-    StringUtils::TransformStrCase(content, static_cast<int32_t>(textStyle.GetTextCase()));
-    if (!content.empty() && needObscureText) {
-        builder->AddText(
-            TextFieldPattern::CreateObscuredText(static_cast<int32_t>(StringUtils::ToWstring(content).length())));
-    } else {
-        builder->AddText(StringUtils::Str8ToStr16(content));
-    }
+    builder->AddText(GetDisplayText(textStyle, content, needObscureText));
     builder->Pop();
 
     auto paragraph = builder->Build();
     paragraph_.reset(paragraph.release());
 }
 
+void TextFieldLayoutAlgorithm::LayoutParagraph(float layoutWidth, bool fitIntrinsicWidth)
+{
+    CHECK_NULL_VOID(paragraph_);
+    paragraph_->Layout(layoutWidth);
+    auto paragraphNewWidth = static_cast<float>(paragraph_->GetMaxIntrinsicWidth());
+    if (!NearEqual(paragraphNewWidth, paragraph_->GetMaxWidth()) && fitIntrinsicWidth) {
+        paragraph_->Layout(std::ceil(paragraphNewWidth));
+    }
+}
+
+ParagraphCacheKey TextFieldLayoutAlgorithm::CreateParagraphCacheKey(const TextStyle& textStyle,
+    const std::string& content, bool needObscureText, float layoutWidth, bool fitIntrinsicWidth)
+{
+    ParagraphStyle paraStyle = { .direction = GetTextDirection(content),
+        .align = textStyle.GetTextAlign(),
+        .maxLines = textStyle.GetMaxLines(),
+        .fontLocale = Localization::GetInstance()->GetFontLocale(),
+        .wordBreak = textStyle.GetWordBreak(),
+        .textOverflow = textStyle.GetTextOverflow() };
+    ParagraphCacheKey key(ParagraphCacheType::TEXT_FIELD, paraStyle);
+    auto pipeline = PipelineContext::GetCurrentContext();
+    if (pipeline) {
+        key.AddScale(pipeline->GetDipScale());
+        key.AddScale(pipeline->GetFontScale());
+        key.AddScale(pipeline->GetLogicScale());
+    }
+    key.PushStyle(textStyle);
+    // the key holds the obscured text of a password, never the password itself.
+    key.AddText(GetDisplayText(textStyle, content, needObscureText));
+    key.PopStyle();
+    key.AddLayoutConstraint(layoutWidth);
+    key.AddLayoutConstraint(fitIntrinsicWidth ? 1.0f : 0.0f);
+    return key;
+}
+
 TextDirection TextFieldLayoutAlgorithm::GetTextDirection(const std::string& content)
 {
     TextDirection textDirection = TextDirection::LTR;
@@ -27,6 +27,7 @@
 #include "core/components_ng/pattern/text/text_styles.h"
 #include "core/components_ng/pattern/text_field/text_field_layout_property.h"
 #include "core/components_ng/render/paragraph.h"
+#include "core/components_ng/render/paragraph_cache.h"
 
 namespace OHOS::Ace::NG {
 
@@ -91,6 +92,10 @@ public:
 
 private:
     void CreateParagraph(const TextStyle& textStyle, std::string content, bool needObscureText);
+    // Lays the paragraph out with [layoutWidth], [fitIntrinsicWidth] shrinks it to its intrinsic width afterwards.
+    void LayoutParagraph(float layoutWidth, bool fitIntrinsicWidth);
+    ParagraphCacheKey CreateParagraphCacheKey(const TextStyle& textStyle, const std::string& content,
+        bool needObscureText, float layoutWidth, bool fitIntrinsicWidth);
     bool CreateParagraphAndLayout(
         const TextStyle& textStyle, const std::string& content, const LayoutConstraintF& contentConstraint);
     bool AdaptMinTextSize(TextStyle& textStyle, const std::string& content, const LayoutConstraintF& contentConstraint,
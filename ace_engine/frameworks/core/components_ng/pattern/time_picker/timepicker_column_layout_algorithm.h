@@ -38,6 +38,13 @@ public:
     void ChangeAmPmTextStyle(uint32_t index, uint32_t showOptionCount, const SizeF& size,
         const RefPtr<LayoutWrapper>& childLayoutWrapper, LayoutWrapper* layoutWrapper);
 
+    // The picker theme comes from the current pipeline context and the picker node is read through the host node,
+    // neither of which is available on the background layout thread.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return MAIN_TASK;
+    }
+
     float GetCurrentOffset() const
     {
         return currentOffset_;
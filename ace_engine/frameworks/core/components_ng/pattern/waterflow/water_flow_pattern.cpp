@@ -45,7 +45,33 @@ bool WaterFlowPattern::IsAtBottom() const
 {
     return layoutInfo_.offsetEnd_;
 };
-void WaterFlowPattern::UpdateScrollBarOffset() {};
+void WaterFlowPattern::UpdateScrollBarOffset()
+{
+    if (!GetScrollBar() && !GetScrollBarProxy()) {
+        return;
+    }
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    auto geometryNode = host->GetGeometryNode();
+    CHECK_NULL_VOID(geometryNode);
+    // every item laid out so far stays in the lanes, only the items after them have to be estimated.
+    int32_t itemCount = 0;
+    for (const auto& crossItems : layoutInfo_.waterFlowItems_) {
+        itemCount += static_cast<int32_t>(crossItems.second.size());
+    }
+    if (itemCount == 0) {
+        return;
+    }
+    auto mainHeight = layoutInfo_.GetMaxMainHeight();
+    auto totalCount = host->TotalChildCount() - (layoutInfo_.footerIndex_ + 1);
+    float estimatedHeight = mainHeight;
+    if (!layoutInfo_.itemEnd_ && totalCount > itemCount) {
+        estimatedHeight = mainHeight / itemCount * totalCount;
+    }
+    auto viewScopeSize = geometryNode->GetPaddingSize();
+    Size mainSize = { viewScopeSize.Width(), viewScopeSize.Height() };
+    UpdateScrollBarRegion(-layoutInfo_.currentOffset_, estimatedHeight, mainSize);
+}
 
 RefPtr<LayoutAlgorithm> WaterFlowPattern::CreateLayoutAlgorithm()
 {
@@ -90,6 +116,7 @@ bool WaterFlowPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dir
         }
     }
     layoutInfo_ = std::move(layoutInfo);
+    UpdateScrollBarOffset();
     return false;
 }
 
@@ -17,6 +17,7 @@
 
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/base/geometry_node.h"
+#include "core/components_ng/base/hit_test_index.h"
 #include "core/components_ng/render/drawing.h"
 #include "core/components_ng/render/paint_property.h"
 
@@ -70,6 +71,7 @@ void FlutterRenderContext::SyncGeometryProperties(GeometryNode* geometryNode)
     const auto& frameRect = geometryNode->GetFrameRect();
     LOGD("SyncGeometryProperties frameRect:%s", frameRect.ToString().c_str());
     CHECK_NULL_VOID_NOLOG(flutterNode_);
+    HitTestIndex::MarkGeometryChanged();
     flutterNode_->SetFrameRect(frameRect);
 }
 
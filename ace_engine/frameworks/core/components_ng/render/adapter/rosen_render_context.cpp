@@ -39,6 +39,7 @@
 #include "core/components/theme/app_theme.h"
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/base/geometry_node.h"
+#include "core/components_ng/base/hit_test_index.h"
 #include "core/components_ng/pattern/stage/page_pattern.h"
 #include "core/components_ng/pattern/stage/stage_pattern.h"
 #include "core/components_ng/property/calc_length.h"
@@ -130,6 +131,7 @@ void RosenRenderContext::SetPivot(float xPivot, float yPivot)
 {
     // change pivot without animation
     CHECK_NULL_VOID(rsNode_);
+    HitTestIndex::MarkGeometryChanged();
     if (pivotProperty_) {
         pivotProperty_->Set({ xPivot, yPivot });
     } else {
@@ -185,6 +187,7 @@ void RosenRenderContext::SyncGeometryProperties(GeometryNode* /*geometryNode*/)
 void RosenRenderContext::SyncGeometryProperties(const RectF& paintRect)
 {
     CHECK_NULL_VOID(rsNode_);
+    HitTestIndex::MarkGeometryChanged();
     rsNode_->SetBounds(paintRect.GetX(), paintRect.GetY(), paintRect.Width(), paintRect.Height());
     rsNode_->SetFrame(paintRect.GetX(), paintRect.GetY(), paintRect.Width(), paintRect.Height());
     SetPivot(0.5f, 0.5f); // default pivot is center
@@ -417,6 +420,7 @@ void RosenRenderContext::OnOpacityUpdate(double opacity)
 void RosenRenderContext::OnTransformScaleUpdate(const VectorF& scale)
 {
     CHECK_NULL_VOID(rsNode_);
+    HitTestIndex::MarkGeometryChanged();
     rsNode_->SetScale(scale.x, scale.y);
     RequestNextFrame();
 }
@@ -438,6 +442,7 @@ void RosenRenderContext::OnTransformTranslateUpdate(const TranslateOptions& tran
         xValue = translate.x.ConvertToPx();
         yValue = translate.y.ConvertToPx();
     }
+    HitTestIndex::MarkGeometryChanged();
     rsNode_->SetTranslate(xValue, yValue, 0.0f);
     RequestNextFrame();
 }
@@ -576,6 +581,7 @@ void RosenRenderContext::OpacityAnimation(const AnimationOption& option, double
 void RosenRenderContext::ScaleAnimation(const AnimationOption& option, double begin, double end)
 {
     CHECK_NULL_VOID(rsNode_);
+    HitTestIndex::MarkGeometryChanged();
     rsNode_->SetScale(begin);
     AnimationUtils::Animate(
         option,
@@ -837,6 +843,7 @@ void RosenRenderContext::OnModifyDone()
     if (!rect.GetSize().IsPositive()) {
         return;
     }
+    HitTestIndex::MarkGeometryChanged();
     rsNode_->SetBounds(rect.GetX(), rect.GetY(), rect.Width(), rect.Height());
     rsNode_->SetFrame(rect.GetX(), rect.GetY(), rect.Width(), rect.Height());
     isPositionChanged_ = false;
@@ -1273,6 +1280,7 @@ void RosenRenderContext::AnimateHoverEffectScale(bool isHovered)
     int32_t themeDuration = appTheme->GetHoverDuration();
 
     LOGD("HoverEffect.Scale: scale from %{public}f to %{public}f", scaleStart, scaleEnd);
+    HitTestIndex::MarkGeometryChanged();
     rsNode_->SetScale(scaleStart);
     Rosen::RSAnimationTimingProtocol protocol;
     protocol.SetDuration(themeDuration);
@@ -1836,6 +1844,7 @@ void RosenRenderContext::AddChild(const RefPtr<RenderContext>& renderContext, in
 void RosenRenderContext::SetBounds(float positionX, float positionY, float width, float height)
 {
     CHECK_NULL_VOID(rsNode_);
+    HitTestIndex::MarkGeometryChanged();
     rsNode_->SetBounds(positionX, positionY, width, height);
 }
 
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/render/paragraph_cache.h"
+
+#include <cmath>
+#include <functional>
+
+#include "base/utils/utils.h"
+#include "core/common/font_manager.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+// Rough cost of a laid-out paragraph: the fixed part, then glyphs, positions and clusters of every code unit.
+constexpr size_t PARAGRAPH_BASE_SIZE = 512;
+constexpr size_t PARAGRAPH_SIZE_PER_CHAR = 48;
+constexpr size_t HASH_SEED = 0x9e3779b9;
+constexpr int32_t HASH_LEFT_SHIFT = 6;
+constexpr int32_t HASH_RIGHT_SHIFT = 2;
+
+template<typename T>
+size_t Hash(const T& value)
+{
+    return std::hash<T> {}(value);
+}
+
+bool IsSameParagraphStyle(const ParagraphStyle& lhs, const ParagraphStyle& rhs)
+{
+    return lhs.direction == rhs.direction && lhs.align == rhs.align && lhs.maxLines == rhs.maxLines &&
+           lhs.fontLocale == rhs.fontLocale && lhs.wordBreak == rhs.wordBreak && lhs.textOverflow == rhs.textOverflow;
+}
+
+bool IsSameMetric(double lhs, double rhs)
+{
+    return lhs == rhs || NearEqual(lhs, rhs);
+}
+} // namespace
+
+ParagraphCacheKey::ParagraphCacheKey(ParagraphCacheType type, const ParagraphStyle& paragraphStyle)
+    : type_(type), paragraphStyle_(paragraphStyle)
+{
+    Combine(static_cast<size_t>(type));
+    Combine(static_cast<size_t>(paragraphStyle.direction));
+    Combine(static_cast<size_t>(paragraphStyle.align));
+    Combine(static_cast<size_t>(paragraphStyle.maxLines));
+    Combine(Hash(paragraphStyle.fontLocale));
+    Combine(static_cast<size_t>(paragraphStyle.wordBreak));
+    Combine(static_cast<size_t>(paragraphStyle.textOverflow));
+}
+
+void ParagraphCacheKey::Combine(size_t value)
+{
+    hash_ ^= value + HASH_SEED + (hash_ << HASH_LEFT_SHIFT) + (hash_ >> HASH_RIGHT_SHIFT);
+}
+
+void ParagraphCacheKey::PushStyle(const TextStyle& style)
+{
+    operations_.emplace_back(Operation::PUSH_STYLE);
+    styles_.emplace_back(style);
+    // only the attributes which usually differ take part in the hash, the rest is compared by operator==.
+    Combine(static_cast<size_t>(Operation::PUSH_STYLE));
+    Combine(Hash(style.GetFontSize().Value()));
+    Combine(static_cast<size_t>(style.GetFontSize().Unit()));
+    Combine(static_cast<size_t>(style.GetFontWeight()));
+    Combine(static_cast<size_t>(style.GetFontStyle()));
+    Combine(static_cast<size_t>(style.GetTextColor().GetValue()));
+    for (const auto& family : style.GetFontFamilies()) {
+        Combine(Hash(family));
+    }
+}
+
+void ParagraphCacheKey::PopStyle()
+{
+    operations_.emplace_back(Operation::POP_STYLE);
+    Combine(static_cast<size_t>(Operation::POP_STYLE));
+}
+
+void ParagraphCacheKey::AddText(const std::u16string& text)
+{
+    operations_.emplace_back(Operation::ADD_TEXT);
+    texts_.emplace_back(text);
+    textLength_ += text.length();
+    Combine(static_cast<size_t>(Operation::ADD_TEXT));
+    Combine(Hash(text));
+}
+
+void ParagraphCacheKey::AddLayoutConstraint(float value)
+{
+    metrics_.emplace_back(value);
+    auto bucket = std::isfinite(value) ? static_cast<int64_t>(std::floor(value)) : -1;
+    Combine(Hash(bucket));
+}
+
+void ParagraphCacheKey::AddScale(double scale)
+{
+    metrics_.emplace_back(scale);
+    Combine(Hash(scale));
+}
+
+bool ParagraphCacheKey::operator==(const ParagraphCacheKey& other) const
+{
+    if (hash_ != other.hash_ || type_ != other.type_ || textLength_ != other.textLength_ ||
+        operations_ != other.operations_ || metrics_.size() != other.metrics_.size() ||
+        !IsSameParagraphStyle(paragraphStyle_, other.paragraphStyle_)) {
+        return false;
+    }
+    for (size_t i = 0; i < metrics_.size(); ++i) {
+        if (!IsSameMetric(metrics_[i], other.metrics_[i])) {
+            return false;
+        }
+    }
+    return texts_ == other.texts_ && styles_ == other.styles_;
+}
+
+ParagraphCache& ParagraphCache::GetInstance()
+{
+    static ParagraphCache instance;
+    return instance;
+}
+
+RefPtr<Paragraph> ParagraphCache::GetParagraph(const ParagraphCacheKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = Find(key);
+    if (iter == cacheList_.end() || !iter->paragraph) {
+        ++statistics_.missCount;
+        return nullptr;
+    }
+    ++statistics_.hitCount;
+    return iter->paragraph;
+}
+
+void ParagraphCache::PutParagraph(const ParagraphCacheKey& key, const RefPtr<Paragraph>& paragraph)
+{
+    CHECK_NULL_VOID(paragraph);
+    std::lock_guard<std::mutex> lock(mutex_);
+    Insert(key).paragraph = paragraph;
+    Evict();
+}
+
+#ifndef ACE_UNITTEST
+std::shared_ptr<RSParagraph> ParagraphCache::GetRSParagraph(const ParagraphCacheKey& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = Find(key);
+    if (iter == cacheList_.end() || !iter->rsParagraph) {
+        ++statistics_.missCount;
+        return nullptr;
+    }
+    ++statistics_.hitCount;
+    return iter->rsParagraph;
+}
+
+void ParagraphCache::PutRSParagraph(const ParagraphCacheKey& key, const std::shared_ptr<RSParagraph>& paragraph)
+{
+    CHECK_NULL_VOID(paragraph);
+    std::lock_guard<std::mutex> lock(mutex_);
+    Insert(key).rsParagraph = paragraph;
+    Evict();
+}
+#endif
+
+std::list<ParagraphCache::CacheNode>::iterator ParagraphCache::Find(const ParagraphCacheKey& key)
+{
+    CheckFontGeneration();
+    auto iter = cache_.find(key.GetHash());
+    if (iter == cache_.end() || !(iter->second->cacheKey == key)) {
+        return cacheList_.end();
+    }
+    cacheList_.splice(cacheList_.begin(), cacheList_, iter->second);
+    return iter->second;
+}
+
+ParagraphCache::CacheNode& ParagraphCache::Insert(const ParagraphCacheKey& key)
+{
+    CheckFontGeneration();
+    auto iter = cache_.find(key.GetHash());
+    if (iter != cache_.end()) {
+        // same key laid out twice or a hash collision, the newest paragraph wins.
+        RemoveNode(iter->second);
+    }
+    auto memorySize = PARAGRAPH_BASE_SIZE + key.GetTextLength() * PARAGRAPH_SIZE_PER_CHAR;
+    cacheList_.emplace_front(key, memorySize);
+    cache_[key.GetHash()] = cacheList_.begin();
+    statistics_.memorySize += memorySize;
+    ++statistics_.count;
+    return cacheList_.front();
+}
+
+void ParagraphCache::CheckFontGeneration()
+{
+    auto fontGeneration = FontManager::GetFontGeneration();
+    if (fontGeneration != fontGeneration_) {
+        // paragraphs are shaped with the fonts available at that time.
+        cacheList_.clear();
+        cache_.clear();
+        statistics_.count = 0;
+        statistics_.memorySize = 0;
+        fontGeneration_ = fontGeneration;
+    }
+}
+
+void ParagraphCache::Evict()
+{
+    while (!cacheList_.empty() && (statistics_.memorySize > memoryLimit_ || statistics_.count > countLimit_)) {
+        RemoveNode(std::prev(cacheList_.end()));
+        ++statistics_.evictCount;
+    }
+}
+
+void ParagraphCache::RemoveNode(std::list<CacheNode>::iterator iter)
+{
+    statistics_.memorySize -= iter->memorySize;
+    --statistics_.count;
+    cache_.erase(iter->cacheKey.GetHash());
+    cacheList_.erase(iter);
+}
+
+void ParagraphCache::SetCapacity(size_t memoryLimit, size_t countLimit)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    memoryLimit_ = memoryLimit;
+    countLimit_ = countLimit;
+    Evict();
+}
+
+void ParagraphCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    cacheList_.clear();
+    cache_.clear();
+    statistics_ = ParagraphCacheStatistics();
+}
+
+ParagraphCacheStatistics ParagraphCache::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_RENDER_PARAGRAPH_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_RENDER_PARAGRAPH_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/memory/ace_type.h"
+#include "base/utils/noncopyable.h"
+#include "core/components/common/properties/text_style.h"
+#include "core/components_ng/render/drawing.h"
+#include "core/components_ng/render/paragraph.h"
+
+namespace OHOS::Ace::NG {
+enum class ParagraphCacheType {
+    TEXT = 0,
+    TEXT_FIELD,
+};
+
+// Describes a laid-out paragraph: the paragraph style, every builder call (styles and texts) and the widths it is
+// laid out with. Two paragraphs built from equal keys end up in the same state, so they can be shared.
+class ParagraphCacheKey {
+public:
+    ParagraphCacheKey(ParagraphCacheType type, const ParagraphStyle& paragraphStyle);
+    ~ParagraphCacheKey() = default;
+
+    void PushStyle(const TextStyle& style);
+    void PopStyle();
+    void AddText(const std::u16string& text);
+    // Widths (or heights) the paragraph is laid out or fitted with. They only take part in the hash by bucket,
+    // equality is still exact since line breaking depends on them.
+    void AddLayoutConstraint(float value);
+    // Dimensions of the styles are converted with the scales of the pipeline the paragraph is built in.
+    void AddScale(double scale);
+
+    size_t GetHash() const
+    {
+        return hash_;
+    }
+
+    size_t GetTextLength() const
+    {
+        return textLength_;
+    }
+
+    bool operator==(const ParagraphCacheKey& other) const;
+
+private:
+    enum class Operation : uint8_t {
+        PUSH_STYLE = 0,
+        POP_STYLE,
+        ADD_TEXT,
+    };
+
+    void Combine(size_t value);
+
+    ParagraphCacheType type_;
+    ParagraphStyle paragraphStyle_;
+    std::vector<Operation> operations_;
+    std::vector<TextStyle> styles_;
+    std::vector<std::u16string> texts_;
+    std::vector<double> metrics_;
+    size_t textLength_ = 0;
+    size_t hash_ = 0;
+};
+
+struct ParagraphCacheStatistics {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t evictCount = 0;
+    size_t count = 0;
+    size_t memorySize = 0;
+
+    double GetHitRate() const
+    {
+        auto total = hitCount + missCount;
+        return total > 0 ? static_cast<double>(hitCount) / static_cast<double>(total) : 0.0;
+    }
+};
+
+// Process wide LRU of laid-out paragraphs shared by text, text field and span nodes. Paragraphs stored here must not
+// be built or laid out again, users only measure, hit test and paint them.
+class ACE_EXPORT ParagraphCache final : public NonCopyable {
+public:
+    static constexpr size_t DEFAULT_MEMORY_LIMIT = 4 * 1024 * 1024;
+    static constexpr size_t DEFAULT_COUNT_LIMIT = 512;
+
+    static ParagraphCache& GetInstance();
+
+    RefPtr<Paragraph> GetParagraph(const ParagraphCacheKey& key);
+    void PutParagraph(const ParagraphCacheKey& key, const RefPtr<Paragraph>& paragraph);
+#ifndef ACE_UNITTEST
+    std::shared_ptr<RSParagraph> GetRSParagraph(const ParagraphCacheKey& key);
+    void PutRSParagraph(const ParagraphCacheKey& key, const std::shared_ptr<RSParagraph>& paragraph);
+#endif
+
+    // [memoryLimit] is the estimated bytes of all paragraphs, [countLimit] the number of them.
+    void SetCapacity(size_t memoryLimit, size_t countLimit);
+    void Clear();
+    ParagraphCacheStatistics GetStatistics() const;
+
+private:
+    struct CacheNode {
+        CacheNode(const ParagraphCacheKey& key, size_t memorySize) : cacheKey(key), memorySize(memorySize) {}
+        ParagraphCacheKey cacheKey;
+        size_t memorySize = 0;
+        RefPtr<Paragraph> paragraph;
+#ifndef ACE_UNITTEST
+        std::shared_ptr<RSParagraph> rsParagraph;
+#endif
+    };
+
+    ParagraphCache() = default;
+    ~ParagraphCache() = default;
+
+    std::list<CacheNode>::iterator Find(const ParagraphCacheKey& key);
+    CacheNode& Insert(const ParagraphCacheKey& key);
+    void CheckFontGeneration();
+    void Evict();
+    void RemoveNode(std::list<CacheNode>::iterator iter);
+
+    mutable std::mutex mutex_;
+    std::list<CacheNode> cacheList_;
+    std::unordered_map<size_t, std::list<CacheNode>::iterator> cache_;
+    size_t memoryLimit_ = DEFAULT_MEMORY_LIMIT;
+    size_t countLimit_ = DEFAULT_COUNT_LIMIT;
+    uint32_t fontGeneration_ = 0;
+    ParagraphCacheStatistics statistics_;
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_RENDER_PARAGRAPH_CACHE_H
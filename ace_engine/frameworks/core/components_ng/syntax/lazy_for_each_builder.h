@@ -17,6 +17,8 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_FOREACH_LAZY_FOR_EACH_BUILDER_H
 
 #include <cstdint>
+#include <iterator>
+#include <list>
 #include <map>
 #include <optional>
 #include <string>
@@ -30,6 +32,56 @@
 
 namespace OHOS::Ace::NG {
 
+// Detached item subtrees which left the cached range, kept by key so that scrolling back to an item reuses its
+// subtree instead of running the item generator again. Beyond CAPACITY the items detached first are dropped.
+class ACE_EXPORT LazyForEachRecycleCache {
+public:
+    static constexpr size_t CAPACITY = 16;
+
+    void Put(const std::string& key, const RefPtr<UINode>& node)
+    {
+        CHECK_NULL_VOID(node);
+        if (index_.find(key) != index_.end()) {
+            return;
+        }
+        items_.emplace_back(key, node);
+        index_.try_emplace(key, std::prev(items_.end()));
+        while (items_.size() > CAPACITY) {
+            index_.erase(items_.front().first);
+            items_.pop_front();
+        }
+    }
+
+    RefPtr<UINode> Take(const std::string& key)
+    {
+        auto iter = index_.find(key);
+        if (iter == index_.end()) {
+            return nullptr;
+        }
+        auto node = iter->second->second;
+        items_.erase(iter->second);
+        index_.erase(iter);
+        return node;
+    }
+
+    size_t Size() const
+    {
+        return items_.size();
+    }
+
+    void Clear()
+    {
+        items_.clear();
+        index_.clear();
+    }
+
+private:
+    // [key, UINode], in detach order.
+    std::list<std::pair<std::string, RefPtr<UINode>>> items_;
+    // [key, position in items_]
+    std::unordered_map<std::string, std::list<std::pair<std::string, RefPtr<UINode>>>::iterator> index_;
+};
+
 class ACE_EXPORT LazyForEachBuilder : public virtual AceType {
     DECLARE_ACE_TYPE(NG::LazyForEachBuilder, AceType)
 public:
@@ -98,6 +150,13 @@ public:
                 }
             }
         }
+        // keep the items which left the cached range for reuse instead of destroying them.
+        for (auto& [key, node] : generatedItem) {
+            if (generatedItem_.find(key) == generatedItem_.end()) {
+                node->SetActive(false);
+                recycleCache_.Put(key, node);
+            }
+        }
         std::swap(cachedItems_, cachedItems);
         LOGD("LazyForEach cached size : %{public}d", static_cast<int32_t>(generatedItem_.size()));
     }
@@ -119,11 +178,18 @@ public:
     void Clean()
     {
         generatedItem_.clear();
+        recycleCache_.Clear();
+    }
+
+    size_t GetRecycledItemCount() const
+    {
+        return recycleCache_.Size();
     }
 
     void RemoveChild(const std::string& id)
     {
         generatedItem_.erase(id);
+        recycleCache_.Take(id);
     }
 
     void ExpandChildrenOnInitial()
@@ -141,11 +207,18 @@ protected:
         int32_t index, const std::unordered_map<std::string, RefPtr<UINode>>& cachedItems) = 0;
     virtual void OnExpandChildrenOnInitialInNG() = 0;
 
+    // called by OnGetChildByIndex with the key of the item before generating it.
+    RefPtr<UINode> TakeRecycledItem(const std::string& key)
+    {
+        return recycleCache_.Take(key);
+    }
+
 private:
     // [key, UINode]
     std::unordered_map<std::string, RefPtr<UINode>> generatedItem_;
     // [index, key]
     std::unordered_map<int32_t, std::optional<std::string>> cachedItems_;
+    LazyForEachRecycleCache recycleCache_;
 
     ACE_DISALLOW_COPY_AND_MOVE(LazyForEachBuilder);
 };
@@ -20,7 +20,10 @@
 
 #include "base/json/json_util.h"
 #include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/base/hit_test_index.h"
+#include "core/components_ng/event/input_event.h"
 #include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/test/mock/render/mock_render_context.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -30,6 +33,80 @@ namespace {
 const RefPtr<FrameNode> FRAME_NODE_PARENT =
     FrameNode::CreateFrameNode("parent", 0, AceType::MakeRefPtr<Pattern>(), true);
 const RefPtr<FrameNode> FRAME_NODE = FrameNode::CreateFrameNode("one", 1, AceType::MakeRefPtr<Pattern>());
+constexpr int32_t HIT_TEST_COLUMNS = 8;
+constexpr float HIT_TEST_CELL_SIZE = 50.0f;
+
+class HitTestRenderContext : public MockRenderContext {
+    DECLARE_ACE_TYPE(HitTestRenderContext, MockRenderContext)
+public:
+    explicit HitTestRenderContext(const RectF& rect) : rect_(rect) {}
+    ~HitTestRenderContext() override = default;
+
+    RectF GetPaintRectWithTransform() override
+    {
+        return rect_;
+    }
+
+private:
+    RectF rect_;
+};
+
+void SetHitTestRect(const RefPtr<FrameNode>& frameNode, const RectF& rect)
+{
+    frameNode->renderContext_ = AceType::MakeRefPtr<HitTestRenderContext>(rect);
+    frameNode->isActive_ = true;
+}
+
+// [count] children in rows of cells, and one more child over the first two cells on top of them.
+RefPtr<FrameNode> CreateHitTestTree(int32_t parentId, int32_t count, std::vector<RefPtr<FrameNode>>& children)
+{
+    auto parent = FrameNode::CreateFrameNode("parent", parentId, AceType::MakeRefPtr<Pattern>(), true);
+    SetHitTestRect(parent, RectF(0.0f, 0.0f, 1000.0f, 1000.0f));
+    auto addChild = [&parent, &children, parentId](const RectF& rect) {
+        auto id = parentId + 1 + static_cast<int32_t>(children.size());
+        auto child = FrameNode::CreateFrameNode("child", id, AceType::MakeRefPtr<Pattern>());
+        SetHitTestRect(child, rect);
+        auto inputHub = child->GetOrCreateInputEventHub();
+        OnAxisEventFunc onAxis = [](AxisInfo& /* info */) {};
+        inputHub->AddOnAxisEvent(AceType::MakeRefPtr<InputEvent>(std::move(onAxis)));
+        OnMouseEventFunc onMouse = [](MouseInfo& /* info */) {};
+        inputHub->AddOnMouseEvent(AceType::MakeRefPtr<InputEvent>(std::move(onMouse)));
+        parent->AddChild(child);
+        children.emplace_back(child);
+    };
+    for (int32_t i = 0; i < count; ++i) {
+        addChild(RectF((i % HIT_TEST_COLUMNS) * HIT_TEST_CELL_SIZE, (i / HIT_TEST_COLUMNS) * HIT_TEST_CELL_SIZE,
+            HIT_TEST_CELL_SIZE, HIT_TEST_CELL_SIZE));
+    }
+    addChild(RectF(0.0f, 0.0f, HIT_TEST_CELL_SIZE * 2, HIT_TEST_CELL_SIZE));
+    parent->needSyncRenderTree_ = true;
+    parent->RebuildRenderContextTree();
+    return parent;
+}
+
+// Index of the child whose targets the tests collected, -1 if none did.
+int32_t TouchTestHit(const RefPtr<FrameNode>& parent, const std::vector<RefPtr<FrameNode>>& children,
+    const PointF& point)
+{
+    TouchRestrict touchRestrict { TouchRestrict::NONE };
+    touchRestrict.hitTestType = SourceType::MOUSE;
+    TouchTestResult touchResult;
+    parent->TouchTest(point, point, touchRestrict, touchResult, 0);
+    AxisTestResult axisResult;
+    parent->AxisTest(point, point, axisResult);
+    if (touchResult.size() != 1 || axisResult.size() != 1) {
+        return (touchResult.empty() && axisResult.empty()) ? -1 : -2;
+    }
+    for (int32_t i = 0; i < static_cast<int32_t>(children.size()); ++i) {
+        auto inputHub = children[i]->GetOrCreateInputEventHub();
+        const auto& mouseTarget = inputHub->mouseEventActuator_->mouseEventTarget_;
+        if (AceType::RawPtr(touchResult.front()) == AceType::RawPtr(mouseTarget) &&
+            axisResult.front() == inputHub->axisEventActuator_->axisEventTarget_) {
+            return i;
+        }
+    }
+    return -2;
+}
 } // namespace
 class FrameNodeTestNg : public testing::Test {
 public:
@@ -90,4 +167,136 @@ HWTEST_F(FrameNodeTestNg, FrameNodeTestNg004, TestSize.Level1)
     node->GetRenderContext()->RequestNextFrame();
     EXPECT_TRUE(node->IsOnMainTree());
 }
-} // namespace OHOS::Ace::NG
\ No newline at end of file
+
+/**
+ * @tc.name: FrameNodeTestNg005
+ * @tc.desc: Test window geometry is computed once per pass for area change callbacks
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeTestNg005, TestSize.Level1)
+{
+    auto parent = FrameNode::CreateFrameNode("parent", 20, AceType::MakeRefPtr<Pattern>(), true);
+    auto child = FrameNode::CreateFrameNode("child", 21, AceType::MakeRefPtr<Pattern>());
+    parent->AddChild(child);
+    parent->GetGeometryNode()->SetFrameOffset(OffsetF(10.0f, 20.0f));
+    child->GetGeometryNode()->SetFrameOffset(OffsetF(5.0f, 5.0f));
+    child->GetGeometryNode()->SetFrameSize(SizeF(100.0f, 100.0f));
+
+    OffsetF lastOrigin;
+    int32_t changedCount = 0;
+    child->SetOnAreaChangeCallback(
+        [&lastOrigin, &changedCount](const RectF& /* oldRect */, const OffsetF& /* oldOrigin */,
+            const RectF& /* rect */, const OffsetF& origin) {
+            lastOrigin = origin;
+            changedCount++;
+        });
+    child->TriggerOnAreaChangeCallback(1);
+    EXPECT_EQ(changedCount, 1);
+    EXPECT_EQ(lastOrigin, OffsetF(10.0f, 20.0f));
+
+    /**
+     * @tc.steps: step1. move the parent, the memoized geometry is reused within the same pass.
+     */
+    parent->GetGeometryNode()->SetFrameOffset(OffsetF(30.0f, 40.0f));
+    child->TriggerOnAreaChangeCallback(1);
+    EXPECT_EQ(changedCount, 1);
+
+    /**
+     * @tc.steps: step2. a new pass picks up the moved parent.
+     */
+    child->TriggerOnAreaChangeCallback(2);
+    EXPECT_EQ(changedCount, 2);
+    EXPECT_EQ(lastOrigin, OffsetF(30.0f, 40.0f));
+    EXPECT_EQ(child->GetWindowGeometry(2).offset, child->GetOffsetRelativeToWindow());
+}
+
+/**
+ * @tc.name: FrameNodeTestNg006
+ * @tc.desc: Test the hit test index returns the children which may contain a point in hit test order
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeTestNg006, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. build the index over a row of children, the third one may be hit anywhere.
+     */
+    HitTestIndex index;
+    std::vector<std::optional<RectF>> bounds;
+    bounds.emplace_back(RectF(0.0f, 0.0f, 100.0f, 100.0f));
+    bounds.emplace_back(RectF(100.0f, 0.0f, 100.0f, 100.0f));
+    bounds.emplace_back(std::nullopt);
+    bounds.emplace_back(RectF(50.0f, 50.0f, 100.0f, 100.0f));
+    index.Build(std::move(bounds));
+    EXPECT_TRUE(index.IsValid());
+
+    /**
+     * @tc.steps: step2. query points inside and outside of the bounds.
+     * @tc.expected: step2. the candidates are the children containing the point and the unbounded one, in order.
+     */
+    std::vector<int32_t> candidates;
+    index.Query(PointF(10.0f, 10.0f), candidates);
+    EXPECT_EQ(candidates, std::vector<int32_t>({ 0, 2 }));
+    candidates.clear();
+    index.Query(PointF(120.0f, 80.0f), candidates);
+    EXPECT_EQ(candidates, std::vector<int32_t>({ 1, 2, 3 }));
+    candidates.clear();
+    index.Query(PointF(500.0f, 500.0f), candidates);
+    EXPECT_EQ(candidates, std::vector<int32_t>({ 2 }));
+
+    /**
+     * @tc.steps: step3. change the geometry.
+     * @tc.expected: step3. the index is stale and only rebuilt once the geometry stays the same.
+     */
+    HitTestIndex::MarkGeometryChanged();
+    EXPECT_FALSE(index.IsValid());
+    EXPECT_FALSE(index.IsGeometryStable());
+    EXPECT_TRUE(index.IsGeometryStable());
+}
+
+/**
+ * @tc.name: FrameNodeTestNg007
+ * @tc.desc: Test touch and axis tests hit the same child with and without the hit test index
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeTestNg007, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. build a node with few children and one with enough children for the index.
+     */
+    std::vector<RefPtr<FrameNode>> fewChildren;
+    auto few = CreateHitTestTree(100, HIT_TEST_COLUMNS, fewChildren);
+    std::vector<RefPtr<FrameNode>> manyChildren;
+    auto many = CreateHitTestTree(200, HIT_TEST_COLUMNS * 5, manyChildren);
+    ASSERT_LT(few->frameChildren_.size(), HitTestIndex::MIN_CHILD_COUNT);
+    ASSERT_GE(many->frameChildren_.size(), HitTestIndex::MIN_CHILD_COUNT);
+
+    /**
+     * @tc.steps: step2. test points twice, the index is built once the geometry stays the same.
+     * @tc.expected: step2. the topmost child containing the point is hit and blocks the ones below it.
+     */
+    for (int32_t round = 0; round < 2; ++round) {
+        for (const auto& [node, children] : { std::make_pair(few, fewChildren), std::make_pair(many, manyChildren) }) {
+            auto cover = static_cast<int32_t>(children.size()) - 1;
+            EXPECT_EQ(TouchTestHit(node, children, PointF(60.0f, 20.0f)), cover);
+            EXPECT_EQ(TouchTestHit(node, children, PointF(160.0f, 20.0f)), 3);
+            EXPECT_EQ(TouchTestHit(node, children, PointF(999.0f, 999.0f)), -1);
+        }
+        EXPECT_EQ(TouchTestHit(many, manyChildren, PointF(375.0f, 225.0f)), 39);
+    }
+    EXPECT_TRUE(few->hitTestIndex_ == nullptr);
+    ASSERT_TRUE(many->hitTestIndex_ != nullptr);
+    EXPECT_TRUE(many->hitTestIndex_->IsValid());
+
+    /**
+     * @tc.steps: step3. reorder the children by z index, the first child is now on top of the cover.
+     * @tc.expected: step3. both paths follow the new order.
+     */
+    for (const auto& [node, children] : { std::make_pair(few, fewChildren), std::make_pair(many, manyChildren) }) {
+        children.front()->GetRenderContext()->UpdateZIndex(2);
+        node->needSyncRenderTree_ = true;
+        node->RebuildRenderContextTree();
+        EXPECT_EQ(TouchTestHit(node, children, PointF(20.0f, 20.0f)), 0);
+        EXPECT_EQ(TouchTestHit(node, children, PointF(60.0f, 20.0f)), static_cast<int32_t>(children.size()) - 1);
+    }
+}
+} // namespace OHOS::Ace::NG
@@ -39,8 +39,12 @@ protected:
     std::pair<std::string, RefPtr<NG::UINode>> OnGetChildByIndex(
         int32_t index, const std::unordered_map<std::string, RefPtr<NG::UINode>>& /* cachedItems */) override
     {
-        return { std::to_string(index),
-            AceType::MakeRefPtr<NG::FrameNode>(V2::TEXT_ETS_TAG, -1, AceType::MakeRefPtr<NG::Pattern>()) };
+        auto key = std::to_string(index);
+        auto recycledNode = TakeRecycledItem(key);
+        if (recycledNode) {
+            return { key, recycledNode };
+        }
+        return { key, AceType::MakeRefPtr<NG::FrameNode>(V2::TEXT_ETS_TAG, -1, AceType::MakeRefPtr<NG::Pattern>()) };
     }
     void OnExpandChildrenOnInitialInNG() override {}
 };
@@ -32,6 +32,7 @@
 #include "core/components_ng/pattern/list/list_model_ng.h"
 #include "core/components_ng/pattern/list/list_position_controller.h"
 #include "core/components_ng/pattern/list/list_pattern.h"
+#include "core/components_ng/pattern/scrollable/item_size_index.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -51,6 +52,7 @@ constexpr int32_t JUMP_INDEX_SPECIAL_CASE1 = -2;
 constexpr int32_t JUMP_INDEX_SPECIAL_CASE2 = 100;
 constexpr float LIST_ITEM_WIDTH = 10.0f;
 constexpr float LIST_ITEM_HEIGHT = 30.0f;
+constexpr int32_t LARGE_ITEM_COUNT = 100000;
 constexpr float LIST_WIDTH_CONSTRAINT_CASE1_VALUE = 70.0f;
 constexpr float LIST_WIDTH_CONSTRAINT_CASE2_VALUE = 60.0f;
 constexpr float LIST_HEIGHT_LIMIT = 200.0f;
@@ -3051,5 +3053,62 @@ HWTEST_F(ListPatternTestNg, ListPositionControllerTest004, TestSize.Level1)
     EXPECT_NE(
         AceType::DynamicCast<ListPattern>(positionController1->scroll_.Upgrade()), nullptr);
 }
-} // namespace OHOS::Ace::NG
 
+/**
+ * @tc.name: ItemSizeIndexTest001
+ * @tc.desc: Test offsets and indexes answered by the item size index of a large list
+ * @tc.type: FUNC
+ */
+HWTEST_F(ListPatternTestNg, ItemSizeIndexTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record the first ten items, item 5 is twice as high as the others.
+     * @tc.expected: step1. the measured items are summed, the others use the average size.
+     */
+    auto sizeIndex = AceType::MakeRefPtr<ItemSizeIndex>();
+    sizeIndex->Reset(LARGE_ITEM_COUNT);
+    for (int32_t index = START_INDEX; index < END_INDEX; index++) {
+        sizeIndex->Update(index, index == JUMP_INDEX ? LIST_ITEM_HEIGHT * 2 : LIST_ITEM_HEIGHT);
+    }
+    float measuredSize = LIST_ITEM_HEIGHT * (END_INDEX + 1);
+    float averageSize = measuredSize / END_INDEX;
+    EXPECT_EQ(sizeIndex->GetMeasuredCount(), END_INDEX);
+    EXPECT_EQ(sizeIndex->GetAverageSize(), averageSize);
+    EXPECT_EQ(sizeIndex->GetOffset(JUMP_INDEX), JUMP_INDEX * LIST_ITEM_HEIGHT);
+    EXPECT_EQ(sizeIndex->GetOffset(JUMP_INDEX + 1), (JUMP_INDEX + 2) * LIST_ITEM_HEIGHT);
+    EXPECT_EQ(sizeIndex->GetOffset(END_INDEX * 2), measuredSize + END_INDEX * averageSize);
+    EXPECT_EQ(sizeIndex->GetTotalSize(), measuredSize + (LARGE_ITEM_COUNT - END_INDEX) * averageSize);
+
+    /**
+     * @tc.steps: step2. query the item at some offsets.
+     * @tc.expected: step2. the item containing the offset is returned, clamped to the item range.
+     */
+    EXPECT_EQ(sizeIndex->GetIndex(-LIST_ITEM_HEIGHT), 0);
+    EXPECT_EQ(sizeIndex->GetIndex(JUMP_INDEX * LIST_ITEM_HEIGHT - 1.0f), JUMP_INDEX - 1);
+    EXPECT_EQ(sizeIndex->GetIndex(JUMP_INDEX * LIST_ITEM_HEIGHT), JUMP_INDEX);
+    EXPECT_EQ(sizeIndex->GetIndex((JUMP_INDEX + 1) * LIST_ITEM_HEIGHT), JUMP_INDEX);
+    EXPECT_EQ(sizeIndex->GetIndex(sizeIndex->GetOffset(END_INDEX * 2)), END_INDEX * 2);
+    EXPECT_EQ(sizeIndex->GetIndex(sizeIndex->GetTotalSize() * 2), LARGE_ITEM_COUNT - 1);
+
+    /**
+     * @tc.steps: step3. remeasure item 5 and shrink the list.
+     * @tc.expected: step3. sizes of the remaining items are kept.
+     */
+    sizeIndex->Update(JUMP_INDEX, LIST_ITEM_HEIGHT);
+    sizeIndex->Resize(END_INDEX * 2);
+    EXPECT_EQ(sizeIndex->GetCount(), END_INDEX * 2);
+    EXPECT_TRUE(sizeIndex->IsMeasured(JUMP_INDEX));
+    EXPECT_FALSE(sizeIndex->IsMeasured(END_INDEX));
+    EXPECT_EQ(sizeIndex->GetTotalSize(), END_INDEX * 2 * LIST_ITEM_HEIGHT);
+
+    /**
+     * @tc.steps: step4. estimate the offset of a list laid out from item 5.
+     * @tc.expected: step4. the estimate offset comes from the size index.
+     */
+    ListLayoutAlgorithm listLayoutAlgorithm;
+    listLayoutAlgorithm.SetSizeIndex(sizeIndex);
+    listLayoutAlgorithm.itemPosition_[JUMP_INDEX] = { 0.0f, LIST_ITEM_HEIGHT, false };
+    listLayoutAlgorithm.CalculateEstimateOffset();
+    EXPECT_EQ(listLayoutAlgorithm.estimateOffset_, JUMP_INDEX * LIST_ITEM_HEIGHT);
+}
+} // namespace OHOS::Ace::NG
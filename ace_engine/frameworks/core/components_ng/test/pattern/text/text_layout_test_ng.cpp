@@ -27,6 +27,7 @@
 #include "core/components_ng/pattern/text/text_model_ng.h"
 #include "core/components_ng/pattern/text/text_pattern.h"
 #include "core/components_ng/render/paragraph.h"
+#include "core/components_ng/render/paragraph_cache.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -45,6 +46,8 @@ constexpr Dimension ADAPT_MIN_FONT_SIZE_VALUE = Dimension(50, DimensionUnit::PX)
 constexpr Dimension ADAPT_MAX_FONT_SIZE_VALUE = Dimension(80, DimensionUnit::PX);
 constexpr Dimension ADAPT_FONT_SIZE_STEP_VALUE = Dimension(10, DimensionUnit::PX);
 const std::string CREATE_VALUE = "Hello World";
+constexpr size_t PARAGRAPH_CACHE_COUNT_LIMIT = 2;
+constexpr size_t PARAGRAPH_CACHE_MEMORY_LIMIT = 1024 * 1024;
 const SizeF CONTAINER_SIZE(RK356_WIDTH, RK356_HEIGHT);
 const SizeF TEXT_SIZE(TEXT_WIDTH, TEXT_HEIGHT);
 
@@ -820,4 +823,109 @@ HWTEST_F(TextLayoutTestNg, DidExceedMaxLines002, TestSize.Level1)
 
     EXPECT_EQ(ret, true);
 }
+
+/**
+ * @tc.name: AdaptMinTextSize001
+ * @tc.desc: Test the adaptive font size search falls back to the min font size and caches its result.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextLayoutTestNg, AdaptMinTextSize001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create textFrameNode and a text style with minFontSize 50px, maxFontSize 80px, step 10px.
+     */
+    auto textFrameNode = FrameNode::CreateFrameNode(V2::TOAST_ETS_TAG, 0, AceType::MakeRefPtr<TextPattern>());
+    EXPECT_FALSE(textFrameNode == nullptr);
+    auto pipeline = textFrameNode->GetContext();
+    LayoutConstraintF parentLayoutConstraint;
+    parentLayoutConstraint.maxSize = CONTAINER_SIZE;
+    TextStyle textStyle;
+    textStyle.SetAdaptTextSize(ADAPT_MAX_FONT_SIZE_VALUE, ADAPT_MIN_FONT_SIZE_VALUE);
+    textStyle.SetAdaptFontSizeStep(ADAPT_FONT_SIZE_STEP_VALUE);
+    auto originStyle = textStyle;
+
+    /**
+     * @tc.steps: step2. search the font size, the mocked paragraph never fits.
+     * @tc.expected: step2. the min font size is used and the search result is cached.
+     */
+    auto textLayoutAlgorithm = AceType::MakeRefPtr<TextLayoutAlgorithm>();
+    auto result = textLayoutAlgorithm->AdaptMinTextSize(textStyle, CREATE_VALUE, parentLayoutConstraint, pipeline);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(textStyle.GetFontSize().Value(), ADAPT_MIN_FONT_SIZE_VALUE.Value());
+    const auto& cache = textLayoutAlgorithm->GetAdaptFontSizeCache();
+    ASSERT_TRUE(cache.has_value());
+    EXPECT_EQ(cache->fontSize, ADAPT_MIN_FONT_SIZE_VALUE.Value());
+    EXPECT_EQ(cache->content, CREATE_VALUE);
+
+    /**
+     * @tc.steps: step3. measure the same text again with the cache of the node.
+     * @tc.expected: step3. the cached font size is used, a different content searches again.
+     */
+    auto cachedAlgorithm = AceType::MakeRefPtr<TextLayoutAlgorithm>();
+    cachedAlgorithm->SetAdaptFontSizeCache(cache);
+    auto cachedStyle = originStyle;
+    result = cachedAlgorithm->AdaptMinTextSize(cachedStyle, CREATE_VALUE, parentLayoutConstraint, pipeline);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(cachedStyle.GetFontSize().Value(), ADAPT_MIN_FONT_SIZE_VALUE.Value());
+    cachedStyle = originStyle;
+    result = cachedAlgorithm->AdaptMinTextSize(cachedStyle, CREATE_VALUE + CREATE_VALUE, parentLayoutConstraint,
+        pipeline);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(cachedAlgorithm->GetAdaptFontSizeCache()->content, CREATE_VALUE + CREATE_VALUE);
+}
+
+/**
+ * @tc.name: ParagraphCache001
+ * @tc.desc: Test the paragraph cache shares equal paragraphs, evicts the least recently used one and counts hits.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextLayoutTestNg, ParagraphCache001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create keys of two texts, the second one laid out with two different widths.
+     */
+    auto& paragraphCache = ParagraphCache::GetInstance();
+    paragraphCache.Clear();
+    paragraphCache.SetCapacity(PARAGRAPH_CACHE_MEMORY_LIMIT, PARAGRAPH_CACHE_COUNT_LIMIT);
+    auto createKey = [](const std::string& content, float width) {
+        ParagraphCacheKey key(ParagraphCacheType::TEXT, ParagraphStyle());
+        key.PushStyle(TextStyle());
+        key.AddText(StringUtils::Str8ToStr16(content));
+        key.AddLayoutConstraint(width);
+        return key;
+    };
+    auto firstKey = createKey(CREATE_VALUE, RK356_WIDTH);
+    auto secondKey = createKey(CREATE_VALUE + CREATE_VALUE, RK356_WIDTH);
+    auto narrowKey = createKey(CREATE_VALUE + CREATE_VALUE, TEXT_WIDTH);
+    EXPECT_TRUE(firstKey == createKey(CREATE_VALUE, RK356_WIDTH));
+    EXPECT_FALSE(secondKey == narrowKey);
+
+    /**
+     * @tc.steps: step2. put two paragraphs and look them up.
+     * @tc.expected: step2. equal keys hit, a key with another width misses.
+     */
+    auto firstParagraph = Paragraph::Create(ParagraphStyle(), FontCollection::Current());
+    auto secondParagraph = Paragraph::Create(ParagraphStyle(), FontCollection::Current());
+    EXPECT_EQ(paragraphCache.GetParagraph(firstKey), nullptr);
+    paragraphCache.PutParagraph(firstKey, firstParagraph);
+    paragraphCache.PutParagraph(secondKey, secondParagraph);
+    EXPECT_EQ(paragraphCache.GetParagraph(firstKey), firstParagraph);
+    EXPECT_EQ(paragraphCache.GetParagraph(narrowKey), nullptr);
+
+    /**
+     * @tc.steps: step3. put a third paragraph into the full cache.
+     * @tc.expected: step3. the least recently used second paragraph is evicted.
+     */
+    paragraphCache.PutParagraph(narrowKey, secondParagraph);
+    EXPECT_EQ(paragraphCache.GetParagraph(secondKey), nullptr);
+    EXPECT_EQ(paragraphCache.GetParagraph(firstKey), firstParagraph);
+    auto statistics = paragraphCache.GetStatistics();
+    EXPECT_EQ(statistics.hitCount, 2);
+    EXPECT_EQ(statistics.missCount, 3);
+    EXPECT_EQ(statistics.evictCount, 1);
+    EXPECT_EQ(statistics.count, PARAGRAPH_CACHE_COUNT_LIMIT);
+    EXPECT_DOUBLE_EQ(statistics.GetHitRate(), 0.4);
+    paragraphCache.SetCapacity(ParagraphCache::DEFAULT_MEMORY_LIMIT, ParagraphCache::DEFAULT_COUNT_LIMIT);
+    paragraphCache.Clear();
+}
 } // namespace OHOS::Ace::NG
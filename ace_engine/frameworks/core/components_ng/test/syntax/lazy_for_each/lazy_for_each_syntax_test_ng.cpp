@@ -50,6 +50,7 @@ constexpr int32_t INDEX_EQUAL_WITH_START_INDEX = 1;
 constexpr int32_t INDEX_EQUAL_WITH_START_INDEX_DELETED = -1;
 constexpr int32_t INDEX_MIDDLE = 3;
 constexpr int32_t INDEX_MIDDLE_2 = 4;
+constexpr size_t RECYCLED_ITEM_COUNT = 5;
 } // namespace
 
 class LazyForEachSyntaxTestNg : public testing::Test {
@@ -507,4 +508,65 @@ HWTEST_F(LazyForEachSyntaxTestNg, ForEachSyntaxWrapperBuilderTest009, TestSize.L
     EXPECT_EQ(parentLayoutWrapper->GetTotalChildCount(), LAZY_FOR_EACH_NODE_IDS.size());
     EXPECT_EQ(lazyLayoutWrapperBuilder->preNodeIds_, LAZY_FOR_EACH_NODE_IDS);
 }
+
+/**
+ * @tc.name: ForEachSyntaxRecycleTest010
+ * @tc.desc: Items which leave the cached range are kept in the recycle cache and reused by key.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachSyntaxTestNg, ForEachSyntaxRecycleTest010, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create LazyForEach and update its items to [0, 6] without cached items.
+     */
+    auto frameNode = AceType::MakeRefPtr<FrameNode>(V2::TEXT_ETS_TAG, -1, AceType::MakeRefPtr<Pattern>());
+    ViewStackProcessor::GetInstance()->Push(frameNode);
+    LazyForEachModelNG lazyForEach;
+    const RefPtr<LazyForEachActuator> mockLazyForEachActuator =
+        AceType::MakeRefPtr<OHOS::Ace::Framework::MockLazyForEachBuilder>();
+    lazyForEach.Create(mockLazyForEachActuator);
+    auto lazyForEachNode = AceType::DynamicCast<LazyForEachNode>(ViewStackProcessor::GetInstance()->Finish());
+    ASSERT_NE(lazyForEachNode, nullptr);
+    auto builder = AceType::DynamicCast<LazyForEachBuilder>(mockLazyForEachActuator);
+    for (auto iter : LAZY_FOR_EACH_NODE_IDS_INT) {
+        builder->CreateChildByIndex(iter.value_or(0));
+    }
+    auto ids = LAZY_FOR_EACH_NODE_IDS;
+    lazyForEachNode->UpdateLazyForEachItems(NEW_START_ID, NEW_END_ID, std::move(ids), {});
+    EXPECT_EQ(builder->GetRecycledItemCount(), 0);
+    auto firstNode = builder->GetChildByKey("0");
+    ASSERT_NE(firstNode, nullptr);
+
+    /**
+     * @tc.steps: step2. Shrink the items to [3, 4].
+     * @tc.expected: The other items are recycled instead of destroyed.
+     */
+    lazyForEachNode->UpdateLazyForEachItems(INDEX_MIDDLE, INDEX_MIDDLE_2, { "3", "4" }, {});
+    EXPECT_EQ(builder->GetRecycledItemCount(), RECYCLED_ITEM_COUNT);
+    EXPECT_EQ(builder->GetChildByKey("0"), nullptr);
+
+    /**
+     * @tc.steps: step3. Create item 0 again.
+     * @tc.expected: The recycled node is reused and leaves the cache.
+     */
+    auto itemInfo = builder->CreateChildByIndex(0);
+    EXPECT_EQ(itemInfo.first, "0");
+    EXPECT_EQ(itemInfo.second, firstNode);
+    EXPECT_EQ(builder->GetRecycledItemCount(), RECYCLED_ITEM_COUNT - 1);
+
+    /**
+     * @tc.steps: step4. Create more items than the cache holds and shrink the items to [3, 4] again, then clean
+     *                   the builder.
+     * @tc.expected: The cache keeps at most its capacity and is emptied by Clean.
+     */
+    for (int32_t index = NEW_END_ID + 1; index <= NEW_END_ID + static_cast<int32_t>(LazyForEachRecycleCache::CAPACITY);
+         ++index) {
+        builder->CreateChildByIndex(index);
+    }
+    lazyForEachNode->UpdateLazyForEachItems(INDEX_MIDDLE, INDEX_MIDDLE_2, { "3", "4" }, {});
+    EXPECT_EQ(builder->GetRecycledItemCount(), LazyForEachRecycleCache::CAPACITY);
+    EXPECT_EQ(builder->GetChildByKey("0"), nullptr);
+    builder->Clean();
+    EXPECT_EQ(builder->GetRecycledItemCount(), 0);
+}
 } // namespace OHOS::Ace::NG
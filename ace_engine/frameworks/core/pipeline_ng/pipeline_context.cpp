@@ -40,6 +40,7 @@
 #include "base/log/frame_report.h"
 #include "base/memory/referenced.h"
 #include "base/thread/task_executor.h"
+#include "base/utils/time_util.h"
 #include "base/utils/utils.h"
 #include "core/animation/scheduler.h"
 #include "core/common/ace_application_info.h"
@@ -68,6 +69,7 @@
 
 namespace {
 constexpr int32_t TIME_THRESHOLD = 2 * 1000000; // 3 millisecond
+constexpr int64_t NANOSECONDS_PER_MILLISECOND = 1000000;
 } // namespace
 
 namespace OHOS::Ace::NG {
@@ -1091,6 +1093,7 @@ void PipelineContext::HandleVisibleAreaChangeEvent()
     if (visibleAreaChangeNodes_.empty()) {
         return;
     }
+    auto geometryPassId = ++windowGeometryPassId_;
     for (auto& visibleChangeNode : visibleAreaChangeNodes_) {
         auto uiNode = ElementRegister::GetInstance()->GetUINodeById(visibleChangeNode.first);
         if (!uiNode) {
@@ -1100,7 +1103,7 @@ void PipelineContext::HandleVisibleAreaChangeEvent()
         if (!frameNode) {
             continue;
         }
-        frameNode->TriggerVisibleAreaChangeCallback(visibleChangeNode.second);
+        frameNode->TriggerVisibleAreaChangeCallback(visibleChangeNode.second, geometryPassId);
     }
 }
 
@@ -1119,6 +1122,7 @@ void PipelineContext::HandleOnAreaChangeEvent()
     if (onAreaChangeNodeIds_.empty()) {
         return;
     }
+    auto geometryPassId = ++windowGeometryPassId_;
     for (const auto& nodeId : onAreaChangeNodeIds_) {
         auto uiNode = ElementRegister::GetInstance()->GetUINodeById(nodeId);
         if (!uiNode) {
@@ -1128,7 +1132,7 @@ void PipelineContext::HandleOnAreaChangeEvent()
         if (!frameNode) {
             continue;
         }
-        frameNode->TriggerOnAreaChangeCallback();
+        frameNode->TriggerOnAreaChangeCallback(geometryPassId);
     }
 }
 
@@ -1398,6 +1402,12 @@ void PipelineContext::OnIdle(int64_t deadline)
     CHECK_RUN_ON(UI);
     ACE_SCOPED_TRACE("OnIdle, targettime:%" PRId64 "", deadline);
     taskScheduler_.FlushPredictTask(deadline - TIME_THRESHOLD);
+    // the rest of the frame is given to the js engine, e.g. for a gc mark slice
+    auto frontend = weakFrontend_.Upgrade();
+    int64_t idleTime = (deadline - TIME_THRESHOLD - GetSysTimestamp()) / NANOSECONDS_PER_MILLISECOND;
+    if (frontend && idleTime > 0) {
+        frontend->NotifyIdleTime(static_cast<int32_t>(idleTime));
+    }
 }
 
 void PipelineContext::Finish(bool /*autoFinish*/) const
@@ -374,6 +374,8 @@ private:
 
     std::unordered_set<int32_t> onAreaChangeNodeIds_;
     std::unordered_map<int32_t, std::list<VisibleCallbackInfo>> visibleAreaChangeNodes_;
+    // bumped for every pass over the nodes above, FrameNode memoizes window geometry per pass
+    uint64_t windowGeometryPassId_ = 0;
 
     RefPtr<StageManager> stageManager_;
     RefPtr<OverlayManager> overlayManager_;
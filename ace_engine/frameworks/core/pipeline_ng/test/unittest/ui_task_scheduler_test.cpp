@@ -12,7 +12,10 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <atomic>
 #include <cstdint>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 // Add the following two macro definitions to test the private and protected method.
@@ -110,4 +113,39 @@ HWTEST_F(UITaskSchedulerTest, UITaskSchedulerTest002, TestSize.Level1)
     uiTaskScheduler.FlushPredictTask(deadlineVal);
     EXPECT_EQ(flagTask, deadlineVal);
 }
+
+/**
+ * @tc.name: UITaskSchedulerTest003
+ * @tc.desc: Test the function ExecuteParallelLayoutTasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UITaskSchedulerTest, UITaskSchedulerTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: initialize background tasks, each of them records its execution and commit.
+     */
+    constexpr int32_t taskCount = 16;
+    std::atomic<int32_t> executedCount { 0 };
+    std::vector<int32_t> commitOrder;
+    std::vector<UITask> tasks;
+    for (int32_t i = 0; i < taskCount; ++i) {
+        UITask task([&executedCount]() { ++executedCount; }, BACKGROUND_TASK);
+        task.SetCommitTask([&commitOrder, &executedCount, i]() {
+            EXPECT_EQ(executedCount.load(), taskCount);
+            commitOrder.emplace_back(i);
+        });
+        tasks.emplace_back(std::move(task));
+    }
+
+    /**
+     * @tc.steps2: Call the function ExecuteParallelLayoutTasks.
+     * @tc.expected: All tasks are executed before any commit, and the commits run in the order of the tasks.
+     */
+    UITaskScheduler::ExecuteParallelLayoutTasks(tasks);
+    EXPECT_EQ(executedCount.load(), taskCount);
+    ASSERT_EQ(static_cast<int32_t>(commitOrder.size()), taskCount);
+    for (int32_t i = 0; i < taskCount; ++i) {
+        EXPECT_EQ(commitOrder[i], i);
+    }
+}
 } // namespace OHOS::Ace::NG
@@ -15,15 +15,58 @@
 
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "base/log/frame_report.h"
 #include "base/memory/referenced.h"
 #include "base/thread/background_task_executor.h"
 #include "base/thread/cancelable_callback.h"
+#include "base/utils/system_properties.h"
 #include "base/utils/utils.h"
+#include "core/common/container_scope.h"
 #include "core/common/thread_checker.h"
 #include "core/components_ng/base/frame_node.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+
+// Shared by the ui thread and the background threads which execute the same batch of layout tasks. Tasks are claimed
+// by index, so a background thread started after all tasks are claimed exits without touching the task list.
+struct ParallelLayoutContext {
+    std::vector<UITask>* tasks = nullptr;
+    size_t total = 0;
+    std::atomic<size_t> next { 0 };
+    size_t finished = 0;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    void Run()
+    {
+        while (true) {
+            auto index = next.fetch_add(1);
+            if (index >= total) {
+                return;
+            }
+            (*tasks)[index]();
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++finished == total) {
+                condition.notify_all();
+            }
+        }
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this]() { return finished == total; });
+    }
+};
+
+} // namespace
 
 UITaskScheduler::~UITaskScheduler() = default;
 
@@ -52,6 +95,8 @@ void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
         FrameReport::GetInstance().BeginFlushRender();
     }
     auto dirtyLayoutNodes = std::move(dirtyLayoutNodes_);
+    bool parallelLayout = !forceUseMainThread && SystemProperties::GetParallelLayoutEnabled();
+    std::vector<UITask> backgroundTasks;
     // Priority task creation
     for (auto&& pageNodes : dirtyLayoutNodes) {
         for (auto&& node : pageNodes.second) {
@@ -65,12 +110,50 @@ void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
             if (task) {
                 if (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK)) {
                     (*task)();
+                } else if (parallelLayout) {
+                    // The layout wrapper tree of each task is built from a different dirty subtree, so the tasks are
+                    // independent of each other and can be measured at the same time.
+                    backgroundTasks.emplace_back(std::move(task.value()));
                 } else {
-                    LOGW("need to use multithread feature");
+                    (*task)();
+                    task->Commit();
                 }
             }
         }
     }
+    ExecuteParallelLayoutTasks(backgroundTasks);
+}
+
+void UITaskScheduler::ExecuteParallelLayoutTasks(std::vector<UITask>& tasks)
+{
+    if (tasks.empty()) {
+        return;
+    }
+    ACE_SCOPED_TRACE("UITaskScheduler::ExecuteParallelLayoutTasks, task size: %zu", tasks.size());
+    if (tasks.size() > 1) {
+        auto context = std::make_shared<ParallelLayoutContext>();
+        context->tasks = &tasks;
+        context->total = tasks.size();
+        auto instanceId = ContainerScope::CurrentId();
+        size_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        size_t helperCount = std::min(tasks.size(), hardwareThreads) - 1;
+        for (size_t i = 0; i < helperCount; ++i) {
+            BackgroundTaskExecutor::GetInstance().PostTask([context, instanceId]() {
+                ContainerScope scope(instanceId);
+                context->Run();
+            });
+        }
+        // The ui thread takes part in the work as well, so the frame never waits for a busy background thread to
+        // pick up a task.
+        context->Run();
+        context->Wait();
+    } else {
+        tasks.front()();
+    }
+    // Mount the results to the ui tree in the same order as the tasks were created.
+    for (const auto& task : tasks) {
+        task.Commit();
+    }
 }
 
 void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
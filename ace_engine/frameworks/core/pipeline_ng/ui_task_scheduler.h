@@ -21,6 +21,7 @@
 #include <list>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
@@ -60,8 +61,23 @@ public:
         }
     }
 
+    // The commit task is always executed on main thread after the task itself has finished, it is used to mount the
+    // results produced by a background task to the ui tree.
+    void SetCommitTask(std::function<void()>&& commitTask)
+    {
+        commitTask_ = std::move(commitTask);
+    }
+
+    void Commit() const
+    {
+        if (commitTask_) {
+            commitTask_();
+        }
+    }
+
 private:
     std::function<void()> task_;
+    std::function<void()> commitTask_;
     TaskThread taskThread_ = MAIN_TASK;
 };
 
@@ -93,6 +109,10 @@ public:
     bool isEmpty();
 
 private:
+    // Run independent layout tasks on background threads together with the calling thread, then commit the results
+    // in order on the calling thread.
+    static void ExecuteParallelLayoutTasks(std::vector<UITask>& tasks);
+
     template<typename T>
     struct NodeCompare {
         bool operator()(const T& nodeLeft, const T& nodeRight) const
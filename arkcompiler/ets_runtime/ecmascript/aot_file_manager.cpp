@@ -50,15 +50,11 @@ using BytecodeStubCSigns = kungfu::BytecodeStubCSigns;
 void ModuleSectionDes::SaveSectionsInfo(std::ofstream &file)
 {
     uint32_t secInfoSize = GetSecInfosSize();
-    uint32_t secSize = 0;
     file.write(reinterpret_cast<char *>(&secInfoSize), sizeof(secInfoSize));
-    std::multimap<std::string, double> SecMap;
     for (auto &s : sectionsInfo_) {
         uint8_t secName = static_cast<uint8_t>(s.first);
         uint32_t curSecSize = GetSecSize(s.first);
         uint64_t curSecAddr = GetSecAddr(s.first);
-        secSize += curSecSize;
-        SecMap.insert(make_pair(GetSecName(s.first), static_cast<double>(curSecSize)));
         file.write(reinterpret_cast<char *>(&secName), sizeof(secName));
         file.write(reinterpret_cast<char *>(&curSecSize), sizeof(curSecSize));
         file.write(reinterpret_cast<char *>(curSecAddr), curSecSize);
@@ -72,6 +68,47 @@ void ModuleSectionDes::SaveSectionsInfo(std::ofstream &file)
     uint32_t cnt = GetFuncCount();
     file.write(reinterpret_cast<char *>(&index), sizeof(index));
     file.write(reinterpret_cast<char *>(&cnt), sizeof(cnt));
+    LogSectionsSize();
+}
+
+void ModuleSectionDes::SaveSectionsData(std::ofstream &file)
+{
+    for (auto &s : sectionsInfo_) {
+        file.write(reinterpret_cast<char *>(GetSecAddr(s.first)), GetSecSize(s.first));
+    }
+    std::shared_ptr<uint8_t> ptr = GetArkStackMapSharePtr();
+    file.write(reinterpret_cast<char *>(ptr.get()), GetArkStackMapSize());
+}
+
+void ModuleSectionDes::SaveSectionsDes(std::ofstream &file)
+{
+    uint32_t secInfoSize = GetSecInfosSize();
+    file.write(reinterpret_cast<char *>(&secInfoSize), sizeof(secInfoSize));
+    for (auto &s : sectionsInfo_) {
+        uint8_t secName = static_cast<uint8_t>(s.first);
+        uint32_t curSecSize = GetSecSize(s.first);
+        file.write(reinterpret_cast<char *>(&secName), sizeof(secName));
+        file.write(reinterpret_cast<char *>(&curSecSize), sizeof(curSecSize));
+    }
+    uint32_t size = GetArkStackMapSize();
+    uint32_t index = GetStartIndex();
+    uint32_t cnt = GetFuncCount();
+    file.write(reinterpret_cast<char *>(&size), sizeof(size));
+    file.write(reinterpret_cast<char *>(&index), sizeof(index));
+    file.write(reinterpret_cast<char *>(&cnt), sizeof(cnt));
+    LogSectionsSize();
+}
+
+void ModuleSectionDes::LogSectionsSize()
+{
+    uint32_t secSize = 0;
+    std::multimap<std::string, double> SecMap;
+    for (auto &s : sectionsInfo_) {
+        uint32_t curSecSize = GetSecSize(s.first);
+        secSize += curSecSize;
+        SecMap.insert(make_pair(GetSecName(s.first), static_cast<double>(curSecSize)));
+    }
+    uint32_t size = GetArkStackMapSize();
     for (auto [key, val] : SecMap) {
         LOG_COMPILER(DEBUG) << key << " size is "
                             << std::fixed << std::setprecision(DECIMAL_LENS)
@@ -83,6 +120,35 @@ void ModuleSectionDes::SaveSectionsInfo(std::ofstream &file)
                         << ", ark stack map size = " << (size / 1_KB) << "KB";
 }
 
+void ModuleSectionDes::LoadSectionsDes(BinaryBufferParser &parser, uint32_t &curUnitOffset, uint64_t codeAddress)
+{
+    uint32_t secInfoSize = 0;
+    parser.ParseBuffer(&secInfoSize, sizeof(secInfoSize));
+    auto secBegin = codeAddress + static_cast<uintptr_t>(curUnitOffset);
+    for (uint32_t i = 0; i < secInfoSize; i++) {
+        uint8_t secName = 0;
+        parser.ParseBuffer(&secName, sizeof(secName));
+        auto secEnumName = static_cast<ElfSecName>(secName);
+        uint32_t secSize = 0;
+        parser.ParseBuffer(&secSize, sizeof(secSize));
+        SetSecSize(secSize, secEnumName);
+        SetSecAddr(secBegin, secEnumName);
+        curUnitOffset += secSize;
+        secBegin += secSize;
+    }
+    uint32_t size = 0;
+    uint32_t index = 0;
+    uint32_t cnt = 0;
+    parser.ParseBuffer(&size, sizeof(size));
+    parser.ParseBuffer(&index, sizeof(index));
+    parser.ParseBuffer(&cnt, sizeof(cnt));
+    SetArkStackMapSize(size);
+    SetArkStackMapPtr(reinterpret_cast<uint8_t *>(secBegin));
+    curUnitOffset += size;
+    SetStartIndex(index);
+    SetFuncCount(cnt);
+}
+
 void ModuleSectionDes::LoadStackMapSection(BinaryBufferParser &parser, uintptr_t secBegin, uint32_t &curUnitOffset)
 {
     uint32_t size = 0;
@@ -257,8 +323,15 @@ void AnFileInfo::Save(const std::string &filename, kungfu::Triple triple)
     file.write(reinterpret_cast<char *>(&moduleNum), sizeof(moduleNum_));
     file.write(reinterpret_cast<char *>(&totalCodeSize_), sizeof(totalCodeSize_));
     LOG_COMPILER(DEBUG) << "total code size = " << (totalCodeSize_ / 1_KB) << "KB";
+    // the code is aligned in the file, so loading can map it instead of copying it
+    auto offset = static_cast<uint64_t>(file.tellp());
+    std::vector<char> padding(AlignUp(offset, CODE_ALIGNMENT) - offset, 0);
+    file.write(padding.data(), padding.size());
     for (size_t i = 0; i < moduleNum; i++) {
-        des_[i].SaveSectionsInfo(file);
+        des_[i].SaveSectionsData(file);
+    }
+    for (size_t i = 0; i < moduleNum; i++) {
+        des_[i].SaveSectionsDes(file);
     }
     file.close();
 }
@@ -323,11 +396,27 @@ bool AnFileInfo::Load(const std::string &filename)
     }
 
     file.read(reinterpret_cast<char *>(&header_), sizeof(Elf64_Ehdr));
+    file.close();
     if (!VerifyELFHeader(header_, base::FileHeader::ToVersionNumber(AOTFileVersion::AN_VERSION))) {
-        file.close();
         return false;
     }
 
+    bool streamed = VerifyELFHeader(header_,
+                                    base::FileHeader::ToVersionNumber(AOTFileVersion::STREAMED_AN_VERSION), true);
+    bool loaded = streamed ? LoadStreamed(realPath) : LoadMapped(realPath);
+    if (!loaded) {
+        return false;
+    }
+    RelocateEntries();
+    LOG_COMPILER(INFO) << "loaded an file: " << filename.c_str();
+    isLoad_ = true;
+    return true;
+}
+
+bool AnFileInfo::LoadStreamed(const std::string &realPath)
+{
+    std::ifstream file(realPath.c_str(), std::ofstream::binary);
+    file.seekg(sizeof(Elf64_Ehdr));
     file.read(reinterpret_cast<char *>(&entryNum_), sizeof(entryNum_));
     entries_.resize(entryNum_);
     file.read(reinterpret_cast<char *>(entries_.data()), sizeof(FuncEntryDes) * entryNum_);
@@ -346,7 +435,77 @@ bool AnFileInfo::Load(const std::string &filename)
     for (size_t i = 0; i < moduleNum_; i++) {
         des_[i].LoadSectionsInfo(file, curUnitOffset, codeAddress);
     }
+    file.close();
+    return true;
+}
 
+bool AnFileInfo::LoadMapped(const std::string &realPath, bool mapExecutable)
+{
+    // code pages are shared with other processes mapping the same file and only read when first executed.
+    // A mount which forbids executable mappings still gets a private copy of the code.
+    MemMap fileMap;
+    bool executable = false;
+    if (mapExecutable) {
+        fileMap = FileMap(realPath.c_str(), FILE_RDONLY, PAGE_PROT_EXEC_READ);
+        executable = fileMap.GetOriginAddr() != nullptr;
+    }
+    if (!executable) {
+        fileMap = FileMap(realPath.c_str(), FILE_RDONLY, PAGE_PROT_READ);
+        if (fileMap.GetOriginAddr() == nullptr) {
+            LOG_COMPILER(INFO) << "Fail to load an file: " << realPath.c_str();
+            return false;
+        }
+    }
+    auto fileBegin = reinterpret_cast<uint8_t *>(fileMap.GetOriginAddr());
+    BinaryBufferParser parser(fileBegin, fileMap.GetSize());
+    parser.ParseBuffer(&header_, sizeof(Elf64_Ehdr));
+    parser.ParseBuffer(&entryNum_, sizeof(entryNum_));
+    entries_.resize(entryNum_);
+    if (entryNum_ > 0) {
+        parser.ParseBuffer(entries_.data(), sizeof(FuncEntryDes) * entryNum_);
+    }
+    parser.ParseBuffer(&moduleNum_, sizeof(moduleNum_));
+    des_.resize(moduleNum_);
+    parser.ParseBuffer(&totalCodeSize_, sizeof(totalCodeSize_));
+
+    uint64_t codeOffset = AlignUp(static_cast<uint64_t>(parser.GetOffset()), CODE_ALIGNMENT);
+    uint64_t desOffset = codeOffset + totalCodeSize_;
+    if (totalCodeSize_ == 0 || desOffset > parser.GetLength()) {
+        FileUnMap(fileMap);
+        LOG_COMPILER(ERROR) << "error: code in the an file is empty or truncated!";
+        return false;
+    }
+
+    uint64_t codeAddress = 0;
+    if (executable) {
+        exeMem_.addr_ = fileMap.GetOriginAddr();
+        exeMem_.size_ = fileMap.GetSize();
+        exeMem_.fileMapped_ = true;
+        codeAddress = reinterpret_cast<uint64_t>(fileBegin + codeOffset);
+    } else {
+        ExecutedMemoryAllocator::AllocateBuf(totalCodeSize_, exeMem_);
+        parser.ParseBuffer(reinterpret_cast<uint8_t *>(exeMem_.addr_), totalCodeSize_, fileBegin + codeOffset);
+        codeAddress = reinterpret_cast<uint64_t>(exeMem_.addr_);
+    }
+
+    BinaryBufferParser desParser(fileBegin + desOffset, parser.GetLength() - desOffset);
+    uint32_t curUnitOffset = 0;
+    for (size_t i = 0; i < moduleNum_; i++) {
+        des_[i].LoadSectionsDes(desParser, curUnitOffset, codeAddress);
+    }
+    if (!executable) {
+        FileUnMap(fileMap);
+    }
+    if (curUnitOffset != totalCodeSize_) {
+        Destroy();
+        LOG_COMPILER(ERROR) << "error: sections of the an file do not match its code size!";
+        return false;
+    }
+    return true;
+}
+
+void AnFileInfo::RelocateEntries()
+{
     for (size_t i = 0; i < entries_.size(); i++) {
         FuncEntryDes& funcDes = entries_[i];
         auto moduleDes = des_[funcDes.moduleIndex_];
@@ -359,10 +518,6 @@ bool AnFileInfo::Load(const std::string &filename)
 #endif
         }
     }
-
-    LOG_COMPILER(INFO) << "loaded an file: " << filename.c_str();
-    isLoad_ = true;
-    return true;
 }
 
 void AnFileInfo::Destroy()
@@ -19,8 +19,13 @@
 #include "ecmascript/deoptimizer/calleeReg.h"
 #include "ecmascript/js_function.h"
 #include "ecmascript/js_runtime_options.h"
+#include "ecmascript/platform/file.h"
 #include "ecmascript/stackmap/ark_stackmap.h"
 
+namespace panda::test {
+class AOTFileManagerTest;
+}  // namespace panda::test
+
 namespace panda::ecmascript {
 class JSpandafile;
 class JSThread;
@@ -32,6 +37,16 @@ public:
     void ParseBuffer(void *dst, uint32_t count);
     void ParseBuffer(uint8_t *dst, uint32_t count, uint8_t *src);
 
+    uint32_t GetOffset() const
+    {
+        return offset_;
+    }
+
+    uint32_t GetLength() const
+    {
+        return length_;
+    }
+
 private:
     uint8_t *buffer_ {nullptr};
     uint32_t length_ {0};
@@ -43,6 +58,8 @@ public:
     struct ExeMem {
         void *addr_ {nullptr};
         size_t size_ {0};
+        // addr_ is a mapping of the whole '.an' file, the code is executed in place
+        bool fileMapped_ {false};
     };
 
     static void AllocateBuf(uint32_t size, ExeMem &exeMem) {
@@ -53,9 +70,14 @@ public:
 
     static void DestoryBuf(ExeMem &exeMem) {
         if (exeMem.addr_ != nullptr) {
-            MachineCodePageUnmap(MemMap(exeMem.addr_, exeMem.size_));
+            if (exeMem.fileMapped_) {
+                FileUnMap(MemMap(exeMem.addr_, exeMem.size_));
+            } else {
+                MachineCodePageUnmap(MemMap(exeMem.addr_, exeMem.size_));
+            }
             exeMem.addr_ = nullptr;
             exeMem.size_ = 0;
+            exeMem.fileMapped_ = false;
         }
     }
 };
@@ -194,6 +216,10 @@ struct ModuleSectionDes {
     }
 
     void SaveSectionsInfo(std::ofstream &file);
+    // the mapped '.an' layout keeps the section contents apart from their names and sizes
+    void SaveSectionsData(std::ofstream &file);
+    void SaveSectionsDes(std::ofstream &file);
+    void LoadSectionsDes(BinaryBufferParser &parser, uint32_t &curUnitOffset, uint64_t codeAddress);
     void LoadSectionsInfo(BinaryBufferParser &parser, uint32_t &curUnitOffset,
         uint64_t codeAddress);
     void LoadStackMapSection(BinaryBufferParser &parser, uintptr_t secBegin, uint32_t &curUnitOffset);
@@ -202,6 +228,8 @@ struct ModuleSectionDes {
     void LoadStackMapSection(std::ifstream &file, uintptr_t secBegin, uint32_t &curUnitOffset);
 
 private:
+    void LogSectionsSize();
+
     static constexpr int DECIMAL_LENS = 2;
     static constexpr int HUNDRED_TIME = 100;
     static constexpr int PERCENT_LENS = 4;
@@ -390,13 +418,21 @@ public:
     }
 
 private:
+    // the code of an '.an' file starts at this file offset alignment, so it keeps the alignment it had in memory
+    static constexpr uint32_t CODE_ALIGNMENT = 4_KB;
+
     bool Load(const std::string &filename);
+    bool LoadStreamed(const std::string &realPath);
+    // mapExecutable false copies the code out of a read-only mapping, as when executable mappings are refused.
+    bool LoadMapped(const std::string &realPath, bool mapExecutable = true);
+    void RelocateEntries();
     bool RewriteRelcateTextSection(const char* symbol, uintptr_t patchAddr);
     std::unordered_map<uint32_t, uint64_t> mainEntryMap_ {};
     bool isLoad_ {false};
     Elf64_Ehdr header_;
 
     friend class AnFileDataManager;
+    friend class test::AOTFileManagerTest;
 };
 
 class PUBLIC_API StubFileInfo : public AOTFileInfo {
@@ -20,7 +20,9 @@
 namespace panda::ecmascript {
 class AOTFileVersion {
 public:
-    static constexpr base::FileHeader::VersionType AN_VERSION = {0, 0, 0, 2};
+    static constexpr base::FileHeader::VersionType AN_VERSION = {0, 0, 0, 3};
+    // '.an' files up to this version interleave the code with its description and are read into anonymous memory
+    static constexpr base::FileHeader::VersionType STREAMED_AN_VERSION = {0, 0, 0, 2};
     static constexpr base::FileHeader::VersionType REWRITE_RELOCATE_AN_VERSION = {0, 0, 0, 1};
     static constexpr base::FileHeader::VersionType AI_VERSION = {0, 0, 0, 1};
 };
@@ -366,7 +366,8 @@ JSTaggedValue JsonStringifier::SerializeJSONProperty(const JSHandle<JSTaggedValu
                 return tagValue;
             }
             // If Type(value) is String, return QuoteJSONString(value).
-            case JSType::STRING: {
+            case JSType::STRING:
+            case JSType::TREE_STRING: {
                 CString str = ConvertToString(*JSHandle<EcmaString>(valHandle), StringConvertedUsage::LOGICOPERATION);
                 str = ValueToQuotedString(str);
                 result_ += str;
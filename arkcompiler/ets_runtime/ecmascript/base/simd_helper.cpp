@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/base/simd_helper.h"
+
+#include "libpandabase/cpu_features.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace panda::ecmascript::base::simd_helper {
+namespace {
+constexpr uint8_t ASCII_MAX = 0x7F;
+
+bool IsCompressible(uint16_t unit)
+{
+    // \0 is not compressed, see EcmaString::IsASCIICharacter
+    return static_cast<uint16_t>(unit - 1U) < ASCII_MAX;
+}
+
+template<typename T>
+size_t ScalarCompressiblePrefix(const T *data, size_t len)
+{
+    size_t i = 0;
+    while (i < len && IsCompressible(data[i])) {
+        i++;
+    }
+    return i;
+}
+
+size_t ScalarAsciiPrefix(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+    while (i < len && data[i] <= ASCII_MAX) {
+        i++;
+    }
+    return i;
+}
+
+template<typename T1, typename T2>
+size_t ScalarMismatch(const T1 *lhs, const T2 *rhs, size_t len)
+{
+    size_t i = 0;
+    while (i < len && static_cast<uint16_t>(lhs[i]) == static_cast<uint16_t>(rhs[i])) {
+        i++;
+    }
+    return i;
+}
+
+template<typename T>
+size_t ScalarFindChar(const T *data, size_t len, T c)
+{
+    size_t i = 0;
+    while (i < len && data[i] != c) {
+        i++;
+    }
+    return i;
+}
+
+#if defined(__SSE2__)
+constexpr size_t VECTOR_SIZE = sizeof(__m128i);
+constexpr uint32_t FULL_MASK = 0xFFFF;
+
+inline __m128i Load(const void *data)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+}
+
+inline void Store(void *data, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data), value);
+}
+
+// index of the first byte whose bit is clear in a _mm_movemask_epi8 result
+inline size_t FirstClear(uint32_t mask)
+{
+    return static_cast<size_t>(__builtin_ctz(~mask));
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_HELPER_AVX2 1  // NOLINT(cppcoreguidelines-macro-usage)
+constexpr size_t AVX2_VECTOR_SIZE = sizeof(__m256i);
+const bool HAS_AVX2 = panda::compiler::CpuFeaturesHasAvx2();
+
+__attribute__((target("avx2"))) size_t Avx2CompressiblePrefix(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    for (; i + AVX2_VECTOR_SIZE <= len; i += AVX2_VECTOR_SIZE) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        // bytes in [1, 0x7F] are exactly the positive ones
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(value, zero)));
+        if (mask != UINT32_MAX) {
+            return i + static_cast<size_t>(__builtin_ctz(~mask));
+        }
+    }
+    return i + ScalarCompressiblePrefix(data + i, len - i);
+}
+
+__attribute__((target("avx2"))) size_t Avx2CompressiblePrefix(const uint16_t *data, size_t len)
+{
+    size_t i = 0;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i limit = _mm256_set1_epi16(ASCII_MAX + 1);
+    constexpr size_t units = AVX2_VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        // units above 0x7FFF are negative as int16 and fail the first compare
+        __m256i inRange = _mm256_and_si256(_mm256_cmpgt_epi16(value, zero), _mm256_cmpgt_epi16(limit, value));
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(inRange));
+        if (mask != UINT32_MAX) {
+            return i + static_cast<size_t>(__builtin_ctz(~mask)) / sizeof(uint16_t);
+        }
+    }
+    return i + ScalarCompressiblePrefix(data + i, len - i);
+}
+
+__attribute__((target("avx2"))) size_t Avx2AsciiPrefix(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+    for (; i + AVX2_VECTOR_SIZE <= len; i += AVX2_VECTOR_SIZE) {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+        auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(value));
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+    return i + ScalarAsciiPrefix(data + i, len - i);
+}
+#endif
+#elif defined(__aarch64__)
+constexpr size_t VECTOR_SIZE = sizeof(uint8x16_t);
+constexpr uint8_t TRUE_BYTE = 0xFF;
+constexpr uint16_t TRUE_HALF = 0xFFFF;
+#endif
+}  // namespace
+
+size_t CompressiblePrefix(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+#if defined(SIMD_HELPER_AVX2)
+    if (HAS_AVX2) {
+        return Avx2CompressiblePrefix(data, len);
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(Load(data + i), zero)));
+        if (mask != FULL_MASK) {
+            return i + FirstClear(mask);
+        }
+    }
+#elif defined(__aarch64__)
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        int8x16_t value = vreinterpretq_s8_u8(vld1q_u8(data + i));
+        if (vminvq_u8(vcgtzq_s8(value)) != TRUE_BYTE) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarCompressiblePrefix(data + i, len - i);
+}
+
+size_t CompressiblePrefix(const uint16_t *data, size_t len)
+{
+    size_t i = 0;
+#if defined(SIMD_HELPER_AVX2)
+    if (HAS_AVX2) {
+        return Avx2CompressiblePrefix(data, len);
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i limit = _mm_set1_epi16(ASCII_MAX + 1);
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        __m128i value = Load(data + i);
+        __m128i inRange = _mm_and_si128(_mm_cmpgt_epi16(value, zero), _mm_cmplt_epi16(value, limit));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(inRange));
+        if (mask != FULL_MASK) {
+            return i + FirstClear(mask) / sizeof(uint16_t);
+        }
+    }
+#elif defined(__aarch64__)
+    const uint16x8_t one = vdupq_n_u16(1);
+    const uint16x8_t limit = vdupq_n_u16(ASCII_MAX);
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        uint16x8_t value = vld1q_u16(data + i);
+        if (vminvq_u16(vcltq_u16(vsubq_u16(value, one), limit)) != TRUE_HALF) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarCompressiblePrefix(data + i, len - i);
+}
+
+size_t AsciiPrefix(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+#if defined(SIMD_HELPER_AVX2)
+    if (HAS_AVX2) {
+        return Avx2AsciiPrefix(data, len);
+    }
+#endif
+#if defined(__SSE2__)
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(Load(data + i)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+#elif defined(__aarch64__)
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        if (vmaxvq_u8(vld1q_u8(data + i)) > ASCII_MAX) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarAsciiPrefix(data + i, len - i);
+}
+
+void WidenCopy(uint16_t *dst, const uint8_t *src, size_t len)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        __m128i value = Load(src + i);
+        Store(dst + i, _mm_unpacklo_epi8(value, zero));
+        Store(dst + i + VECTOR_SIZE / sizeof(uint16_t), _mm_unpackhi_epi8(value, zero));
+    }
+#elif defined(__aarch64__)
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        uint8x16_t value = vld1q_u8(src + i);
+        vst1q_u16(dst + i, vmovl_u8(vget_low_u8(value)));
+        vst1q_u16(dst + i + VECTOR_SIZE / sizeof(uint16_t), vmovl_high_u8(value));
+    }
+#endif
+    for (; i < len; i++) {
+        dst[i] = src[i];
+    }
+}
+
+void NarrowCopy(uint8_t *dst, const uint16_t *src, size_t len)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i lowByte = _mm_set1_epi16(0xFF);
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        // clear the high bytes first, the saturating pack then keeps the low bytes unchanged
+        __m128i low = _mm_and_si128(Load(src + i), lowByte);
+        __m128i high = _mm_and_si128(Load(src + i + VECTOR_SIZE / sizeof(uint16_t)), lowByte);
+        Store(dst + i, _mm_packus_epi16(low, high));
+    }
+#elif defined(__aarch64__)
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        uint8x8_t low = vmovn_u16(vld1q_u16(src + i));
+        vst1q_u8(dst + i, vmovn_high_u16(low, vld1q_u16(src + i + VECTOR_SIZE / sizeof(uint16_t))));
+    }
+#endif
+    for (; i < len; i++) {
+        dst[i] = static_cast<uint8_t>(src[i]);
+    }
+}
+
+size_t FindChar(const uint8_t *data, size_t len, uint8_t c)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i target = _mm_set1_epi8(static_cast<char>(c));
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Load(data + i), target)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(mask));
+        }
+    }
+#elif defined(__aarch64__)
+    const uint8x16_t target = vdupq_n_u8(c);
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        if (vmaxvq_u8(vceqq_u8(vld1q_u8(data + i), target)) != 0) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarFindChar(data + i, len - i, c);
+}
+
+size_t FindChar(const uint16_t *data, size_t len, uint16_t c)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i target = _mm_set1_epi16(static_cast<int16_t>(c));
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(Load(data + i), target)));
+        if (mask != 0) {
+            return i + static_cast<size_t>(__builtin_ctz(mask)) / sizeof(uint16_t);
+        }
+    }
+#elif defined(__aarch64__)
+    const uint16x8_t target = vdupq_n_u16(c);
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        if (vmaxvq_u16(vceqq_u16(vld1q_u16(data + i), target)) != 0) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarFindChar(data + i, len - i, c);
+}
+
+size_t Mismatch(const uint8_t *lhs, const uint8_t *rhs, size_t len)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Load(lhs + i), Load(rhs + i))));
+        if (mask != FULL_MASK) {
+            return i + FirstClear(mask);
+        }
+    }
+#elif defined(__aarch64__)
+    for (; i + VECTOR_SIZE <= len; i += VECTOR_SIZE) {
+        if (vminvq_u8(vceqq_u8(vld1q_u8(lhs + i), vld1q_u8(rhs + i))) != TRUE_BYTE) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarMismatch(lhs + i, rhs + i, len - i);
+}
+
+size_t Mismatch(const uint16_t *lhs, const uint16_t *rhs, size_t len)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(Load(lhs + i), Load(rhs + i))));
+        if (mask != FULL_MASK) {
+            return i + FirstClear(mask) / sizeof(uint16_t);
+        }
+    }
+#elif defined(__aarch64__)
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        if (vminvq_u16(vceqq_u16(vld1q_u16(lhs + i), vld1q_u16(rhs + i))) != TRUE_HALF) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarMismatch(lhs + i, rhs + i, len - i);
+}
+
+size_t Mismatch(const uint8_t *lhs, const uint16_t *rhs, size_t len)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        __m128i wide = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(lhs + i)), zero);
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi16(wide, Load(rhs + i))));
+        if (mask != FULL_MASK) {
+            return i + FirstClear(mask) / sizeof(uint16_t);
+        }
+    }
+#elif defined(__aarch64__)
+    constexpr size_t units = VECTOR_SIZE / sizeof(uint16_t);
+    for (; i + units <= len; i += units) {
+        uint16x8_t wide = vmovl_u8(vld1_u8(lhs + i));
+        if (vminvq_u16(vceqq_u16(wide, vld1q_u16(rhs + i))) != TRUE_HALF) {
+            break;
+        }
+    }
+#endif
+    return i + ScalarMismatch(lhs + i, rhs + i, len - i);
+}
+}  // namespace panda::ecmascript::base::simd_helper
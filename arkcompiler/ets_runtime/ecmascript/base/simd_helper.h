@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_BASE_SIMD_HELPER_H
+#define ECMASCRIPT_BASE_SIMD_HELPER_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Kernels over raw utf8 / utf16 code units. They use SSE2 on x86-64, and AVX2 for the scans when the cpu has it,
+// NEON on aarch64 and plain loops on the other targets.
+namespace panda::ecmascript::base::simd_helper {
+// number of leading code units in [1, 0x7F], the range EcmaString stores compressed
+size_t CompressiblePrefix(const uint8_t *data, size_t len);
+size_t CompressiblePrefix(const uint16_t *data, size_t len);
+
+// number of leading bytes below 0x80, each of them is a whole utf8 character
+size_t AsciiPrefix(const uint8_t *data, size_t len);
+
+// zero extends every byte
+void WidenCopy(uint16_t *dst, const uint8_t *src, size_t len);
+// keeps the low byte of every code unit
+void NarrowCopy(uint8_t *dst, const uint16_t *src, size_t len);
+
+// index of the first code unit equal to c, len if there is none
+size_t FindChar(const uint8_t *data, size_t len, uint8_t c);
+size_t FindChar(const uint16_t *data, size_t len, uint16_t c);
+
+// index of the first position where the code units differ, len if all of them are equal
+size_t Mismatch(const uint8_t *lhs, const uint8_t *rhs, size_t len);
+size_t Mismatch(const uint16_t *lhs, const uint16_t *rhs, size_t len);
+size_t Mismatch(const uint8_t *lhs, const uint16_t *rhs, size_t len);
+
+inline size_t Mismatch(const uint16_t *lhs, const uint8_t *rhs, size_t len)
+{
+    return Mismatch(rhs, lhs, len);
+}
+
+// hash = hash * 31 + unit for every unit. Four units are folded per step, so the multiplications do not wait
+// for each other.
+template<typename T>
+uint32_t ComputeHash(const T *data, size_t len, uint32_t hash)
+{
+    constexpr uint32_t FACTOR = 31;
+    constexpr uint32_t FACTOR_2 = FACTOR * FACTOR;
+    constexpr uint32_t FACTOR_3 = FACTOR_2 * FACTOR;
+    constexpr uint32_t FACTOR_4 = FACTOR_3 * FACTOR;
+    constexpr size_t STEP = 4;
+    size_t i = 0;
+    for (; i + STEP <= len; i += STEP) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        hash = hash * FACTOR_4 + data[i] * FACTOR_3 + data[i + 1] * FACTOR_2 + data[i + 2] * FACTOR + data[i + 3];
+    }
+    for (; i < len; i++) {
+        hash = hash * FACTOR + data[i];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return hash;
+}
+}  // namespace panda::ecmascript::base::simd_helper
+#endif  // ECMASCRIPT_BASE_SIMD_HELPER_H
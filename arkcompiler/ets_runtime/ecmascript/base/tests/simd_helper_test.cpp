@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/base/simd_helper.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+using namespace panda::ecmascript::base;
+
+namespace panda::test {
+// long enough to go through the wide blocks and the scalar tail
+static constexpr size_t MAX_LENGTH = 70;
+
+class SimdHelperTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+/*
+ * @tc.name: CompressiblePrefix
+ * @tc.desc: Put a code unit outside [1, 0x7F] at every position of ascii data of every length, and check that
+ *           the prefix stops exactly there.
+ * @tc.type: FUNC
+ */
+HWTEST_F_L0(SimdHelperTest, CompressiblePrefix)
+{
+    std::vector<uint8_t> bytes(MAX_LENGTH, 'a');
+    std::vector<uint16_t> units(MAX_LENGTH, 'a');
+    for (size_t len = 0; len <= MAX_LENGTH; len++) {
+        EXPECT_EQ(simd_helper::CompressiblePrefix(bytes.data(), len), len);
+        EXPECT_EQ(simd_helper::CompressiblePrefix(units.data(), len), len);
+        EXPECT_EQ(simd_helper::AsciiPrefix(bytes.data(), len), len);
+        for (size_t pos = 0; pos < len; pos++) {
+            for (uint16_t bad : {0x0, 0x80, 0xFF}) {
+                bytes[pos] = static_cast<uint8_t>(bad);
+                EXPECT_EQ(simd_helper::CompressiblePrefix(bytes.data(), len), pos);
+                EXPECT_EQ(simd_helper::AsciiPrefix(bytes.data(), len), bad == 0 ? len : pos);
+                bytes[pos] = 'a';
+            }
+            for (uint16_t bad : {0x0, 0x80, 0x100, 0xFFFF}) {
+                units[pos] = bad;
+                EXPECT_EQ(simd_helper::CompressiblePrefix(units.data(), len), pos);
+                units[pos] = 'a';
+            }
+        }
+    }
+}
+
+/*
+ * @tc.name: WidenCopy_NarrowCopy
+ * @tc.desc: Copy between utf8 and utf16 buffers of every length, and check that nothing after the copied range
+ *           is written.
+ * @tc.type: FUNC
+ */
+HWTEST_F_L0(SimdHelperTest, WidenCopy_NarrowCopy)
+{
+    constexpr uint16_t GUARD = 0xABCD;
+    std::vector<uint8_t> bytes(MAX_LENGTH);
+    std::vector<uint16_t> units(MAX_LENGTH);
+    for (size_t i = 0; i < MAX_LENGTH; i++) {
+        bytes[i] = static_cast<uint8_t>(i * 7 + 0x70);
+        units[i] = static_cast<uint16_t>(i * 0x301 + 0x70);
+    }
+    for (size_t len = 0; len < MAX_LENGTH; len++) {
+        std::vector<uint16_t> wide(MAX_LENGTH, GUARD);
+        simd_helper::WidenCopy(wide.data(), bytes.data(), len);
+        std::vector<uint8_t> narrow(MAX_LENGTH, static_cast<uint8_t>(GUARD));
+        simd_helper::NarrowCopy(narrow.data(), units.data(), len);
+        for (size_t i = 0; i < len; i++) {
+            EXPECT_EQ(wide[i], bytes[i]);
+            EXPECT_EQ(narrow[i], static_cast<uint8_t>(units[i]));
+        }
+        EXPECT_EQ(wide[len], GUARD);
+        EXPECT_EQ(narrow[len], static_cast<uint8_t>(GUARD));
+    }
+}
+
+/*
+ * @tc.name: FindChar_Mismatch
+ * @tc.desc: Put the searched or differing code unit at every position, and check the returned index. A utf16
+ *           unit whose low byte matches must not be taken as equal to the utf8 unit.
+ * @tc.type: FUNC
+ */
+HWTEST_F_L0(SimdHelperTest, FindChar_Mismatch)
+{
+    for (size_t len = 0; len <= MAX_LENGTH; len++) {
+        std::vector<uint8_t> lhs8(len, 'x');
+        std::vector<uint8_t> rhs8(len, 'x');
+        std::vector<uint16_t> lhs16(len, 'x');
+        std::vector<uint16_t> rhs16(len, 'x');
+        EXPECT_EQ(simd_helper::FindChar(lhs8.data(), len, static_cast<uint8_t>('y')), len);
+        EXPECT_EQ(simd_helper::FindChar(lhs16.data(), len, static_cast<uint16_t>('y')), len);
+        EXPECT_EQ(simd_helper::Mismatch(lhs8.data(), rhs8.data(), len), len);
+        EXPECT_EQ(simd_helper::Mismatch(lhs16.data(), rhs16.data(), len), len);
+        EXPECT_EQ(simd_helper::Mismatch(lhs8.data(), rhs16.data(), len), len);
+        for (size_t pos = 0; pos < len; pos++) {
+            lhs8[pos] = 'y';
+            lhs16[pos] = 'y';
+            rhs16[pos] = 0x100 + 'x';
+            EXPECT_EQ(simd_helper::FindChar(lhs8.data(), len, static_cast<uint8_t>('y')), pos);
+            EXPECT_EQ(simd_helper::FindChar(lhs16.data(), len, static_cast<uint16_t>('y')), pos);
+            EXPECT_EQ(simd_helper::Mismatch(lhs8.data(), rhs8.data(), len), pos);
+            EXPECT_EQ(simd_helper::Mismatch(lhs16.data(), rhs16.data(), len), pos);
+            EXPECT_EQ(simd_helper::Mismatch(rhs8.data(), rhs16.data(), len), pos);
+            EXPECT_EQ(simd_helper::Mismatch(rhs16.data(), rhs8.data(), len), pos);
+            lhs8[pos] = 'x';
+            lhs16[pos] = 'x';
+            rhs16[pos] = 'x';
+        }
+    }
+}
+
+/*
+ * @tc.name: ComputeHash
+ * @tc.desc: Check that the unrolled hash gives the same value as hash = hash * 31 + unit.
+ * @tc.type: FUNC
+ */
+HWTEST_F_L0(SimdHelperTest, ComputeHash)
+{
+    std::vector<uint16_t> units(MAX_LENGTH);
+    for (size_t i = 0; i < MAX_LENGTH; i++) {
+        units[i] = static_cast<uint16_t>(i * 0x1F3 + 1);
+    }
+    for (size_t len = 0; len <= MAX_LENGTH; len++) {
+        uint32_t expected = 0;
+        for (size_t i = 0; i < len; i++) {
+            expected = expected * 31 + units[i];  // 31: hash factor
+        }
+        EXPECT_EQ(simd_helper::ComputeHash(units.data(), len, 0), expected);
+    }
+}
+}  // namespace panda::test
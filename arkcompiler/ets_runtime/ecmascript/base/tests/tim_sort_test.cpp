@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "ecmascript/base/builtins_base.h"
+#include "ecmascript/base/tim_sort.h"
+#include "ecmascript/ecma_string-inl.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/js_function.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tagged_array-inl.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+using namespace panda::ecmascript::base;
+
+namespace panda::test {
+class TimSortTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+
+    class TestClass : public base::BuiltinsBase {
+    public:
+        // Items are encoded as key * KEY_SCALE + original index, only the key is compared.
+        static JSTaggedValue CompareByKey(EcmaRuntimeCallInfo *argv)
+        {
+            int32_t x = GetCallArg(argv, 0)->GetInt() / KEY_SCALE;
+            int32_t y = GetCallArg(argv, 1)->GetInt() / KEY_SCALE;
+            return GetTaggedInt(x - y);
+        }
+    };
+
+    static constexpr int32_t KEY_SCALE = 10000;
+};
+
+/**
+ * @tc.name: CompareIntAsString
+ * @tc.desc: Check that ints are ordered as their decimal strings would be.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TimSortTest, CompareIntAsString)
+{
+    std::vector<int32_t> values = {0, 1, -1, 9, 10, -10, 12, 120, 123, 13, 100, -2, -12, -123,
+                                   INT32_MAX, INT32_MIN, INT32_MAX - 1, 2147483, 1000000000};
+    for (int32_t x : values) {
+        for (int32_t y : values) {
+            int32_t expected = std::to_string(x).compare(std::to_string(y));
+            int32_t result = TimSort::CompareIntAsString(x, y);
+            EXPECT_EQ(expected < 0, result < 0) << x << " " << y;
+            EXPECT_EQ(expected == 0, result == 0) << x << " " << y;
+        }
+    }
+}
+
+/**
+ * @tc.name: SortIntDefault
+ * @tc.desc: Sort enough ints to go through run merging and check the default string order.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TimSortTest, SortIntDefault)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    constexpr uint32_t length = 1000;
+    std::vector<int32_t> expected;
+    JSHandle<TaggedArray> items = factory->NewTaggedArray(length);
+    for (uint32_t i = 0; i < length; i++) {
+        // a few ascending and descending runs with a noisy tail
+        int32_t value = (i < length / 2) ? static_cast<int32_t>(i) : static_cast<int32_t>((i * 7919) % 613) - 300;
+        expected.push_back(value);
+        items->Set(thread, i, JSTaggedValue(value));
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](int32_t x, int32_t y) {
+        return std::to_string(x) < std::to_string(y);
+    });
+    TimSort::Sort(thread, items, length, thread->GlobalConstants()->GetHandledUndefined());
+    for (uint32_t i = 0; i < length; i++) {
+        EXPECT_EQ(items->Get(i).GetInt(), expected[i]);
+    }
+}
+
+/**
+ * @tc.name: SortMixedPrimitiveDefault
+ * @tc.desc: Doubles and strings are compared by their string form.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TimSortTest, SortMixedPrimitiveDefault)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> items = factory->NewTaggedArray(4); // 4: number of items
+    items->Set(thread, 0, JSTaggedValue(2.5));
+    items->Set(thread, 1, factory->NewFromASCII("10").GetTaggedValue());
+    items->Set(thread, 2, JSTaggedValue(1)); // 2: index
+    items->Set(thread, 3, JSTaggedValue::True()); // 3: index
+    TimSort::Sort(thread, items, 4, thread->GlobalConstants()->GetHandledUndefined()); // 4: number of items
+    EXPECT_EQ(items->Get(0).GetInt(), 1);
+    EXPECT_TRUE(items->Get(1).IsString());
+    EXPECT_EQ(items->Get(2).GetDouble(), 2.5); // 2: index
+    EXPECT_TRUE(items->Get(3).IsTrue()); // 3: index
+}
+
+/**
+ * @tc.name: SortStableWithCallback
+ * @tc.desc: Items with equal keys keep their original order when a comparator is given.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TimSortTest, SortStableWithCallback)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> func(factory->NewJSFunction(env, reinterpret_cast<void *>(TestClass::CompareByKey)));
+    constexpr uint32_t length = 2000;
+    JSHandle<TaggedArray> items = factory->NewTaggedArray(length);
+    for (uint32_t i = 0; i < length; i++) {
+        int32_t key = static_cast<int32_t>((i * 31) % 17); // only 17 distinct keys
+        items->Set(thread, i, JSTaggedValue(key * KEY_SCALE + static_cast<int32_t>(i)));
+    }
+    TimSort::Sort(thread, items, length, func);
+    EXPECT_FALSE(thread->HasPendingException());
+    for (uint32_t i = 1; i < length; i++) {
+        int32_t previous = items->Get(i - 1).GetInt();
+        int32_t current = items->Get(i).GetInt();
+        EXPECT_TRUE(previous / KEY_SCALE < current / KEY_SCALE ||
+                    (previous / KEY_SCALE == current / KEY_SCALE && previous % KEY_SCALE < current % KEY_SCALE));
+    }
+}
+}  // namespace panda::test
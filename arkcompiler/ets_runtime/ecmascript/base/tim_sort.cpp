@@ -0,0 +1,628 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/base/tim_sort.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "ecmascript/base/array_helper.h"
+#include "ecmascript/ecma_string-inl.h"
+#include "ecmascript/js_tagged_value-inl.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tagged_array-inl.h"
+
+namespace panda::ecmascript::base {
+namespace {
+constexpr uint64_t DECIMAL = 10;
+
+// Every string is compared O(log n) times, a tree string would be copied out again by each comparison.
+void FlattenStrings(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t length)
+{
+    const EcmaVM *vm = thread->GetEcmaVM();
+    JSMutableHandle<EcmaString> string(thread, JSTaggedValue::Undefined());
+    for (uint32_t i = 0; i < length; i++) {
+        string.Update(items->Get(i));
+        if (EcmaStringAccessor(string).IsTreeString()) {
+            items->Set(thread, i, JSTaggedValue(EcmaStringAccessor::Flatten(vm, string)));
+        }
+    }
+}
+
+uint32_t CountDecimalDigits(uint64_t value)
+{
+    uint32_t digits = 1;
+    while (value >= DECIMAL) {
+        value /= DECIMAL;
+        digits++;
+    }
+    return digits;
+}
+
+uint64_t PowerOfTen(uint32_t exponent)
+{
+    uint64_t result = 1;
+    while (exponent-- > 0) {
+        result *= DECIMAL;
+    }
+    return result;
+}
+}  // namespace
+
+TimSort::TimSort(JSThread *thread, const JSHandle<TaggedArray> &items, const JSHandle<TaggedArray> &tmp,
+                 const JSHandle<JSTaggedValue> &fn, CompareMode mode, uint32_t stride)
+    : thread_(thread), items_(items), tmp_(tmp), fn_(fn), key_(thread, JSTaggedValue::Undefined()),
+      valueX_(thread, JSTaggedValue::Undefined()), valueY_(thread, JSTaggedValue::Undefined()), mode_(mode),
+      stride_(stride)
+{
+}
+
+void TimSort::Sort(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t length,
+                   const JSHandle<JSTaggedValue> &fn)
+{
+    if (length < 2) { // 2: nothing to compare
+        return;
+    }
+    CompareMode mode = CompareMode::GENERIC;
+    if (fn->IsUndefined()) {
+        bool cacheString = false;
+        mode = ChooseCompareMode(items, length, &cacheString);
+        if (cacheString) {
+            SortByCachedString(thread, items, length);
+            return;
+        }
+        if (mode == CompareMode::STRING) {
+            FlattenStrings(thread, items, length);
+        }
+    }
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    // A merge never copies more than the shorter run out, which is at most half of the items.
+    JSHandle<TaggedArray> tmp = factory->NewTaggedArray(length / 2 + 1); // 2: half
+    TimSort sorter(thread, items, tmp, fn, mode, 1);
+    sorter.SortRange(length);
+}
+
+int32_t TimSort::CompareIntAsString(int32_t x, int32_t y)
+{
+    if (x == y) {
+        return 0;
+    }
+    // '-' is ordered before every digit.
+    if (x < 0 && y >= 0) {
+        return -1;
+    }
+    if (x >= 0 && y < 0) {
+        return 1;
+    }
+    uint64_t absX = static_cast<uint64_t>(std::abs(static_cast<int64_t>(x)));
+    uint64_t absY = static_cast<uint64_t>(std::abs(static_cast<int64_t>(y)));
+    uint32_t digitsX = CountDecimalDigits(absX);
+    uint32_t digitsY = CountDecimalDigits(absY);
+    // Pad the shorter number to the same digit count, a proper prefix is ordered first.
+    if (digitsX < digitsY) {
+        uint64_t scaledX = absX * PowerOfTen(digitsY - digitsX);
+        return scaledX <= absY ? -1 : 1;
+    }
+    if (digitsX > digitsY) {
+        uint64_t scaledY = absY * PowerOfTen(digitsX - digitsY);
+        return absX < scaledY ? -1 : 1;
+    }
+    return absX < absY ? -1 : 1;
+}
+
+TimSort::CompareMode TimSort::ChooseCompareMode(const JSHandle<TaggedArray> &items, uint32_t length,
+                                                bool *cacheString)
+{
+    bool allInt = true;
+    bool allString = true;
+    bool allPrimitive = true;
+    for (uint32_t i = 0; i < length && allPrimitive; i++) {
+        JSTaggedValue value = items->Get(i);
+        allInt = allInt && value.IsInt();
+        allString = allString && value.IsString();
+        // Converting these to strings has no side effect, so each one is converted only once.
+        allPrimitive = value.IsNumber() || value.IsString() || value.IsBoolean() || value.IsNull() ||
+                       value.IsBigInt();
+    }
+    if (allInt) {
+        return CompareMode::INT_AS_STRING;
+    }
+    if (allString) {
+        return CompareMode::STRING;
+    }
+    *cacheString = allPrimitive && length <= TaggedArray::MAX_ARRAY_INDEX / 2; // 2: key and value
+    return CompareMode::GENERIC;
+}
+
+void TimSort::SortByCachedString(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t length)
+{
+    constexpr uint32_t stride = 2; // 2: key and value
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<TaggedArray> keyed = factory->NewTaggedArray(length * stride);
+    for (uint32_t i = 0; i < length; i++) {
+        [[maybe_unused]] EcmaHandleScope handleScope(thread);
+        JSHandle<JSTaggedValue> value(thread, items->Get(i));
+        JSHandle<EcmaString> key = JSTaggedValue::ToString(thread, value);
+        RETURN_IF_ABRUPT_COMPLETION(thread);
+        keyed->Set(thread, i * stride, JSTaggedValue(EcmaStringAccessor::Flatten(thread->GetEcmaVM(), key)));
+        keyed->Set(thread, i * stride + 1, value.GetTaggedValue());
+    }
+    JSHandle<TaggedArray> tmp = factory->NewTaggedArray((length / 2 + 1) * stride); // 2: half
+    TimSort sorter(thread, keyed, tmp, thread->GlobalConstants()->GetHandledUndefined(), CompareMode::STRING,
+                   stride);
+    sorter.SortRange(length);
+    for (uint32_t i = 0; i < length; i++) {
+        items->Set(thread, i, keyed->Get(i * stride + 1));
+    }
+}
+
+int64_t TimSort::MinRunLength(int64_t length)
+{
+    int64_t r = 0;
+    while (length >= MIN_MERGE) {
+        r |= (length & 1);
+        length >>= 1;
+    }
+    return length + r;
+}
+
+void TimSort::SortRange(int64_t length)
+{
+    if (length < MIN_MERGE) {
+        int64_t initRunLength = CountRunAndMakeAscending(0, length);
+        BinaryInsertionSort(0, length, initRunLength);
+        return;
+    }
+    int64_t minRun = MinRunLength(length);
+    int64_t low = 0;
+    int64_t remaining = length;
+    do {
+        int64_t runLength = CountRunAndMakeAscending(low, low + remaining);
+        if (runLength < minRun) {
+            int64_t force = std::min(remaining, minRun);
+            BinaryInsertionSort(low, low + force, low + runLength);
+            runLength = force;
+        }
+        runs_.push_back({low, runLength});
+        MergeCollapse();
+        low += runLength;
+        remaining -= runLength;
+    } while (remaining != 0);
+    MergeForceCollapse();
+}
+
+bool TimSort::Greater(JSTaggedValue x, JSTaggedValue y)
+{
+    switch (mode_) {
+        case CompareMode::INT_AS_STRING:
+            return CompareIntAsString(x.GetInt(), y.GetInt()) > 0;
+        case CompareMode::STRING:
+            return EcmaStringAccessor::Compare(EcmaString::Cast(x.GetTaggedObject()),
+                                               EcmaString::Cast(y.GetTaggedObject())) > 0;
+        default:
+            break;
+    }
+    // Once the comparator threw, finish the sort without calling it again; the caller discards the result.
+    if (thread_->HasPendingException()) {
+        return false;
+    }
+    valueX_.Update(x);
+    valueY_.Update(y);
+    return ArrayHelper::SortCompare(thread_, fn_, valueX_, valueY_) > 0;
+}
+
+JSTaggedValue TimSort::KeyAt(const JSHandle<TaggedArray> &array, int64_t index) const
+{
+    return array->Get(static_cast<uint32_t>(index * stride_));
+}
+
+void TimSort::CopyRange(const JSHandle<TaggedArray> &dst, int64_t dstIndex, const JSHandle<TaggedArray> &src,
+                        int64_t srcIndex, int64_t count)
+{
+    TaggedArray *dstArray = *dst;
+    TaggedArray *srcArray = *src;
+    auto dstSlot = static_cast<uint32_t>(dstIndex * stride_);
+    auto srcSlot = static_cast<uint32_t>(srcIndex * stride_);
+    auto slots = static_cast<uint32_t>(count * stride_);
+    if (dstArray == srcArray && dstSlot > srcSlot) {
+        for (uint32_t i = slots; i > 0; i--) {
+            dstArray->Set(thread_, dstSlot + i - 1, srcArray->Get(srcSlot + i - 1));
+        }
+        return;
+    }
+    for (uint32_t i = 0; i < slots; i++) {
+        dstArray->Set(thread_, dstSlot + i, srcArray->Get(srcSlot + i));
+    }
+}
+
+void TimSort::ReverseRange(int64_t low, int64_t high)
+{
+    TaggedArray *items = *items_;
+    high--;
+    while (low < high) {
+        for (uint32_t i = 0; i < stride_; i++) {
+            auto lowSlot = static_cast<uint32_t>(low * stride_ + i);
+            auto highSlot = static_cast<uint32_t>(high * stride_ + i);
+            JSTaggedValue value = items->Get(lowSlot);
+            items->Set(thread_, lowSlot, items->Get(highSlot));
+            items->Set(thread_, highSlot, value);
+        }
+        low++;
+        high--;
+    }
+}
+
+void TimSort::BinaryInsertionSort(int64_t low, int64_t high, int64_t start)
+{
+    if (start == low) {
+        start++;
+    }
+    for (; start < high; start++) {
+        // The pivot is parked in tmp_, which is unused until the runs are merged.
+        CopyRange(tmp_, 0, items_, start, 1);
+        int64_t left = low;
+        int64_t right = start;
+        while (left < right) {
+            int64_t middle = left + ((right - left) >> 1);
+            if (Greater(KeyAt(items_, middle), KeyAt(tmp_, 0))) {
+                right = middle;
+            } else {
+                left = middle + 1;
+            }
+        }
+        CopyRange(items_, left + 1, items_, left, start - left);
+        CopyRange(items_, left, tmp_, 0, 1);
+    }
+}
+
+int64_t TimSort::CountRunAndMakeAscending(int64_t low, int64_t high)
+{
+    int64_t runHigh = low + 1;
+    if (runHigh == high) {
+        return 1;
+    }
+    // Only strictly descending runs are reversed, so equal items keep their order.
+    if (Greater(KeyAt(items_, low), KeyAt(items_, runHigh))) {
+        runHigh++;
+        while (runHigh < high && Greater(KeyAt(items_, runHigh - 1), KeyAt(items_, runHigh))) {
+            runHigh++;
+        }
+        ReverseRange(low, runHigh);
+    } else {
+        runHigh++;
+        while (runHigh < high && !Greater(KeyAt(items_, runHigh - 1), KeyAt(items_, runHigh))) {
+            runHigh++;
+        }
+    }
+    return runHigh - low;
+}
+
+// Returns the leftmost position in array[base, base + length) at which key_ can be inserted.
+int64_t TimSort::GallopLeft(const JSHandle<TaggedArray> &array, int64_t base, int64_t length, int64_t hint)
+{
+    int64_t lastOffset = 0;
+    int64_t offset = 1;
+    if (Greater(key_.GetTaggedValue(), KeyAt(array, base + hint))) {
+        int64_t maxOffset = length - hint;
+        while (offset < maxOffset && Greater(key_.GetTaggedValue(), KeyAt(array, base + hint + offset))) {
+            lastOffset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, maxOffset);
+        lastOffset += hint;
+        offset += hint;
+    } else {
+        int64_t maxOffset = hint + 1;
+        while (offset < maxOffset && !Greater(key_.GetTaggedValue(), KeyAt(array, base + hint - offset))) {
+            lastOffset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, maxOffset);
+        int64_t tmp = lastOffset;
+        lastOffset = hint - offset;
+        offset = hint - tmp;
+    }
+    lastOffset++;
+    while (lastOffset < offset) {
+        int64_t middle = lastOffset + ((offset - lastOffset) >> 1);
+        if (Greater(key_.GetTaggedValue(), KeyAt(array, base + middle))) {
+            lastOffset = middle + 1;
+        } else {
+            offset = middle;
+        }
+    }
+    return offset;
+}
+
+// Returns the rightmost position in array[base, base + length) at which key_ can be inserted.
+int64_t TimSort::GallopRight(const JSHandle<TaggedArray> &array, int64_t base, int64_t length, int64_t hint)
+{
+    int64_t lastOffset = 0;
+    int64_t offset = 1;
+    if (Greater(KeyAt(array, base + hint), key_.GetTaggedValue())) {
+        int64_t maxOffset = hint + 1;
+        while (offset < maxOffset && Greater(KeyAt(array, base + hint - offset), key_.GetTaggedValue())) {
+            lastOffset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, maxOffset);
+        int64_t tmp = lastOffset;
+        lastOffset = hint - offset;
+        offset = hint - tmp;
+    } else {
+        int64_t maxOffset = length - hint;
+        while (offset < maxOffset && !Greater(KeyAt(array, base + hint + offset), key_.GetTaggedValue())) {
+            lastOffset = offset;
+            offset = (offset << 1) + 1;
+        }
+        offset = std::min(offset, maxOffset);
+        lastOffset += hint;
+        offset += hint;
+    }
+    lastOffset++;
+    while (lastOffset < offset) {
+        int64_t middle = lastOffset + ((offset - lastOffset) >> 1);
+        if (Greater(KeyAt(array, base + middle), key_.GetTaggedValue())) {
+            offset = middle;
+        } else {
+            lastOffset = middle + 1;
+        }
+    }
+    return offset;
+}
+
+void TimSort::MergeCollapse()
+{
+    while (runs_.size() > 1) {
+        size_t n = runs_.size() - 2; // 2: the two topmost runs
+        if ((n > 0 && runs_[n - 1].length <= runs_[n].length + runs_[n + 1].length) ||
+            (n > 1 && runs_[n - 2].length <= runs_[n - 1].length + runs_[n].length)) { // 2: third run from the top
+            if (runs_[n - 1].length < runs_[n + 1].length) {
+                n--;
+            }
+        } else if (runs_[n].length > runs_[n + 1].length) {
+            break;
+        }
+        MergeAt(n);
+    }
+}
+
+void TimSort::MergeForceCollapse()
+{
+    while (runs_.size() > 1) {
+        size_t n = runs_.size() - 2; // 2: the two topmost runs
+        if (n > 0 && runs_[n - 1].length < runs_[n + 1].length) {
+            n--;
+        }
+        MergeAt(n);
+    }
+}
+
+void TimSort::MergeAt(size_t index)
+{
+    int64_t base1 = runs_[index].base;
+    int64_t length1 = runs_[index].length;
+    int64_t base2 = runs_[index + 1].base;
+    int64_t length2 = runs_[index + 1].length;
+    runs_[index].length = length1 + length2;
+    runs_.erase(runs_.begin() + static_cast<int64_t>(index) + 1);
+
+    // Items of run1 that are not greater than the first item of run2 are already in place.
+    key_.Update(KeyAt(items_, base2));
+    int64_t skipped = GallopRight(items_, base1, length1, 0);
+    base1 += skipped;
+    length1 -= skipped;
+    if (length1 == 0) {
+        return;
+    }
+    // Likewise for the items of run2 not less than the last item of run1.
+    key_.Update(KeyAt(items_, base1 + length1 - 1));
+    length2 = GallopLeft(items_, base2, length2, length2 - 1);
+    if (length2 == 0) {
+        return;
+    }
+    if (length1 <= length2) {
+        MergeLow(base1, length1, base2, length2);
+    } else {
+        MergeHigh(base1, length1, base2, length2);
+    }
+}
+
+void TimSort::MergeLow(int64_t base1, int64_t length1, int64_t base2, int64_t length2)
+{
+    CopyRange(tmp_, 0, items_, base1, length1);
+    int64_t cursor1 = 0;
+    int64_t cursor2 = base2;
+    int64_t dest = base1;
+    CopyRange(items_, dest++, items_, cursor2++, 1);
+    if (--length2 == 0) {
+        CopyRange(items_, dest, tmp_, cursor1, length1);
+        return;
+    }
+    if (length1 == 1) {
+        CopyRange(items_, dest, items_, cursor2, length2);
+        CopyRange(items_, dest + length2, tmp_, cursor1, 1);
+        return;
+    }
+
+    int64_t minGallop = minGallop_;
+    bool finished = false;
+    while (!finished) {
+        int64_t count1 = 0;
+        int64_t count2 = 0;
+        // Merge one item at a time until one run starts winning consistently.
+        do {
+            if (Greater(KeyAt(tmp_, cursor1), KeyAt(items_, cursor2))) {
+                CopyRange(items_, dest++, items_, cursor2++, 1);
+                count2++;
+                count1 = 0;
+                finished = (--length2 == 0);
+            } else {
+                CopyRange(items_, dest++, tmp_, cursor1++, 1);
+                count1++;
+                count2 = 0;
+                finished = (--length1 == 1);
+            }
+        } while (!finished && (count1 | count2) < minGallop);
+        // Then gallop, copying whole blocks, until that stops paying off.
+        while (!finished) {
+            key_.Update(KeyAt(items_, cursor2));
+            count1 = GallopRight(tmp_, cursor1, length1, 0);
+            if (count1 != 0) {
+                CopyRange(items_, dest, tmp_, cursor1, count1);
+                dest += count1;
+                cursor1 += count1;
+                length1 -= count1;
+                if (length1 <= 1) {
+                    finished = true;
+                    break;
+                }
+            }
+            CopyRange(items_, dest++, items_, cursor2++, 1);
+            if (--length2 == 0) {
+                finished = true;
+                break;
+            }
+            key_.Update(KeyAt(tmp_, cursor1));
+            count2 = GallopLeft(items_, cursor2, length2, 0);
+            if (count2 != 0) {
+                CopyRange(items_, dest, items_, cursor2, count2);
+                dest += count2;
+                cursor2 += count2;
+                length2 -= count2;
+                if (length2 == 0) {
+                    finished = true;
+                    break;
+                }
+            }
+            CopyRange(items_, dest++, tmp_, cursor1++, 1);
+            if (--length1 == 1) {
+                finished = true;
+                break;
+            }
+            minGallop--;
+            if (count1 < MIN_GALLOP && count2 < MIN_GALLOP) {
+                break;
+            }
+        }
+        if (!finished) {
+            minGallop = std::max<int64_t>(minGallop, 0) + 2; // 2: penalty for leaving galloping mode
+        }
+    }
+    minGallop_ = std::max<int64_t>(minGallop, 1);
+
+    if (length1 == 1) {
+        CopyRange(items_, dest, items_, cursor2, length2);
+        CopyRange(items_, dest + length2, tmp_, cursor1, 1);
+    } else if (length1 > 1) {
+        CopyRange(items_, dest, tmp_, cursor1, length1);
+    }
+    // length1 only drops to zero with an inconsistent comparator, the rest of run2 is then already in place.
+}
+
+void TimSort::MergeHigh(int64_t base1, int64_t length1, int64_t base2, int64_t length2)
+{
+    CopyRange(tmp_, 0, items_, base2, length2);
+    int64_t cursor1 = base1 + length1 - 1;
+    int64_t cursor2 = length2 - 1;
+    int64_t dest = base2 + length2 - 1;
+    CopyRange(items_, dest--, items_, cursor1--, 1);
+    if (--length1 == 0) {
+        CopyRange(items_, dest - (length2 - 1), tmp_, 0, length2);
+        return;
+    }
+    if (length2 == 1) {
+        dest -= length1;
+        cursor1 -= length1;
+        CopyRange(items_, dest + 1, items_, cursor1 + 1, length1);
+        CopyRange(items_, dest, tmp_, cursor2, 1);
+        return;
+    }
+
+    int64_t minGallop = minGallop_;
+    bool finished = false;
+    while (!finished) {
+        int64_t count1 = 0;
+        int64_t count2 = 0;
+        do {
+            if (Greater(KeyAt(items_, cursor1), KeyAt(tmp_, cursor2))) {
+                CopyRange(items_, dest--, items_, cursor1--, 1);
+                count1++;
+                count2 = 0;
+                finished = (--length1 == 0);
+            } else {
+                CopyRange(items_, dest--, tmp_, cursor2--, 1);
+                count2++;
+                count1 = 0;
+                finished = (--length2 == 1);
+            }
+        } while (!finished && (count1 | count2) < minGallop);
+        while (!finished) {
+            key_.Update(KeyAt(tmp_, cursor2));
+            count1 = length1 - GallopRight(items_, base1, length1, length1 - 1);
+            if (count1 != 0) {
+                dest -= count1;
+                cursor1 -= count1;
+                length1 -= count1;
+                CopyRange(items_, dest + 1, items_, cursor1 + 1, count1);
+                if (length1 == 0) {
+                    finished = true;
+                    break;
+                }
+            }
+            CopyRange(items_, dest--, tmp_, cursor2--, 1);
+            if (--length2 == 1) {
+                finished = true;
+                break;
+            }
+            key_.Update(KeyAt(items_, cursor1));
+            count2 = length2 - GallopLeft(tmp_, 0, length2, length2 - 1);
+            if (count2 != 0) {
+                dest -= count2;
+                cursor2 -= count2;
+                length2 -= count2;
+                CopyRange(items_, dest + 1, tmp_, cursor2 + 1, count2);
+                if (length2 <= 1) {
+                    finished = true;
+                    break;
+                }
+            }
+            CopyRange(items_, dest--, items_, cursor1--, 1);
+            if (--length1 == 0) {
+                finished = true;
+                break;
+            }
+            minGallop--;
+            if (count1 < MIN_GALLOP && count2 < MIN_GALLOP) {
+                break;
+            }
+        }
+        if (!finished) {
+            minGallop = std::max<int64_t>(minGallop, 0) + 2; // 2: penalty for leaving galloping mode
+        }
+    }
+    minGallop_ = std::max<int64_t>(minGallop, 1);
+
+    if (length2 == 1) {
+        dest -= length1;
+        cursor1 -= length1;
+        CopyRange(items_, dest + 1, items_, cursor1 + 1, length1);
+        CopyRange(items_, dest, tmp_, cursor2, 1);
+    } else if (length2 > 1) {
+        CopyRange(items_, dest - (length2 - 1), tmp_, 0, length2);
+    }
+    // length2 only drops to zero with an inconsistent comparator, the rest of run1 is then already in place.
+}
+}  // namespace panda::ecmascript::base
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_BASE_TIM_SORT_H
+#define ECMASCRIPT_BASE_TIM_SORT_H
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/js_handle.h"
+#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/mem/c_containers.h"
+#include "ecmascript/tagged_array.h"
+
+namespace panda::ecmascript::base {
+// Stable TimSort used by Array.prototype.sort. The items must neither contain holes nor undefined, those are
+// ordered by the caller. The comparator may run arbitrary JS, so no raw element pointer is held across a comparison.
+class TimSort {
+public:
+    static void Sort(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t length,
+                     const JSHandle<JSTaggedValue> &fn);
+
+    // Compares the decimal representation of two ints without creating strings.
+    static int32_t CompareIntAsString(int32_t x, int32_t y);
+
+private:
+    enum class CompareMode : uint8_t {
+        INT_AS_STRING,
+        STRING,
+        GENERIC,
+    };
+
+    struct Run {
+        int64_t base;
+        int64_t length;
+    };
+
+    static constexpr int64_t MIN_MERGE = 32;
+    static constexpr int64_t MIN_GALLOP = 7;
+
+    TimSort(JSThread *thread, const JSHandle<TaggedArray> &items, const JSHandle<TaggedArray> &tmp,
+            const JSHandle<JSTaggedValue> &fn, CompareMode mode, uint32_t stride);
+
+    static CompareMode ChooseCompareMode(const JSHandle<TaggedArray> &items, uint32_t length, bool *cacheString);
+    static void SortByCachedString(JSThread *thread, const JSHandle<TaggedArray> &items, uint32_t length);
+    static int64_t MinRunLength(int64_t length);
+
+    void SortRange(int64_t length);
+    bool Greater(JSTaggedValue x, JSTaggedValue y);
+    JSTaggedValue KeyAt(const JSHandle<TaggedArray> &array, int64_t index) const;
+    void CopyRange(const JSHandle<TaggedArray> &dst, int64_t dstIndex, const JSHandle<TaggedArray> &src,
+                   int64_t srcIndex, int64_t count);
+    void ReverseRange(int64_t low, int64_t high);
+    void BinaryInsertionSort(int64_t low, int64_t high, int64_t start);
+    int64_t CountRunAndMakeAscending(int64_t low, int64_t high);
+    int64_t GallopLeft(const JSHandle<TaggedArray> &array, int64_t base, int64_t length, int64_t hint);
+    int64_t GallopRight(const JSHandle<TaggedArray> &array, int64_t base, int64_t length, int64_t hint);
+    void MergeCollapse();
+    void MergeForceCollapse();
+    void MergeAt(size_t index);
+    void MergeLow(int64_t base1, int64_t length1, int64_t base2, int64_t length2);
+    void MergeHigh(int64_t base1, int64_t length1, int64_t base2, int64_t length2);
+
+    JSThread *thread_ {nullptr};
+    JSHandle<TaggedArray> items_;
+    JSHandle<TaggedArray> tmp_;
+    JSHandle<JSTaggedValue> fn_;
+    JSMutableHandle<JSTaggedValue> key_;
+    JSMutableHandle<JSTaggedValue> valueX_;
+    JSMutableHandle<JSTaggedValue> valueY_;
+    CompareMode mode_ {CompareMode::GENERIC};
+    // Number of slots per item. Items sorted by a cached string key are stored as [key, value] pairs.
+    uint32_t stride_ {1};
+    int64_t minGallop_ {MIN_GALLOP};
+    CVector<Run> runs_ {};
+};
+}  // namespace panda::ecmascript::base
+
+#endif  // ECMASCRIPT_BASE_TIM_SORT_H
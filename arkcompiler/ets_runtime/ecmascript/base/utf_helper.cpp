@@ -15,6 +15,10 @@
 
 #include "ecmascript/base/utf_helper.h"
 
+#include <algorithm>
+
+#include "ecmascript/base/simd_helper.h"
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 static constexpr int32_t U16_SURROGATE_OFFSET = (0xd800 << 10UL) + 0xdc00 - 0x10000;
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -186,7 +190,10 @@ size_t Utf16ToUtf8Size(const uint16_t *utf16, uint32_t length, bool modify)
                 res += UtfLength::TWO;  // special case for U+0000 => C0 80
             }
         } else if (utf16[i] <= UTF8_1B_MAX) {  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            res += 1;
+            // the whole ascii run takes one byte per character
+            size_t run = simd_helper::CompressiblePrefix(utf16 + i, length - i);
+            res += run;
+            i += run - 1;
         } else if (utf16[i] <= UTF8_2B_MAX) {  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             res += UtfLength::TWO;
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
@@ -215,6 +222,15 @@ size_t ConvertRegionUtf16ToUtf8(const uint16_t *utf16In, uint8_t *utf8Out, size_
     size_t utf8Pos = 0;
     size_t end = start + utf16Len;
     for (size_t i = start; i < end; ++i) {
+        if (utf16In[i] != 0 && utf16In[i] <= UTF8_1B_MAX) {
+            // ascii run, copied as is while it fits
+            size_t run = simd_helper::CompressiblePrefix(utf16In + i, end - i);
+            size_t copied = utf8Pos < utf8Len ? std::min(run, utf8Len - utf8Pos) : 0;
+            simd_helper::NarrowCopy(utf8Out + utf8Pos, utf16In + i, copied);
+            utf8Pos += copied;
+            i += run - 1;
+            continue;
+        }
         uint32_t codepoint = DecodeUTF16(utf16In, end, &i);
         if (codepoint == 0) {
             if (modify) {
@@ -267,12 +283,23 @@ std::pair<uint32_t, size_t> ConvertUtf8ToUtf16Pair(const uint8_t *data, bool com
 
 size_t Utf8ToUtf16Size(const uint8_t *utf8, size_t utf8Len)
 {
-    return utf::MUtf8ToUtf16Size(utf8, utf8Len);
+    // every byte of the ascii prefix is one utf16 code unit
+    size_t prefix = simd_helper::AsciiPrefix(utf8, utf8Len);
+    return prefix + utf::MUtf8ToUtf16Size(utf8 + prefix, utf8Len - prefix);
 }
 
 size_t ConvertRegionUtf8ToUtf16(const uint8_t *utf8In, uint16_t *utf16Out, size_t utf8Len, size_t utf16Len,
                                 size_t start)
 {
-    return utf::ConvertRegionMUtf8ToUtf16(utf8In, utf16Out, utf8Len, utf16Len, start);
+    if (start != 0) {
+        return utf::ConvertRegionMUtf8ToUtf16(utf8In, utf16Out, utf8Len, utf16Len, start);
+    }
+    size_t prefix = simd_helper::AsciiPrefix(utf8In, std::min(utf8Len, utf16Len));
+    simd_helper::WidenCopy(utf16Out, utf8In, prefix);
+    if (prefix == utf16Len) {
+        return prefix;
+    }
+    return prefix + utf::ConvertRegionMUtf8ToUtf16(utf8In + prefix, utf16Out + prefix, utf8Len - prefix,
+                                                   utf16Len - prefix, 0);
 }
 }  // namespace panda::ecmascript::base::utf_helper
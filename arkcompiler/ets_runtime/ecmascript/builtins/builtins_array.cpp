@@ -2226,49 +2226,8 @@ JSTaggedValue BuiltinsArray::Sort(EcmaRuntimeCallInfo *argv)
         THROW_TYPE_ERROR_AND_RETURN(thread, "Callable is false", JSTaggedValue::Exception());
     }
 
-    // 2. Let len be ToLength(Get(obj, "length")).
-    int64_t len = ArrayHelper::GetArrayLength(thread, JSHandle<JSTaggedValue>(thisObjHandle));
-    // 3. ReturnIfAbrupt(len).
-    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-
-    JSMutableHandle<JSTaggedValue> presentValue(thread, JSTaggedValue::Undefined());
-    JSMutableHandle<JSTaggedValue> middleValue(thread, JSTaggedValue::Undefined());
-    JSMutableHandle<JSTaggedValue> previousValue(thread, JSTaggedValue::Undefined());
-    for (int i = 1; i < len; i++) {
-        int beginIndex = 0;
-        int endIndex = i;
-        presentValue.Update(ObjectFastOperator::FastGetPropertyByIndex<true>(thread,
-            thisObjHandle.GetTaggedValue(), i));
-        RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-        while (beginIndex < endIndex) {
-            int middleIndex = (beginIndex + endIndex) / 2; // 2 : half
-            middleValue.Update(
-                ObjectFastOperator::FastGetPropertyByIndex<true>(thread, thisObjHandle.GetTaggedValue(), middleIndex));
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-            double compareResult = ArrayHelper::SortCompare(thread, callbackFnHandle, middleValue, presentValue);
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-            if (compareResult > 0) {
-                endIndex = middleIndex;
-            } else {
-                beginIndex = middleIndex + 1;
-            }
-        }
-
-        if (endIndex >= 0 && endIndex < i) {
-            for (int j = i; j > endIndex; j--) {
-                previousValue.Update(
-                    ObjectFastOperator::FastGetPropertyByIndex<true>(thread, thisObjHandle.GetTaggedValue(), j - 1));
-                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-                ObjectFastOperator::FastSetPropertyByIndex(thread, thisObjHandle.GetTaggedValue(), j,
-                                                           previousValue.GetTaggedValue());
-                RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-            }
-            ObjectFastOperator::FastSetPropertyByIndex(thread, thisObjHandle.GetTaggedValue(), endIndex,
-                                                       presentValue.GetTaggedValue());
-            RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-        }
-    }
-
+    JSArray::Sort(thread, thisObjHandle, callbackFnHandle);
+    RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
     return thisObjHandle.GetTaggedValue();
 }
 
@@ -1724,8 +1724,8 @@ JSTaggedValue BuiltinsRegExp::RegExpInitialize(JSThread *thread, const JSHandle<
     RegExpParser parser = RegExpParser(&chunk);
     RegExpParserCache *regExpParserCache = thread->GetEcmaVM()->GetRegExpParserCache();
     CVector<CString> groupName;
-    auto getCache = regExpParserCache->GetCache(*patternStrHandle, flagsBits, groupName);
-    if (getCache.first == JSTaggedValue::Hole()) {
+    auto getCache = regExpParserCache->GetCache(patternStdStr, flagsBits, groupName);
+    if (getCache.first == nullptr) {
         parser.Init(const_cast<char *>(reinterpret_cast<const char *>(patternStdStr.c_str())), patternStdStr.size(),
                     flagsBits);
         parser.Parse();
@@ -1750,14 +1750,14 @@ JSTaggedValue BuiltinsRegExp::RegExpInitialize(JSThread *thread, const JSHandle<
         regexp->SetGroupName(thread, taggedArray);
     }
     // 13. Set obj’s [[RegExpMatcher]] internal slot.
-    if (getCache.first == JSTaggedValue::Hole()) {
+    if (getCache.first == nullptr) {
         auto bufferSize = parser.GetOriginBufferSize();
         auto buffer = parser.GetOriginBuffer();
         factory->NewJSRegExpByteCodeData(regexp, buffer, bufferSize);
-        regExpParserCache->SetCache(*patternStrHandle, flagsBits, regexp->GetByteCodeBuffer(), bufferSize, groupName);
+        regExpParserCache->SetCache(patternStdStr, flagsBits, buffer, bufferSize, groupName);
     } else {
-        regexp->SetByteCodeBuffer(thread, getCache.first);
-        regexp->SetLength(static_cast<uint32_t>(getCache.second));
+        // every regexp owns its byte code, the cached one may be evicted
+        factory->NewJSRegExpByteCodeData(regexp, const_cast<uint8_t *>(getCache.first), getCache.second);
     }
     // 14. Let setStatus be Set(obj, "lastIndex", 0, true).
     JSHandle<JSTaggedValue> lastIndexString = thread->GlobalConstants()->GetHandledLastIndexString();
@@ -240,8 +240,10 @@ JSTaggedValue BuiltinsString::CharAt(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that indexed reads do not walk a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     int32_t thisLen = static_cast<int32_t>(EcmaStringAccessor(thisHandle).GetLength());
     JSHandle<JSTaggedValue> posTag = BuiltinsString::GetCallArg(argv, 0);
     int32_t pos = 0;
@@ -269,8 +271,10 @@ JSTaggedValue BuiltinsString::CharCodeAt(EcmaRuntimeCallInfo *argv)
     JSThread *thread = argv->GetThread();
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that indexed reads do not walk a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     int32_t thisLen = static_cast<int32_t>(EcmaStringAccessor(thisHandle).GetLength());
     JSHandle<JSTaggedValue> posTag = BuiltinsString::GetCallArg(argv, 0);
     int32_t pos = 0;
@@ -298,8 +302,10 @@ JSTaggedValue BuiltinsString::CodePointAt(EcmaRuntimeCallInfo *argv)
     JSThread *thread = argv->GetThread();
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that indexed reads do not walk a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     JSHandle<JSTaggedValue> posTag = BuiltinsString::GetCallArg(argv, 0);
 
     JSTaggedNumber posVal = JSTaggedValue::ToNumber(thread, posTag);
@@ -370,14 +376,17 @@ JSTaggedValue BuiltinsString::EndsWith(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
     JSHandle<JSTaggedValue> searchTag = BuiltinsString::GetCallArg(argv, 0);
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     bool isRegexp = JSObject::IsRegExp(thread, searchTag);
     if (isRegexp) {
         THROW_TYPE_ERROR_AND_RETURN(thread, "is regexp", JSTaggedValue::Exception());
     }
-    JSHandle<EcmaString> searchHandle = JSTaggedValue::ToString(thread, searchTag);
+    JSHandle<EcmaString> searchStr = JSTaggedValue::ToString(thread, searchTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> searchHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), searchStr));
     uint32_t thisLen = EcmaStringAccessor(thisHandle).GetLength();
     uint32_t searchLen = EcmaStringAccessor(searchHandle).GetLength();
     uint32_t pos = 0;
@@ -411,14 +420,17 @@ JSTaggedValue BuiltinsString::Includes(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> searchTag = BuiltinsString::GetCallArg(argv, 0);
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     bool isRegexp = JSObject::IsRegExp(thread, searchTag);
     if (isRegexp) {
         THROW_TYPE_ERROR_AND_RETURN(thread, "is regexp", JSTaggedValue::Exception());
     }
-    JSHandle<EcmaString> searchHandle = JSTaggedValue::ToString(thread, searchTag);
+    JSHandle<EcmaString> searchStr = JSTaggedValue::ToString(thread, searchTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> searchHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), searchStr));
     uint32_t thisLen = EcmaStringAccessor(thisHandle).GetLength();
     int32_t pos = 0;
     JSHandle<JSTaggedValue> posTag = BuiltinsBase::GetCallArg(argv, 1);
@@ -446,11 +458,14 @@ JSTaggedValue BuiltinsString::IndexOf(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> searchTag = BuiltinsString::GetCallArg(argv, 0);
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     uint32_t thisLen = EcmaStringAccessor(thisHandle).GetLength();
-    JSHandle<EcmaString> searchHandle = JSTaggedValue::ToString(thread, searchTag);
+    JSHandle<EcmaString> searchStr = JSTaggedValue::ToString(thread, searchTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> searchHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), searchStr));
     JSHandle<JSTaggedValue> posTag = BuiltinsString::GetCallArg(argv, 1);
     int32_t pos = 0;
     if (posTag->IsInt()) {
@@ -479,11 +494,14 @@ JSTaggedValue BuiltinsString::LastIndexOf(EcmaRuntimeCallInfo *argv)
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     JSHandle<JSTaggedValue> searchTag = BuiltinsString::GetCallArg(argv, 0);
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     int32_t thisLen = static_cast<int32_t>(EcmaStringAccessor(thisHandle).GetLength());
-    JSHandle<EcmaString> searchHandle = JSTaggedValue::ToString(thread, searchTag);
+    JSHandle<EcmaString> searchStr = JSTaggedValue::ToString(thread, searchTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> searchHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), searchStr));
     int32_t pos = 0;
     if (argv->GetArgsNumber() == 1) {
         pos = thisLen;
@@ -828,13 +846,16 @@ JSTaggedValue BuiltinsString::Replace(EcmaRuntimeCallInfo *argv)
     }
 
     // Let string be ToString(O).
-    JSHandle<EcmaString> thisString = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     // ReturnIfAbrupt(string).
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisString(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     // Let searchString be ToString(searchValue).
-    JSHandle<EcmaString> searchString = JSTaggedValue::ToString(thread, searchTag);
+    JSHandle<EcmaString> searchStr = JSTaggedValue::ToString(thread, searchTag);
     // ReturnIfAbrupt(searchString).
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> searchString(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), searchStr));
     // Let functionalReplace be IsCallable(replaceValue).
     if (!replaceTag->IsCallable()) {
         // If functionalReplace is false, then
@@ -945,11 +966,14 @@ JSTaggedValue BuiltinsString::ReplaceAll(EcmaRuntimeCallInfo *argv)
     }
 
     // 3. Let string be ? ToString(O).
-    JSHandle<EcmaString> thisString = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisString(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     // 4. Let searchString be ? ToString(searchValue).
-    JSHandle<EcmaString> searchString = JSTaggedValue::ToString(thread, searchTag);
+    JSHandle<EcmaString> searchStr = JSTaggedValue::ToString(thread, searchTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> searchString(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), searchStr));
     // 5. Let functionalReplace be IsCallable(replaceValue).
     // 6. If functionalReplace is false, then
     if (!replaceTag->IsCallable()) {
@@ -1037,10 +1061,12 @@ JSTaggedValue BuiltinsString::GetSubstitution(JSThread *thread, const JSHandle<E
                                               const JSHandle<EcmaString> &srcString, int position,
                                               const JSHandle<TaggedArray> &captureList,
                                               const JSHandle<JSTaggedValue> &namedCaptures,
-                                              const JSHandle<EcmaString> &replacement)
+                                              const JSHandle<EcmaString> &replacementStr)
 {
     BUILTINS_API_TRACE(thread, String, GetSubstitution);
     auto ecmaVm = thread->GetEcmaVM();
+    // Flattening stores the flat string into the tree, so the calls for the next matches find it flat already.
+    JSHandle<EcmaString> replacement(thread, EcmaStringAccessor::Flatten(ecmaVm, replacementStr));
     ObjectFactory *factory = ecmaVm->GetFactory();
     JSHandle<EcmaString> dollarString = JSHandle<EcmaString>::Cast(thread->GlobalConstants()->GetHandledDollarString());
     int32_t replaceLength = static_cast<int32_t>(EcmaStringAccessor(replacement).GetLength());
@@ -1327,8 +1353,10 @@ JSTaggedValue BuiltinsString::Split(EcmaRuntimeCallInfo *argv)
         }
     }
     // Let S be ToString(O).
-    JSHandle<EcmaString> thisString = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisString(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     // Let A be ArrayCreate(0).
     JSHandle<JSObject> resultArray(JSArray::ArrayCreate(thread, JSTaggedNumber(0)));
     uint32_t arrayLength = 0;
@@ -1347,8 +1375,9 @@ JSTaggedValue BuiltinsString::Split(EcmaRuntimeCallInfo *argv)
     }
     // Let s be the number of elements in S.
     int32_t thisLength = static_cast<int32_t>(EcmaStringAccessor(thisString).GetLength());
-    JSHandle<EcmaString> seperatorString = JSTaggedValue::ToString(thread, seperatorTag);
+    JSHandle<EcmaString> seperatorStr = JSTaggedValue::ToString(thread, seperatorTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> seperatorString(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), seperatorStr));
     if (seperatorTag->IsUndefined()) {
         // Perform CreateDataProperty(A, "0", S).
         JSObject::CreateDataProperty(thread, resultArray, 0, JSHandle<JSTaggedValue>(thisString));
@@ -1410,15 +1439,18 @@ JSTaggedValue BuiltinsString::StartsWith(EcmaRuntimeCallInfo *argv)
     JSHandle<JSTaggedValue> searchTag = BuiltinsString::GetCallArg(argv, 0);
 
     JSHandle<JSTaggedValue> thisTag(JSTaggedValue::RequireObjectCoercible(thread, GetThis(argv)));
-    JSHandle<EcmaString> thisHandle = JSTaggedValue::ToString(thread, thisTag);
+    JSHandle<EcmaString> thisStr = JSTaggedValue::ToString(thread, thisTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    // Flatten once so that the searches below read the characters in place instead of copying a tree string.
+    JSHandle<EcmaString> thisHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), thisStr));
     bool isRegexp = JSObject::IsRegExp(thread, searchTag);
     if (isRegexp) {
         THROW_TYPE_ERROR_AND_RETURN(thread, "is regexp", JSTaggedValue::Exception());
     }
 
-    JSHandle<EcmaString> searchHandle = JSTaggedValue::ToString(thread, searchTag);
+    JSHandle<EcmaString> searchStr = JSTaggedValue::ToString(thread, searchTag);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
+    JSHandle<EcmaString> searchHandle(thread, EcmaStringAccessor::Flatten(thread->GetEcmaVM(), searchStr));
     uint32_t thisLen = EcmaStringAccessor(thisHandle).GetLength();
     uint32_t searchLen = EcmaStringAccessor(searchHandle).GetLength();
     int32_t pos = 0;
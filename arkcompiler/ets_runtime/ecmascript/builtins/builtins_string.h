@@ -44,7 +44,7 @@ public:
                                          const JSHandle<EcmaString> &srcString, int position,
                                          const JSHandle<TaggedArray> &captureList,
                                          const JSHandle<JSTaggedValue> &namedCaptures,
-                                         const JSHandle<EcmaString> &replacement);
+                                         const JSHandle<EcmaString> &replacementStr);
     // 21.1.3.1
     static JSTaggedValue CharAt(EcmaRuntimeCallInfo *argv);
     // 21.1.3.2
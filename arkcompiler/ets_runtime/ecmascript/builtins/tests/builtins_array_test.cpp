@@ -165,6 +165,20 @@ public:
             }
             return GetTaggedBoolean(false);
         }
+
+        // Compares numbers ascending and truncates the array stored in the "target" property of the comparator.
+        static JSTaggedValue TestTruncateSortFunc(EcmaRuntimeCallInfo *argv)
+        {
+            JSThread *thread = argv->GetThread();
+            ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+            JSHandle<JSTaggedValue> targetKey(factory->NewFromASCII("target"));
+            JSHandle<JSTaggedValue> target =
+                JSTaggedValue::GetProperty(thread, GetConstructor(argv), targetKey).GetValue();
+            JSHandle<JSTaggedValue> lengthKey = thread->GlobalConstants()->GetHandledLengthString();
+            JSHandle<JSTaggedValue> newLength(thread, JSTaggedValue(2)); // 2 : the length the array is truncated to
+            JSTaggedValue::SetProperty(thread, target, lengthKey, newLength);
+            return GetTaggedInt(GetCallArg(argv, 0)->GetInt() - GetCallArg(argv, 1)->GetInt());
+        }
     };
 };
 
@@ -1362,6 +1376,47 @@ HWTEST_F_L0(BuiltinsArrayTest, Sort)
     EXPECT_EQ(JSArray::GetProperty(thread, resultArr, key2).GetValue()->GetInt(), 3);
 }
 
+HWTEST_F_L0(BuiltinsArrayTest, SortWithTruncatingComparator)
+{
+    auto ecmaVM = thread->GetEcmaVM();
+    JSHandle<GlobalEnv> env = ecmaVM->GetGlobalEnv();
+    ObjectFactory *factory = ecmaVM->GetFactory();
+
+    JSHandle<JSTaggedValue> lengthKeyHandle = thread->GlobalConstants()->GetHandledLengthString();
+    JSArray *arr = JSArray::Cast(JSArray::ArrayCreate(thread, JSTaggedNumber(0)).GetTaggedValue().GetTaggedObject());
+    EXPECT_TRUE(arr != nullptr);
+    JSHandle<JSObject> obj(thread, arr);
+    int32_t count = 5; // 5 : values 5, 4, 3, 2, 1
+    for (int32_t i = 0; i < count; i++) {
+        JSHandle<JSTaggedValue> key(thread, JSTaggedValue(i));
+        PropertyDescriptor desc(thread, JSHandle<JSTaggedValue>(thread, JSTaggedValue(count - i)), true, true, true);
+        JSArray::DefineOwnProperty(thread, obj, key, desc);
+    }
+
+    JSHandle<JSFunction> func = factory->NewJSFunction(env, reinterpret_cast<void *>(TestClass::TestTruncateSortFunc));
+    JSHandle<JSTaggedValue> targetKey(factory->NewFromASCII("target"));
+    JSObject::SetProperty(thread, JSHandle<JSTaggedValue>(func), targetKey, JSHandle<JSTaggedValue>(obj));
+
+    auto ecmaRuntimeCallInfo1 = TestHelper::CreateEcmaRuntimeCallInfo(thread, JSTaggedValue::Undefined(), 6);
+    ecmaRuntimeCallInfo1->SetFunction(JSTaggedValue::Undefined());
+    ecmaRuntimeCallInfo1->SetThis(obj.GetTaggedValue());
+    ecmaRuntimeCallInfo1->SetCallArg(0, func.GetTaggedValue());
+
+    [[maybe_unused]] auto prev = TestHelper::SetupFrame(thread, ecmaRuntimeCallInfo1);
+    JSTaggedValue result = Array::Sort(ecmaRuntimeCallInfo1);
+    TestHelper::TearDownFrame(thread, prev);
+
+    // The sorted values are set as properties again, which grows the truncated array back instead of writing them
+    // to the elements store beyond its length.
+    EXPECT_TRUE(result.IsECMAObject());
+    JSHandle<JSTaggedValue> resultArr(thread, result);
+    EXPECT_EQ(JSArray::GetProperty(thread, resultArr, lengthKeyHandle).GetValue()->GetInt(), count);
+    for (int32_t i = 0; i < count; i++) {
+        JSHandle<JSTaggedValue> key(thread, JSTaggedValue(i));
+        EXPECT_EQ(JSArray::GetProperty(thread, resultArr, key).GetValue()->GetInt(), i + 1);
+    }
+}
+
 HWTEST_F_L0(BuiltinsArrayTest, Unshift)
 {
     JSHandle<JSTaggedValue> lengthKeyHandle = thread->GlobalConstants()->GetHandledLengthString();
@@ -646,15 +646,39 @@ HWTEST_F_L0(BuiltinsRegExpTest, Replace3)
 HWTEST_F_L0(BuiltinsRegExpTest, RegExpParseCache)
 {
     RegExpParserCache *regExpParserCache = thread->GetEcmaVM()->GetRegExpParserCache();
-    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
-    JSHandle<EcmaString> string1 = factory->NewFromASCII("abc");
-    JSHandle<EcmaString> string2 = factory->NewFromASCII("abcd");
+    regExpParserCache->Clear();
+    CString string1("abc");
+    CString string2("abcd");
+    uint8_t codeBuffer[] = {1, 2};
+    CVector<CString> vec;
+    regExpParserCache->SetCache(string1, 0, codeBuffer, sizeof(codeBuffer), vec);
+    auto cached = regExpParserCache->GetCache(string1, 0, vec);
+    ASSERT_TRUE(cached.first != nullptr);
+    ASSERT_EQ(cached.second, 2U);
+    ASSERT_EQ(cached.first[1], 2U);
+    ASSERT_TRUE(regExpParserCache->GetCache(string1, 1, vec).first == nullptr);
+    ASSERT_TRUE(regExpParserCache->GetCache(string2, 0, vec).first == nullptr);
+    // the cache does not refer to the heap and is kept across collections
+    thread->GetEcmaVM()->CollectGarbage(TriggerGCType::FULL_GC);
+    ASSERT_TRUE(regExpParserCache->GetCache(string1, 0, vec).first != nullptr);
+}
+
+HWTEST_F_L0(BuiltinsRegExpTest, RegExpParseCacheEviction)
+{
+    RegExpParserCache regExpParserCache(512);  // 512: room for a few small patterns
+    uint8_t codeBuffer[64] = {0};  // 64: size of the byte code
     CVector<CString> vec;
-    regExpParserCache->SetCache(*string1, 0, JSTaggedValue::True(), 2, vec);
-    ASSERT_TRUE(regExpParserCache->GetCache(*string1, 0, vec).first == JSTaggedValue::True());
-    ASSERT_TRUE(regExpParserCache->GetCache(*string1, 0, vec).second == 2U);
-    ASSERT_TRUE(regExpParserCache->GetCache(*string1,
-                                            RegExpParserCache::CACHE_SIZE, vec).first == JSTaggedValue::Hole());
-    ASSERT_TRUE(regExpParserCache->GetCache(*string2, 0, vec).first == JSTaggedValue::Hole());
+    for (int i = 0; i < 10; i++) {  // 10: more patterns than the cache can hold
+        regExpParserCache.SetCache(CString("pattern") + ToCString(i), 0, codeBuffer, sizeof(codeBuffer), vec);
+        // keep the first pattern in use
+        ASSERT_TRUE(regExpParserCache.GetCache(CString("pattern0"), 0, vec).first != nullptr);
+    }
+    ASSERT_LE(regExpParserCache.GetCachedBytes(), 512U);
+    ASSERT_GT(regExpParserCache.GetEvictionCount(), 0U);
+    ASSERT_EQ(regExpParserCache.GetCachedCount() + regExpParserCache.GetEvictionCount(), 10U);
+    ASSERT_TRUE(regExpParserCache.GetCache(CString("pattern1"), 0, vec).first == nullptr);
+    ASSERT_TRUE(regExpParserCache.GetCache(CString("pattern9"), 0, vec).first != nullptr);
+    ASSERT_EQ(regExpParserCache.GetHitCount(), 11U);
+    ASSERT_EQ(regExpParserCache.GetMissCount(), 1U);
 }
 }  // namespace panda::test
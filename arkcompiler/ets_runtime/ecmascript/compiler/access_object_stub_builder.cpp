@@ -37,7 +37,11 @@ GateRef AccessObjectStubBuilder::LoadObjByName(GateRef glue, GateRef receiver, G
     builder.LoadICByName(&result, &tryFastPath, &slowPath, &exit);
     Bind(&tryFastPath);
     {
+        Label tryGenericPath(env);
         GateRef propKey = ResolvePropKey(glue, prop, info);
+        builder.SetParameters(glue, receiver, profileTypeInfo, value, slotId, propKey);
+        builder.LoadMegaICByName(&result, &tryGenericPath, &slowPath, &exit);
+        Bind(&tryGenericPath);
         result = GetPropertyByName(glue, receiver, propKey);
         Branch(TaggedIsHole(*result), &slowPath, &exit);
     }
@@ -99,7 +103,11 @@ GateRef AccessObjectStubBuilder::StoreObjByName(GateRef glue, GateRef receiver,
     builder.StoreICByName(&result, &tryFastPath, &slowPath, &exit);
     Bind(&tryFastPath);
     {
+        Label tryGenericPath(env);
         GateRef propKey = ResolvePropKey(glue, prop, info);
+        builder.SetParameters(glue, receiver, profileTypeInfo, value, slotId, propKey);
+        builder.StoreMegaICByName(&result, &tryGenericPath, &slowPath, &exit);
+        Bind(&tryGenericPath);
         result = SetPropertyByName(glue, receiver, propKey, value, false);
         Branch(TaggedIsHole(*result), &slowPath, &exit);
     }
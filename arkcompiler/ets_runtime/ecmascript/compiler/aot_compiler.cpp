@@ -106,6 +106,7 @@ int Main(const int argc, const char **argv)
         size_t maxAotMethodSize = runtimeOptions.GetMaxAotMethodSize();
         bool isEnableTypeLowering = runtimeOptions.IsEnableTypeLowering();
         uint32_t hotnessThreshold = runtimeOptions.GetPGOHotnessThreshold();
+        uint32_t compilerThreadNum = runtimeOptions.GetCompilerThreadNum();
         AOTInitialize(vm);
 
         CompilerLog log(logOption, isTraceBC);
@@ -117,7 +118,7 @@ int Main(const int argc, const char **argv)
             entrypoint = runtimeOptions.GetEntryPoint();
         }
         PassManager passManager(vm, entrypoint, triple, optLevel, relocMode, &log, &logList, maxAotMethodSize,
-                                isEnableTypeLowering, profilerIn, hotnessThreshold);
+                                isEnableTypeLowering, profilerIn, hotnessThreshold, compilerThreadNum);
         for (const auto &fileName : pandaFileNames) {
             auto extendedFilePath = panda::os::file::File::GetExtendedFilePath(fileName);
             LOG_COMPILER(INFO) << "AOT compile: " << extendedFilePath;
@@ -165,7 +165,7 @@ DECLARE_BUILTINS(CharCodeAt)
     {
         Branch(TaggedIsHeapObject(thisValue), &thisIsHeapobject, &slowPath);
         Bind(&thisIsHeapobject);
-        Branch(IsString(thisValue), &isString, &slowPath);
+        Branch(IsLineString(thisValue), &isString, &slowPath);
         Bind(&isString);
         {
             GateRef thisLen = GetLengthFromString(thisValue);
@@ -235,13 +235,13 @@ DECLARE_BUILTINS(IndexOf)
     {
         Branch(TaggedIsHeapObject(thisValue), &thisIsHeapobject, &slowPath);
         Bind(&thisIsHeapobject);
-        Branch(IsString(thisValue), &isString, &slowPath);
+        Branch(IsLineString(thisValue), &isString, &slowPath);
         Bind(&isString);
         {
             GateRef searchTag = GetCallArg0();
             Branch(TaggedIsHeapObject(searchTag), &searchTagIsHeapObject, &slowPath);
             Bind(&searchTagIsHeapObject);
-            Branch(IsString(searchTag), &isSearchString, &slowPath);
+            Branch(IsLineString(searchTag), &isSearchString, &slowPath);
             Bind(&isSearchString);
             {
                 GateRef thisLen = GetLengthFromString(thisValue);
@@ -348,7 +348,7 @@ DECLARE_BUILTINS(Substring)
     {
         Branch(TaggedIsHeapObject(thisValue), &thisIsHeapobject, &slowPath);
         Bind(&thisIsHeapobject);
-        Branch(IsString(thisValue), &isString, &slowPath);
+        Branch(IsLineString(thisValue), &isString, &slowPath);
         Bind(&isString);
         {
             Label next(env);
@@ -497,7 +497,7 @@ DECLARE_BUILTINS(CharAt)
     {
         Branch(TaggedIsHeapObject(thisValue), &thisIsHeapobject, &slowPath);
         Bind(&thisIsHeapobject);
-        Branch(IsString(thisValue), &isString, &slowPath);
+        Branch(IsLineString(thisValue), &isString, &slowPath);
         Bind(&isString);
         {
             GateRef thisLen = GetLengthFromString(thisValue);
@@ -1412,6 +1412,31 @@ DEF_CALL_SIGNATURE(FindElementWithCache)
     callSign->SetTargetKind(CallSignature::TargetKind::RUNTIME_STUB_NO_GC);
 }
 
+#define MEGA_IC_HANDLER_CALL_SIGNATURE(name)                    \
+    /* 3 : 3 input parameters */                                \
+    CallSignature signature(#name, 0, 3,                        \
+        ArgumentsOrder::DEFAULT_ORDER, VariableType::JS_ANY()); \
+    *callSign = signature;                                      \
+    /* 3 : 3 input parameters */                                \
+    std::array<VariableType, 3> params = {                      \
+        VariableType::NATIVE_POINTER(),                         \
+        VariableType::JS_ANY(),                                 \
+        VariableType::JS_ANY(),                                 \
+    };                                                          \
+    callSign->SetParameters(params.data());                     \
+    callSign->SetGCLeafFunction(true);                          \
+    callSign->SetTargetKind(CallSignature::TargetKind::RUNTIME_STUB_NO_GC);
+
+DEF_CALL_SIGNATURE(GetLoadMegaICHandler)
+{
+    MEGA_IC_HANDLER_CALL_SIGNATURE(GetLoadMegaICHandler)
+}
+
+DEF_CALL_SIGNATURE(GetStoreMegaICHandler)
+{
+    MEGA_IC_HANDLER_CALL_SIGNATURE(GetStoreMegaICHandler)
+}
+
 DEF_CALL_SIGNATURE(DoubleToInt)
 {
     // 1 : 1 input parameters
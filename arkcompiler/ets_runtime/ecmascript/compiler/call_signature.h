@@ -406,6 +406,8 @@ private:
     V(FloatATan)                            \
     V(FloatFloor)                           \
     V(FindElementWithCache)                 \
+    V(GetLoadMegaICHandler)                 \
+    V(GetStoreMegaICHandler)                \
     V(MarkingBarrier)                       \
     V(StoreBarrier)                         \
     V(CallArg0)                             \
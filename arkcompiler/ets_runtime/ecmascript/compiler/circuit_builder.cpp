@@ -180,6 +180,20 @@ GateRef CircuitBuilder::StableArrayCheck(GateRef gate)
     return ret;
 }
 
+GateRef CircuitBuilder::HeapObjectCheck(GateRef gate)
+{
+    auto currentLabel = env_->GetCurrentLabel();
+    auto currentControl = currentLabel->GetControl();
+    auto currentDepend = currentLabel->GetDepend();
+    ASSERT(acc_.HasFrameState(currentDepend));
+    auto frameState = acc_.GetFrameState(currentDepend);
+    GateRef ret = GetCircuit()->NewGate(circuit_->HeapObjectCheck(),
+        MachineType::I1, {currentControl, currentDepend, gate, frameState}, GateType::NJSValue());
+    currentLabel->SetControl(ret);
+    currentLabel->SetDepend(ret);
+    return ret;
+}
+
 GateRef CircuitBuilder::TypedArrayCheck(GateType type, GateRef gate)
 {
     auto currentLabel = env_->GetCurrentLabel();
@@ -653,8 +667,7 @@ GateRef CircuitBuilder::TaggedIsString(GateRef obj)
     Branch(TaggedIsHeapObject(obj), &isHeapObject, &exit);
     Bind(&isHeapObject);
     {
-        result = Equal(GetObjectType(LoadHClass(obj)),
-            Int32(static_cast<int32_t>(JSType::STRING)));
+        result = TaggedObjectIsString(obj);
         Jump(&exit);
     }
     Bind(&exit);
@@ -674,7 +687,7 @@ GateRef CircuitBuilder::TaggedIsStringOrSymbol(GateRef obj)
     Bind(&isHeapObject);
     {
         GateRef objType = GetObjectType(LoadHClass(obj));
-        result = Equal(objType, Int32(static_cast<int32_t>(JSType::STRING)));
+        result = TaggedObjectIsString(obj);
         Label isString(env_);
         Label notString(env_);
         Branch(*result, &exit, &notString);
@@ -221,6 +221,7 @@ public:
     inline GateRef Int32OverflowCheck(GateRef gate);
     GateRef ArrayCheck(GateRef gate);
     GateRef StableArrayCheck(GateRef gate);
+    GateRef HeapObjectCheck(GateRef gate);
     GateRef TypedArrayCheck(GateType type, GateRef gate);
     GateRef IndexCheck(GateType type, GateRef gate, GateRef index);
     GateRef ObjectTypeCheck(GateType type, GateRef gate, GateRef hclassOffset);
@@ -441,6 +442,7 @@ public:
     inline GateRef IsExtensible(GateRef object);
     inline GateRef TaggedObjectIsEcmaObject(GateRef obj);
     inline GateRef IsJSObject(GateRef obj);
+    inline GateRef TaggedObjectIsString(GateRef obj);
     inline GateRef TaggedObjectBothAreString(GateRef x, GateRef y);
     inline GateRef IsCallable(GateRef obj);
     inline GateRef IsCallableFromBitField(GateRef bitfield);
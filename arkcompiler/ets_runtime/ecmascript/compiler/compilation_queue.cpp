@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/compilation_queue.h"
+
+#include "ecmascript/compiler/pass_manager.h"
+#include "ecmascript/taskpool/taskpool.h"
+
+namespace panda::ecmascript::kungfu {
+CompilationUnit::CompilationUnit(PassInfo *info, const CString &recordName, const std::string &fullName,
+                                 MethodLiteral *methodLiteral, uint32_t methodOffset,
+                                 const MethodPcInfo &methodPCInfo, size_t methodInfoIndex, bool hasTypes,
+                                 bool enableLog, bool enableTypeLowering, NativeAreaAllocator *allocator)
+    : recordName_(recordName), circuit_(allocator, info->GetCompilerConfig()->Is64Bit())
+{
+    builder_ = std::make_unique<BytecodeCircuitBuilder>(info->GetJSPandaFile(), methodLiteral, methodPCInfo,
+                                                        info->GetTSManager(), &circuit_, info->GetByteCodes(),
+                                                        hasTypes, enableLog, enableTypeLowering, fullName,
+                                                        recordName_);
+    data_ = std::make_unique<PassData>(builder_.get(), &circuit_, info, info->GetCompilerLog(), fullName,
+                                       methodInfoIndex, hasTypes, recordName_, methodLiteral, methodOffset,
+                                       allocator);
+}
+
+void CompilationQueue::Push(std::unique_ptr<CompilationUnit> unit)
+{
+    if (!IsParallel()) {
+        Schedule(unit.get());
+        GenerateIR(unit.get());
+        return;
+    }
+    CompilationUnit *pushed = unit.get();
+    {
+        os::memory::LockHolder holder(mutex_);
+        pending_.push_back({std::move(unit), false});
+    }
+    Taskpool::GetCurrentTaskpool()->PostTask(std::make_unique<ScheduleTask>(taskId_, this, pushed));
+    while (pending_.size() > maxPending_) {
+        EmitFront();
+    }
+}
+
+void CompilationQueue::Flush()
+{
+    while (!pending_.empty()) {
+        EmitFront();
+    }
+}
+
+void CompilationQueue::Schedule(CompilationUnit *unit)
+{
+    PassRunner<PassData> pipeline(unit->GetData());
+    pipeline.RunPass<VerifierPass>();
+    pipeline.RunPass<SchedulingPass>();
+}
+
+void CompilationQueue::GenerateIR(CompilationUnit *unit)
+{
+    PassRunner<PassData> pipeline(unit->GetData());
+    pipeline.RunPass<LLVMIRGenPass>();
+}
+
+void CompilationQueue::FinishSchedule(CompilationUnit *unit)
+{
+    os::memory::LockHolder holder(mutex_);
+    for (auto &pending : pending_) {
+        if (pending.unit.get() == unit) {
+            pending.scheduled = true;
+            break;
+        }
+    }
+    scheduledCV_.SignalAll();
+}
+
+void CompilationQueue::EmitFront()
+{
+    std::unique_ptr<CompilationUnit> unit;
+    {
+        os::memory::LockHolder holder(mutex_);
+        while (!pending_.front().scheduled) {
+            scheduledCV_.Wait(&mutex_);
+        }
+        unit = std::move(pending_.front().unit);
+        pending_.pop_front();
+    }
+    GenerateIR(unit.get());
+}
+
+bool CompilationQueue::ScheduleTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    Schedule(unit_);
+    queue_->FinishSchedule(unit_);
+    return true;
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_COMPILATION_QUEUE_H
+#define ECMASCRIPT_COMPILER_COMPILATION_QUEUE_H
+
+#include <deque>
+#include <memory>
+
+#include "ecmascript/compiler/pass.h"
+#include "ecmascript/taskpool/task.h"
+#include "os/mutex.h"
+
+namespace panda::ecmascript::kungfu {
+// Circuit of one method together with its builder and pass data. It lives from bytecode translation until llvm ir
+// is generated, which may happen after the next methods have been translated.
+class CompilationUnit {
+public:
+    CompilationUnit(PassInfo *info, const CString &recordName, const std::string &fullName,
+                    MethodLiteral *methodLiteral, uint32_t methodOffset, const MethodPcInfo &methodPCInfo,
+                    size_t methodInfoIndex, bool hasTypes, bool enableLog, bool enableTypeLowering,
+                    NativeAreaAllocator *allocator);
+    ~CompilationUnit() = default;
+    NO_COPY_SEMANTIC(CompilationUnit);
+    NO_MOVE_SEMANTIC(CompilationUnit);
+
+    BytecodeCircuitBuilder *GetBuilder() const
+    {
+        return builder_.get();
+    }
+
+    PassData *GetData() const
+    {
+        return data_.get();
+    }
+
+private:
+    CString recordName_;
+    Circuit circuit_;
+    std::unique_ptr<BytecodeCircuitBuilder> builder_ {nullptr};
+    std::unique_ptr<PassData> data_ {nullptr};
+};
+
+// Runs the passes that only read their own circuit (verifier and scheduling) on the taskpool, while the js thread
+// translates and lowers the next methods. Lowering stays on the js thread because it uses the TSManager and the
+// heap, and llvm ir is generated on the js thread in push order because all methods share one llvm module, so the
+// output does not depend on the thread count.
+class CompilationQueue {
+public:
+    CompilationQueue(int32_t taskId, uint32_t threadNum) : taskId_(taskId), maxPending_(threadNum) {}
+    ~CompilationQueue() = default;
+    NO_COPY_SEMANTIC(CompilationQueue);
+    NO_MOVE_SEMANTIC(CompilationQueue);
+
+    bool IsParallel() const
+    {
+        return maxPending_ > 1;
+    }
+
+    // unit has run its lowering passes
+    void Push(std::unique_ptr<CompilationUnit> unit);
+    // generates llvm ir for all pushed units
+    void Flush();
+
+private:
+    class ScheduleTask : public Task {
+    public:
+        ScheduleTask(int32_t id, CompilationQueue *queue, CompilationUnit *unit)
+            : Task(id), queue_(queue), unit_(unit) {}
+        ~ScheduleTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(ScheduleTask);
+        NO_MOVE_SEMANTIC(ScheduleTask);
+
+    private:
+        CompilationQueue *queue_ {nullptr};
+        CompilationUnit *unit_ {nullptr};
+    };
+
+    struct PendingUnit {
+        std::unique_ptr<CompilationUnit> unit;
+        bool scheduled {false};
+    };
+
+    static void Schedule(CompilationUnit *unit);
+    static void GenerateIR(CompilationUnit *unit);
+    void FinishSchedule(CompilationUnit *unit);
+    void EmitFront();
+
+    int32_t taskId_ {0};
+    uint32_t maxPending_ {1};
+    std::deque<PendingUnit> pending_ {};
+    os::memory::Mutex mutex_;
+    os::memory::ConditionVariable scheduledCV_;
+};
+}  // namespace panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_COMPILATION_QUEUE_H
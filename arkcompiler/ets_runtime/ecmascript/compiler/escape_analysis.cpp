@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/escape_analysis.h"
+
+#include "ecmascript/global_env_constants-inl.h"
+#include "ecmascript/jspandafile/program_object.h"
+
+namespace panda::ecmascript::kungfu {
+namespace {
+size_t GetFieldNum(VirtualObjectKind kind)
+{
+    switch (kind) {
+        case VirtualObjectKind::ITER_RESULT:
+            return 2;  // 2: value, done
+        case VirtualObjectKind::CLOSURE:
+            return 3;  // 3: method id, length, env
+        default:
+            return 0;
+    }
+}
+}  // namespace
+
+void EscapeAnalysis::Run()
+{
+    std::vector<GateRef> gateList;
+    circuit_->GetAllGates(gateList);
+    for (const auto &gate : gateList) {
+        VirtualObjectKind kind = VirtualObjectKind::ITER_RESULT;
+        if (acc_.GetOpCode(gate) == OpCode::JS_BYTECODE && GetVirtualObjectKind(gate, &kind) &&
+            !IsEscaped(gate, kind)) {
+            ScalarReplace(gate, kind);
+        }
+    }
+
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "";
+        LOG_COMPILER(INFO) << "\033[34m"
+                           << "===================="
+                           << " After escape analysis "
+                           << "[" << GetMethodName() << "]"
+                           << "===================="
+                           << "\033[0m";
+        LOG_COMPILER(INFO) << "removed allocations: " << removedNum_;
+        circuit_->PrintAllGatesWithBytecode();
+        LOG_COMPILER(INFO) << "\033[34m" << "========================= End ==========================" << "\033[0m";
+    }
+}
+
+bool EscapeAnalysis::GetVirtualObjectKind(GateRef gate, VirtualObjectKind *kind) const
+{
+    switch (acc_.GetByteCodeOpcode(gate)) {
+        case EcmaOpcode::CREATEITERRESULTOBJ_V8_V8:
+            *kind = VirtualObjectKind::ITER_RESULT;
+            return true;
+        case EcmaOpcode::CREATEEMPTYOBJECT:
+            *kind = VirtualObjectKind::EMPTY_OBJECT;
+            return true;
+        case EcmaOpcode::CREATEEMPTYARRAY_IMM8:
+        case EcmaOpcode::CREATEEMPTYARRAY_IMM16:
+            *kind = VirtualObjectKind::EMPTY_ARRAY;
+            return true;
+        case EcmaOpcode::DEFINEFUNC_IMM8_ID16_IMM8:
+        case EcmaOpcode::DEFINEFUNC_IMM16_ID16_IMM8:
+            *kind = VirtualObjectKind::CLOSURE;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// removing a bytecode covered by a catch block would also have to rewrite the merge of the handler
+bool EscapeAnalysis::HasExceptionHandler(GateRef gate) const
+{
+    auto uses = acc_.ConstUses(gate);
+    for (auto it = uses.begin(); it != uses.end(); ++it) {
+        if (acc_.GetOpCode(*it) == OpCode::IF_EXCEPTION) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// returns the index of the field of object read by gate, or -1 if gate is not such a load
+int32_t EscapeAnalysis::GetLoadedField(GateRef gate, GateRef object, VirtualObjectKind kind) const
+{
+    if (kind != VirtualObjectKind::ITER_RESULT || acc_.GetOpCode(gate) != OpCode::JS_BYTECODE) {
+        return -1;
+    }
+    EcmaOpcode ecmaOpcode = acc_.GetByteCodeOpcode(gate);
+    if (ecmaOpcode != EcmaOpcode::LDOBJBYNAME_IMM8_ID16 && ecmaOpcode != EcmaOpcode::LDOBJBYNAME_IMM16_ID16) {
+        return -1;
+    }
+    // 3: number of value inputs
+    ASSERT(acc_.GetNumValueIn(gate) == 3);
+    if (acc_.GetValueIn(gate, 2) != object || HasExceptionHandler(gate)) { // 2: receiver
+        return -1;
+    }
+
+    DISALLOW_GARBAGE_COLLECTION;
+    uint16_t propIndex = acc_.GetConstDataId(acc_.GetValueIn(gate, 1)).GetId();
+    auto thread = tsManager_->GetEcmaVM()->GetJSThread();
+    JSHandle<ConstantPool> constantPool(tsManager_->GetConstantPool());
+    auto prop = ConstantPool::GetStringFromCache(thread, constantPool.GetTaggedValue(), propIndex);
+    const GlobalEnvConstants *globalConst = thread->GlobalConstants();
+    // own data properties of an iterator result, nothing on the prototype chain can shadow them
+    if (prop == globalConst->GetValueString()) {
+        return 0;
+    }
+    if (prop == globalConst->GetDoneString()) {
+        return 1;
+    }
+    return -1;
+}
+
+bool EscapeAnalysis::IsEscaped(GateRef gate, VirtualObjectKind kind) const
+{
+    if (HasExceptionHandler(gate)) {
+        return true;
+    }
+    auto uses = acc_.ConstUses(gate);
+    for (auto it = uses.begin(); it != uses.end(); ++it) {
+        GateRef use = *it;
+        if (!acc_.IsValueIn(use, it.GetIndex()) || acc_.GetOpCode(use) == OpCode::FRAME_STATE) {
+            continue;
+        }
+        if (GetLoadedField(use, gate, kind) < 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+GateRef EscapeAnalysis::GetField(GateRef gate, VirtualObjectKind kind, size_t index) const
+{
+    ASSERT(index < GetFieldNum(kind));
+    // the fields are the value inputs of the bytecode: value and done of an iterator result, method id, length
+    // and env of a closure
+    return acc_.GetValueIn(gate, index);
+}
+
+GateRef EscapeAnalysis::NewVirtualObject(GateRef gate, VirtualObjectKind kind)
+{
+    size_t fieldNum = GetFieldNum(kind);
+    std::vector<GateRef> inList;
+    inList.emplace_back(acc_.GetConstantGate(MachineType::I64, static_cast<uint64_t>(kind), GateType::NJSValue()));
+    for (size_t i = 0; i < fieldNum; i++) {
+        inList.emplace_back(GetField(gate, kind, i));
+    }
+    return circuit_->NewGate(circuit_->VirtualObject(inList.size()), inList);
+}
+
+void EscapeAnalysis::ScalarReplace(GateRef gate, VirtualObjectKind kind)
+{
+    GateRef virtualObject = Circuit::NullGate();
+    std::vector<GateRef> loads;
+    auto uses = acc_.Uses(gate);
+    for (auto useIt = uses.begin(); useIt != uses.end();) {
+        if (!acc_.IsValueIn(useIt)) {
+            ++useIt;
+        } else if (acc_.GetOpCode(*useIt) == OpCode::FRAME_STATE) {
+            if (virtualObject == Circuit::NullGate()) {
+                virtualObject = NewVirtualObject(gate, kind);
+            }
+            useIt = acc_.ReplaceIn(useIt, virtualObject);
+        } else {
+            loads.emplace_back(*useIt);
+            ++useIt;
+        }
+    }
+    for (auto load : loads) {
+        int32_t index = GetLoadedField(load, gate, kind);
+        ASSERT(index >= 0);
+        RemoveHir(load, GetField(gate, kind, static_cast<size_t>(index)));
+    }
+    RemoveHir(gate, Circuit::NullGate());
+    removedNum_++;
+}
+
+// gate has no exception handler, so its state and depend uses simply skip it
+void EscapeAnalysis::RemoveHir(GateRef gate, GateRef value)
+{
+    acc_.ReplaceGate(gate, acc_.GetState(gate), acc_.GetDep(gate), value);
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_ESCAPE_ANALYSIS_H
+#define ECMASCRIPT_COMPILER_ESCAPE_ANALYSIS_H
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/ts_types/ts_manager.h"
+
+namespace panda::ecmascript::kungfu {
+// Removes allocations whose object never escapes: the object is only read through fields that are known when it
+// is created, or only kept alive by frame states. Loads of the fields are replaced by the field values, and frame
+// states refer to a VIRTUAL_OBJECT gate instead, from which the deoptimizer creates the object again.
+class EscapeAnalysis {
+public:
+    EscapeAnalysis(Circuit *circuit, TSManager *tsManager, bool enableLog, const std::string &name)
+        : circuit_(circuit), acc_(circuit), tsManager_(tsManager), enableLog_(enableLog), methodName_(name) {}
+
+    ~EscapeAnalysis() = default;
+
+    void Run();
+
+private:
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    const std::string &GetMethodName() const
+    {
+        return methodName_;
+    }
+
+    bool GetVirtualObjectKind(GateRef gate, VirtualObjectKind *kind) const;
+    bool HasExceptionHandler(GateRef gate) const;
+    int32_t GetLoadedField(GateRef gate, GateRef object, VirtualObjectKind kind) const;
+    bool IsEscaped(GateRef gate, VirtualObjectKind kind) const;
+    GateRef GetField(GateRef gate, VirtualObjectKind kind, size_t index) const;
+    GateRef NewVirtualObject(GateRef gate, VirtualObjectKind kind);
+    void ScalarReplace(GateRef gate, VirtualObjectKind kind);
+    void RemoveHir(GateRef gate, GateRef value);
+
+    Circuit *circuit_ {nullptr};
+    GateAccessor acc_;
+    TSManager *tsManager_ {nullptr};
+    bool enableLog_ {false};
+    std::string methodName_;
+    size_t removedNum_ {0};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_ESCAPE_ANALYSIS_H
@@ -88,6 +88,15 @@ enum class DeoptType : uint8_t {
     NOTDECOV,
     NOTNEGOV,
     NOTCALLTGT,
+    NOTHEAPOBJECT,
+};
+
+// objects removed by escape analysis, the deoptimizer creates them again from their fields
+enum class VirtualObjectKind : uint8_t {
+    ITER_RESULT = 0,  // fields: value, done
+    EMPTY_OBJECT,
+    EMPTY_ARRAY,
+    CLOSURE,  // fields: method id, length, env
 };
 
 enum class ICmpCondition : uint8_t {
@@ -195,6 +204,7 @@ std::string MachineTypeToStr(MachineType machineType);
     V(TypedCallCheck, TYPED_CALL_CHECK, GateFlags::CHECKABLE, 1, 1, 3)                  \
     V(ArrayCheck, ARRAY_CHECK, GateFlags::CHECKABLE, 1, 1, 1)                           \
     V(StableArrayCheck, STABLE_ARRAY_CHECK, GateFlags::CHECKABLE, 1, 1, 1)              \
+    V(HeapObjectCheck, HEAP_OBJECT_CHECK, GateFlags::CHECKABLE, 1, 1, 1)                \
     V(DeoptCheck, DEOPT_CHECK, GateFlags::NONE_FLAG, 1, 1, 3)                           \
     V(LoadProperty, LOAD_PROPERTY, GateFlags::NO_WRITE, 1, 1, 2)                        \
     V(StoreProperty, STORE_PROPERTY, GateFlags::NONE_FLAG, 1, 1, 3)                     \
@@ -213,6 +223,7 @@ std::string MachineTypeToStr(MachineType machineType);
     V(TypedCall, TYPED_CALL, GateFlags::NONE_FLAG, 1, 1, value)                          \
     V(Construct, CONSTRUCT, GateFlags::NONE_FLAG, 1, 1, value)                           \
     V(FrameState, FRAME_STATE, GateFlags::NONE_FLAG, 0, 0, value)                        \
+    V(VirtualObject, VIRTUAL_OBJECT, GateFlags::NONE_FLAG, 0, 0, value)                  \
     V(RuntimeCall, RUNTIME_CALL, GateFlags::NONE_FLAG, 0, 1, value)                      \
     V(RuntimeCallWithArgv, RUNTIME_CALL_WITH_ARGV, GateFlags::NONE_FLAG, 0, 1, value)    \
     V(NoGcRuntimeCall, NOGC_RUNTIME_CALL, GateFlags::NONE_FLAG, 0, 1, value)             \
@@ -96,6 +96,82 @@ void ICStubBuilder::ValuedICAccessor(Variable* cachedHandler, Label *tryICHandle
     }
 }
 
+// Receivers the ic runtime puts into the megamorphic cache, see ICRuntimeStub::LoadMegaICByName.
+GateRef ICStubBuilder::IsMegaICCacheable(GateRef hclass)
+{
+    GateRef jsType = GetObjectType(hclass);
+    GateRef isJSObject = BoolAnd(
+        Int32GreaterThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_OBJECT_FIRST))),
+        Int32LessThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_OBJECT_LAST))));
+    GateRef isTypedArray = BoolAnd(
+        Int32GreaterThan(jsType, Int32(static_cast<int32_t>(JSType::JS_TYPED_ARRAY_FIRST))),
+        Int32LessThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_TYPED_ARRAY_LAST))));
+    GateRef isSpecialContainer = BoolAnd(
+        Int32GreaterThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_API_ARRAY_LIST))),
+        Int32LessThanOrEqual(jsType, Int32(static_cast<int32_t>(JSType::JS_API_QUEUE))));
+    GateRef isModuleNamespace = Int32Equal(jsType, Int32(static_cast<int32_t>(JSType::JS_MODULE_NAMESPACE)));
+    GateRef hasOrdinaryGet = BoolOr(BoolOr(isTypedArray, isSpecialContainer), isModuleNamespace);
+    return BoolAnd(BoolAnd(isJSObject, BoolNot(hasOrdinaryGet)), BoolNot(IsDictionaryModeByHClass(hclass)));
+}
+
+// Once the ic of the site went megamorphic, the handler is looked up in the cache shared by all such sites. On a
+// miss cacheable receivers go to the slow path, which fills the cache, the others take the generic fast path.
+void ICStubBuilder::MegaICAccessor(Variable* cachedHandler, Label *tryICHandler, int handlerStubId)
+{
+    auto env = GetEnvironment();
+    Label receiverIsHeapObject(env);
+    Label hasProfile(env);
+    Label isMega(env);
+    Label miss(env);
+
+    Branch(TaggedIsHeapObject(receiver_), &receiverIsHeapObject, tryFastPath_);
+    Bind(&receiverIsHeapObject);
+    Branch(TaggedIsUndefined(profileTypeInfo_), tryFastPath_, &hasProfile);
+    Bind(&hasProfile);
+    GateRef firstValue = GetValueFromTaggedArray(profileTypeInfo_, slotId_);
+    Branch(TaggedIsHole(firstValue), &isMega, tryFastPath_);
+    Bind(&isMega);
+    {
+        GateRef hclass = LoadHClass(receiver_);
+        cachedHandler->WriteVariable(CallNGCRuntime(glue_, handlerStubId, { glue_, hclass, propKey_ }));
+        Branch(TaggedIsHole(cachedHandler->ReadVariable()), &miss, tryICHandler);
+        Bind(&miss);
+        Branch(IsMegaICCacheable(hclass), slowPath_, tryFastPath_);
+    }
+}
+
+void ICStubBuilder::LoadMegaICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success)
+{
+    auto env = GetEnvironment();
+    Label loadWithHandler(env);
+
+    SetLabels(tryFastPath, slowPath, success);
+    DEFVARIABLE(cachedHandler, VariableType::JS_ANY(), Hole());
+    MegaICAccessor(&cachedHandler, &loadWithHandler, RTSTUB_ID(GetLoadMegaICHandler));
+    Bind(&loadWithHandler);
+    {
+        GateRef ret = LoadICWithHandler(glue_, receiver_, receiver_, *cachedHandler);
+        result->WriteVariable(ret);
+        Branch(TaggedIsHole(ret), tryFastPath_, success_);
+    }
+}
+
+void ICStubBuilder::StoreMegaICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success)
+{
+    auto env = GetEnvironment();
+    Label storeWithHandler(env);
+
+    SetLabels(tryFastPath, slowPath, success);
+    DEFVARIABLE(cachedHandler, VariableType::JS_ANY(), Hole());
+    MegaICAccessor(&cachedHandler, &storeWithHandler, RTSTUB_ID(GetStoreMegaICHandler));
+    Bind(&storeWithHandler);
+    {
+        GateRef ret = StoreICWithHandler(glue_, receiver_, receiver_, value_, *cachedHandler);
+        result->WriteVariable(ret);
+        Branch(TaggedIsHole(ret), tryFastPath_, success_);
+    }
+}
+
 void ICStubBuilder::LoadICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success)
 {
     auto env = GetEnvironment();
@@ -49,8 +49,12 @@ public:
     void StoreICByValue(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
     void TryLoadGlobalICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
     void TryStoreGlobalICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
+    void LoadMegaICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
+    void StoreMegaICByName(Variable* result, Label* tryFastPath, Label *slowPath, Label *success);
 private:
     void NamedICAccessor(Variable* cachedHandler, Label *tryICHandler);
+    void MegaICAccessor(Variable* cachedHandler, Label *tryICHandler, int handlerStubId);
+    GateRef IsMegaICCacheable(GateRef hclass);
     void ValuedICAccessor(Variable* cachedHandler, Label *tryICHandler, Label* tryElementIC);
     void SetLabels(Label* tryFastPath, Label *slowPath, Label *success)
     {
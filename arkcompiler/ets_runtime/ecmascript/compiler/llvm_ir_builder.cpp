@@ -188,7 +188,7 @@ void LLVMIRBuilder::InitializeHandlers()
         OpCode::RETURN_LIST,
         OpCode::ARG_LIST, OpCode::THROW,
         OpCode::DEPEND_SELECTOR, OpCode::DEPEND_RELAY, OpCode::DEPEND_AND,
-        OpCode::FRAME_STATE, OpCode::STATE_SPLIT
+        OpCode::FRAME_STATE, OpCode::STATE_SPLIT, OpCode::VIRTUAL_OBJECT
     };
 }
 
@@ -1967,16 +1967,14 @@ void LLVMIRBuilder::VisitDeopt(GateRef gate)
         if (acc_.IsConstantValue(vregValue, JSTaggedValue::VALUE_OPTIMIZED_OUT)) {
             continue;
         }
-        values.emplace_back(LLVMConstInt(LLVMInt32Type(), i, false));
-        values.emplace_back(gate2LValue_.at(vregValue));
+        CollectDeoptValue(values, static_cast<int32_t>(i), vregValue);
     }
     if (!acc_.IsConstantValue(env, JSTaggedValue::VALUE_OPTIMIZED_OUT)) {
         values.emplace_back(LLVMConstInt(LLVMInt32Type(), static_cast<int>(SpecVregIndex::ENV_INDEX), false));
         values.emplace_back(gate2LValue_.at(env));
     }
     if (!acc_.IsConstantValue(acc, JSTaggedValue::VALUE_OPTIMIZED_OUT)) {
-        values.emplace_back(LLVMConstInt(LLVMInt32Type(), static_cast<int>(SpecVregIndex::ACC_INDEX), false));
-        values.emplace_back(gate2LValue_.at(acc));
+        CollectDeoptValue(values, static_cast<int32_t>(SpecVregIndex::ACC_INDEX), acc);
     }
     values.emplace_back(LLVMConstInt(LLVMInt32Type(), static_cast<int>(SpecVregIndex::PC_INDEX), false));
     values.emplace_back(gate2LValue_.at(pc));
@@ -1985,6 +1983,25 @@ void LLVMIRBuilder::VisitDeopt(GateRef gate)
     gate2LValue_[gate] = runtimeCall;
 }
 
+// an object removed by escape analysis is passed as its kind and fields, see VirtualObjectIndex
+void LLVMIRBuilder::CollectDeoptValue(std::vector<LLVMValueRef> &values, int32_t index, GateRef value)
+{
+    if (acc_.GetOpCode(value) != OpCode::VIRTUAL_OBJECT) {
+        values.emplace_back(LLVMConstInt(LLVMInt32Type(), index, false));
+        values.emplace_back(gate2LValue_.at(value));
+        return;
+    }
+    size_t numValueIn = acc_.GetNumValueIn(value);
+    ASSERT(numValueIn > 0 && numValueIn <= VirtualObjectIndex::MAX_FIELD_NUM + 1);
+    values.emplace_back(LLVMConstInt(LLVMInt32Type(), VirtualObjectIndex::GetKindIndex(index), false));
+    values.emplace_back(gate2LValue_.at(acc_.GetValueIn(value, 0)));
+    for (size_t i = 1; i < numValueIn; i++) {
+        int32_t fieldIndex = VirtualObjectIndex::GetFieldIndex(index, i - 1);
+        values.emplace_back(LLVMConstInt(LLVMInt32Type(), fieldIndex, false));
+        values.emplace_back(gate2LValue_.at(acc_.GetValueIn(value, i)));
+    }
+}
+
 LLVMModule::LLVMModule(const std::string &name, const std::string &triple, bool enablePGOProfiler)
     : cfg_(triple, enablePGOProfiler)
 {
@@ -341,6 +341,7 @@ private:
     LLVMTypeRef GetExperimentalDeoptTy();
     LLVMValueRef GetExperimentalDeopt(LLVMModuleRef &module);
     void GenDeoptEntry(LLVMModuleRef &module);
+    void CollectDeoptValue(std::vector<LLVMValueRef> &values, int32_t index, GateRef value);
     const CompilationConfig *compCfg_ {nullptr};
     const std::vector<std::vector<GateRef>> *scheduledGates_ {nullptr};
     const Circuit *circuit_ {nullptr};
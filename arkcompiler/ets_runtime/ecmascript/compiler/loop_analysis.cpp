@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/loop_analysis.h"
+
+#include <algorithm>
+
+namespace panda::ecmascript::kungfu {
+void LoopAnalysis::Run()
+{
+    std::vector<GateRef> gateList;
+    acc_.GetAllGates(gateList);
+    for (const auto &gate : gateList) {
+        if (acc_.GetOpCode(gate) != OpCode::LOOP_BEGIN) {
+            continue;
+        }
+        GateRef loopBack = acc_.GetState(gate, 1);  // 1: loop back
+        auto loop = std::make_unique<LoopInfo>(gate, loopBack);
+        CollectBody(loop.get());
+        loops_.emplace_back(loop.get());
+        loopInfos_.emplace_back(std::move(loop));
+    }
+
+    // a loop has more gates than any loop nested in it
+    std::stable_sort(loops_.begin(), loops_.end(), [](const LoopInfo *lhs, const LoopInfo *rhs) {
+        return lhs->GetBody().size() > rhs->GetBody().size();
+    });
+    for (auto loop : loops_) {
+        auto parent = innermostLoop_.find(loop->GetLoopHead());
+        if (parent != innermostLoop_.end()) {
+            loop->parent_ = parent->second;
+            loop->depth_ = parent->second->GetDepth() + 1;
+            parent->second->children_.emplace_back(loop);
+        }
+        for (const auto &state : loop->GetBody()) {
+            innermostLoop_[state] = loop;
+        }
+    }
+}
+
+void LoopAnalysis::CollectBody(LoopInfo *loop)
+{
+    GateRef loopHead = loop->GetLoopHead();
+    auto &body = loop->body_;
+    std::vector<GateRef> workList;
+    body.insert(loopHead);
+    if (body.insert(loop->GetLoopBack()).second) {
+        workList.emplace_back(loop->GetLoopBack());
+    }
+    while (!workList.empty()) {
+        GateRef gate = workList.back();
+        workList.pop_back();
+        size_t stateCount = acc_.GetStateCount(gate);
+        for (size_t i = 0; i < stateCount; i++) {
+            GateRef pred = acc_.GetState(gate, i);
+            if (acc_.IsState(pred) && body.insert(pred).second) {
+                workList.emplace_back(pred);
+            }
+        }
+    }
+}
+
+LoopInfo *LoopAnalysis::GetInnermostLoop(GateRef state) const
+{
+    auto it = innermostLoop_.find(state);
+    if (it == innermostLoop_.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+size_t LoopAnalysis::GetLoopDepth(GateRef state) const
+{
+    LoopInfo *loop = GetInnermostLoop(state);
+    return loop == nullptr ? 0 : loop->GetDepth();
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_LOOP_ANALYSIS_H
+#define ECMASCRIPT_COMPILER_LOOP_ANALYSIS_H
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ecmascript/compiler/circuit.h"
+#include "ecmascript/compiler/gate_accessor.h"
+
+namespace panda::ecmascript::kungfu {
+class LoopInfo {
+public:
+    LoopInfo(GateRef loopHead, GateRef loopBack) : loopHead_(loopHead), loopBack_(loopBack) {}
+    ~LoopInfo() = default;
+
+    GateRef GetLoopHead() const
+    {
+        return loopHead_;
+    }
+
+    GateRef GetLoopBack() const
+    {
+        return loopBack_;
+    }
+
+    LoopInfo *GetParent() const
+    {
+        return parent_;
+    }
+
+    const std::vector<LoopInfo *> &GetChildren() const
+    {
+        return children_;
+    }
+
+    // 1 for an outermost loop
+    size_t GetDepth() const
+    {
+        return depth_;
+    }
+
+    // state gates from the loop head to the loop back, including the ones of nested loops
+    const std::unordered_set<GateRef> &GetBody() const
+    {
+        return body_;
+    }
+
+    bool Contains(GateRef state) const
+    {
+        return body_.count(state) > 0;
+    }
+
+private:
+    GateRef loopHead_ {Circuit::NullGate()};
+    GateRef loopBack_ {Circuit::NullGate()};
+    LoopInfo *parent_ {nullptr};
+    std::vector<LoopInfo *> children_;
+    size_t depth_ {1};
+    std::unordered_set<GateRef> body_;
+
+    friend class LoopAnalysis;
+};
+
+// Builds the loop tree of a circuit. Every LOOP_BEGIN heads a natural loop whose body is found by walking the
+// state inputs back from its LOOP_BACK, loops nest by containment of their heads.
+class LoopAnalysis {
+public:
+    explicit LoopAnalysis(Circuit *circuit) : acc_(circuit) {}
+    ~LoopAnalysis() = default;
+
+    void Run();
+
+    // outermost loops first, a loop always comes before the loops nested in it
+    const std::vector<LoopInfo *> &GetLoops() const
+    {
+        return loops_;
+    }
+
+    LoopInfo *GetInnermostLoop(GateRef state) const;
+    size_t GetLoopDepth(GateRef state) const;
+
+private:
+    void CollectBody(LoopInfo *loop);
+
+    GateAccessor acc_;
+    std::vector<std::unique_ptr<LoopInfo>> loopInfos_;
+    std::vector<LoopInfo *> loops_;
+    std::unordered_map<GateRef, LoopInfo *> innermostLoop_;
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_LOOP_ANALYSIS_H
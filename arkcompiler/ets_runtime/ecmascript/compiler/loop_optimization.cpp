@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/compiler/loop_optimization.h"
+
+#include <algorithm>
+
+#include "ecmascript/compiler/scheduler.h"
+
+namespace panda::ecmascript::kungfu {
+void LoopOptimization::Run()
+{
+    LoopAnalysis loopAnalysis(circuit_);
+    loopAnalysis.Run();
+    const auto &loops = loopAnalysis.GetLoops();
+    if (!loops.empty()) {
+        Scheduler::CalculateDominatorTree(circuit_, bbGatesList_, bbGatesAddrToIdx_, immDom_);
+        // inner loops first, so that checks hoisted out of them can leave the outer loops too
+        for (auto it = loops.rbegin(); it != loops.rend(); ++it) {
+            HoistChecks(*it);
+        }
+    }
+
+    if (IsLogEnabled()) {
+        LOG_COMPILER(INFO) << "";
+        LOG_COMPILER(INFO) << "\033[34m"
+                           << "===================="
+                           << " After loop optimization "
+                           << "[" << GetMethodName() << "]"
+                           << "===================="
+                           << "\033[0m";
+        LOG_COMPILER(INFO) << "loops: " << loops.size() << ", hoisted checks: " << hoistedNum_;
+        circuit_->PrintAllGatesWithBytecode();
+        LOG_COMPILER(INFO) << "\033[34m" << "========================= End ==========================" << "\033[0m";
+    }
+}
+
+GateRef LoopOptimization::GetDependSelector(GateRef loopHead) const
+{
+    auto uses = acc_.ConstUses(loopHead);
+    for (auto it = uses.begin(); it != uses.end(); ++it) {
+        if (acc_.GetOpCode(*it) == OpCode::DEPEND_SELECTOR) {
+            return *it;
+        }
+    }
+    return Circuit::NullGate();
+}
+
+// depend gates from the loop back to the loop head, including the ones of nested loops
+void LoopOptimization::CollectLoopDepends(GateRef dependSelector, std::unordered_set<GateRef> &depends) const
+{
+    std::vector<GateRef> workList;
+    depends.insert(dependSelector);
+    GateRef loopBackDepend = acc_.GetDep(dependSelector, 1);  // 1: loop back
+    if (depends.insert(loopBackDepend).second) {
+        workList.emplace_back(loopBackDepend);
+    }
+    while (!workList.empty()) {
+        GateRef gate = workList.back();
+        workList.pop_back();
+        size_t dependCount = acc_.GetDependCount(gate);
+        for (size_t i = 0; i < dependCount; i++) {
+            GateRef depend = acc_.GetDep(gate, i);
+            if (depends.insert(depend).second) {
+                workList.emplace_back(depend);
+            }
+        }
+    }
+}
+
+// typed stores write into objects whose layout is already known, anything else may run code changing hclasses
+bool LoopOptimization::KeepsHClass(const std::unordered_set<GateRef> &depends) const
+{
+    for (const auto &depend : depends) {
+        OpCode op = acc_.GetOpCode(depend);
+        if (!acc_.IsNotWrite(depend) && op != OpCode::STORE_ELEMENT && op != OpCode::STORE_PROPERTY) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LoopOptimization::IsInvariant(GateRef gate, const LoopInfo *loop, const std::unordered_set<GateRef> &depends)
+{
+    auto found = invariants_.find(gate);
+    if (found != invariants_.end()) {
+        return found->second;
+    }
+    bool invariant = true;
+    if (acc_.GetMetaData(gate)->IsFixed()) {
+        // a selector outside of the loop dominates it, so its value does not change in the loop
+        invariant = !loop->Contains(acc_.GetState(gate));
+    } else if (acc_.GetStateCount(gate) > 0) {
+        invariant = !loop->Contains(gate);
+    } else {
+        size_t dependCount = acc_.GetDependCount(gate);
+        for (size_t i = 0; i < dependCount && invariant; i++) {
+            invariant = depends.count(acc_.GetDep(gate, i)) == 0;
+        }
+        size_t valueCount = acc_.GetNumValueIn(gate);
+        for (size_t i = 0; i < valueCount && invariant; i++) {
+            invariant = IsInvariant(acc_.GetValueIn(gate, i), loop, depends);
+        }
+    }
+    invariants_[gate] = invariant;
+    return invariant;
+}
+
+bool LoopOptimization::IsHoistableCheck(GateRef gate, bool keepsHClass) const
+{
+    switch (acc_.GetOpCode(gate)) {
+        // the type of a value never changes
+        case OpCode::PRIMITIVE_TYPE_CHECK:
+        case OpCode::INT32_OVERFLOW_CHECK:
+        case OpCode::HEAP_OBJECT_CHECK:
+            return true;
+        // the hclass of an object stays the same as long as the loop does not run arbitrary code
+        case OpCode::ARRAY_CHECK:
+        case OpCode::STABLE_ARRAY_CHECK:
+        case OpCode::TYPED_ARRAY_CHECK:
+            return keepsHClass;
+        default:
+            return false;
+    }
+}
+
+bool LoopOptimization::Dominates(GateRef dominator, GateRef gate) const
+{
+    auto dominatorIt = bbGatesAddrToIdx_.find(dominator);
+    auto gateIt = bbGatesAddrToIdx_.find(gate);
+    if (dominatorIt == bbGatesAddrToIdx_.end() || gateIt == bbGatesAddrToIdx_.end()) {
+        return false;
+    }
+    size_t dominatorIdx = dominatorIt->second;
+    size_t idx = gateIt->second;
+    while (idx > dominatorIdx) {
+        idx = immDom_[idx];
+    }
+    return idx == dominatorIdx;
+}
+
+// The first frame state of the loop describes the frame at the loop head when nothing before it in the loop
+// writes. Replacing the selectors of the loop by their entry values gives the frame before the first iteration.
+GateRef LoopOptimization::GetLoopEntryFrameState(GateRef dependSelector, const LoopInfo *loop,
+                                                 const std::unordered_set<GateRef> &depends)
+{
+    GateRef depend = dependSelector;
+    GateRef frameState = Circuit::NullGate();
+    std::vector<GateRef> dependUses;
+    while (frameState == Circuit::NullGate()) {
+        acc_.GetDependUses(depend, dependUses);
+        if (dependUses.size() != 1) {
+            return Circuit::NullGate();
+        }
+        depend = dependUses.front();
+        if (acc_.GetOpCode(depend) == OpCode::STATE_SPLIT) {
+            frameState = acc_.GetFrameState(depend);
+        } else if (!acc_.IsNotWrite(depend) || acc_.GetMetaData(depend)->IsFixed()) {
+            return Circuit::NullGate();
+        }
+    }
+
+    size_t numValueIn = acc_.GetNumValueIn(frameState);
+    std::vector<GateRef> inList(numValueIn, Circuit::NullGate());
+    for (size_t i = 0; i < numValueIn; i++) {
+        GateRef value = acc_.GetValueIn(frameState, i);
+        if (acc_.GetOpCode(value) == OpCode::VALUE_SELECTOR && acc_.GetState(value) == loop->GetLoopHead()) {
+            value = acc_.GetValueIn(value, 0);  // 0: entry
+        } else if (!IsInvariant(value, loop, depends)) {
+            return Circuit::NullGate();
+        }
+        inList[i] = value;
+    }
+    return circuit_->NewGate(circuit_->FrameState(numValueIn), inList);
+}
+
+// appends gate, whose state and depend are the ones entering the loop, to the chains entering the loop
+void LoopOptimization::LinkBeforeLoop(GateRef gate, GateRef loopHead, GateRef dependSelector)
+{
+    acc_.ReplaceStateIn(loopHead, gate, 0);  // 0: entry
+    acc_.ReplaceDependIn(dependSelector, gate, 0);  // 0: entry
+}
+
+void LoopOptimization::HoistChecks(const LoopInfo *loop)
+{
+    GateRef loopHead = loop->GetLoopHead();
+    GateRef dependSelector = GetDependSelector(loopHead);
+    if (dependSelector == Circuit::NullGate()) {
+        return;
+    }
+    std::unordered_set<GateRef> depends;
+    CollectLoopDepends(dependSelector, depends);
+    invariants_.clear();
+    bool keepsHClass = KeepsHClass(depends);
+
+    // a check is moved only if it runs in every iteration and nothing else uses it
+    std::vector<GateRef> checks;
+    for (const auto &gate : depends) {
+        if (!IsHoistableCheck(gate, keepsHClass) || !Dominates(gate, loop->GetLoopBack())) {
+            continue;
+        }
+        bool invariant = true;
+        size_t valueCount = acc_.GetNumValueIn(gate);
+        for (size_t i = 0; i < valueCount && invariant; i++) {
+            invariant = IsInvariant(acc_.GetValueIn(gate, i), loop, depends);
+        }
+        auto uses = acc_.ConstUses(gate);
+        for (auto it = uses.begin(); it != uses.end() && invariant; ++it) {
+            invariant = !acc_.IsValueIn(*it, it.GetIndex());
+        }
+        if (invariant) {
+            checks.emplace_back(gate);
+        }
+    }
+    if (checks.empty()) {
+        return;
+    }
+    GateRef frameState = GetLoopEntryFrameState(dependSelector, loop, depends);
+    if (frameState == Circuit::NullGate()) {
+        return;
+    }
+
+    // the checks dominate each other, keep their order
+    std::sort(checks.begin(), checks.end(), [this](GateRef lhs, GateRef rhs) {
+        return Dominates(lhs, rhs) && lhs != rhs;
+    });
+    for (const auto &check : checks) {
+        GateRef state = acc_.GetState(check);
+        GateRef depend = acc_.GetDep(check);
+        auto uses = acc_.Uses(check);
+        for (auto useIt = uses.begin(); useIt != uses.end();) {
+            if (acc_.IsStateIn(useIt)) {
+                useIt = acc_.ReplaceIn(useIt, state);
+            } else if (acc_.IsDependIn(useIt)) {
+                useIt = acc_.ReplaceIn(useIt, depend);
+            } else {
+                ++useIt;
+            }
+        }
+        if (acc_.GetOpCode(check) != OpCode::PRIMITIVE_TYPE_CHECK &&
+            acc_.GetOpCode(check) != OpCode::INT32_OVERFLOW_CHECK &&
+            acc_.GetOpCode(check) != OpCode::HEAP_OBJECT_CHECK) {
+            // in the loop the object might only be reached after testing that it is one
+            GateRef receiver = acc_.GetValueIn(check, 0);
+            GateRef deoptType = builder_.Int64(static_cast<int64_t>(DeoptType::NOTHEAPOBJECT));
+            GateRef heapObjectCheck = circuit_->NewGate(circuit_->DeoptCheck(), MachineType::I1,
+                { acc_.GetState(loopHead, 0), acc_.GetDep(dependSelector, 0), builder_.TaggedIsHeapObject(receiver),
+                  frameState, deoptType }, GateType::NJSValue());
+            LinkBeforeLoop(heapObjectCheck, loopHead, dependSelector);
+        }
+        acc_.ReplaceStateIn(check, acc_.GetState(loopHead, 0));
+        acc_.ReplaceDependIn(check, acc_.GetDep(dependSelector, 0));
+        acc_.ReplaceFrameStateIn(check, frameState);
+        LinkBeforeLoop(check, loopHead, dependSelector);
+        hoistedNum_++;
+    }
+}
+}  // namespace panda::ecmascript::kungfu
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_COMPILER_LOOP_OPTIMIZATION_H
+#define ECMASCRIPT_COMPILER_LOOP_OPTIMIZATION_H
+
+#include "ecmascript/compiler/circuit_builder.h"
+#include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/compiler/loop_analysis.h"
+
+namespace panda::ecmascript::kungfu {
+// Hoists type checks of loop invariant values out of loops. A hoisted check runs once before the loop and deopts
+// to the beginning of the loop, with the values the loop is entered with.
+class LoopOptimization {
+public:
+    LoopOptimization(Circuit *circuit, bool enableLog, const std::string &name)
+        : circuit_(circuit), acc_(circuit), builder_(circuit), enableLog_(enableLog), methodName_(name) {}
+
+    ~LoopOptimization() = default;
+
+    void Run();
+
+private:
+    bool IsLogEnabled() const
+    {
+        return enableLog_;
+    }
+
+    const std::string &GetMethodName() const
+    {
+        return methodName_;
+    }
+
+    GateRef GetDependSelector(GateRef loopHead) const;
+    void CollectLoopDepends(GateRef dependSelector, std::unordered_set<GateRef> &depends) const;
+    bool KeepsHClass(const std::unordered_set<GateRef> &depends) const;
+    bool IsInvariant(GateRef gate, const LoopInfo *loop, const std::unordered_set<GateRef> &depends);
+    bool IsHoistableCheck(GateRef gate, bool keepsHClass) const;
+    bool Dominates(GateRef dominator, GateRef gate) const;
+    GateRef GetLoopEntryFrameState(GateRef dependSelector, const LoopInfo *loop,
+                                   const std::unordered_set<GateRef> &depends);
+    void LinkBeforeLoop(GateRef gate, GateRef loopHead, GateRef dependSelector);
+    void HoistChecks(const LoopInfo *loop);
+
+    Circuit *circuit_ {nullptr};
+    GateAccessor acc_;
+    CircuitBuilder builder_;
+    bool enableLog_ {false};
+    std::string methodName_;
+    std::vector<GateRef> bbGatesList_;
+    std::unordered_map<GateRef, size_t> bbGatesAddrToIdx_;
+    std::vector<size_t> immDom_;
+    std::unordered_map<GateRef, bool> invariants_;
+    size_t hoistedNum_ {0};
+};
+}  // panda::ecmascript::kungfu
+#endif  // ECMASCRIPT_COMPILER_LOOP_OPTIMIZATION_H
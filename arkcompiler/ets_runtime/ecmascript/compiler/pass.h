@@ -19,9 +19,11 @@
 #include "ecmascript/compiler/async_function_lowering.h"
 #include "ecmascript/compiler/bytecode_circuit_builder.h"
 #include "ecmascript/compiler/early_elimination.h"
+#include "ecmascript/compiler/escape_analysis.h"
 #include "ecmascript/compiler/common_stubs.h"
 #include "ecmascript/compiler/compiler_log.h"
 #include "ecmascript/compiler/llvm_codegen.h"
+#include "ecmascript/compiler/loop_optimization.h"
 #include "ecmascript/compiler/scheduler.h"
 #include "ecmascript/compiler/slowpath_lowering.h"
 #include "ecmascript/compiler/ts_inline_lowering.h"
@@ -185,7 +187,8 @@ public:
         TimeScope timescope("TSTypeLoweringPass", data->GetMethodName(), data->GetMethodOffset(), data->GetLog());
         bool enableLog = data->GetLog()->EnableMethodCIRLog();
         TSTypeLowering lowering(data->GetCircuit(), data->GetInfo(), enableLog,
-                                data->GetMethodName());
+                                data->GetMethodName(), data->GetRecordName(),
+                                data->GetMethodLiteral()->GetMethodId());
         lowering.RunTSTypeLowering();
         return true;
     }
@@ -244,6 +247,17 @@ public:
     }
 };
 
+class LoopOptimizationPass {
+public:
+    bool Run(PassData* data)
+    {
+        TimeScope timescope("LoopOptimizationPass", data->GetMethodName(), data->GetMethodOffset(), data->GetLog());
+        bool enableLog = data->GetLog()->EnableMethodCIRLog();
+        LoopOptimization(data->GetCircuit(), enableLog, data->GetMethodName()).Run();
+        return true;
+    }
+};
+
 class EarlyEliminationPass {
 public:
     bool Run(PassData* data)
@@ -255,6 +269,17 @@ public:
     }
 };
 
+class EscapeAnalysisPass {
+public:
+    bool Run(PassData* data)
+    {
+        TimeScope timescope("EscapeAnalysisPass", data->GetMethodName(), data->GetMethodOffset(), data->GetLog());
+        bool enableLog = data->GetLog()->EnableMethodCIRLog();
+        EscapeAnalysis(data->GetCircuit(), data->GetTSManager(), enableLog, data->GetMethodName()).Run();
+        return true;
+    }
+};
+
 class SchedulingPass {
 public:
     bool Run(PassData* data)
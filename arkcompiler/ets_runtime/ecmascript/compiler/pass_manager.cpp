@@ -18,6 +18,7 @@
 #include "ecmascript/compiler/bytecodes.h"
 #include "ecmascript/compiler/pass.h"
 #include "ecmascript/compiler/compilation_driver.h"
+#include "ecmascript/compiler/compilation_queue.h"
 #include "ecmascript/ecma_handle_scope.h"
 #include "ecmascript/jspandafile/js_pandafile_manager.h"
 #include "ecmascript/jspandafile/panda_file_translator.h"
@@ -64,13 +65,13 @@ bool PassManager::Compile(const std::string &fileName, AOTFileGenerator &generat
     TSManager *tsManager = vm_->GetTSManager();
     tsManager->SetCompilationDriver(&cmpDriver);
     PassInfo info(tsManager, &bytecodes, &lexEnvManager, &cmpCfg, log_,
-        jsPandaFile, &bcInfoCollector, aotModule);
+        jsPandaFile, &bcInfoCollector, aotModule, &profilerLoader_);
 
-    cmpDriver.Run([this, &fileName, &info]
+    CompilationQueue cmpQueue(vm_->GetJSThread()->GetThreadId(), GetCompilerThreadNum());
+    cmpDriver.Run([this, &fileName, &info, &cmpQueue]
         (const CString recordName, const std::string &methodName, MethodLiteral *methodLiteral,
          uint32_t methodOffset, const MethodPcInfo &methodPCInfo, size_t methodInfoIndex) {
         auto jsPandaFile = info.GetJSPandaFile();
-        auto cmpCfg = info.GetCompilerConfig();
         auto tsManager = info.GetTSManager();
         // note: TSManager need to set current constantpool before all pass
         tsManager->SetCurConstantPool(jsPandaFile, methodOffset);
@@ -88,33 +89,32 @@ bool PassManager::Compile(const std::string &fileName, AOTFileGenerator &generat
             LOG_COMPILER(INFO) << "record: " << recordName << " has no types";
         }
 
-        Circuit circuit(vm_->GetNativeAreaAllocator(), cmpCfg->Is64Bit());
-        BytecodeCircuitBuilder builder(jsPandaFile, methodLiteral, methodPCInfo, tsManager, &circuit,
-                                       info.GetByteCodes(), hasTypes, enableMethodLog && log_->OutputCIR(),
-                                       EnableTypeLowering(), fullName, recordName);
+        auto unit = std::make_unique<CompilationUnit>(&info, recordName, fullName, methodLiteral, methodOffset,
+                                                      methodPCInfo, methodInfoIndex, hasTypes,
+                                                      enableMethodLog && log_->OutputCIR(), EnableTypeLowering(),
+                                                      vm_->GetNativeAreaAllocator());
         {
             TimeScope timeScope("BytecodeToCircuit", methodName, methodOffset, log_);
-            builder.BytecodeToCircuit();
+            unit->GetBuilder()->BytecodeToCircuit();
         }
 
-        PassData data(&builder, &circuit, &info, log_, fullName,
-                      methodInfoIndex, hasTypes, recordName,
-                      methodLiteral, methodOffset, vm_->GetNativeAreaAllocator());
-        PassRunner<PassData> pipeline(&data);
+        PassRunner<PassData> pipeline(unit->GetData());
         if (EnableTypeInfer()) {
             pipeline.RunPass<TypeInferPass>();
         }
         pipeline.RunPass<AsyncFunctionLoweringPass>();
         if (EnableTypeLowering()) {
             pipeline.RunPass<TSTypeLoweringPass>();
+            pipeline.RunPass<LoopOptimizationPass>();
             pipeline.RunPass<EarlyEliminationPass>();
+            pipeline.RunPass<EscapeAnalysisPass>();
             pipeline.RunPass<TypeLoweringPass>();
         }
         pipeline.RunPass<SlowPathLoweringPass>();
-        pipeline.RunPass<VerifierPass>();
-        pipeline.RunPass<SchedulingPass>();
-        pipeline.RunPass<LLVMIRGenPass>();
+        // verifier, scheduling and llvm ir generation
+        cmpQueue.Push(std::move(unit));
     });
+    cmpQueue.Flush();
     LOG_COMPILER(INFO) << bytecodeInfo.GetSkippedMethodSize() << " methods in "
                        << fileName << " have been skipped";
     generator.AddModule(aotModule, aotModuleAssembler, &bcInfoCollector);
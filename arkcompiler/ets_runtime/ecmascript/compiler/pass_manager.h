@@ -31,9 +31,11 @@ class PassInfo {
 public:
     explicit PassInfo(TSManager *tsManager, Bytecodes *bytecodes, LexEnvManager *lexEnvManager,
                              CompilationConfig *cmpCfg, CompilerLog *log, const JSPandaFile *jsPandaFile,
-                             BytecodeInfoCollector* bcInfoCollector, LLVMModule *aotModule)
+                             BytecodeInfoCollector* bcInfoCollector, LLVMModule *aotModule,
+                             PGOProfilerLoader *profilerLoader = nullptr)
         : tsManager_(tsManager), bytecodes_(bytecodes), lexEnvManager_(lexEnvManager), cmpCfg_(cmpCfg),
-          log_(log), jsPandaFile_(jsPandaFile), bcInfoCollector_(bcInfoCollector), aotModule_(aotModule)
+          log_(log), jsPandaFile_(jsPandaFile), bcInfoCollector_(bcInfoCollector), aotModule_(aotModule),
+          profilerLoader_(profilerLoader)
     {
     }
 
@@ -77,6 +79,11 @@ public:
         return aotModule_;
     }
 
+    PGOProfilerLoader* GetProfilerLoader() const
+    {
+        return profilerLoader_;
+    }
+
     bool IsSkippedMethod(uint32_t methodOffset) const
     {
         return bcInfoCollector_->IsSkippedMethod(methodOffset);
@@ -96,17 +103,18 @@ private:
     const JSPandaFile *jsPandaFile_ {nullptr};
     BytecodeInfoCollector *bcInfoCollector_ {nullptr};
     LLVMModule *aotModule_ {nullptr};
+    PGOProfilerLoader *profilerLoader_ {nullptr};
 };
 
 class PassManager {
 public:
     PassManager(EcmaVM* vm, std::string entry, std::string &triple, size_t optLevel, size_t relocMode,
                 CompilerLog *log, AotMethodLogList *logList, size_t maxAotMethodSize, bool enableTypeLowering,
-                const std::string &profIn, uint32_t hotnessThreshold)
+                const std::string &profIn, uint32_t hotnessThreshold, uint32_t compilerThreadNum = 1)
         : vm_(vm), entry_(entry), triple_(triple), optLevel_(optLevel), relocMode_(relocMode), log_(log),
           logList_(logList), maxAotMethodSize_(maxAotMethodSize), enableTypeLowering_(enableTypeLowering),
           enableTypeInfer_(enableTypeLowering || vm_->GetTSManager()->AssertTypes()),
-          profilerLoader_(profIn, hotnessThreshold) {};
+          compilerThreadNum_(compilerThreadNum), profilerLoader_(profIn, hotnessThreshold) {};
     PassManager() = default;
     ~PassManager() = default;
 
@@ -127,6 +135,15 @@ private:
         return enableTypeInfer_;
     }
 
+    // method logs and pass timing are not thread safe, methods are compiled one at a time while they are on
+    uint32_t GetCompilerThreadNum() const
+    {
+        if (!log_->NoneMethod() || log_->GetEnableCompilerLogTime()) {
+            return 1;
+        }
+        return compilerThreadNum_;
+    }
+
     EcmaVM *vm_ {nullptr};
     std::string entry_ {};
     std::string triple_ {};
@@ -137,6 +154,7 @@ private:
     size_t maxAotMethodSize_ {0};
     bool enableTypeLowering_ {true};
     bool enableTypeInfer_ {true};
+    uint32_t compilerThreadNum_ {1};
     PGOProfilerLoader profilerLoader_;
 };
 }
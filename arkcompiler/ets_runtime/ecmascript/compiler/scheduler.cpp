@@ -15,11 +15,53 @@
 
 #include "ecmascript/compiler/scheduler.h"
 #include <cmath>
+#include <optional>
 #include <stack>
 #include "ecmascript/compiler/gate_accessor.h"
+#include "ecmascript/compiler/loop_analysis.h"
 #include "ecmascript/compiler/verifier.h"
 
 namespace panda::ecmascript::kungfu {
+namespace {
+// pure machine operations, executing them on a path that did not compute them before can not fault
+bool IsLoopInvariantCandidate(GateAccessor &acc, GateRef gate)
+{
+    switch (acc.GetOpCode(gate)) {
+        case OpCode::ADD:
+        case OpCode::SUB:
+        case OpCode::MUL:
+        case OpCode::EXP:
+        case OpCode::FDIV:
+        case OpCode::FMOD:
+        case OpCode::AND:
+        case OpCode::XOR:
+        case OpCode::OR:
+        case OpCode::LSL:
+        case OpCode::LSR:
+        case OpCode::ASR:
+        case OpCode::ZEXT:
+        case OpCode::SEXT:
+        case OpCode::TRUNC:
+        case OpCode::FEXT:
+        case OpCode::FTRUNC:
+        case OpCode::REV:
+        case OpCode::TRUNC_FLOAT_TO_INT64:
+        case OpCode::TAGGED_TO_INT64:
+        case OpCode::INT64_TO_TAGGED:
+        case OpCode::SIGNED_INT_TO_FLOAT:
+        case OpCode::UNSIGNED_INT_TO_FLOAT:
+        case OpCode::FLOAT_TO_SIGNED_INT:
+        case OpCode::UNSIGNED_FLOAT_TO_INT:
+        case OpCode::BITCAST:
+        case OpCode::ICMP:
+        case OpCode::FCMP:
+            return true;
+        default:
+            return false;
+    }
+}
+}  // namespace
+
 void Scheduler::CalculateDominatorTree(const Circuit *circuit,
                                        std::vector<GateRef>& bbGatesList,
                                        std::unordered_map<GateRef, size_t> &bbGatesAddrToIdx,
@@ -202,6 +244,8 @@ void Scheduler::Run(const Circuit *circuit, ControlFlowGraph &result,
         std::vector<GateRef> order;
         std::unordered_map<GateRef, size_t> lowerBound;
         Scheduler::CalculateSchedulingLowerBound(circuit, bbGatesAddrToIdx, lowestCommonAncestor, lowerBound, &order);
+        HoistLoopInvariantGates(circuit, bbGatesList, bbGatesAddrToIdx, immDom, lowestCommonAncestor, order,
+                                lowerBound);
         for (const auto &schedulableGate : order) {
             result[lowerBound.at(schedulableGate)].push_back(schedulableGate);
         }
@@ -444,6 +488,104 @@ void Scheduler::CalculateSchedulingLowerBound(const Circuit *circuit,
     }
 }
 
+// Gates are scheduled in the latest block dominating all their uses, which keeps loop invariant computations
+// inside the loop. Pure computations are moved up the dominator tree to the block with the smallest loop depth
+// between that block and the block of their inputs; constants follow their uses, other gates keep their block.
+void Scheduler::HoistLoopInvariantGates(const Circuit *circuit, const std::vector<GateRef> &bbGatesList,
+                                        const std::unordered_map<GateRef, size_t> &bbGatesAddrToIdx,
+                                        const std::vector<size_t> &immDom,
+                                        const std::function<size_t(size_t, size_t)> &lowestCommonAncestor,
+                                        const std::vector<GateRef> &order,
+                                        std::unordered_map<GateRef, size_t> &lowerBound)
+{
+    GateAccessor acc(const_cast<Circuit*>(circuit));
+    LoopAnalysis loopAnalysis(const_cast<Circuit*>(circuit));
+    loopAnalysis.Run();
+    if (loopAnalysis.GetLoops().empty()) {
+        return;
+    }
+    std::vector<size_t> loopDepth(bbGatesList.size());
+    std::vector<size_t> domDepth(bbGatesList.size(), 0);
+    for (size_t idx = 0; idx < bbGatesList.size(); idx++) {
+        loopDepth[idx] = loopAnalysis.GetLoopDepth(bbGatesList[idx]);
+        if (idx > 0) {
+            domDepth[idx] = domDepth[immDom[idx]] + 1;
+        }
+    }
+    std::unordered_set<GateRef> scheduled(order.begin(), order.end());
+    std::unordered_map<GateRef, size_t> upperBound;
+    // order lists the uses of a gate before the gate, so inputs are visited first in reverse
+    std::vector<GateRef> inputs;
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        GateRef gate = *it;
+        if (acc.IsConstant(gate)) {
+            upperBound[gate] = 0;
+            continue;
+        }
+        if (!IsLoopInvariantCandidate(acc, gate)) {
+            continue;
+        }
+        size_t curUpperBound = 0;
+        acc.GetIns(gate, inputs);
+        for (const auto &input : inputs) {
+            size_t inputBlock = 0;
+            if (upperBound.count(input) > 0) {
+                inputBlock = upperBound.at(input);
+            } else if (scheduled.count(input) > 0) {
+                inputBlock = lowerBound.at(input);
+            } else if (acc.IsState(input)) {
+                inputBlock = bbGatesAddrToIdx.at(input);
+            } else if (acc.GetMetaData(input)->IsFixed()) {
+                inputBlock = bbGatesAddrToIdx.at(acc.GetIn(input, 0));
+            }
+            if (domDepth[inputBlock] > domDepth[curUpperBound]) {
+                curUpperBound = inputBlock;
+            }
+        }
+        upperBound[gate] = curUpperBound;
+    }
+    for (const auto &gate : order) {
+        if (upperBound.count(gate) == 0) {
+            continue;
+        }
+        std::optional<size_t> curLowerBound;
+        auto uses = acc.Uses(gate);
+        for (auto useIt = uses.begin(); useIt != uses.end(); ++useIt) {
+            GateRef use = *useIt;
+            size_t useBlock = 0;
+            if (scheduled.count(use) > 0) {
+                useBlock = lowerBound.at(use);
+            } else if (acc.GetMetaData(use)->IsFixed()) {
+                GateRef state = acc.GetIn(use, 0);
+                if (bbGatesAddrToIdx.count(state) == 0) {
+                    continue;
+                }
+                useBlock = acc.GetOpCode(use) == OpCode::VALUE_SELECTOR ?
+                    bbGatesAddrToIdx.at(acc.GetIn(state, useIt.GetIndex() - 1)) : bbGatesAddrToIdx.at(state);
+            } else if (acc.IsState(use) && bbGatesAddrToIdx.count(use) > 0) {
+                useBlock = bbGatesAddrToIdx.at(use);
+            } else {
+                continue;
+            }
+            curLowerBound = curLowerBound.has_value() ? lowestCommonAncestor(*curLowerBound, useBlock) : useBlock;
+        }
+        if (!curLowerBound.has_value()) {
+            continue;
+        }
+        size_t best = *curLowerBound;
+        if (!acc.IsConstant(gate)) {
+            size_t curUpperBound = upperBound.at(gate);
+            for (size_t cur = best; domDepth[cur] > domDepth[curUpperBound];) {
+                cur = immDom[cur];
+                if (loopDepth[cur] < loopDepth[best]) {
+                    best = cur;
+                }
+            }
+        }
+        lowerBound[gate] = best;
+    }
+}
+
 void Scheduler::Print(const std::vector<std::vector<GateRef>> *cfg, const Circuit *circuit)
 {
     GateAccessor acc(const_cast<Circuit*>(circuit));
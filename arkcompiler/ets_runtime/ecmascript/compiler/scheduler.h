@@ -45,6 +45,13 @@ public:
     static void Print(const ControlFlowGraph *cfg, const Circuit *circuit);
 
 private:
+    static void HoistLoopInvariantGates(const Circuit *circuit, const std::vector<GateRef> &bbGatesList,
+                                        const std::unordered_map<GateRef, size_t> &bbGatesAddrToIdx,
+                                        const std::vector<size_t> &immDom,
+                                        const std::function<size_t(size_t, size_t)> &lowestCommonAncestor,
+                                        const std::vector<GateRef> &order,
+                                        std::unordered_map<GateRef, size_t> &lowerBound);
+
     static void PrintUpperBoundError(const Circuit *circuit, GateRef curGate,
                                      GateRef predUpperBound, GateRef curUpperBound);
 };
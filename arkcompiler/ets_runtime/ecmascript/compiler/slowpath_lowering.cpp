@@ -3199,7 +3199,7 @@ void SlowPathLowering::LowerTypeof(GateRef gate)
         {
             Label objIsString(&builder_);
             Label objNotString(&builder_);
-            builder_.Branch(builder_.IsJsType(obj, JSType::STRING), &objIsString, &objNotString);
+            builder_.Branch(builder_.TaggedObjectIsString(obj), &objIsString, &objNotString);
             builder_.Bind(&objIsString);
             {
                 result = builder_.Load(VariableType::JS_POINTER(), gConstAddr,
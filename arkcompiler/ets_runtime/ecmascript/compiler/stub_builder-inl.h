@@ -1057,6 +1057,12 @@ inline GateRef StubBuilder::IsSymbol(GateRef obj)
 }
 
 inline GateRef StubBuilder::IsString(GateRef obj)
+{
+    return env_->GetBuilder()->TaggedObjectIsString(obj);
+}
+
+// The characters of a line string are stored inline, unlike those of a tree string.
+inline GateRef StubBuilder::IsLineString(GateRef obj)
 {
     GateRef objectType = GetObjectType(LoadHClass(obj));
     return Int32Equal(objectType, Int32(static_cast<int32_t>(JSType::STRING)));
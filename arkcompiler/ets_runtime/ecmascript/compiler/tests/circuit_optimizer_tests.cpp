@@ -13,10 +13,13 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <random>
 
 #include "ecmascript/compiler/circuit_optimizer.h"
 #include "ecmascript/compiler/early_elimination.h"
+#include "ecmascript/compiler/loop_analysis.h"
+#include "ecmascript/compiler/scheduler.h"
 #include "ecmascript/compiler/verifier.h"
 #include "ecmascript/mem/native_area_allocator.h"
 #include "ecmascript/tests/test_helper.h"
@@ -574,4 +577,53 @@ HWTEST_F_L0(CircuitOptimizerTests, TestMergeEarlyElimination) {
     EXPECT_TRUE(acc.GetMetaData(load2)->IsNop());
     EXPECT_TRUE(acc.GetMetaData(load3)->IsNop());
 }
-} // namespace panda::test
\ No newline at end of file
+
+HWTEST_F_L0(CircuitOptimizerTests, TestLoopInvariantCodeMotion) {
+    ecmascript::NativeAreaAllocator allocator;
+    Circuit circuit(&allocator);
+    GateAccessor acc(&circuit);
+    auto n = circuit.NewArg(MachineType::I64, 0, GateType::NJSValue(), acc.GetArgRoot());
+    auto zero = circuit.GetConstantGate(MachineType::I64, 0, GateType::NJSValue());
+    auto one = circuit.GetConstantGate(MachineType::I64, 1, GateType::NJSValue());
+    auto loopBegin = circuit.NewGate(circuit.LoopBegin(),
+                                     MachineType::NOVALUE,
+                                     { acc.GetStateRoot(), Circuit::NullGate() },
+                                     GateType::Empty());
+    auto i = circuit.NewGate(circuit.ValueSelector(2), // 2: valuesIn
+                             MachineType::I64,
+                             { loopBegin, zero, Circuit::NullGate() },
+                             GateType::NJSValue());
+    // n + 1 does not change in the loop
+    auto step = circuit.NewGate(circuit.Add(), MachineType::I64, { n, one }, GateType::NJSValue());
+    auto next = circuit.NewGate(circuit.Add(), MachineType::I64, { i, step }, GateType::NJSValue());
+    acc.NewIn(i, 2, next);
+    auto predicate = circuit.NewGate(circuit.Icmp(
+                                     static_cast<uint64_t>(ecmascript::kungfu::ICmpCondition::SLT)),
+                                     MachineType::I1,
+                                     { next, n },
+                                     GateType::NJSValue());
+    auto ifBranch = circuit.NewGate(circuit.IfBranch(), { loopBegin, predicate });
+    auto ifTrue = circuit.NewGate(circuit.IfTrue(), { ifBranch });
+    auto ifFalse = circuit.NewGate(circuit.IfFalse(), { ifBranch });
+    auto loopBack = circuit.NewGate(circuit.LoopBack(), { ifTrue });
+    acc.NewIn(loopBegin, 1, loopBack);
+    auto ret = circuit.NewGate(circuit.Return(),
+                               { ifFalse, acc.GetDependRoot(), next, acc.GetReturnRoot() });
+    EXPECT_TRUE(ecmascript::kungfu::Verifier::Run(&circuit));
+
+    ecmascript::kungfu::LoopAnalysis loopAnalysis(&circuit);
+    loopAnalysis.Run();
+    EXPECT_EQ(loopAnalysis.GetLoops().size(), 1U);
+    EXPECT_EQ(loopAnalysis.GetLoopDepth(ifTrue), 1U);
+    EXPECT_EQ(loopAnalysis.GetLoopDepth(ret), 0U);
+
+    ecmascript::kungfu::Scheduler::ControlFlowGraph cfg;
+    ecmascript::kungfu::Scheduler::Run(&circuit, cfg);
+    auto inBlock = [&cfg](size_t bbIdx, GateRef gate) {
+        return std::find(cfg[bbIdx].begin(), cfg[bbIdx].end(), gate) != cfg[bbIdx].end();
+    };
+    // the entry block is the only one outside of the loop dominating it
+    EXPECT_TRUE(inBlock(0, step));
+    EXPECT_FALSE(inBlock(0, next));
+}
+} // namespace panda::test
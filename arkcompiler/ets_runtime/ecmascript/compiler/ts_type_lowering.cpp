@@ -719,6 +719,10 @@ void TSTypeLowering::LowerTypedLdArrayLength(GateRef gate)
 {
     AddProfiling(gate);
     GateRef array = acc_.GetValueIn(gate, 2);
+    // only the profile says it is an array, it may not even be an object
+    if (!tsManager_->IsArrayTypeKind(acc_.GetGateType(array))) {
+        builder_.HeapObjectCheck(array);
+    }
     builder_.ArrayCheck(array);
 
     ASSERT(acc_.GetOpCode(acc_.GetDep(gate)) == OpCode::STATE_SPLIT);
@@ -741,7 +745,7 @@ void TSTypeLowering::LowerTypedLdObjByName(GateRef gate)
     ASSERT(acc_.GetNumValueIn(gate) == 3);
     GateRef receiver = acc_.GetValueIn(gate, 2); // 2: acc or this object
     GateType receiverType = acc_.GetGateType(receiver);
-    if (tsManager_->IsArrayTypeKind(receiverType)) {
+    if (tsManager_->IsArrayTypeKind(receiverType) || IsProfiledKind(gate, PGOObjectKind::INITIAL_ARRAY)) {
         EcmaString *propString = EcmaString::Cast(prop.GetTaggedObject());
         EcmaString *lengthString = EcmaString::Cast(thread->GlobalConstants()->GetLengthString().GetTaggedObject());
         if (propString == lengthString) {
@@ -915,14 +919,19 @@ void TSTypeLowering::LowerTypedLdObjByValue(GateRef gate, bool isThis)
     }
     GateType receiverType = acc_.GetGateType(receiver);
     GateType propKeyType = acc_.GetGateType(propKey);
-    if (!tsManager_->IsArrayTypeKind(receiverType) || !propKeyType.IsIntType()) { // slowpath
+    bool isArrayIndex = tsManager_->IsArrayTypeKind(receiverType) && propKeyType.IsIntType();
+    // element ics only profile integer keys, the checks below deopt for other receivers and keys
+    if (!isArrayIndex && !IsProfiledKind(gate, PGOObjectKind::INITIAL_ARRAY)) { // slowpath
         acc_.DeleteStateSplitAndFrameState(gate);
         return;
     }
 
     AddProfiling(gate);
 
-    builder_.PrimitiveTypeCheck(propKeyType, propKey);
+    builder_.PrimitiveTypeCheck(GateType::IntType(), propKey);
+    if (!tsManager_->IsArrayTypeKind(receiverType)) {
+        builder_.HeapObjectCheck(receiver);
+    }
     builder_.StableArrayCheck(receiver);
     builder_.IndexCheck(receiverType, receiver, propKey);
 
@@ -1073,6 +1082,17 @@ void TSTypeLowering::LowerCallThis1Imm8V8V8(GateRef gate)
     }
 }
 
+bool TSTypeLowering::IsProfiledKind(GateRef gate, PGOObjectKind kind) const
+{
+    if (profilerLoader_ == nullptr) {
+        return false;
+    }
+    // 0: ic slot id
+    uint16_t slotId = static_cast<uint16_t>(acc_.GetConstantValue(acc_.GetValueIn(gate, 0)));
+    const PGOSiteInfo *site = profilerLoader_->GetSiteInfo(recordName_, methodId_, slotId);
+    return site != nullptr && site->IsOnlyKind(kind);
+}
+
 void TSTypeLowering::AddProfiling(GateRef gate)
 {
     if (IsProfiling()) {
@@ -26,13 +26,14 @@ namespace panda::ecmascript::kungfu {
 class TSTypeLowering {
 public:
     TSTypeLowering(Circuit *circuit, PassInfo *info,
-                   bool enableLog, const std::string& name)
+                   bool enableLog, const std::string& name, const CString &recordName, EntityId methodId)
         : circuit_(circuit), acc_(circuit), builder_(circuit, info->GetCompilerConfig()),
           dependEntry_(circuit->GetDependRoot()),
           tsManager_(info->GetTSManager()),
+          profilerLoader_(info->GetProfilerLoader()),
           enableLog_(enableLog),
           profiling_(info->GetCompilerConfig()->IsProfiling()),
-          methodName_(name), glue_(acc_.GetGlueFromArgList()) {}
+          methodName_(name), recordName_(recordName), methodId_(methodId), glue_(acc_.GetGlueFromArgList()) {}
 
     ~TSTypeLowering() = default;
 
@@ -108,15 +109,21 @@ private:
     void SpeculateCallBuiltin(GateRef gate, BuiltinsStubCSigns::ID Op);
     BuiltinsStubCSigns::ID GetBuiltinId(GateRef func, GateRef receiver);
 
+    // Every receiver the inline cache of the property access gate saw when profiling had the kind.
+    bool IsProfiledKind(GateRef gate, PGOObjectKind kind) const;
+
     void AddProfiling(GateRef gate);
     Circuit *circuit_ {nullptr};
     GateAccessor acc_;
     CircuitBuilder builder_;
     GateRef dependEntry_ {Gate::InvalidGateRef};
     TSManager *tsManager_ {nullptr};
+    PGOProfilerLoader *profilerLoader_ {nullptr};
     bool enableLog_ {false};
     bool profiling_ {false};
     std::string methodName_;
+    CString recordName_;
+    EntityId methodId_;
     GateRef glue_ {Circuit::NullGate()};
 };
 }  // panda::ecmascript::kungfu
@@ -54,6 +54,9 @@ void TypeLowering::LowerType(GateRef gate)
         case OpCode::STABLE_ARRAY_CHECK:
             LowerStableArrayCheck(gate, glue);
             break;
+        case OpCode::HEAP_OBJECT_CHECK:
+            LowerHeapObjectCheck(gate);
+            break;
         case OpCode::TYPED_ARRAY_CHECK:
             LowerTypedArrayCheck(gate, glue);
             break;
@@ -174,6 +177,18 @@ void TypeLowering::LowerBooleanCheck(GateRef gate)
     acc_.ReplaceGate(gate, builder_.GetState(), builder_.GetDepend(), Circuit::NullGate());
 }
 
+void TypeLowering::LowerHeapObjectCheck(GateRef gate)
+{
+    Environment env(gate, circuit_, &builder_);
+    GateRef frameState = GetFrameState(gate);
+
+    GateRef receiver = acc_.GetValueIn(gate, 0);
+    GateRef heapObjectCheck = builder_.TaggedIsHeapObject(receiver);
+    builder_.DeoptCheck(heapObjectCheck, frameState, DeoptType::NOTHEAPOBJECT);
+
+    acc_.ReplaceGate(gate, builder_.GetState(), builder_.GetDepend(), Circuit::NullGate());
+}
+
 void TypeLowering::LowerArrayCheck(GateRef gate, GateRef glue)
 {
     Environment env(gate, circuit_, &builder_);
@@ -280,13 +295,11 @@ void TypeLowering::LowerIndexCheck(GateRef gate)
 {
     Environment env(gate, circuit_, &builder_);
     auto type = acc_.GetParamGateType(gate);
-    if (tsManager_->IsArrayTypeKind(type)) {
-        LowerArrayIndexCheck(gate);
-    } else if (tsManager_->IsFloat32ArrayType(type)) {
+    if (tsManager_->IsFloat32ArrayType(type)) {
         LowerFloat32ArrayIndexCheck(gate);
     } else {
-        LOG_ECMA(FATAL) << "this branch is unreachable";
-        UNREACHABLE();
+        // the receiver is an array, either by its ts type or by pgo type feedback, and has passed an array check
+        LowerArrayIndexCheck(gate);
     }
 }
 
@@ -184,6 +184,7 @@ private:
     void LowerFloat32ArrayCheck(GateRef gate, GateRef glue);
     void LowerArrayCheck(GateRef gate, GateRef glue);
     void LowerStableArrayCheck(GateRef gate, GateRef glue);
+    void LowerHeapObjectCheck(GateRef gate);
     void LowerTypedArrayCheck(GateRef gate, GateRef glue);
     void LowerFloat32ArrayIndexCheck(GateRef gate);
     void LowerArrayIndexCheck(GateRef gate);
@@ -16,9 +16,14 @@
 #include "ecmascript/compiler/assembler/assembler.h"
 #include "ecmascript/compiler/gate_meta_data.h"
 #include "ecmascript/dfx/stackinfo/js_stackinfo.h"
+#include "ecmascript/ecma_handle_scope.h"
 #include "ecmascript/frames.h"
+#include "ecmascript/global_env.h"
 #include "ecmascript/interpreter/interpreter.h"
+#include "ecmascript/interpreter/slow_runtime_stub.h"
+#include "ecmascript/js_function.h"
 #include "ecmascript/js_thread.h"
+#include "ecmascript/jspandafile/program_object.h"
 #include "ecmascript/stubs/runtime_stubs-inl.h"
 
 namespace panda::ecmascript {
@@ -71,6 +76,7 @@ private:
 void Deoptimizier::CollectVregs(const std::vector<kungfu::ARKDeopt>& deoptBundle)
 {
     deoptVregs_.clear();
+    virtualObjects_.clear();
     for (size_t i = 0; i < deoptBundle.size(); i++) {
         kungfu::ARKDeopt deopt = deoptBundle.at(i);
         JSTaggedType v;
@@ -99,6 +105,10 @@ void Deoptimizier::CollectVregs(const std::vector<kungfu::ARKDeopt>& deoptBundle
         if (id != static_cast<kungfu::OffsetType>(SpecVregIndex::PC_INDEX)) {
             if (id == static_cast<kungfu::OffsetType>(SpecVregIndex::ENV_INDEX)) {
                 env_ = JSTaggedValue(v);
+            } else if (VirtualObjectIndex::IsVirtualObjectIndex(id)) {
+                auto &entries = virtualObjects_[VirtualObjectIndex::GetVreg(id)];
+                entries.resize(VirtualObjectIndex::MAX_FIELD_NUM + 1, JSTaggedValue::Undefined());
+                entries[VirtualObjectIndex::GetEntry(id)] = JSTaggedValue(v);
             } else {
                 deoptVregs_[id] = JSTaggedValue(v);
             }
@@ -108,6 +118,81 @@ void Deoptimizier::CollectVregs(const std::vector<kungfu::ARKDeopt>& deoptBundle
     }
 }
 
+void Deoptimizier::MaterializeVirtualObjects()
+{
+    if (virtualObjects_.empty()) {
+        return;
+    }
+    [[maybe_unused]] EcmaHandleScope handleScope(thread_);
+    // creating the objects may move the collected values, so they are kept in handles until all objects exist
+    std::vector<std::pair<kungfu::OffsetType, JSHandle<JSTaggedValue>>> vregs;
+    for (const auto &[id, value] : deoptVregs_) {
+        vregs.emplace_back(id, JSHandle<JSTaggedValue>(thread_, value));
+    }
+    JSHandle<JSTaggedValue> env(thread_, env_);
+    std::vector<std::pair<int32_t, std::vector<JSHandle<JSTaggedValue>>>> objects;
+    for (const auto &[vreg, entries] : virtualObjects_) {
+        // the kind, and the method id and length of a closure, are raw integers
+        auto kind = static_cast<kungfu::VirtualObjectKind>(entries[0].GetRawData());
+        size_t rawNum = kind == kungfu::VirtualObjectKind::CLOSURE ? 3 : 1;  // 3: kind, method id, length
+        std::vector<JSHandle<JSTaggedValue>> fields;
+        for (size_t i = 0; i < entries.size(); i++) {
+            JSTaggedValue entry = entries[i];
+            if (i < rawNum) {
+                entry = JSTaggedValue(static_cast<int32_t>(entry.GetRawData()));
+            }
+            fields.emplace_back(thread_, entry);
+        }
+        objects.emplace_back(vreg, std::move(fields));
+    }
+    for (const auto &[vreg, fields] : objects) {
+        JSTaggedValue object = MaterializeVirtualObject(fields);
+        vregs.emplace_back(vreg, JSHandle<JSTaggedValue>(thread_, object));
+    }
+    for (const auto &[id, value] : vregs) {
+        deoptVregs_[id] = value.GetTaggedValue();
+    }
+    env_ = env.GetTaggedValue();
+    virtualObjects_.clear();
+}
+
+// entries are the kind of the object followed by its fields, see VirtualObjectKind
+JSTaggedValue Deoptimizier::MaterializeVirtualObject(const std::vector<JSHandle<JSTaggedValue>> &entries)
+{
+    EcmaVM *vm = thread_->GetEcmaVM();
+    ObjectFactory *factory = vm->GetFactory();
+    JSHandle<GlobalEnv> globalEnv = vm->GetGlobalEnv();
+    auto kind = static_cast<kungfu::VirtualObjectKind>(entries[0]->GetInt());
+    switch (kind) {
+        case kungfu::VirtualObjectKind::ITER_RESULT:
+            return SlowRuntimeStub::CreateIterResultObj(thread_, entries[1].GetTaggedValue(),  // 1: value
+                                                        entries[2].GetTaggedValue());  // 2: done
+        case kungfu::VirtualObjectKind::EMPTY_OBJECT:
+            return SlowRuntimeStub::CreateEmptyObject(thread_, factory, globalEnv);
+        case kungfu::VirtualObjectKind::EMPTY_ARRAY:
+            return SlowRuntimeStub::CreateEmptyArray(thread_, factory, globalEnv);
+        case kungfu::VirtualObjectKind::CLOSURE: {
+            // same as definefunc in the interpreter
+            JSHandle<JSFunction> currentFunc(thread_, GetFrameArgv(kungfu::CommonArgIdx::FUNC));
+            JSTaggedValue callTarget = currentFunc.GetTaggedValue();
+            JSTaggedValue constpool = GetMethod(callTarget)->GetConstantPool();
+            uint32_t methodId = static_cast<uint32_t>(entries[1]->GetInt());  // 1: method id
+            Method *method = Method::Cast(ConstantPool::GetMethodFromCache(thread_, constpool, methodId)
+                .GetTaggedObject());
+            JSFunction *jsFunc = JSFunction::Cast(SlowRuntimeStub::DefineFunc(thread_, method).GetTaggedObject());
+            jsFunc->SetPropertyInlinedProps(thread_, JSFunction::LENGTH_INLINE_PROPERTY_INDEX,
+                                            entries[2].GetTaggedValue());  // 2: length
+            jsFunc->SetLexicalEnv(thread_, entries[3].GetTaggedValue());  // 3: env
+            jsFunc->SetModule(thread_, currentFunc->GetModule());
+            jsFunc->SetHomeObject(thread_, currentFunc->GetHomeObject());
+            return JSTaggedValue(jsFunc);
+        }
+        default:
+            LOG_FULL(FATAL) << "unknown virtual object kind";
+            UNREACHABLE();
+    }
+}
+
 // when AOT trigger deopt, frame layout as the following
 // * OptimizedJSFunctionFrame layout description as the following:
 //               +--------------------------+ ---------------
@@ -328,6 +413,8 @@ std::string Deoptimizier::DisplayItems(kungfu::DeoptType type)
             return "NOT NEG OVERFLOW";
         case kungfu::DeoptType::NOTCALLTGT:
             return "NOT CALL TARGET";
+        case kungfu::DeoptType::NOTHEAPOBJECT:
+            return "NOT HEAP OBJECT";
         default: {
             return "NOT CHECK";
         }
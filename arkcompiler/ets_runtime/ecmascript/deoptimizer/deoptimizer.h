@@ -16,6 +16,8 @@
 #ifndef ECMASCRIPT_DEOPTIMIZER_DEOPTIMIZER_H
 #define ECMASCRIPT_DEOPTIMIZER_DEOPTIMIZER_H
 
+#include <map>
+
 #include "ecmascript/base/aligned_struct.h"
 #include "ecmascript/compiler/argument_accessor.h"
 #include "ecmascript/deoptimizer/calleeReg.h"
@@ -32,6 +34,52 @@ enum class SpecVregIndex: int {
     ENV_INDEX = -4,
 };
 
+// A vreg holding an object removed by escape analysis is passed as the kind of the object followed by its fields,
+// each under its own id below FIRST_INDEX, so that the bundle sorted by id keeps them apart from the vregs.
+class VirtualObjectIndex {
+public:
+    static constexpr int32_t FIRST_INDEX = -8;
+    static constexpr int32_t MAX_FIELD_NUM = 3;
+
+    // vreg is the index of the vreg or ACC_INDEX
+    static int32_t GetKindIndex(int32_t vreg)
+    {
+        return Encode(vreg, 0);
+    }
+
+    static int32_t GetFieldIndex(int32_t vreg, uint32_t field)
+    {
+        ASSERT(field < MAX_FIELD_NUM);
+        return Encode(vreg, field + 1);
+    }
+
+    static bool IsVirtualObjectIndex(int32_t index)
+    {
+        return index <= FIRST_INDEX;
+    }
+
+    static int32_t GetVreg(int32_t index)
+    {
+        return (FIRST_INDEX - index) / ENTRY_NUM + static_cast<int32_t>(SpecVregIndex::ACC_INDEX);
+    }
+
+    // 0 for the kind, field + 1 for a field
+    static uint32_t GetEntry(int32_t index)
+    {
+        return static_cast<uint32_t>((FIRST_INDEX - index) % ENTRY_NUM);
+    }
+
+private:
+    static constexpr int32_t ENTRY_NUM = MAX_FIELD_NUM + 1;
+
+    static int32_t Encode(int32_t vreg, uint32_t entry)
+    {
+        ASSERT(vreg >= static_cast<int32_t>(SpecVregIndex::ACC_INDEX));
+        int32_t slot = vreg - static_cast<int32_t>(SpecVregIndex::ACC_INDEX);
+        return FIRST_INDEX - slot * ENTRY_NUM - static_cast<int32_t>(entry);
+    }
+};
+
 struct Context {
     uintptr_t callsiteSp;
     uintptr_t callsiteFp;
@@ -96,6 +144,7 @@ public:
         traceDeopt_= options.GetTraceDeopt();
     }
     void CollectVregs(const std::vector<kungfu::ARKDeopt>& deoptBundle);
+    void MaterializeVirtualObjects();
     void CollectDeoptBundleVec(std::vector<kungfu::ARKDeopt>& deoptBundle);
     JSTaggedType ConstructAsmInterpretFrame(kungfu::DeoptType type);
     static std::string DisplayItems(kungfu::DeoptType type);
@@ -145,12 +194,15 @@ private:
     Method* GetMethod(JSTaggedValue &target);
     void RelocateCalleeSave();
     void Dump(Method* method, kungfu::DeoptType type);
+    JSTaggedValue MaterializeVirtualObject(const std::vector<JSHandle<JSTaggedValue>> &entries);
     JSThread *thread_ {nullptr};
     uintptr_t *calleeRegAddr_ {nullptr};
     size_t numCalleeRegs_ {0};
     AsmStackContext stackContext_;
 
     std::unordered_map<kungfu::OffsetType, JSTaggedValue> deoptVregs_;
+    // kind and fields of the objects removed by escape analysis, by vreg
+    std::map<int32_t, std::vector<JSTaggedValue>> virtualObjects_;
     struct Context context_ {0, 0, {}};
     uint32_t pc_ {0};
     JSTaggedValue env_ {JSTaggedValue::Undefined()};
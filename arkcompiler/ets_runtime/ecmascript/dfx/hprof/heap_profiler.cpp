@@ -31,12 +31,19 @@ HeapProfiler::HeapProfiler(const EcmaVM *vm) : vm_(vm), chunk_(vm->GetNativeArea
         LOG_FULL(FATAL) << "alloc snapshot json serializer failed";
         UNREACHABLE();
     }
+    binarySerializer_ = GetChunk()->New<HeapSnapshotBinarySerializer>(vm);
+    if (UNLIKELY(binarySerializer_ == nullptr)) {
+        LOG_FULL(FATAL) << "alloc snapshot binary serializer failed";
+        UNREACHABLE();
+    }
 }
 HeapProfiler::~HeapProfiler()
 {
     ClearSnapshot();
     GetChunk()->Delete(jsonSerializer_);
     jsonSerializer_ = nullptr;
+    GetChunk()->Delete(binarySerializer_);
+    binarySerializer_ = nullptr;
 }
 
 void HeapProfiler::UpdateHeapObjects(HeapSnapshot *snapshot)
@@ -65,7 +72,15 @@ bool HeapProfiler::DumpHeapSnapshot(DumpFormat dumpFormat, Stream *stream, Progr
     ASSERT(snapshot != nullptr);
     if (!stream->Good()) {
         FileStream newStream(GenDumpFileName(dumpFormat));
-        return jsonSerializer_->Serialize(snapshot, &newStream);
+        return Serialize(dumpFormat, snapshot, &newStream);
+    }
+    return Serialize(dumpFormat, snapshot, stream);
+}
+
+bool HeapProfiler::Serialize(DumpFormat dumpFormat, HeapSnapshot *snapshot, Stream *stream)
+{
+    if (dumpFormat == DumpFormat::BINARY) {
+        return binarySerializer_->Serialize(snapshot, stream);
     }
     return jsonSerializer_->Serialize(snapshot, stream);
 }
@@ -139,18 +154,21 @@ std::string HeapProfiler::GenDumpFileName(DumpFormat dumpFormat)
     switch (dumpFormat) {
         case DumpFormat::JSON:
             filename.append(GetTimeStamp());
+            filename.append(".heapsnapshot");
             break;
         case DumpFormat::BINARY:
-            filename.append("unimplemented");
+            filename.append(GetTimeStamp());
+            filename.append(".rawheap");
             break;
         case DumpFormat::OTHER:
             filename.append("unimplemented");
+            filename.append(".heapsnapshot");
             break;
         default:
             filename.append("unimplemented");
+            filename.append(".heapsnapshot");
             break;
     }
-    filename.append(".heapsnapshot");
     return CstringConvertToStdString(filename);
 }
 
@@ -17,6 +17,7 @@
 #define ECMASCRIPT_HPROF_HEAP_PROFILER_H
 
 #include "ecmascript/dfx/hprof/heap_profiler_interface.h"
+#include "ecmascript/dfx/hprof/heap_snapshot_binary_serializer.h"
 #include "ecmascript/dfx/hprof/heap_snapshot_json_serializer.h"
 #include "ecmascript/dfx/hprof/heap_tracker.h"
 #include "ecmascript/ecma_macros.h"
@@ -69,11 +70,13 @@ private:
     CString GetTimeStamp();
     void UpdateHeapObjects(HeapSnapshot *snapshot);
     void ClearSnapshot();
+    bool Serialize(DumpFormat dumpFormat, HeapSnapshot *snapshot, Stream *stream);
 
     const size_t MAX_NUM_HPROF = 5;  // ~10MB
     const EcmaVM *vm_;
     CVector<HeapSnapshot *> hprofs_;
     HeapSnapshotJSONSerializer *jsonSerializer_ {nullptr};
+    HeapSnapshotBinarySerializer *binarySerializer_ {nullptr};
     std::unique_ptr<HeapTracker> heapTracker_;
     Chunk chunk_;
 };
@@ -251,6 +251,8 @@ CString *HeapSnapshot::GenerateNodeName(TaggedObject *entry)
             return GetString("HiddenClass");
         case JSType::STRING:
             return GetString("BaseString");
+        case JSType::TREE_STRING:
+            return GetString("TreeString");
         case JSType::JS_OBJECT: {
             CString objName = CString("JSOBJECT(Ctor=");  // Ctor-name
             return GetString(objName);
@@ -0,0 +1,531 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/dfx/hprof/heap_snapshot_binary_serializer.h"
+
+#include "ecmascript/dfx/hprof/heap_snapshot.h"
+#include "ecmascript/dfx/hprof/string_hashmap.h"
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/js_thread.h"
+#include "ecmascript/taskpool/taskpool.h"
+
+namespace panda::ecmascript {
+namespace {
+constexpr uint8_t VARINT_PAYLOAD_MASK = 0x7f;
+constexpr uint8_t VARINT_CONTINUATION = 0x80;
+constexpr uint32_t VARINT_PAYLOAD_BITS = 7;
+constexpr uint32_t VARINT_MAX_SHIFT = 63;
+
+class BinaryReader {
+public:
+    BinaryReader(const uint8_t *data, size_t size) : cur_(data), end_(data + size) {}
+
+    bool ReadVarint(uint64_t *value)
+    {
+        uint64_t result = 0;
+        uint32_t shift = 0;
+        while (cur_ < end_ && shift <= VARINT_MAX_SHIFT) {
+            uint8_t byte = *cur_++;
+            result |= static_cast<uint64_t>(byte & VARINT_PAYLOAD_MASK) << shift;
+            if ((byte & VARINT_CONTINUATION) == 0) {
+                *value = result;
+                return true;
+            }
+            shift += VARINT_PAYLOAD_BITS;
+        }
+        return false;
+    }
+
+    bool ReadVarints(uint64_t *values, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) {
+            if (!ReadVarint(&values[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ReadBytes(size_t size, const char **data)
+    {
+        if (static_cast<size_t>(end_ - cur_) < size) {
+            return false;
+        }
+        *data = reinterpret_cast<const char *>(cur_);
+        cur_ += size;
+        return true;
+    }
+
+private:
+    const uint8_t *cur_ {nullptr};
+    const uint8_t *end_ {nullptr};
+};
+
+constexpr size_t NODE_RECORD_FIELDS = 6;
+constexpr size_t EDGE_RECORD_FIELDS = 3;
+constexpr size_t FUNCTION_INFO_FIELDS = 6;
+constexpr size_t TRACE_NODE_FIELDS = 5;
+constexpr size_t SAMPLE_FIELDS = 2;
+
+// Mirrors HeapSnapshotJSONSerializer section by section so that both paths produce identical files
+class JSONConverter {
+public:
+    JSONConverter(BinaryReader *reader, StreamWriter *writer) : reader_(reader), writer_(writer) {}
+
+    bool Convert()
+    {
+        const char *magic = nullptr;
+        uint64_t version = 0;
+        uint64_t nodeCount = 0;
+        uint64_t edgeCount = 0;
+        uint64_t traceFunctionCount = 0;
+        if (!reader_->ReadBytes(HeapSnapshotBinarySerializer::MAGIC_SIZE, &magic) ||
+            memcmp(magic, HeapSnapshotBinarySerializer::MAGIC, HeapSnapshotBinarySerializer::MAGIC_SIZE) != 0 ||
+            !reader_->ReadVarint(&version) || version != HeapSnapshotBinarySerializer::VERSION) {
+            return false;
+        }
+        if (!reader_->ReadVarint(&nodeCount) || !reader_->ReadVarint(&edgeCount) ||
+            !reader_->ReadVarint(&traceFunctionCount)) {
+            return false;
+        }
+        HeapSnapshotJSONSerializer::WriteSnapshotHeader(writer_, nodeCount, edgeCount, traceFunctionCount);
+        if (!ConvertNodes() || !ConvertEdges() || !ConvertTraceFunctionInfo() || !ConvertTraceTree() ||
+            !ConvertSamples()) {
+            return false;
+        }
+        writer_->Write("\"locations\":[],\n");
+        if (!ConvertStringTable()) {
+            return false;
+        }
+        writer_->Write("}\n");
+        return true;
+    }
+
+private:
+    bool ConvertNodes()
+    {
+        uint64_t count = 0;
+        if (!reader_->ReadVarint(&count)) {
+            return false;
+        }
+        writer_->Write("\"nodes\":[");
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t fields[NODE_RECORD_FIELDS] = {0};
+            if (!reader_->ReadVarints(fields, NODE_RECORD_FIELDS)) {
+                return false;
+            }
+            if (i > 0) {
+                writer_->Write(",");
+            }
+            for (uint64_t field : fields) {
+                writer_->Write(field);
+                writer_->Write(",");
+            }
+            writer_->Write(i == count - 1 ? "0],\n" : "0\n");
+        }
+        return true;
+    }
+
+    bool ConvertEdges()
+    {
+        uint64_t count = 0;
+        if (!reader_->ReadVarint(&count)) {
+            return false;
+        }
+        writer_->Write("\"edges\":[");
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t fields[EDGE_RECORD_FIELDS] = {0};
+            if (!reader_->ReadVarints(fields, EDGE_RECORD_FIELDS)) {
+                return false;
+            }
+            if (i > 0) {
+                writer_->Write(",");
+            }
+            writer_->Write(fields[0]);
+            writer_->Write(",");
+            writer_->Write(fields[1]);
+            writer_->Write(",");
+            writer_->Write(fields[2]);  // 2 : to_node
+            writer_->Write(i == count - 1 ? "],\n" : "\n");
+        }
+        return true;
+    }
+
+    bool ConvertTraceFunctionInfo()
+    {
+        uint64_t count = 0;
+        if (!reader_->ReadVarint(&count)) {
+            return false;
+        }
+        writer_->Write("\"trace_function_infos\":[");
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t fields[FUNCTION_INFO_FIELDS] = {0};
+            if (!reader_->ReadVarints(fields, FUNCTION_INFO_FIELDS)) {
+                return false;
+            }
+            if (i > 0) {
+                writer_->Write(",");
+            }
+            for (size_t j = 0; j < FUNCTION_INFO_FIELDS; j++) {
+                writer_->Write(fields[j]);
+                writer_->Write(j == FUNCTION_INFO_FIELDS - 1 ? "\n" : ",");
+            }
+        }
+        writer_->Write("],\n");
+        return true;
+    }
+
+    bool ConvertTraceTree()
+    {
+        uint64_t hasRoot = 0;
+        if (!reader_->ReadVarint(&hasRoot)) {
+            return false;
+        }
+        writer_->Write("\"trace_tree\":[");
+        if (hasRoot != 0 && !ConvertTraceNode()) {
+            return false;
+        }
+        writer_->Write("],\n");
+        return true;
+    }
+
+    bool ConvertTraceNode()
+    {
+        uint64_t fields[TRACE_NODE_FIELDS] = {0};
+        if (!reader_->ReadVarints(fields, TRACE_NODE_FIELDS)) {
+            return false;
+        }
+        for (size_t j = 0; j < TRACE_NODE_FIELDS - 1; j++) {
+            writer_->Write(fields[j]);
+            writer_->Write(",");
+        }
+        writer_->Write("[");
+        uint64_t childCount = fields[TRACE_NODE_FIELDS - 1];
+        for (uint64_t i = 0; i < childCount; i++) {
+            if (i > 0) {
+                writer_->Write(",");
+            }
+            if (!ConvertTraceNode()) {
+                return false;
+            }
+        }
+        writer_->Write("]");
+        return true;
+    }
+
+    bool ConvertSamples()
+    {
+        uint64_t count = 0;
+        if (!reader_->ReadVarint(&count)) {
+            return false;
+        }
+        writer_->Write("\"samples\":[");
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t fields[SAMPLE_FIELDS] = {0};
+            if (!reader_->ReadVarints(fields, SAMPLE_FIELDS)) {
+                return false;
+            }
+            if (i > 0) {
+                writer_->Write("\n, ");
+            }
+            writer_->Write(fields[0]);
+            writer_->Write(", ");
+            writer_->Write(fields[1]);
+        }
+        writer_->Write("],\n");
+        return true;
+    }
+
+    bool ConvertStringTable()
+    {
+        uint64_t count = 0;
+        if (!reader_->ReadVarint(&count)) {
+            return false;
+        }
+        writer_->Write("\"strings\":[\"<dummy>\",\n");
+        writer_->Write("\"\",\n");
+        writer_->Write("\"GC roots\",\n");
+        for (uint64_t i = 0; i < count; i++) {
+            uint64_t length = 0;
+            const char *data = nullptr;
+            if (!reader_->ReadVarint(&length) || !reader_->ReadBytes(length, &data)) {
+                return false;
+            }
+            writer_->Write("\"");
+            writer_->Write(data, length);
+            writer_->Write(i == count - 1 ? "\"\n" : "\",\n");
+        }
+        writer_->Write("]\n");
+        return true;
+    }
+
+    BinaryReader *reader_ {nullptr};
+    StreamWriter *writer_ {nullptr};
+};
+}  // namespace
+
+bool HeapSnapshotBinarySerializer::Serialize(HeapSnapshot *snapshot, Stream *stream)
+{
+    LOG_ECMA(INFO) << "HeapSnapshotBinarySerializer::Serialize begin";
+    snapshot_ = snapshot;
+    ASSERT(snapshot_->GetNodes() != nullptr && snapshot_->GetEdges() != nullptr &&
+           snapshot_->GetEcmaStringTable() != nullptr);
+    StreamWriter writer(stream);
+    writer_ = &writer;
+
+    SerializeHeader();             // 1.
+    SerializeNodes();              // 2.
+    SerializeEdges();              // 3.
+    SerializeTraceFunctionInfo();  // 4.
+    SerializeTraceTree();          // 5.
+    SerializeSamples();            // 6.
+    SerializeStringTable();        // 7.
+    writer_->End();
+
+    writer_ = nullptr;
+    blocks_.clear();
+    buffer_.clear();
+    LOG_ECMA(INFO) << "HeapSnapshotBinarySerializer::Serialize exit";
+    return true;
+}
+
+bool HeapSnapshotBinarySerializer::ConvertToJSON(const uint8_t *data, size_t size, Stream *stream)
+{
+    BinaryReader reader(data, size);
+    StreamWriter writer(stream);
+    JSONConverter converter(&reader, &writer);
+    bool success = converter.Convert();
+    writer.End();
+    if (!success) {
+        LOG_ECMA(ERROR) << "HeapSnapshotBinarySerializer::ConvertToJSON malformed binary snapshot";
+    }
+    return success;
+}
+
+void HeapSnapshotBinarySerializer::WriteVarint(CVector<uint8_t> *buffer, uint64_t value)
+{
+    while (value >= VARINT_CONTINUATION) {
+        buffer->push_back(static_cast<uint8_t>(value | VARINT_CONTINUATION));
+        value >>= VARINT_PAYLOAD_BITS;
+    }
+    buffer->push_back(static_cast<uint8_t>(value));
+}
+
+void HeapSnapshotBinarySerializer::WriteBytes(CVector<uint8_t> *buffer, const char *data, size_t size)
+{
+    buffer->insert(buffer->end(), data, data + size);
+}
+
+void HeapSnapshotBinarySerializer::FlushBuffer()
+{
+    writer_->Write(reinterpret_cast<const char *>(buffer_.data()), buffer_.size());
+    buffer_.clear();
+}
+
+void HeapSnapshotBinarySerializer::SerializeHeader()
+{
+    WriteBytes(&buffer_, MAGIC, MAGIC_SIZE);
+    WriteVarint(&buffer_, VERSION);
+    WriteVarint(&buffer_, snapshot_->GetNodeCount());
+    WriteVarint(&buffer_, snapshot_->GetEdgeCount());
+    WriteVarint(&buffer_, snapshot_->GetTrackAllocationsStack().size());
+    FlushBuffer();
+}
+
+void HeapSnapshotBinarySerializer::SerializeNodes()
+{
+    const StringHashMap *stringTable = snapshot_->GetEcmaStringTable();
+    SerializeRecords<Node>(snapshot_->GetNodes(), [stringTable](const Node *node, CVector<uint8_t> *buffer) {
+        WriteVarint(buffer, static_cast<uint64_t>(NodeTypeConverter::Convert(node->GetType())));
+        WriteVarint(buffer, stringTable->GetStringId(node->GetName()));
+        WriteVarint(buffer, node->GetId());
+        WriteVarint(buffer, node->GetSelfSize());
+        WriteVarint(buffer, node->GetEdgeCount());
+        WriteVarint(buffer, node->GetStackTraceId());
+    });
+}
+
+void HeapSnapshotBinarySerializer::SerializeEdges()
+{
+    const StringHashMap *stringTable = snapshot_->GetEcmaStringTable();
+    SerializeRecords<Edge>(snapshot_->GetEdges(), [stringTable](const Edge *edge, CVector<uint8_t> *buffer) {
+        WriteVarint(buffer, static_cast<uint64_t>(edge->GetType()));
+        WriteVarint(buffer, stringTable->GetStringId(edge->GetName()));
+        WriteVarint(buffer, edge->GetTo()->GetIndex() * Node::NODE_FIELD_COUNT);
+    });
+}
+
+template<class T>
+void HeapSnapshotBinarySerializer::SerializeRecords(const CList<T *> *records,
+                                                    const std::function<void(const T *, CVector<uint8_t> *)> &encoder)
+{
+    ASSERT(records != nullptr);
+    WriteVarint(&buffer_, records->size());
+    FlushBuffer();
+
+    size_t batchBlocks = (Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() + 1) * BLOCKS_PER_THREAD;
+    blocks_.resize(batchBlocks);
+    CVector<typename CList<T *>::const_iterator> blockStarts;
+    CVector<size_t> blockSizes;
+    auto iter = records->begin();
+    size_t remaining = records->size();
+    while (remaining > 0) {
+        // Only the iterator of each block is collected, so a batch costs no more than its encoded bytes
+        blockStarts.clear();
+        blockSizes.clear();
+        while (blockStarts.size() < batchBlocks && remaining > 0) {
+            size_t blockSize = std::min(BLOCK_RECORDS, remaining);
+            blockStarts.emplace_back(iter);
+            blockSizes.emplace_back(blockSize);
+            std::advance(iter, blockSize);
+            remaining -= blockSize;
+        }
+        encodeBlock_ = [this, &blockStarts, &blockSizes, &encoder](size_t index) {
+            CVector<uint8_t> &block = blocks_[index];
+            block.clear();
+            auto record = blockStarts[index];
+            for (size_t i = 0; i < blockSizes[index]; i++, record++) {
+                encoder(*record, &block);
+            }
+        };
+        RunEncodeTasks(blockStarts.size());
+        for (size_t i = 0; i < blockStarts.size(); i++) {
+            writer_->Write(reinterpret_cast<const char *>(blocks_[i].data()), blocks_[i].size());
+        }
+    }
+    encodeBlock_ = nullptr;
+}
+
+void HeapSnapshotBinarySerializer::RunEncodeTasks(size_t blockCount)
+{
+    blockCount_ = blockCount;
+    nextBlock_.store(0, std::memory_order_relaxed);
+    int parallel = static_cast<int>(std::min<size_t>(blockCount - 1,
+                                                      Taskpool::GetCurrentTaskpool()->GetTotalThreadNum()));
+    {
+        os::memory::LockHolder holder(mutex_);
+        runningTasks_ = parallel;
+    }
+    for (int i = 0; i < parallel; i++) {
+        Taskpool::GetCurrentTaskpool()->PostTask(
+            std::make_unique<EncodeTask>(vm_->GetJSThread()->GetThreadId(), this));
+    }
+    EncodeBlocks(true);
+
+    os::memory::LockHolder holder(mutex_);
+    while (runningTasks_ > 0) {
+        condition_.Wait(&mutex_);
+    }
+}
+
+void HeapSnapshotBinarySerializer::EncodeBlocks(bool isMain)
+{
+    size_t index = nextBlock_.fetch_add(1, std::memory_order_relaxed);
+    while (index < blockCount_) {
+        encodeBlock_(index);
+        index = nextBlock_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (!isMain) {
+        os::memory::LockHolder holder(mutex_);
+        if (--runningTasks_ <= 0) {
+            condition_.SignalAll();
+        }
+    }
+}
+
+bool HeapSnapshotBinarySerializer::EncodeTask::Run([[maybe_unused]] uint32_t threadIndex)
+{
+    serializer_->EncodeBlocks(false);
+    return true;
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceFunctionInfo()
+{
+    const CVector<FunctionInfo> &trackAllocationsStack = snapshot_->GetTrackAllocationsStack();
+    const StringHashMap *stringTable = snapshot_->GetEcmaStringTable();
+    WriteVarint(&buffer_, trackAllocationsStack.size());
+    for (const auto &info : trackAllocationsStack) {
+        CString functionName(info.functionName.c_str());
+        CString scriptName(info.scriptName.c_str());
+        WriteVarint(&buffer_, static_cast<uint64_t>(info.functionId));
+        WriteVarint(&buffer_, stringTable->GetStringId(&functionName));
+        WriteVarint(&buffer_, stringTable->GetStringId(&scriptName));
+        WriteVarint(&buffer_, static_cast<uint64_t>(info.scriptId));
+        WriteVarint(&buffer_, static_cast<uint64_t>(info.columnNumber));
+        WriteVarint(&buffer_, static_cast<uint64_t>(info.lineNumber));
+    }
+    FlushBuffer();
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceTree()
+{
+    TraceTree *tree = snapshot_->GetTraceTree();
+    TraceNode *root = (tree != nullptr && snapshot_->trackAllocations()) ? tree->GetRoot() : nullptr;
+    WriteVarint(&buffer_, root != nullptr ? 1 : 0);
+    if (root != nullptr) {
+        SerializeTraceNode(root);
+    }
+    FlushBuffer();
+}
+
+void HeapSnapshotBinarySerializer::SerializeTraceNode(TraceNode *node)
+{
+    WriteVarint(&buffer_, node->GetId());
+    WriteVarint(&buffer_, node->GetNodeIndex());
+    WriteVarint(&buffer_, node->GetTotalCount());
+    WriteVarint(&buffer_, node->GetTotalSize());
+    const std::vector<TraceNode *> &children = node->GetChildren();
+    size_t childCount = 0;
+    for (TraceNode *child : children) {
+        childCount += child != nullptr ? 1 : 0;
+    }
+    WriteVarint(&buffer_, childCount);
+    for (TraceNode *child : children) {
+        if (child != nullptr) {
+            SerializeTraceNode(child);
+        }
+    }
+}
+
+void HeapSnapshotBinarySerializer::SerializeSamples()
+{
+    const CVector<TimeStamp> &timeStamps = snapshot_->GetTimeStamps();
+    WriteVarint(&buffer_, timeStamps.size());
+    if (!timeStamps.empty()) {
+        int64_t firstTimeStamp = timeStamps[0].GetTimeStamp();
+        for (const auto &timeStamp : timeStamps) {
+            WriteVarint(&buffer_, static_cast<uint64_t>(timeStamp.GetTimeStamp() - firstTimeStamp));
+            WriteVarint(&buffer_, static_cast<uint64_t>(timeStamp.GetLastSequenceId()));
+        }
+    }
+    FlushBuffer();
+}
+
+void HeapSnapshotBinarySerializer::SerializeStringTable()
+{
+    const StringHashMap *stringTable = snapshot_->GetEcmaStringTable();
+    const CVector<StringKey> &keys = stringTable->GetOrderedKeyStorage();
+    WriteVarint(&buffer_, keys.size());
+    for (auto key : keys) {
+        const CString *str = stringTable->GetStringByKey(key);
+        WriteVarint(&buffer_, str->size());
+        WriteBytes(&buffer_, str->c_str(), str->size());
+        if (buffer_.size() >= BLOCK_RECORDS) {
+            FlushBuffer();
+        }
+    }
+    FlushBuffer();
+}
+}  // namespace panda::ecmascript
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_HPROF_HEAP_SNAPSHOT_BINARY_SERIALIZER_H
+#define ECMASCRIPT_HPROF_HEAP_SNAPSHOT_BINARY_SERIALIZER_H
+
+#include <atomic>
+#include <functional>
+
+#include "ecmascript/dfx/hprof/heap_snapshot_json_serializer.h"
+#include "ecmascript/mem/c_containers.h"
+#include "ecmascript/taskpool/task.h"
+
+#include "libpandabase/os/mutex.h"
+
+namespace panda::ecmascript {
+class EcmaVM;
+class HeapSnapshot;
+class TraceNode;
+
+/*
+ * Binary heap snapshot, every integer is a LEB128 varint:
+ *   magic "ARKHPROF", version, node_count, edge_count, trace_function_count
+ *   nodes:                [count] {type, name, id, self_size, edge_count, trace_node_id}
+ *   edges:                [count] {type, name_or_index, to_node}
+ *   trace_function_infos: [count] {function_id, name, script_name, script_id, column, line}
+ *   trace_tree:           [has_root] pre-order {id, function_info_index, count, size, [children]}
+ *   samples:              [count] {timestamp_us, last_assigned_id}
+ *   strings:              [count] {length, bytes}
+ * Nodes and edges are encoded block by block on the taskpool and streamed out in order,
+ * ConvertToJSON turns the file back into the JSON snapshot consumed by DevTools.
+ */
+class HeapSnapshotBinarySerializer {
+public:
+    explicit HeapSnapshotBinarySerializer(const EcmaVM *vm) : vm_(vm) {}
+    ~HeapSnapshotBinarySerializer() = default;
+    NO_MOVE_SEMANTIC(HeapSnapshotBinarySerializer);
+    NO_COPY_SEMANTIC(HeapSnapshotBinarySerializer);
+    bool Serialize(HeapSnapshot *snapshot, Stream *stream);
+
+    static bool ConvertToJSON(const uint8_t *data, size_t size, Stream *stream);
+
+    static constexpr char MAGIC[] = "ARKHPROF";
+    static constexpr size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+    static constexpr uint64_t VERSION = 1;
+
+private:
+    class EncodeTask : public Task {
+    public:
+        EncodeTask(int32_t id, HeapSnapshotBinarySerializer *serializer) : Task(id), serializer_(serializer) {}
+        ~EncodeTask() override = default;
+        bool Run(uint32_t threadIndex) override;
+
+        NO_COPY_SEMANTIC(EncodeTask);
+        NO_MOVE_SEMANTIC(EncodeTask);
+
+    private:
+        HeapSnapshotBinarySerializer *serializer_;
+    };
+
+    void SerializeHeader();
+    void SerializeNodes();
+    void SerializeEdges();
+    template<class T>
+    void SerializeRecords(const CList<T *> *records, const std::function<void(const T *, CVector<uint8_t> *)> &encoder);
+    void EncodeBlocks(bool isMain);
+    void RunEncodeTasks(size_t blockCount);
+    void SerializeTraceFunctionInfo();
+    void SerializeTraceTree();
+    void SerializeTraceNode(TraceNode *node);
+    void SerializeSamples();
+    void SerializeStringTable();
+    void FlushBuffer();
+
+    static void WriteVarint(CVector<uint8_t> *buffer, uint64_t value);
+    static void WriteBytes(CVector<uint8_t> *buffer, const char *data, size_t size);
+
+    // Records of one block are encoded by a single task, a batch holds a few blocks per taskpool thread
+    static constexpr size_t BLOCK_RECORDS = 16384;
+    static constexpr size_t BLOCKS_PER_THREAD = 2;
+
+    const EcmaVM *vm_ {nullptr};
+    HeapSnapshot *snapshot_ {nullptr};
+    StreamWriter *writer_ {nullptr};
+    CVector<uint8_t> buffer_;
+    CVector<CVector<uint8_t>> blocks_;
+    std::function<void(size_t)> encodeBlock_;
+    size_t blockCount_ {0};
+    std::atomic<size_t> nextBlock_ {0};
+    int runningTasks_ {0};
+    os::memory::Mutex mutex_;
+    os::memory::ConditionVariable condition_;
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_HPROF_HEAP_SNAPSHOT_BINARY_SERIALIZER_H
@@ -53,40 +53,47 @@ bool HeapSnapshotJSONSerializer::Serialize(HeapSnapshot *snapshot, Stream *strea
 
 void HeapSnapshotJSONSerializer::SerializeSnapshotHeader()
 {
-    writer_->Write("{\"snapshot\":\n");  // 1.
-    writer_->Write("{\"meta\":\n");      // 2.
+    WriteSnapshotHeader(writer_, snapshot_->GetNodeCount(), snapshot_->GetEdgeCount(),
+                        snapshot_->GetTrackAllocationsStack().size());
+}
+
+void HeapSnapshotJSONSerializer::WriteSnapshotHeader(StreamWriter *writer, uint64_t nodeCount, uint64_t edgeCount,
+                                                     uint64_t traceFunctionCount)
+{
+    writer->Write("{\"snapshot\":\n");  // 1.
+    writer->Write("{\"meta\":\n");      // 2.
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("{\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\",");
-    writer_->Write("\"detachedness\"],\n");  // 3.
+    writer->Write("{\"node_fields\":[\"type\",\"name\",\"id\",\"self_size\",\"edge_count\",\"trace_node_id\",");
+    writer->Write("\"detachedness\"],\n");  // 3.
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",");
+    writer->Write("\"node_types\":[[\"hidden\",\"array\",\"string\",\"object\",\"code\",\"closure\",\"regexp\",");
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"number\",\"native\",\"synthetic\",\"concatenated string\",\"slicedstring\",\"symbol\",");
+    writer->Write("\"number\",\"native\",\"synthetic\",\"concatenated string\",\"slicedstring\",\"symbol\",");
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"bigint\"],\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],\n");  // 4.
+    writer->Write("\"bigint\"],\"string\",\"number\",\"number\",\"number\",\"number\",\"number\"],\n");  // 4.
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],\n");  // 5.
+    writer->Write("\"edge_fields\":[\"type\",\"name_or_index\",\"to_node\"],\n");  // 5.
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",");
+    writer->Write("\"edge_types\":[[\"context\",\"element\",\"property\",\"internal\",\"hidden\",\"shortcut\",");
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"weak\"],\"string_or_number\",\"node\"],\n");  // 6.
+    writer->Write("\"weak\"],\"string_or_number\",\"node\"],\n");  // 6.
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",");
+    writer->Write("\"trace_function_info_fields\":[\"function_id\",\"name\",\"script_name\",\"script_id\",");
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"line\",\"column\"],\n");  // 7.
+    writer->Write("\"line\",\"column\"],\n");  // 7.
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],\n");
+    writer->Write("\"trace_node_fields\":[\"id\",\"function_info_index\",\"count\",\"size\",\"children\"],\n");
     // NOLINTNEXTLINE(modernize-raw-string-literal)
-    writer_->Write("\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],\n");  // 9.
+    writer->Write("\"sample_fields\":[\"timestamp_us\",\"last_assigned_id\"],\n");  // 9.
     // NOLINTNEXTLINE(modernize-raw-string-literal)
     // 10.
-    writer_->Write("\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},\n\"node_count\":");
-    writer_->Write(snapshot_->GetNodeCount());                         // 11.
-    writer_->Write(",\n\"edge_count\":");
-    writer_->Write(snapshot_->GetEdgeCount());                         // 12.
-    writer_->Write(",\n\"trace_function_count\":");
-    writer_->Write(snapshot_->GetTrackAllocationsStack().size());   // 13.
-    writer_->Write("\n},\n");  // 14.
+    writer->Write("\"location_fields\":[\"object_index\",\"script_id\",\"line\",\"column\"]},\n\"node_count\":");
+    writer->Write(nodeCount);            // 11.
+    writer->Write(",\n\"edge_count\":");
+    writer->Write(edgeCount);            // 12.
+    writer->Write(",\n\"trace_function_count\":");
+    writer->Write(traceFunctionCount);   // 13.
+    writer->Write("\n},\n");  // 14.
 }
 
 void HeapSnapshotJSONSerializer::SerializeNodes()
@@ -16,6 +16,8 @@
 #ifndef ECMASCRIPT_HPROF_HEAP_SNAPSHOT_SERIALIZER_H
 #define ECMASCRIPT_HPROF_HEAP_SNAPSHOT_SERIALIZER_H
 
+#include <array>
+#include <charconv>
 #include <fstream>
 #include <sstream>
 
@@ -41,9 +43,14 @@ public:
 
     void Write(const CString &str)
     {
-        ASSERT(str.size() <= static_cast<size_t>(INT_MAX));
-        auto len = static_cast<int>(str.size());
-        const char *cur = str.c_str();
+        Write(str.c_str(), str.size());
+    }
+
+    void Write(const char *data, size_t size)
+    {
+        ASSERT(size <= static_cast<size_t>(INT_MAX));
+        auto len = static_cast<int>(size);
+        const char *cur = data;
         const char *end = cur + len;
         while (cur < end) {
             int dstSize = chunkSize_ - current_;
@@ -62,7 +69,11 @@ public:
 
     void Write(uint64_t num)
     {
-        Write(ToCString(num));
+        // Format in place, numbers dominate the snapshot and a CString per number is costly
+        std::array<char, MAX_DIGITS> digits {};
+        auto [end, err] = std::to_chars(digits.data(), digits.data() + digits.size(), num);
+        ASSERT(err == std::errc());
+        Write(digits.data(), static_cast<size_t>(end - digits.data()));
     }
 
     void End()
@@ -74,6 +85,8 @@ public:
     }
 
 private:
+    static constexpr size_t MAX_DIGITS = 20;  // 20 : digits of UINT64_MAX
+
     void WriteChunk()
     {
         stream_->WriteChunk(chunk_.data(), current_);
@@ -94,6 +107,9 @@ public:
     NO_COPY_SEMANTIC(HeapSnapshotJSONSerializer);
     bool Serialize(HeapSnapshot *snapshot, Stream *stream);
 
+    static void WriteSnapshotHeader(StreamWriter *writer, uint64_t nodeCount, uint64_t edgeCount,
+                                    uint64_t traceFunctionCount);
+
 private:
     void SerializeSnapshotHeader();
     void SerializeNodes();
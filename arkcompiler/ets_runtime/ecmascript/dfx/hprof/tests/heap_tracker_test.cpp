@@ -19,6 +19,7 @@
 
 #include "ecmascript/dfx/hprof/heap_profiler_interface.h"
 #include "ecmascript/dfx/hprof/heap_profiler.h"
+#include "ecmascript/dfx/hprof/heap_snapshot_binary_serializer.h"
 #include "ecmascript/dfx/hprof/heap_snapshot_json_serializer.h"
 #include "ecmascript/dfx/hprof/heap_snapshot.h"
 #include "ecmascript/ecma_string.h"
@@ -26,6 +27,7 @@
 
 #include "ecmascript/js_tagged_value.h"
 #include "ecmascript/js_thread.h"
+#include "ecmascript/mem/assert_scope.h"
 #include "ecmascript/mem/heap.h"
 #include "ecmascript/tests/test_helper.h"
 #include "ecmascript/dfx/hprof/file_stream.h"
@@ -77,6 +79,42 @@ public:
 private:
     std::fstream testStream_;
 };
+
+class StringStream : public Stream {
+public:
+    StringStream() = default;
+    ~StringStream() = default;
+
+    void EndOfStream() override {}
+    int GetSize() override
+    {
+        static const int heapProfilerChunkSise = 100_KB;
+        return heapProfilerChunkSise;
+    }
+    bool WriteChunk(char *data, int32_t size) override
+    {
+        data_.append(data, size);
+        return true;
+    }
+    bool Good() override
+    {
+        return true;
+    }
+    void UpdateHeapStats([[maybe_unused]]HeapStat* updateData, [[maybe_unused]]int32_t count) override
+    {
+    }
+    void UpdateLastSeenObjectId([[maybe_unused]]int32_t lastSeenObjectId, [[maybe_unused]]int64_t timeStampUs) override
+    {
+    }
+
+    const std::string &GetData() const
+    {
+        return data_;
+    }
+
+private:
+    std::string data_;
+};
 }
 
 namespace panda::test {
@@ -584,4 +622,42 @@ HWTEST_F_L0(HeapTrackerTest, FindOrAddChild)
     TraceNode *tmpNode = traceNode.FindOrAddChild(2);
     EXPECT_TRUE(tmpNode->GetNodeIndex() == 2);
 }
+
+HWTEST_F_L0(HeapTrackerTest, BinarySnapshotConvertsToJSON)
+{
+    [[maybe_unused]] EcmaHandleScope handleScope(thread);
+    for (int i = 0; i < 100; i++) {
+        JSHandle<EcmaString> string = instance->GetFactory()->NewFromASCII("Hello World");
+        instance->GetFactory()->NewJSString(JSHandle<JSTaggedValue>(string));
+    }
+    HeapProfiler *heapProfile = static_cast<HeapProfiler *>(HeapProfilerInterface::GetInstance(instance));
+    HeapSnapshot *snapshot = heapProfile->GetChunk()->New<HeapSnapshot>(instance, true, false, false,
+                                                                          heapProfile->GetChunk());
+    {
+        DISALLOW_GARBAGE_COLLECTION;
+        const_cast<Heap *>(instance->GetHeap())->Prepare();
+        snapshot->BuildUp();
+    }
+    heapProfile->AddSnapshot(snapshot);
+
+    StringStream jsonStream;
+    HeapSnapshotJSONSerializer jsonSerializer;
+    EXPECT_TRUE(jsonSerializer.Serialize(snapshot, &jsonStream));
+    StringStream binaryStream;
+    HeapSnapshotBinarySerializer binarySerializer(instance);
+    EXPECT_TRUE(binarySerializer.Serialize(snapshot, &binaryStream));
+    EXPECT_LT(binaryStream.GetData().size(), jsonStream.GetData().size());
+
+    StringStream convertedStream;
+    const std::string &binary = binaryStream.GetData();
+    EXPECT_TRUE(HeapSnapshotBinarySerializer::ConvertToJSON(reinterpret_cast<const uint8_t *>(binary.data()),
+                                                            binary.size(), &convertedStream));
+    EXPECT_EQ(convertedStream.GetData(), jsonStream.GetData());
+
+    // a truncated file is rejected instead of producing a broken snapshot
+    StringStream truncatedStream;
+    EXPECT_FALSE(HeapSnapshotBinarySerializer::ConvertToJSON(reinterpret_cast<const uint8_t *>(binary.data()),
+                                                             binary.size() / 2, &truncatedStream));
+    HeapProfilerInterface::Destroy(instance);
+}
 }  // namespace panda::test
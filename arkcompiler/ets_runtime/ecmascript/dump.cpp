@@ -146,6 +146,8 @@ CString JSHClass::DumpJSType(JSType type)
             return "COWArray";
         case JSType::STRING:
             return "BaseString";
+        case JSType::TREE_STRING:
+            return "TreeString";
         case JSType::JS_NATIVE_POINTER:
             return "NativePointer";
         case JSType::JS_OBJECT:
@@ -586,6 +588,7 @@ static void DumpObject(TaggedObject *obj, std::ostream &os)
             DumpConstantPoolClass(ConstantPool::Cast(obj), os);
             break;
         case JSType::STRING:
+        case JSType::TREE_STRING:
             DumpStringClass(EcmaString::Cast(obj), os);
             os << "\n";
             break;
@@ -1060,7 +1063,7 @@ void JSTaggedValue::DumpHeapObjectType(std::ostream &os) const
     }
 
     JSType type = obj->GetClass()->GetObjectType();
-    if (type == JSType::STRING) {
+    if (type == JSType::STRING || type == JSType::TREE_STRING) {
         CString string = ConvertToString(EcmaString::Cast(obj));
         os << std::left << std::setw(DUMP_TYPE_OFFSET) << "[" + string + "]";
     } else if (type == JSType::METHOD) {
@@ -3521,6 +3524,13 @@ static void DumpStringClass(const EcmaString *str,
     vec.emplace_back("string", JSTaggedValue(str));
 }
 
+static void DumpTreeStringClass(const TreeEcmaString *str,
+                                std::vector<std::pair<CString, JSTaggedValue>> &vec)
+{
+    vec.emplace_back("first", str->GetFirst());
+    vec.emplace_back("second", str->GetSecond());
+}
+
 static void DumpClass(TaggedObject *obj,
                          std::vector<std::pair<CString, JSTaggedValue>> &vec)
 {
@@ -3551,6 +3561,9 @@ static void DumpObject(TaggedObject *obj,
         case JSType::STRING:
             DumpStringClass(EcmaString::Cast(obj), vec);
             return;
+        case JSType::TREE_STRING:
+            DumpTreeStringClass(TreeEcmaString::Cast(obj), vec);
+            return;
         case JSType::JS_NATIVE_POINTER:
             return;
         case JSType::JS_OBJECT:
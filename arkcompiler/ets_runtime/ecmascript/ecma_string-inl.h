@@ -119,11 +119,24 @@ inline uint16_t EcmaString::At(int32_t index) const
             return 0;
         }
     }
-    if (!IsUtf16()) {
-        Span<const uint8_t> sp(GetDataUtf8(), length);
+    const EcmaString *string = this;
+    while (string->IsTreeString()) {
+        const TreeEcmaString *tree = TreeEcmaString::ConstCast(string);
+        const EcmaString *first = EcmaString::Cast(tree->GetFirst().GetTaggedObject());
+        int32_t firstLength = static_cast<int32_t>(first->GetLength());
+        if (index < firstLength) {
+            string = first;
+        } else {
+            index -= firstLength;
+            string = EcmaString::Cast(tree->GetSecond().GetTaggedObject());
+        }
+    }
+    length = static_cast<int32_t>(string->GetLength());
+    if (!string->IsUtf16()) {
+        Span<const uint8_t> sp(string->GetDataUtf8(), length);
         return sp[index];
     }
-    Span<const uint16_t> sp(GetDataUtf16(), length);
+    Span<const uint16_t> sp(string->GetDataUtf16(), length);
     return sp[index];
 }
 
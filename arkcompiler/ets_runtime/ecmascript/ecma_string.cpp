@@ -15,6 +15,9 @@
 
 #include "ecmascript/ecma_string-inl.h"
 
+#include <type_traits>
+
+#include "ecmascript/base/simd_helper.h"
 #include "ecmascript/js_symbol.h"
 #include "ecmascript/mem/c_containers.h"
 
@@ -40,6 +43,10 @@ EcmaString *EcmaString::Concat(const EcmaVM *vm,
         return string1;
     }
     bool compressed = (!string1->IsUtf16() && !string2->IsUtf16());
+    if (newLength >= TreeEcmaString::MIN_TREE_ECMASTRING_LENGTH) {
+        return CreateTreeString(vm, str1Handle, str2Handle, newLength, compressed);
+    }
+    // both strings are shorter than any tree string, so they are flat
     auto newString = AllocStringObject(vm, newLength, compressed);
 
     // retrieve strings after gc
@@ -79,27 +86,168 @@ EcmaString *EcmaString::Concat(const EcmaVM *vm,
     return newString;
 }
 
+/* static */
+EcmaString *EcmaString::CreateTreeString(const EcmaVM *vm, const JSHandle<EcmaString> &left,
+    const JSHandle<EcmaString> &right, uint32_t length, bool compressed)
+{
+    // a flattened tree is linked by its flat content, which keeps the new tree shallow
+    auto flatOrTree = [](EcmaString *string) -> JSTaggedValue {
+        if (string->IsTreeString() && TreeEcmaString::Cast(string)->IsFlat()) {
+            return TreeEcmaString::Cast(string)->GetFirst();
+        }
+        return JSTaggedValue(string);
+    };
+    JSThread *thread = vm->GetJSThread();
+    auto string = TreeEcmaString::Cast(vm->GetFactory()->AllocTreeStringObject());
+    string->SetLength(length, compressed);
+    string->SetRawHashcode(0);
+    string->SetFirst(thread, flatOrTree(*left));
+    string->SetSecond(thread, flatOrTree(*right));
+    return string;
+}
+
+/* static */
+EcmaString *EcmaString::Flatten(const EcmaVM *vm, const JSHandle<EcmaString> &string)
+{
+    EcmaString *src = *string;
+    if (!src->IsTreeString()) {
+        return src;
+    }
+    if (TreeEcmaString::Cast(src)->IsFlat()) {
+        return EcmaString::Cast(TreeEcmaString::Cast(src)->GetFirst().GetTaggedObject());
+    }
+    uint32_t length = src->GetLength();
+    bool compressed = src->IsUtf8();
+    auto result = AllocStringObject(vm, length, compressed);
+
+    // retrieve the tree after gc
+    src = *string;
+    if (compressed) {
+        WriteToFlat(src, result->GetDataUtf8Writable(), length);
+    } else {
+        WriteToFlat(src, result->GetDataUtf16Writable(), length);
+    }
+    result->SetRawHashcode(src->GetRawHashcode());
+    JSThread *thread = vm->GetJSThread();
+    TreeEcmaString *tree = TreeEcmaString::Cast(src);
+    tree->SetFirst(thread, JSTaggedValue(result));
+    tree->SetSecond(thread, thread->GlobalConstants()->GetEmptyString());
+    return result;
+}
+
+template<typename DstType, typename SrcType>
+static void CopyChars(DstType *dst, const SrcType *src, uint32_t count)
+{
+    if constexpr (std::is_same_v<DstType, SrcType>) {
+        if (memcpy_s(dst, count * sizeof(DstType), src, count * sizeof(SrcType)) != EOK) {
+            LOG_FULL(FATAL) << "memcpy_s failed";
+            UNREACHABLE();
+        }
+    } else if constexpr (std::is_same_v<DstType, uint16_t> && std::is_same_v<SrcType, uint8_t>) {
+        base::simd_helper::WidenCopy(dst, src, count);
+    } else {
+        Span<DstType> to(dst, count);
+        Span<const SrcType> from(src, count);
+        for (uint32_t i = 0; i < count; i++) {
+            to[i] = static_cast<DstType>(from[i]);
+        }
+    }
+}
+
+/* static */
+template<typename Char>
+void EcmaString::WriteToFlat(EcmaString *src, Char *buf, uint32_t length)
+{
+    // Only the shorter child is written recursively and the loop goes on with the longer one, so the recursion
+    // stays shallow even for the degenerate trees built by appending in a loop.
+    while (length != 0) {
+        ASSERT(length == src->GetLength());
+        if (!src->IsTreeString()) {
+            ASSERT(sizeof(Char) == sizeof(uint16_t) || src->IsUtf8());
+            if (src->IsUtf8()) {
+                CopyChars(buf, src->GetDataUtf8(), length);
+            } else {
+                CopyChars(buf, src->GetDataUtf16(), length);
+            }
+            return;
+        }
+        TreeEcmaString *tree = TreeEcmaString::Cast(src);
+        EcmaString *first = EcmaString::Cast(tree->GetFirst().GetTaggedObject());
+        EcmaString *second = EcmaString::Cast(tree->GetSecond().GetTaggedObject());
+        uint32_t firstLength = first->GetLength();
+        uint32_t secondLength = second->GetLength();
+        if (secondLength >= firstLength) {
+            WriteToFlat(first, buf, firstLength);
+            buf += firstLength;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            src = second;
+            length = secondLength;
+        } else {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            WriteToFlat(second, buf + firstLength, secondLength);
+            src = first;
+            length = firstLength;
+        }
+    }
+}
+
+/* static */
+const uint8_t *EcmaString::GetUtf8DataFlat(const EcmaString *src, CVector<uint8_t> &buf)
+{
+    ASSERT(src->IsUtf8());
+    EcmaString *string = const_cast<EcmaString *>(src);
+    if (string->IsTreeString()) {
+        TreeEcmaString *tree = TreeEcmaString::Cast(string);
+        if (!tree->IsFlat()) {
+            uint32_t length = string->GetLength();
+            buf.resize(length);
+            WriteToFlat(string, buf.data(), length);
+            return buf.data();
+        }
+        string = EcmaString::Cast(tree->GetFirst().GetTaggedObject());
+    }
+    return string->GetDataUtf8();
+}
+
+/* static */
+const uint16_t *EcmaString::GetUtf16DataFlat(const EcmaString *src, CVector<uint16_t> &buf)
+{
+    ASSERT(src->IsUtf16());
+    EcmaString *string = const_cast<EcmaString *>(src);
+    if (string->IsTreeString()) {
+        TreeEcmaString *tree = TreeEcmaString::Cast(string);
+        if (!tree->IsFlat()) {
+            uint32_t length = string->GetLength();
+            buf.resize(length);
+            WriteToFlat(string, buf.data(), length);
+            return buf.data();
+        }
+        string = EcmaString::Cast(tree->GetFirst().GetTaggedObject());
+    }
+    return string->GetDataUtf16();
+}
+
 /* static */
 EcmaString *EcmaString::FastSubString(const EcmaVM *vm,
     const JSHandle<EcmaString> &src, uint32_t start, uint32_t utf16Len)
 {
-    if (src->IsUtf8()) {
-        return FastSubUtf8String(vm, src, start, utf16Len);
+    JSHandle<EcmaString> string = src;
+    if (UNLIKELY(src->IsTreeString())) {
+        string = JSHandle<EcmaString>(vm->GetJSThread(), Flatten(vm, src));
+    }
+    if (string->IsUtf8()) {
+        return FastSubUtf8String(vm, string, start, utf16Len);
     }
-    return FastSubUtf16String(vm, src, start, utf16Len);
+    return FastSubUtf16String(vm, string, start, utf16Len);
 }
 
 template<typename T1, typename T2>
 int32_t CompareStringSpan(Span<T1> &lhsSp, Span<T2> &rhsSp, int32_t count)
 {
-    for (int32_t i = 0; i < count; ++i) {
-        auto left = static_cast<int32_t>(lhsSp[i]);
-        auto right = static_cast<int32_t>(rhsSp[i]);
-        if (left != right) {
-            return left - right;
-        }
+    size_t index = base::simd_helper::Mismatch(lhsSp.data(), rhsSp.data(), count);
+    if (index == static_cast<size_t>(count)) {
+        return 0;
     }
-    return 0;
+    return static_cast<int32_t>(lhsSp[index]) - static_cast<int32_t>(rhsSp[index]);
 }
 
 int32_t EcmaString::Compare(EcmaString *lhs, EcmaString *rhs)
@@ -111,30 +259,34 @@ int32_t EcmaString::Compare(EcmaString *lhs, EcmaString *rhs)
     int32_t rhsCount = static_cast<int32_t>(rhs->GetLength());
     int32_t countDiff = lhsCount - rhsCount;
     int32_t minCount = (countDiff < 0) ? lhsCount : rhsCount;
+    CVector<uint8_t> lhsBufUtf8;
+    CVector<uint16_t> lhsBufUtf16;
+    CVector<uint8_t> rhsBufUtf8;
+    CVector<uint16_t> rhsBufUtf16;
     if (!lhs->IsUtf16() && !rhs->IsUtf16()) {
-        Span<const uint8_t> lhsSp(lhs->GetDataUtf8(), lhsCount);
-        Span<const uint8_t> rhsSp(rhs->GetDataUtf8(), rhsCount);
+        Span<const uint8_t> lhsSp(GetUtf8DataFlat(lhs, lhsBufUtf8), lhsCount);
+        Span<const uint8_t> rhsSp(GetUtf8DataFlat(rhs, rhsBufUtf8), rhsCount);
         int32_t charDiff = CompareStringSpan(lhsSp, rhsSp, minCount);
         if (charDiff != 0) {
             return charDiff;
         }
     } else if (!lhs->IsUtf16()) {
-        Span<const uint8_t> lhsSp(lhs->GetDataUtf8(), lhsCount);
-        Span<const uint16_t> rhsSp(rhs->GetDataUtf16(), rhsCount);
+        Span<const uint8_t> lhsSp(GetUtf8DataFlat(lhs, lhsBufUtf8), lhsCount);
+        Span<const uint16_t> rhsSp(GetUtf16DataFlat(rhs, rhsBufUtf16), rhsCount);
         int32_t charDiff = CompareStringSpan(lhsSp, rhsSp, minCount);
         if (charDiff != 0) {
             return charDiff;
         }
     } else if (!rhs->IsUtf16()) {
-        Span<const uint16_t> lhsSp(lhs->GetDataUtf16(), rhsCount);
-        Span<const uint8_t> rhsSp(rhs->GetDataUtf8(), lhsCount);
+        Span<const uint16_t> lhsSp(GetUtf16DataFlat(lhs, lhsBufUtf16), lhsCount);
+        Span<const uint8_t> rhsSp(GetUtf8DataFlat(rhs, rhsBufUtf8), rhsCount);
         int32_t charDiff = CompareStringSpan(lhsSp, rhsSp, minCount);
         if (charDiff != 0) {
             return charDiff;
         }
     } else {
-        Span<const uint16_t> lhsSp(lhs->GetDataUtf16(), lhsCount);
-        Span<const uint16_t> rhsSp(rhs->GetDataUtf16(), rhsCount);
+        Span<const uint16_t> lhsSp(GetUtf16DataFlat(lhs, lhsBufUtf16), lhsCount);
+        Span<const uint16_t> rhsSp(GetUtf16DataFlat(rhs, rhsBufUtf16), rhsCount);
         int32_t charDiff = CompareStringSpan(lhsSp, rhsSp, minCount);
         if (charDiff != 0) {
             return charDiff;
@@ -143,31 +295,32 @@ int32_t EcmaString::Compare(EcmaString *lhs, EcmaString *rhs)
     return countDiff;
 }
 
+/* static */
+int32_t EcmaString::Compare(const EcmaVM *vm, const JSHandle<EcmaString> &left, const JSHandle<EcmaString> &right)
+{
+    JSHandle<EcmaString> flatLeft(vm->GetJSThread(), Flatten(vm, left));
+    EcmaString *flatRight = Flatten(vm, right);
+    return Compare(*flatLeft, flatRight);
+}
+
 /* static */
 template<typename T1, typename T2>
 int32_t EcmaString::IndexOf(Span<const T1> &lhsSp, Span<const T2> &rhsSp, int32_t pos, int32_t max)
 {
     ASSERT(rhsSp.size() > 0);
-    auto first = static_cast<int32_t>(rhsSp[0]);
-    int32_t i;
-    for (i = pos; i <= max; i++) {
-        if (static_cast<int32_t>(lhsSp[i]) != first) {
-            i++;
-            while (i <= max && static_cast<int32_t>(lhsSp[i]) != first) {
-                i++;
-            }
+    // a utf16 pattern is never searched in a utf8 string, so the first character fits in T1
+    static_assert(sizeof(T1) >= sizeof(T2));
+    auto first = static_cast<T1>(rhsSp[0]);
+    size_t restCount = rhsSp.size() - 1;
+    for (int32_t i = pos; i <= max; i++) {
+        i += static_cast<int32_t>(base::simd_helper::FindChar(lhsSp.data() + i, max - i + 1, first));
+        if (i > max) {
+            break;
         }
         /* Found first character, now look at the rest of rhsSp */
-        if (i <= max) {
-            int j = i + 1;
-            int end = j + static_cast<int>(rhsSp.size()) - 1;
-
-            for (int k = 1; j < end && static_cast<int32_t>(lhsSp[j]) == static_cast<int32_t>(rhsSp[k]); j++, k++) {
-            }
-            if (j == end) {
-                /* Found whole string. */
-                return i;
-            }
+        if (base::simd_helper::Mismatch(lhsSp.data() + i + 1, rhsSp.data() + 1, restCount) == restCount) {
+            /* Found whole string. */
+            return i;
         }
     }
     return -1;
@@ -222,19 +375,23 @@ int32_t EcmaString::IndexOf(EcmaString *lhs, EcmaString *rhs, int pos)
     if (max < 0) {
         return -1;
     }
+    CVector<uint8_t> lhsBufUtf8;
+    CVector<uint16_t> lhsBufUtf16;
+    CVector<uint8_t> rhsBufUtf8;
+    CVector<uint16_t> rhsBufUtf16;
     if (rhs->IsUtf8() && lhs->IsUtf8()) {
-        Span<const uint8_t> lhsSp(lhs->GetDataUtf8(), lhsCount);
-        Span<const uint8_t> rhsSp(rhs->GetDataUtf8(), rhsCount);
+        Span<const uint8_t> lhsSp(GetUtf8DataFlat(lhs, lhsBufUtf8), lhsCount);
+        Span<const uint8_t> rhsSp(GetUtf8DataFlat(rhs, rhsBufUtf8), rhsCount);
         return EcmaString::IndexOf(lhsSp, rhsSp, pos, max);
     } else if (rhs->IsUtf16() && lhs->IsUtf16()) {  // NOLINT(readability-else-after-return)
-        Span<const uint16_t> lhsSp(lhs->GetDataUtf16(), lhsCount);
-        Span<const uint16_t> rhsSp(rhs->GetDataUtf16(), rhsCount);
+        Span<const uint16_t> lhsSp(GetUtf16DataFlat(lhs, lhsBufUtf16), lhsCount);
+        Span<const uint16_t> rhsSp(GetUtf16DataFlat(rhs, rhsBufUtf16), rhsCount);
         return EcmaString::IndexOf(lhsSp, rhsSp, pos, max);
     } else if (rhs->IsUtf16()) {
         return -1;
     } else {  // NOLINT(readability-else-after-return)
-        Span<const uint16_t> lhsSp(lhs->GetDataUtf16(), lhsCount);
-        Span<const uint8_t> rhsSp(rhs->GetDataUtf8(), rhsCount);
+        Span<const uint16_t> lhsSp(GetUtf16DataFlat(lhs, lhsBufUtf16), lhsCount);
+        Span<const uint8_t> rhsSp(GetUtf8DataFlat(rhs, rhsBufUtf8), rhsCount);
         return EcmaString::IndexOf(lhsSp, rhsSp, pos, max);
     }
 }
@@ -267,19 +424,23 @@ int32_t EcmaString::LastIndexOf(EcmaString *lhs, EcmaString *rhs, int pos)
         return pos;
     }
 
+    CVector<uint8_t> lhsBufUtf8;
+    CVector<uint16_t> lhsBufUtf16;
+    CVector<uint8_t> rhsBufUtf8;
+    CVector<uint16_t> rhsBufUtf16;
     if (rhs->IsUtf8() && lhs->IsUtf8()) {
-        Span<const uint8_t> lhsSp(lhs->GetDataUtf8(), lhsCount);
-        Span<const uint8_t> rhsSp(rhs->GetDataUtf8(), rhsCount);
+        Span<const uint8_t> lhsSp(GetUtf8DataFlat(lhs, lhsBufUtf8), lhsCount);
+        Span<const uint8_t> rhsSp(GetUtf8DataFlat(rhs, rhsBufUtf8), rhsCount);
         return EcmaString::LastIndexOf(lhsSp, rhsSp, pos);
     } else if (rhs->IsUtf16() && lhs->IsUtf16()) {  // NOLINT(readability-else-after-return)
-        Span<const uint16_t> lhsSp(lhs->GetDataUtf16(), lhsCount);
-        Span<const uint16_t> rhsSp(rhs->GetDataUtf16(), rhsCount);
+        Span<const uint16_t> lhsSp(GetUtf16DataFlat(lhs, lhsBufUtf16), lhsCount);
+        Span<const uint16_t> rhsSp(GetUtf16DataFlat(rhs, rhsBufUtf16), rhsCount);
         return EcmaString::LastIndexOf(lhsSp, rhsSp, pos);
     } else if (rhs->IsUtf16()) {
         return -1;
     } else {  // NOLINT(readability-else-after-return)
-        Span<const uint16_t> lhsSp(lhs->GetDataUtf16(), lhsCount);
-        Span<const uint8_t> rhsSp(rhs->GetDataUtf8(), rhsCount);
+        Span<const uint16_t> lhsSp(GetUtf16DataFlat(lhs, lhsBufUtf16), lhsCount);
+        Span<const uint8_t> rhsSp(GetUtf8DataFlat(rhs, rhsBufUtf8), rhsCount);
         return EcmaString::LastIndexOf(lhsSp, rhsSp, pos);
     }
 }
@@ -289,9 +450,11 @@ std::u16string EcmaString::ToU16String(uint32_t len)
     uint32_t length = len > 0 ? len : GetLength();
     std::u16string result;
     if (IsUtf16()) {
-        result = base::StringHelper::Utf16ToU16String(GetDataUtf16(), length);
+        CVector<uint16_t> buf;
+        result = base::StringHelper::Utf16ToU16String(GetUtf16DataFlat(this, buf), length);
     } else {
-        result = base::StringHelper::Utf8ToU16String(GetDataUtf8(), length);
+        CVector<uint8_t> buf;
+        result = base::StringHelper::Utf8ToU16String(GetUtf8DataFlat(this, buf), length);
     }
     return result;
 }
@@ -300,50 +463,29 @@ std::u16string EcmaString::ToU16String(uint32_t len)
 bool EcmaString::CanBeCompressed(const EcmaString *string)
 {
     if (string->IsUtf8()) {
-        return CanBeCompressed(string->GetDataUtf8(), string->GetLength());
+        CVector<uint8_t> buf;
+        return CanBeCompressed(GetUtf8DataFlat(string, buf), string->GetLength());
     }
-    return CanBeCompressed(string->GetDataUtf16(), string->GetLength());
+    CVector<uint16_t> buf;
+    return CanBeCompressed(GetUtf16DataFlat(string, buf), string->GetLength());
 }
 
 // static
 bool EcmaString::CanBeCompressed(const uint8_t *utf8Data, uint32_t utf8Len)
 {
-    bool isCompressed = true;
-    uint32_t index = 0;
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    while (index < utf8Len) {
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        if (!IsASCIICharacter(utf8Data[index])) {
-            isCompressed = false;
-            break;
-        }
-        ++index;
-    }
-    return isCompressed;
+    return base::simd_helper::CompressiblePrefix(utf8Data, utf8Len) == utf8Len;
 }
 
 /* static */
 bool EcmaString::CanBeCompressed(const uint16_t *utf16Data, uint32_t utf16Len)
 {
-    bool isCompressed = true;
-    Span<const uint16_t> data(utf16Data, utf16Len);
-    for (uint32_t i = 0; i < utf16Len; i++) {
-        if (!IsASCIICharacter(data[i])) {
-            isCompressed = false;
-            break;
-        }
-    }
-    return isCompressed;
+    return base::simd_helper::CompressiblePrefix(utf16Data, utf16Len) == utf16Len;
 }
 
 /* static */
 void EcmaString::CopyUtf16AsUtf8(const uint16_t *utf16From, uint8_t *utf8To, uint32_t utf16Len)
 {
-    Span<const uint16_t> from(utf16From, utf16Len);
-    Span<uint8_t> to(utf8To, utf16Len);
-    for (uint32_t i = 0; i < utf16Len; i++) {
-        to[i] = from[i];
-    }
+    base::simd_helper::NarrowCopy(utf8To, utf16From, utf16Len);
 }
 
 bool EcmaString::EqualToSplicedString(const EcmaString *str1, const EcmaString *str2)
@@ -362,11 +504,13 @@ bool EcmaString::EqualToSplicedString(const EcmaString *str1, const EcmaString *
         if (str1->IsUtf16() || str2->IsUtf16()) {
             return false;
         }
+        CVector<uint8_t> buf1;
+        CVector<uint8_t> buf2;
         Span<const uint8_t> concatData(GetDataUtf8(), str1->GetLength());
-        Span<const uint8_t> data1(str1->GetDataUtf8(), str1->GetLength());
+        Span<const uint8_t> data1(GetUtf8DataFlat(str1, buf1), str1->GetLength());
         if (EcmaString::StringsAreEquals(concatData, data1)) {
             concatData = Span<const uint8_t>(GetDataUtf8() + str1->GetLength(), str2->GetLength());
-            Span<const uint8_t> data2(str2->GetDataUtf8(), str2->GetLength());
+            Span<const uint8_t> data2(GetUtf8DataFlat(str2, buf2), str2->GetLength());
             return EcmaString::StringsAreEquals(concatData, data2);
         }
     }
@@ -377,12 +521,16 @@ bool EcmaString::EqualToSplicedString(const EcmaString *str1, const EcmaString *
 bool EcmaString::StringsAreEqualSameUtfEncoding(EcmaString *str1, EcmaString *str2)
 {
     if (str1->IsUtf16()) {
-        Span<const uint16_t> data1(str1->GetDataUtf16(), str1->GetLength());
-        Span<const uint16_t> data2(str2->GetDataUtf16(), str1->GetLength());
+        CVector<uint16_t> buf1;
+        CVector<uint16_t> buf2;
+        Span<const uint16_t> data1(GetUtf16DataFlat(str1, buf1), str1->GetLength());
+        Span<const uint16_t> data2(GetUtf16DataFlat(str2, buf2), str1->GetLength());
         return EcmaString::StringsAreEquals(data1, data2);
     } else {  // NOLINT(readability-else-after-return)
-        Span<const uint8_t> data1(str1->GetDataUtf8(), str1->GetLength());
-        Span<const uint8_t> data2(str2->GetDataUtf8(), str1->GetLength());
+        CVector<uint8_t> buf1;
+        CVector<uint8_t> buf2;
+        Span<const uint8_t> data1(GetUtf8DataFlat(str1, buf1), str1->GetLength());
+        Span<const uint8_t> data2(GetUtf8DataFlat(str2, buf2), str1->GetLength());
         return EcmaString::StringsAreEquals(data1, data2);
     }
 }
@@ -397,6 +545,17 @@ bool EcmaString::StringsAreEqual(EcmaString *str1, EcmaString *str2)
     return StringsAreEqualSameUtfEncoding(str1, str2);
 }
 
+/* static */
+bool EcmaString::StringsAreEqual(const EcmaVM *vm, const JSHandle<EcmaString> &str1, const JSHandle<EcmaString> &str2)
+{
+    if (str1->IsUtf16() != str2->IsUtf16() || str1->GetLength() != str2->GetLength()) {
+        return false;
+    }
+    JSHandle<EcmaString> flatStr1(vm->GetJSThread(), Flatten(vm, str1));
+    EcmaString *flatStr2 = Flatten(vm, str2);
+    return StringsAreEqual(*flatStr1, flatStr2);
+}
+
 /* static */
 bool EcmaString::StringsAreEqualUtf8(const EcmaString *str1, const uint8_t *utf8Data, uint32_t utf8Len,
                                      bool canBeCompress)
@@ -410,11 +569,13 @@ bool EcmaString::StringsAreEqualUtf8(const EcmaString *str1, const uint8_t *utf8
     }
 
     if (canBeCompress) {
-        Span<const uint8_t> data1(str1->GetDataUtf8(), utf8Len);
+        CVector<uint8_t> buf;
+        Span<const uint8_t> data1(GetUtf8DataFlat(str1, buf), utf8Len);
         Span<const uint8_t> data2(utf8Data, utf8Len);
         return EcmaString::StringsAreEquals(data1, data2);
     }
-    return IsUtf8EqualsUtf16(utf8Data, utf8Len, str1->GetDataUtf16(), str1->GetLength());
+    CVector<uint16_t> buf;
+    return IsUtf8EqualsUtf16(utf8Data, utf8Len, GetUtf16DataFlat(str1, buf), str1->GetLength());
 }
 
 /* static */
@@ -424,9 +585,11 @@ bool EcmaString::StringsAreEqualUtf16(const EcmaString *str1, const uint16_t *ut
     if (str1->GetLength() != utf16Len) {
         result = false;
     } else if (!str1->IsUtf16()) {
-        result = IsUtf8EqualsUtf16(str1->GetDataUtf8(), str1->GetLength(), utf16Data, utf16Len);
+        CVector<uint8_t> buf;
+        result = IsUtf8EqualsUtf16(GetUtf8DataFlat(str1, buf), str1->GetLength(), utf16Data, utf16Len);
     } else {
-        Span<const uint16_t> data1(str1->GetDataUtf16(), str1->GetLength());
+        CVector<uint16_t> buf;
+        Span<const uint16_t> data1(GetUtf16DataFlat(str1, buf), str1->GetLength());
         Span<const uint16_t> data2(utf16Data, utf16Len);
         result = EcmaString::StringsAreEquals(data1, data2);
     }
@@ -465,13 +628,7 @@ bool EcmaString::StringCopy(Span<T> &dst, size_t dstMax, Span<const T> &src, siz
 template<class T>
 static int32_t ComputeHashForData(const T *data, size_t size, uint32_t hashSeed)
 {
-    uint32_t hash = hashSeed;
-    Span<const T> sp(data, size);
-    for (auto c : sp) {
-        constexpr size_t SHIFT = 5;
-        hash = (hash << SHIFT) - hash + c;
-    }
-    return static_cast<int32_t>(hash);
+    return static_cast<int32_t>(base::simd_helper::ComputeHash(data, size, hashSeed));
 }
 
 static int32_t ComputeHashForUtf8(const uint8_t *utf8Data, uint32_t utf8DataLength)
@@ -479,22 +636,18 @@ static int32_t ComputeHashForUtf8(const uint8_t *utf8Data, uint32_t utf8DataLeng
     if (utf8Data == nullptr) {
         return 0;
     }
-    uint32_t hash = 0;
-    const uint8_t *end = utf8Data + utf8DataLength;
-    while (utf8Data < end) { // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-        constexpr size_t SHIFT = 5;
-        hash = (hash << SHIFT) - hash + *utf8Data++;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    }
-    return static_cast<int32_t>(hash);
+    return ComputeHashForData(utf8Data, utf8DataLength, 0);
 }
 
 uint32_t EcmaString::ComputeHashcode(uint32_t hashSeed) const
 {
     int32_t hash;
     if (!IsUtf16()) {
-        hash = ComputeHashForData(GetDataUtf8(), GetLength(), hashSeed);
+        CVector<uint8_t> buf;
+        hash = ComputeHashForData(GetUtf8DataFlat(this, buf), GetLength(), hashSeed);
     } else {
-        hash = ComputeHashForData(GetDataUtf16(), GetLength(), hashSeed);
+        CVector<uint16_t> buf;
+        hash = ComputeHashForData(GetUtf16DataFlat(this, buf), GetLength(), hashSeed);
     }
     return static_cast<uint32_t>(hash);
 }
@@ -539,6 +692,9 @@ bool EcmaString::IsUtf8EqualsUtf16(const uint8_t *utf8Data, size_t utf8Len, cons
     return EcmaString::StringsAreEquals(data1, data2);
 }
 
+// Index strings are never tree strings, the stubs read their characters directly as well.
+static_assert(TreeEcmaString::MIN_TREE_ECMASTRING_LENGTH > MAX_ELEMENT_INDEX_LEN);
+
 bool EcmaString::ToElementIndex(uint32_t *index)
 {
     uint32_t len = GetLength();
@@ -639,15 +795,16 @@ EcmaString *EcmaString::ToLower(const EcmaVM *vm, const JSHandle<EcmaString> &sr
 {
     uint32_t srcLength = src->GetLength();
     auto factory = vm->GetFactory();
-    if (src->IsUtf16()) {
-        std::u16string u16str = base::StringHelper::Utf16ToU16String(src->GetDataUtf16(), srcLength);
+    JSHandle<EcmaString> string(vm->GetJSThread(), Flatten(vm, src));
+    if (string->IsUtf16()) {
+        std::u16string u16str = base::StringHelper::Utf16ToU16String(string->GetDataUtf16(), srcLength);
         std::string res = base::StringHelper::ToLower(u16str);
         return *(factory->NewFromStdString(res));
     } else {
         const char start = 'A';
         const char end = 'Z';
         auto newString = AllocStringObject(vm, srcLength, true);
-        Span<uint8_t> data(src->GetDataUtf8Writable(), srcLength);
+        Span<uint8_t> data(string->GetDataUtf8Writable(), srcLength);
         auto newStringPtr = newString->GetDataUtf8Writable();
         for (uint32_t index = 0; index < srcLength; ++index) {
             if (base::StringHelper::Utf8CharInRange(data[index], start, end)) {
@@ -665,15 +822,16 @@ EcmaString *EcmaString::ToUpper(const EcmaVM *vm, const JSHandle<EcmaString> &sr
 {
     uint32_t srcLength = src->GetLength();
     auto factory = vm->GetFactory();
-    if (src->IsUtf16()) {
-        std::u16string u16str = base::StringHelper::Utf16ToU16String(src->GetDataUtf16(), srcLength);
+    JSHandle<EcmaString> string(vm->GetJSThread(), Flatten(vm, src));
+    if (string->IsUtf16()) {
+        std::u16string u16str = base::StringHelper::Utf16ToU16String(string->GetDataUtf16(), srcLength);
         std::string res = base::StringHelper::ToUpper(u16str);
         return *(factory->NewFromStdString(res));
     } else {
         const char start = 'a';
         const char end = 'z';
         auto newString = AllocStringObject(vm, srcLength, true);
-        Span<uint8_t> data(src->GetDataUtf8Writable(), srcLength);
+        Span<uint8_t> data(string->GetDataUtf8Writable(), srcLength);
         auto newStringPtr = newString->GetDataUtf8Writable();
         for (uint32_t index = 0; index < srcLength; ++index) {
             if (base::StringHelper::Utf8CharInRange(data[index], start, end)) {
@@ -710,12 +868,13 @@ EcmaString *EcmaString::Trim(const JSThread *thread, const JSHandle<EcmaString>
     if (UNLIKELY(srcLen == 0)) {
         return EcmaString::Cast(thread->GlobalConstants()->GetEmptyString().GetTaggedObject());
     }
-    if (src->IsUtf8()) {
-        Span<const uint8_t> data(src->GetDataUtf8(), srcLen);
-        return TrimBody(thread, src, data, mode);
+    JSHandle<EcmaString> string(thread, Flatten(thread->GetEcmaVM(), src));
+    if (string->IsUtf8()) {
+        Span<const uint8_t> data(string->GetDataUtf8(), srcLen);
+        return TrimBody(thread, string, data, mode);
     } else {
-        Span<const uint16_t> data(src->GetDataUtf16(), srcLen);
-        return TrimBody(thread, src, data, mode);
+        Span<const uint16_t> data(string->GetDataUtf16(), srcLen);
+        return TrimBody(thread, string, data, mode);
     }
 }
 
@@ -26,6 +26,7 @@
 #include "ecmascript/mem/barriers.h"
 #include "ecmascript/mem/space.h"
 #include "ecmascript/mem/tagged_object.h"
+#include "ecmascript/mem/visitor.h"
 
 #include "libpandabase/macros.h"
 #include "securec.h"
@@ -39,6 +40,7 @@ class EcmaVM;
 class EcmaString : public TaggedObject {
 public:
     friend class EcmaStringAccessor;
+    friend class TreeEcmaString;
 
     CAST_CHECK(EcmaString, IsString);
 
@@ -74,11 +76,15 @@ private:
         const JSHandle<EcmaString> &str1Handle, const JSHandle<EcmaString> &str2Handle);
     static EcmaString *FastSubString(const EcmaVM *vm,
         const JSHandle<EcmaString> &src, uint32_t start, uint32_t length);
+    static EcmaString *CreateTreeString(const EcmaVM *vm, const JSHandle<EcmaString> &left,
+                                        const JSHandle<EcmaString> &right, uint32_t length, bool compressed);
+    static EcmaString *Flatten(const EcmaVM *vm, const JSHandle<EcmaString> &string);
 
     template<bool verify = true>
     uint16_t At(int32_t index) const;
 
     static int32_t Compare(EcmaString *lhs, EcmaString *rhs);
+    static int32_t Compare(const EcmaVM *vm, const JSHandle<EcmaString> &left, const JSHandle<EcmaString> &right);
 
     bool IsUtf16() const
     {
@@ -90,6 +96,13 @@ private:
         return (GetMixLength() & STRING_COMPRESSED_BIT) == STRING_COMPRESSED;
     }
 
+    bool IsTreeString() const
+    {
+        return JSTaggedValue(this).IsTreeString();
+    }
+
+    inline bool IsFlat() const;
+
     static size_t ComputeDataSizeUtf16(uint32_t length)
     {
         return length * sizeof(uint16_t);
@@ -105,6 +118,7 @@ private:
 
     inline uint16_t *GetData() const
     {
+        ASSERT_PRINT(!IsTreeString(), "EcmaString: Read data of a tree string");
         return reinterpret_cast<uint16_t *>(ToUintPtr(this) + DATA_OFFSET);
     }
 
@@ -136,7 +150,8 @@ private:
         if (!IsUtf16()) {
             return GetLength() + 1;  // add place for zero in the end
         }
-        return base::utf_helper::Utf16ToUtf8Size(GetData(), GetLength(), modify);
+        CVector<uint16_t> tmpBuf;
+        return base::utf_helper::Utf16ToUtf8Size(GetUtf16DataFlat(this, tmpBuf), GetLength(), modify);
     }
 
     size_t GetUtf16Length() const
@@ -181,25 +196,29 @@ private:
                 LOG_FULL(FATAL) << " length is higher than half of size_t::max";
                 UNREACHABLE();
             }
+            CVector<uint8_t> tmpBuf;
+            const uint8_t *data = GetUtf8DataFlat(this, tmpBuf);
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             // Only memcpy_s maxLength number of chars into buffer if length > maxLength
             if (length > maxLength) {
-                if (memcpy_s(buf, maxLength, GetDataUtf8() + start, maxLength) != EOK) {
+                if (memcpy_s(buf, maxLength, data + start, maxLength) != EOK) {
                     LOG_FULL(FATAL) << "memcpy_s failed when length > maxlength";
                     UNREACHABLE();
                 }
                 return maxLength;
             }
-            if (memcpy_s(buf, maxLength, GetDataUtf8() + start, length) != EOK) {
+            if (memcpy_s(buf, maxLength, data + start, length) != EOK) {
                 LOG_FULL(FATAL) << "memcpy_s failed when length <= maxlength";
                 UNREACHABLE();
             }
             return length;
         }
+        CVector<uint16_t> tmpBuf;
+        const uint16_t *data = GetUtf16DataFlat(this, tmpBuf);
         if (length > maxLength) {
-            return base::utf_helper::ConvertRegionUtf16ToUtf8(GetDataUtf16(), buf, maxLength, maxLength, start, modify);
+            return base::utf_helper::ConvertRegionUtf16ToUtf8(data, buf, maxLength, maxLength, start, modify);
         }
-        return base::utf_helper::ConvertRegionUtf16ToUtf8(GetDataUtf16(), buf, length, maxLength, start, modify);
+        return base::utf_helper::ConvertRegionUtf16ToUtf8(data, buf, length, maxLength, start, modify);
     }
 
     inline uint32_t CopyDataUtf16(uint16_t *buf, uint32_t maxLength) const
@@ -217,15 +236,17 @@ private:
             return 0;
         }
         if (IsUtf16()) {
+            CVector<uint16_t> tmpBuf;
+            const uint16_t *data = GetUtf16DataFlat(this, tmpBuf);
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            if (memcpy_s(buf, ComputeDataSizeUtf16(maxLength), GetDataUtf16() + start, ComputeDataSizeUtf16(length)) !=
-                EOK) {
+            if (memcpy_s(buf, ComputeDataSizeUtf16(maxLength), data + start, ComputeDataSizeUtf16(length)) != EOK) {
                 LOG_FULL(FATAL) << "memcpy_s failed";
                 UNREACHABLE();
             }
             return length;
         }
-        return base::utf_helper::ConvertRegionUtf8ToUtf16(GetDataUtf8(), buf, len, maxLength, start);
+        CVector<uint8_t> tmpBuf;
+        return base::utf_helper::ConvertRegionUtf8ToUtf16(GetUtf8DataFlat(this, tmpBuf), buf, len, maxLength, start);
     }
 
     std::u16string ToU16String(uint32_t len = 0);
@@ -250,12 +271,14 @@ private:
         Span<const uint8_t> str;
         uint32_t strLen = GetLength();
         if (UNLIKELY(IsUtf16())) {
-            size_t len = base::utf_helper::Utf16ToUtf8Size(GetDataUtf16(), strLen, modify) - 1;
+            CVector<uint16_t> tmpBuf;
+            const uint16_t *data = GetUtf16DataFlat(this, tmpBuf);
+            size_t len = base::utf_helper::Utf16ToUtf8Size(data, strLen, modify) - 1;
             buf.reserve(len);
-            len = base::utf_helper::ConvertRegionUtf16ToUtf8(GetDataUtf16(), buf.data(), strLen, len, 0, modify);
+            len = base::utf_helper::ConvertRegionUtf16ToUtf8(data, buf.data(), strLen, len, 0, modify);
             str = Span<const uint8_t>(buf.data(), len);
         } else {
-            str = Span<const uint8_t>(GetDataUtf8(), strLen);
+            str = Span<const uint8_t>(GetUtf8DataFlat(this, buf), strLen);
         }
         return str;
     }
@@ -264,22 +287,28 @@ private:
     {
         if (IsUtf8()) {
             ASSERT(src->IsUtf8());
+            CVector<uint8_t> buf;
+            const uint8_t *data = GetUtf8DataFlat(src, buf);
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            if (length != 0 && memcpy_s(GetDataUtf8Writable() + start, destSize, src->GetDataUtf8(), length) != EOK) {
+            if (length != 0 && memcpy_s(GetDataUtf8Writable() + start, destSize, data, length) != EOK) {
                 LOG_FULL(FATAL) << "memcpy_s failed";
                 UNREACHABLE();
             }
         } else if (src->IsUtf8()) {
+            CVector<uint8_t> buf;
+            const uint8_t *data = GetUtf8DataFlat(src, buf);
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             Span<uint16_t> to(GetDataUtf16Writable() + start, length);
-            Span<const uint8_t> from(src->GetDataUtf8(), length);
+            Span<const uint8_t> from(data, length);
             for (uint32_t i = 0; i < length; i++) {
                 to[i] = from[i];
             }
         } else {
+            CVector<uint16_t> buf;
+            const uint16_t *data = GetUtf16DataFlat(src, buf);
             // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
             if (length != 0 && memcpy_s(GetDataUtf16Writable() + start,
-                ComputeDataSizeUtf16(destSize), src->GetDataUtf16(), ComputeDataSizeUtf16(length)) != EOK) {
+                ComputeDataSizeUtf16(destSize), data, ComputeDataSizeUtf16(length)) != EOK) {
                 LOG_FULL(FATAL) << "memcpy_s failed";
                 UNREACHABLE();
             }
@@ -317,11 +346,7 @@ private:
         SetMixLength(GetMixLength() & ~STRING_INTERN_BIT);
     }
 
-    size_t ObjectSize() const
-    {
-        uint32_t length = GetLength();
-        return IsUtf16() ? ComputeSizeUtf16(length) : ComputeSizeUtf8(length);
-    }
+    inline size_t ObjectSize() const;
 
     uint32_t PUBLIC_API GetHashcode()
     {
@@ -353,6 +378,7 @@ private:
      * Compares strings by bytes, It doesn't check canonical unicode equivalence.
      */
     static bool StringsAreEqual(EcmaString *str1, EcmaString *str2);
+    static bool StringsAreEqual(const EcmaVM *vm, const JSHandle<EcmaString> &str1, const JSHandle<EcmaString> &str2);
     /**
      * Two strings have the same type of utf encoding format.
      */
@@ -420,6 +446,14 @@ private:
 
     static void CopyUtf16AsUtf8(const uint16_t *utf16From, uint8_t *utf8To, uint32_t utf16Len);
 
+    // Returns the characters of src. A tree string that is not flattened yet is written to buf, so this never
+    // allocates on the heap and can be used where no handle is at hand.
+    static const uint8_t *GetUtf8DataFlat(const EcmaString *src, CVector<uint8_t> &buf);
+    static const uint16_t *GetUtf16DataFlat(const EcmaString *src, CVector<uint16_t> &buf);
+
+    template<typename Char>
+    static void WriteToFlat(EcmaString *src, Char *buf, uint32_t length);
+
     static bool IsASCIICharacter(uint16_t data)
     {
         // \0 is not considered ASCII in Ecma-Modified-UTF8 [only modify '\u0000']
@@ -454,6 +488,43 @@ private:
 
 static_assert((EcmaString::DATA_OFFSET % static_cast<uint8_t>(MemAlignment::MEM_ALIGN_OBJECT)) == 0);
 
+// The result of concatenating two strings, without copying their characters. It is flattened the first time the
+// characters are needed as a whole: a flat copy is stored in First and Second becomes the empty string.
+class TreeEcmaString : public EcmaString {
+public:
+    CAST_CHECK(TreeEcmaString, IsTreeString);
+
+    // Shorter results of a concatenation are copied right away.
+    static constexpr uint32_t MIN_TREE_ECMASTRING_LENGTH = 13;
+
+    static constexpr size_t FIRST_OFFSET = EcmaString::SIZE;
+    ACCESSORS(First, FIRST_OFFSET, SECOND_OFFSET)
+    ACCESSORS(Second, SECOND_OFFSET, SIZE)
+
+    DECL_VISIT_OBJECT(FIRST_OFFSET, SIZE)
+
+    bool IsFlat() const
+    {
+        return EcmaString::Cast(GetSecond().GetTaggedObject())->GetLength() == 0;
+    }
+};
+
+static_assert((TreeEcmaString::SIZE % static_cast<uint8_t>(MemAlignment::MEM_ALIGN_OBJECT)) == 0);
+
+inline bool EcmaString::IsFlat() const
+{
+    return !IsTreeString() || TreeEcmaString::ConstCast(this)->IsFlat();
+}
+
+inline size_t EcmaString::ObjectSize() const
+{
+    if (IsTreeString()) {
+        return TreeEcmaString::SIZE;
+    }
+    uint32_t length = GetLength();
+    return IsUtf16() ? ComputeSizeUtf16(length) : ComputeSizeUtf8(length);
+}
+
 // if you want to use functions of EcmaString, please not use directly,
 // and use functions of EcmaStringAccessor alternatively.
 // eg: EcmaString *str = ***; str->GetLength() ----->  EcmaStringAccessor(str).GetLength()
@@ -501,6 +572,12 @@ public:
         return EcmaString::FastSubString(vm, src, start, length);
     }
 
+    // Returns a flat string with the content of string, copying the characters of a tree string once.
+    static EcmaString *Flatten(const EcmaVM *vm, const JSHandle<EcmaString> &string)
+    {
+        return EcmaString::Flatten(vm, string);
+    }
+
     bool IsUtf8() const
     {
         return string_->IsUtf8();
@@ -511,6 +588,16 @@ public:
         return string_->IsUtf16();
     }
 
+    bool IsTreeString() const
+    {
+        return string_->IsTreeString();
+    }
+
+    bool IsFlat() const
+    {
+        return string_->IsFlat();
+    }
+
     uint32_t GetLength() const
     {
         return string_->GetLength();
@@ -541,6 +628,7 @@ public:
         string_->ClearInternStringFlag();
     }
 
+    // Only for strings that are not tree strings, see Flatten.
     const uint8_t *GetDataUtf8()
     {
         return string_->GetDataUtf8();
@@ -631,11 +719,23 @@ public:
         return EcmaString::Compare(lhs, rhs);
     }
 
+    // Flattens tree strings first, so that they are not copied again by every later comparison.
+    static int32_t Compare(const EcmaVM *vm, const JSHandle<EcmaString> &left, const JSHandle<EcmaString> &right)
+    {
+        return EcmaString::Compare(vm, left, right);
+    }
+
     static bool StringsAreEqual(EcmaString *str1, EcmaString *str2)
     {
         return EcmaString::StringsAreEqual(str1, str2);
     }
 
+    // Flattens tree strings first, so that they are not copied again by every later comparison.
+    static bool StringsAreEqual(const EcmaVM *vm, const JSHandle<EcmaString> &str1, const JSHandle<EcmaString> &str2)
+    {
+        return EcmaString::StringsAreEqual(vm, str1, str2);
+    }
+
     static bool StringsAreEqualSameUtfEncoding(EcmaString *str1, EcmaString *str2)
     {
         return EcmaString::StringsAreEqualSameUtfEncoding(str1, str2);
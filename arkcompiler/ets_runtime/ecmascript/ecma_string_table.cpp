@@ -22,64 +22,69 @@
 #include "ecmascript/object_factory.h"
 
 namespace panda::ecmascript {
-EcmaStringTable::EcmaStringTable(const EcmaVM *vm) : vm_(vm) {}
+EcmaStringTable::EcmaStringTable(const EcmaVM *vm) : slots_(INITIAL_CAPACITY), vm_(vm) {}
+
+template<typename Matcher>
+EcmaString *EcmaStringTable::FindInSlots(const CVector<Entry> &slots, uint32_t hashcode, const Matcher &matcher)
+{
+    if (slots.empty()) {
+        return nullptr;
+    }
+    // the load factor keeps empty slots around, so every probe sequence terminates
+    size_t mask = slots.size() - 1;
+    for (size_t index = SlotIndex(hashcode, mask);; index = (index + 1) & mask) {
+        const Entry &entry = slots[index];
+        if (entry.IsEmpty()) {
+            return nullptr;
+        }
+        if (entry.hashcode == hashcode && !entry.IsTombstone() && matcher(entry.string)) {
+            return entry.string;
+        }
+    }
+}
+
+template<typename Matcher>
+EcmaString *EcmaStringTable::Find(uint32_t hashcode, const Matcher &matcher) const
+{
+    EcmaString *result = FindInSlots(slots_, hashcode, matcher);
+    if (result == nullptr && !oldSlots_.empty()) {
+        result = FindInSlots(oldSlots_, hashcode, matcher);
+    }
+    return result;
+}
 
 EcmaString *EcmaStringTable::GetString(const JSHandle<EcmaString> &firstString,
                                        const JSHandle<EcmaString> &secondString) const
 {
     uint32_t hashCode = EcmaStringAccessor(firstString).GetHashcode();
     hashCode = EcmaStringAccessor(secondString).ComputeHashcode(hashCode);
-    auto range = table_.equal_range(hashCode);
-    auto item = range.first;
-    for (; item != range.second; ++item) {
-        auto foundString = item->second;
-        if (EcmaStringAccessor(foundString).EqualToSplicedString(*firstString, *secondString)) {
-            return foundString;
-        }
-    }
-    return nullptr;
+    return Find(hashCode, [&firstString, &secondString](EcmaString *foundString) {
+        return EcmaStringAccessor(foundString).EqualToSplicedString(*firstString, *secondString);
+    });
 }
 
 EcmaString *EcmaStringTable::GetString(const uint8_t *utf8Data, uint32_t utf8Len, bool canBeCompress) const
 {
     uint32_t hashCode = EcmaStringAccessor::ComputeHashcodeUtf8(utf8Data, utf8Len, canBeCompress);
-    auto range = table_.equal_range(hashCode);
-    auto item = range.first;
-    for (; item != range.second; ++item) {
-        auto foundString = item->second;
-        if (EcmaStringAccessor::StringsAreEqualUtf8(foundString, utf8Data, utf8Len, canBeCompress)) {
-            return foundString;
-        }
-    }
-    return nullptr;
+    return Find(hashCode, [utf8Data, utf8Len, canBeCompress](EcmaString *foundString) {
+        return EcmaStringAccessor::StringsAreEqualUtf8(foundString, utf8Data, utf8Len, canBeCompress);
+    });
 }
 
 EcmaString *EcmaStringTable::GetString(const uint16_t *utf16Data, uint32_t utf16Len) const
 {
     uint32_t hashCode = EcmaStringAccessor::ComputeHashcodeUtf16(const_cast<uint16_t *>(utf16Data), utf16Len);
-    auto range = table_.equal_range(hashCode);
-    auto item = range.first;
-    for (; item != range.second; ++item) {
-        auto foundString = item->second;
-        if (EcmaStringAccessor::StringsAreEqualUtf16(foundString, utf16Data, utf16Len)) {
-            return foundString;
-        }
-    }
-    return nullptr;
+    return Find(hashCode, [utf16Data, utf16Len](EcmaString *foundString) {
+        return EcmaStringAccessor::StringsAreEqualUtf16(foundString, utf16Data, utf16Len);
+    });
 }
 
 EcmaString *EcmaStringTable::GetString(EcmaString *string) const
 {
     auto hashcode = EcmaStringAccessor(string).GetHashcode();
-    auto range = table_.equal_range(hashcode);
-    auto item = range.first;
-    for (; item != range.second; ++item) {
-        auto foundString = item->second;
-        if (EcmaStringAccessor::StringsAreEqual(foundString, string)) {
-            return foundString;
-        }
-    }
-    return nullptr;
+    return Find(hashcode, [string](EcmaString *foundString) {
+        return EcmaStringAccessor::StringsAreEqual(foundString, string);
+    });
 }
 
 void EcmaStringTable::InternString(EcmaString *string)
@@ -87,10 +92,85 @@ void EcmaStringTable::InternString(EcmaString *string)
     if (EcmaStringAccessor(string).IsInternString()) {
         return;
     }
-    table_.emplace(EcmaStringAccessor(string).GetHashcode(), string);
+    MigrateOldSlots(MIGRATE_STEP);
+    if ((slotsUsed_ + 1) * MAX_LOAD_DENOMINATOR > slots_.size() * MAX_LOAD_NUMERATOR) {
+        // grow when at least half of the slots hold live strings, otherwise only the tombstones are dropped
+        size_t capacity = slots_.size();
+        if ((slotsLive_ + oldSlotsLive_) * 2 >= capacity) {  // 2: half of the slots
+            capacity *= 2;  // 2: double the capacity
+        }
+        Resize(capacity, true);
+    }
+    PutEntry(EcmaStringAccessor(string).GetHashcode(), string);
     EcmaStringAccessor(string).SetInternString();
 }
 
+void EcmaStringTable::PutEntry(uint32_t hashcode, EcmaString *string)
+{
+    size_t mask = slots_.size() - 1;
+    size_t index = SlotIndex(hashcode, mask);
+    while (slots_[index].IsLive()) {
+        index = (index + 1) & mask;
+    }
+    if (slots_[index].IsEmpty()) {
+        slotsUsed_++;
+    }
+    slots_[index].hashcode = hashcode;
+    slots_[index].string = string;
+    slotsLive_++;
+}
+
+void EcmaStringTable::Resize(size_t capacity, bool incremental)
+{
+    ASSERT((capacity & (capacity - 1)) == 0);
+    // a resize never starts while the previous one is still moving slots
+    MigrateOldSlots(oldSlots_.size());
+    oldSlots_.swap(slots_);
+    slots_ = CVector<Entry>(capacity);
+    migrateIndex_ = 0;
+    oldSlotsLive_ = slotsLive_;
+    slotsUsed_ = 0;
+    slotsLive_ = 0;
+    if (!incremental) {
+        MigrateOldSlots(oldSlots_.size());
+    }
+}
+
+void EcmaStringTable::MigrateOldSlots(size_t count)
+{
+    if (oldSlots_.empty()) {
+        return;
+    }
+    size_t end = std::min(oldSlots_.size(), migrateIndex_ + count);
+    for (; migrateIndex_ < end; ++migrateIndex_) {
+        Entry &entry = oldSlots_[migrateIndex_];
+        if (entry.IsLive()) {
+            PutEntry(entry.hashcode, entry.string);
+            // keep the slot occupied so that the probe sequences of the rest of the old table are intact
+            entry.string = reinterpret_cast<EcmaString *>(TOMBSTONE);
+            oldSlotsLive_--;
+        }
+    }
+    if (migrateIndex_ == oldSlots_.size()) {
+        CVector<Entry>().swap(oldSlots_);
+        migrateIndex_ = 0;
+    }
+}
+
+void EcmaStringTable::Reserve(size_t count)
+{
+    size_t required = slots_.size();
+    while ((slotsLive_ + oldSlotsLive_ + count) * MAX_LOAD_DENOMINATOR > required * MAX_LOAD_NUMERATOR) {
+        required *= 2;  // 2: double the capacity
+    }
+    bool tooManyTombstones = (slotsUsed_ + oldSlotsLive_ + count) * MAX_LOAD_DENOMINATOR >
+        slots_.size() * MAX_LOAD_NUMERATOR;
+    if (required != slots_.size() || tooManyTombstones) {
+        // the strings are about to be interned anyway, so there is nothing to gain from moving the slots lazily
+        Resize(required, false);
+    }
+}
+
 void EcmaStringTable::InternEmptyString(EcmaString *emptyStr)
 {
     InternString(emptyStr);
@@ -104,6 +184,9 @@ EcmaString *EcmaStringTable::GetOrInternString(const JSHandle<EcmaString> &first
         return concatString;
     }
     concatString = EcmaStringAccessor::Concat(vm_, firstString, secondString);
+    // the table only keeps flat strings
+    JSHandle<EcmaString> concatHandle(vm_->GetJSThread(), concatString);
+    concatString = EcmaStringAccessor::Flatten(vm_, concatHandle);
 
     InternString(concatString);
     return concatString;
@@ -149,6 +232,14 @@ EcmaString *EcmaStringTable::GetOrInternString(EcmaString *string)
     if (EcmaStringAccessor(string).IsInternString()) {
         return string;
     }
+    if (EcmaStringAccessor(string).IsTreeString()) {
+        // the table only keeps flat strings, the flat content of the tree is interned instead
+        JSHandle<EcmaString> strHandle(vm_->GetJSThread(), string);
+        string = EcmaStringAccessor::Flatten(vm_, strHandle);
+        if (EcmaStringAccessor(string).IsInternString()) {
+            return string;
+        }
+    }
 
     EcmaString *result = GetString(string);
     if (result != nullptr) {
@@ -186,34 +277,39 @@ EcmaString *EcmaStringTable::GetOrInternStringWithSpaceType(const uint16_t *utf1
 
 void EcmaStringTable::SweepWeakReference(const WeakRootVisitor &visitor)
 {
-    for (auto it = table_.begin(); it != table_.end();) {
-        auto *object = it->second;
+    // sweeping runs in the GC pause, finishing a pending resize first keeps a single table to visit
+    MigrateOldSlots(oldSlots_.size());
+    for (auto &entry : slots_) {
+        if (!entry.IsLive()) {
+            continue;
+        }
+        auto *object = entry.string;
         auto fwd = visitor(object);
         if (fwd == nullptr) {
             LOG_ECMA(VERBOSE) << "StringTable: delete string " << std::hex << object
                            << ", val = " << ConvertToString(object);
-            table_.erase(it++);
+            entry.string = reinterpret_cast<EcmaString *>(TOMBSTONE);
+            slotsLive_--;
         } else if (fwd != object) {
-            it->second = static_cast<EcmaString *>(fwd);
-            ++it;
+            entry.string = static_cast<EcmaString *>(fwd);
             LOG_ECMA(VERBOSE) << "StringTable: forward " << std::hex << object << " -> " << fwd;
-        } else {
-            ++it;
         }
     }
 }
 
 bool EcmaStringTable::CheckStringTableValidity()
 {
-    for (auto itemOuter = table_.begin(); itemOuter != table_.end(); ++itemOuter) {
-        auto outerString = itemOuter->second;
+    MigrateOldSlots(oldSlots_.size());
+    size_t mask = slots_.size() - 1;
+    for (const auto &outer : slots_) {
+        if (!outer.IsLive()) {
+            continue;
+        }
         int counter = 0;
-        auto hashcode = EcmaStringAccessor(outerString).GetHashcode();
-        auto range = table_.equal_range(hashcode);
-        auto it = range.first;
-        for (; it != range.second; ++it) {
-            auto foundString = it->second;
-            if (EcmaStringAccessor::StringsAreEqual(foundString, outerString)) {
+        for (size_t index = SlotIndex(outer.hashcode, mask); !slots_[index].IsEmpty(); index = (index + 1) & mask) {
+            const Entry &entry = slots_[index];
+            if (entry.IsLive() && entry.hashcode == outer.hashcode &&
+                EcmaStringAccessor::StringsAreEqual(entry.string, outer.string)) {
                 ++counter;
             }
         }
@@ -24,12 +24,17 @@ namespace panda::ecmascript {
 class EcmaString;
 class EcmaVM;
 
+// Open-addressed hash set of the interned strings, probed linearly. Each slot caches the hashcode next to the string
+// so that probing does not touch the strings themselves. Removed strings leave a tombstone behind to keep probe chains
+// intact. When the table has to grow the slots are moved to the new table a few at a time on each insertion, so no
+// single intern pays for the whole rehash. The table is used by the owning JS thread and by the GC in its pause only.
 class EcmaStringTable {
 public:
     explicit EcmaStringTable(const EcmaVM *vm);
     virtual ~EcmaStringTable()
     {
-        table_.clear();
+        slots_.clear();
+        oldSlots_.clear();
     }
 
     void InternEmptyString(EcmaString *emptyStr);
@@ -42,19 +47,73 @@ public:
                                                MemSpaceType type);
     EcmaString *GetOrInternStringWithSpaceType(const uint16_t *utf16Data, uint32_t utf16Len, bool canBeCompress,
                                                MemSpaceType type);
+    // Makes room for count more strings at once, used before interning many strings in a row, e.g. a constant pool.
+    void Reserve(size_t count);
 
     void SweepWeakReference(const WeakRootVisitor &visitor);
     bool CheckStringTableValidity();
+
+    size_t GetStringCount() const
+    {
+        return slotsLive_ + oldSlotsLive_;
+    }
+
+    size_t GetCapacity() const
+    {
+        return slots_.size();
+    }
+
 private:
     NO_COPY_SEMANTIC(EcmaStringTable);
     NO_MOVE_SEMANTIC(EcmaStringTable);
 
+    struct Entry {
+        uint32_t hashcode {0};
+        EcmaString *string {nullptr};
+
+        bool IsEmpty() const
+        {
+            return string == nullptr;
+        }
+
+        bool IsTombstone() const
+        {
+            return reinterpret_cast<uintptr_t>(string) == TOMBSTONE;
+        }
+
+        bool IsLive() const
+        {
+            return !IsEmpty() && !IsTombstone();
+        }
+    };
+
+    static constexpr uintptr_t TOMBSTONE = 1;
+    static constexpr size_t INITIAL_CAPACITY = 1024;  // must be a power of 2
+    // The table is resized once live strings and tombstones fill 3/4 of the slots.
+    static constexpr size_t MAX_LOAD_NUMERATOR = 3;
+    static constexpr size_t MAX_LOAD_DENOMINATOR = 4;
+    // Number of old slots moved to the resized table on each insertion.
+    static constexpr size_t MIGRATE_STEP = 64;
+
+    static size_t SlotIndex(uint32_t hashcode, size_t mask)
+    {
+        return (hashcode ^ (hashcode >> 16U)) & mask;  // 16: mix the high bits into the index
+    }
+
+    template<typename Matcher>
+    static EcmaString *FindInSlots(const CVector<Entry> &slots, uint32_t hashcode, const Matcher &matcher);
+    template<typename Matcher>
+    EcmaString *Find(uint32_t hashcode, const Matcher &matcher) const;
+
     EcmaString *GetString(const JSHandle<EcmaString> &firstString, const JSHandle<EcmaString> &secondString) const;
     EcmaString *GetString(const uint8_t *utf8Data, uint32_t utf8Len, bool canBeCompress) const;
     EcmaString *GetString(const uint16_t *utf16Data, uint32_t utf16Len) const;
     EcmaString *GetString(EcmaString *string) const;
 
     void InternString(EcmaString *string);
+    void PutEntry(uint32_t hashcode, EcmaString *string);
+    void Resize(size_t capacity, bool incremental);
+    void MigrateOldSlots(size_t count);
 
     void InsertStringIfNotExist(EcmaString *string)
     {
@@ -64,7 +123,13 @@ private:
         }
     }
 
-    CUnorderedMultiMap<uint32_t, EcmaString *> table_;
+    CVector<Entry> slots_ {};
+    // Slots of the table being resized, empty unless a resize is in progress.
+    CVector<Entry> oldSlots_ {};
+    size_t migrateIndex_ {0};
+    size_t slotsUsed_ {0};
+    size_t slotsLive_ {0};
+    size_t oldSlotsLive_ {0};
     const EcmaVM *vm_{nullptr};
     friend class SnapshotProcessor;
 };
@@ -48,6 +48,7 @@
 #include "ecmascript/global_env.h"
 #include "ecmascript/global_env_constants-inl.h"
 #include "ecmascript/global_env_constants.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
 #include "ecmascript/jobs/micro_job_queue.h"
 #include "ecmascript/jspandafile/constpool_value.h"
@@ -293,11 +294,22 @@ void EcmaVM::SetRuntimeStatEnable(bool flag)
         if (runtimeStat_->IsRuntimeStatEnabled()) {
             runtimeStat_->Print();
             runtimeStat_->ResetAllCount();
+            PrintMegaICStat();
         }
     }
     runtimeStat_->SetRuntimeStatEnabled(flag);
 }
 
+void EcmaVM::PrintMegaICStat() const
+{
+    MegaICCache *loadCache = thread_->GetLoadMegaICCache();
+    MegaICCache *storeCache = thread_->GetStoreMegaICCache();
+    LOG_ECMA(INFO) << "MegaIC load hit:" << loadCache->GetHitCount() << ", miss:" << loadCache->GetMissCount()
+                   << "; store hit:" << storeCache->GetHitCount() << ", miss:" << storeCache->GetMissCount();
+    loadCache->ResetCount();
+    storeCache->ResetCount();
+}
+
 EcmaVM::~EcmaVM()
 {
     initialized_ = false;
@@ -740,9 +752,6 @@ void EcmaVM::ProcessNativeDelete(const WeakRootVisitor &visitor)
 }
 void EcmaVM::ProcessReferences(const WeakRootVisitor &visitor)
 {
-    if (regExpParserCache_ != nullptr) {
-        regExpParserCache_->Clear();
-    }
     heap_->ResetNativeBindingSize();
     // array buffer
     auto iter = nativePointerList_.begin();
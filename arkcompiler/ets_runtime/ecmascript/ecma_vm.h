@@ -592,6 +592,8 @@ private:
 
     void InitializeEcmaScriptRunStat();
 
+    void PrintMegaICStat() const;
+
     void ClearBufferData();
 
     void LoadAOTFiles(const std::string& aotFileName);
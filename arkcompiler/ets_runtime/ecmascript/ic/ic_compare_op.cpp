@@ -93,8 +93,9 @@ JSTaggedValue CompareOp::EqualWithIC(JSThread* thread, JSTaggedValue left,
             break;
         }
         case CompareOpType::STRING_STRING: {
-            bool result = EcmaStringAccessor::StringsAreEqual(static_cast<EcmaString *>(left.GetTaggedObject()),
-                static_cast<EcmaString *>(right.GetTaggedObject()));
+            JSHandle<EcmaString> leftString(thread, left);
+            JSHandle<EcmaString> rightString(thread, right);
+            bool result = EcmaStringAccessor::StringsAreEqual(thread->GetEcmaVM(), leftString, rightString);
             ret = result ? JSTaggedValue::True() : JSTaggedValue::False();
             break;
         }
@@ -269,9 +270,9 @@ ComparisonResult CompareOp::Compare(JSThread *thread, JSTaggedValue left,
             break;
         }
         case CompareOpType::STRING_STRING: {
-            auto xString = static_cast<EcmaString *>(left.GetTaggedObject());
-            auto yString = static_cast<EcmaString *>(right.GetTaggedObject());
-            int result = EcmaStringAccessor::Compare(xString, yString);
+            JSHandle<EcmaString> xString(thread, left);
+            JSHandle<EcmaString> yString(thread, right);
+            int result = EcmaStringAccessor::Compare(thread->GetEcmaVM(), xString, yString);
             if (result < 0) {
                 ret =  ComparisonResult::LESS;
             } else if (result == 0) {
@@ -18,6 +18,7 @@
 #include "ecmascript/global_dictionary-inl.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/ic/ic_handler.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/ic/profile_type_info.h"
 #include "ecmascript/interpreter/slow_runtime_stub.h"
 #include "ecmascript/js_function.h"
@@ -34,9 +35,11 @@ namespace panda::ecmascript {
 void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedValue> key,
                                   JSHandle<JSTaggedValue> receiver)
 {
-    if (icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA) {
+    bool isMega = icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA;
+    if (isMega && !CanUseMegaICCache(op, key)) {
         return;
     }
+    JSHandle<JSTaggedValue> propKey = key;
     if (IsNamedIC(GetICKind())) {
         key = JSHandle<JSTaggedValue>();
     }
@@ -66,7 +69,9 @@ void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedVal
         }
     }
 
-    if (key.IsEmpty()) {
+    if (isMega) {
+        thread_->GetLoadMegaICCache()->Set(*hclass, propKey.GetTaggedValue(), handlerValue.GetTaggedValue());
+    } else if (key.IsEmpty()) {
         icAccessor_.AddHandlerWithoutKey(JSHandle<JSTaggedValue>::Cast(hclass), handlerValue);
     } else if (op.IsElement()) {
         // do not support global element ic
@@ -82,9 +87,11 @@ void ICRuntime::UpdateLoadHandler(const ObjectOperator &op, JSHandle<JSTaggedVal
 void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedValue> key,
                                    JSHandle<JSTaggedValue> receiver)
 {
-    if (icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA) {
+    bool isMega = icAccessor_.GetICState() == ProfileTypeAccessor::ICState::MEGA;
+    if (isMega && !CanUseMegaICCache(op, key)) {
         return;
     }
+    JSHandle<JSTaggedValue> propKey = key;
     if (IsNamedIC(GetICKind())) {
         key = JSHandle<JSTaggedValue>();
     }
@@ -113,7 +120,10 @@ void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedVa
         handlerValue = StoreHandler::StoreProperty(thread_, op);
     }
 
-    if (key.IsEmpty()) {
+    if (isMega) {
+        thread_->GetStoreMegaICCache()->Set(JSHClass::Cast(receiverHClass_->GetTaggedObject()),
+                                            propKey.GetTaggedValue(), handlerValue.GetTaggedValue());
+    } else if (key.IsEmpty()) {
         icAccessor_.AddHandlerWithoutKey(receiverHClass_, handlerValue);
     } else if (op.IsElement()) {
         // do not support global element ic
@@ -126,6 +136,16 @@ void ICRuntime::UpdateStoreHandler(const ObjectOperator &op, JSHandle<JSTaggedVa
     }
 }
 
+bool ICRuntime::CanUseMegaICCache(const ObjectOperator &op, JSHandle<JSTaggedValue> key) const
+{
+    // the megamorphic cache is keyed on (hclass, key), element and global ics are not cached there
+    ICKind kind = GetICKind();
+    if (op.IsElement() || IsGlobalLoadIC(kind) || IsGlobalStoreIC(kind)) {
+        return false;
+    }
+    return key->IsStringOrSymbol();
+}
+
 void ICRuntime::TraceIC([[maybe_unused]] JSHandle<JSTaggedValue> receiver,
                         [[maybe_unused]] JSHandle<JSTaggedValue> key) const
 {
@@ -57,6 +57,8 @@ public:
     void TraceIC(JSHandle<JSTaggedValue> receiver, JSHandle<JSTaggedValue> key) const;
 
 protected:
+    bool CanUseMegaICCache(const ObjectOperator &op, JSHandle<JSTaggedValue> key) const;
+
     JSThread *thread_;
     JSHandle<JSTaggedValue> receiverHClass_{};
     ProfileTypeAccessor icAccessor_;
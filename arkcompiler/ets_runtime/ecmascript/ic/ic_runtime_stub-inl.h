@@ -22,6 +22,7 @@
 #include "ecmascript/ic/ic_runtime_stub.h"
 #include "ecmascript/ic/ic_handler.h"
 #include "ecmascript/ic/ic_runtime.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/interpreter/fast_runtime_stub-inl.h"
 #include "ecmascript/ic/proto_change_details.h"
 #include "ecmascript/js_tagged_value-inl.h"
@@ -106,6 +107,52 @@ ARK_NOINLINE JSTaggedValue ICRuntimeStub::LoadICByName(JSThread *thread, Profile
     return LoadMiss(thread, profileTypeInfo, receiver, key, slotId, ICKind::NamedLoadIC);
 }
 
+// Used once the ic of the site went megamorphic. On a miss of the shared cache the handler is computed by the ic
+// runtime and put into the cache, unless the receiver could not be cached anyway, then hole is returned and the
+// caller takes the generic path.
+ARK_INLINE JSTaggedValue ICRuntimeStub::LoadMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                         JSTaggedValue receiver, JSTaggedValue key, uint32_t slotId)
+{
+    INTERPRETER_TRACE(thread, LoadMegaICByName);
+    if (!receiver.IsHeapObject()) {
+        return JSTaggedValue::Hole();
+    }
+    auto hclass = receiver.GetTaggedObject()->GetClass();
+    JSTaggedValue handler = thread->GetLoadMegaICCache()->Get(hclass, key);
+    if (!handler.IsHole()) {
+        JSTaggedValue result = LoadICWithHandler(thread, receiver, receiver, handler);
+        if (!result.IsHole()) {
+            return result;
+        }
+    }
+    if (!receiver.IsJSObject() || receiver.HasOrdinaryGet() || hclass->IsDictionaryMode()) {
+        return JSTaggedValue::Hole();
+    }
+    return LoadMiss(thread, profileTypeInfo, receiver, key, slotId, ICKind::NamedLoadIC);
+}
+
+ARK_INLINE JSTaggedValue ICRuntimeStub::StoreMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                          JSTaggedValue receiver, JSTaggedValue key,
+                                                          JSTaggedValue value, uint32_t slotId)
+{
+    INTERPRETER_TRACE(thread, StoreMegaICByName);
+    if (!receiver.IsHeapObject()) {
+        return JSTaggedValue::Hole();
+    }
+    auto hclass = receiver.GetTaggedObject()->GetClass();
+    JSTaggedValue handler = thread->GetStoreMegaICCache()->Get(hclass, key);
+    if (!handler.IsHole()) {
+        JSTaggedValue result = StoreICWithHandler(thread, receiver, receiver, value, handler);
+        if (!result.IsHole()) {
+            return result;
+        }
+    }
+    if (!receiver.IsJSObject() || receiver.HasOrdinaryGet() || hclass->IsDictionaryMode()) {
+        return JSTaggedValue::Hole();
+    }
+    return StoreMiss(thread, profileTypeInfo, receiver, key, value, slotId, ICKind::NamedStoreIC);
+}
+
 ARK_INLINE JSTaggedValue ICRuntimeStub::TryLoadICByValue(JSThread *thread, JSTaggedValue receiver, JSTaggedValue key,
                                                          JSTaggedValue firstValue, JSTaggedValue secondValue)
 {
@@ -39,6 +39,11 @@ public:
     static inline JSTaggedValue StoreICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
                                               JSTaggedValue receiver, JSTaggedValue key,
                                               JSTaggedValue value, uint32_t slotId);
+    static inline JSTaggedValue LoadMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                 JSTaggedValue receiver, JSTaggedValue key, uint32_t slotId);
+    static inline JSTaggedValue StoreMegaICByName(JSThread *thread, ProfileTypeInfo *profileTypeInfo,
+                                                  JSTaggedValue receiver, JSTaggedValue key,
+                                                  JSTaggedValue value, uint32_t slotId);
     static inline JSTaggedValue CheckPolyHClass(JSTaggedValue cachedValue, JSHClass* hclass);
     static inline JSTaggedValue LoadICWithHandler(JSThread *thread, JSTaggedValue receiver, JSTaggedValue holder,
                                                   JSTaggedValue handler);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_IC_MEGA_IC_CACHE_H
+#define ECMASCRIPT_IC_MEGA_IC_CACHE_H
+
+#include <array>
+
+#include "ecmascript/js_hclass.h"
+#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/ecma_macros.h"
+
+namespace panda::ecmascript {
+// Stub cache shared by all the property ICs of a thread which went megamorphic. It maps (hclass, key) to the same
+// handlers the per-site ICs use. A primary table is probed first, entries evicted from it move to a smaller
+// secondary table, so two hot (hclass, key) pairs with the same primary index do not keep replacing each other.
+// Like PropertiesCache, the entries are not visited by the GC, the cache is cleared whenever the roots are iterated.
+class MegaICCache {
+public:
+    inline JSTaggedValue Get(JSHClass *jsHclass, JSTaggedValue key)
+    {
+        uint32_t primaryIndex = PrimaryHash(jsHclass, key);
+        Entry &primary = primary_[primaryIndex];
+        if ((primary.hclass_ == jsHclass) && (primary.key_ == key)) {
+            hitCount_++;
+            return primary.handler_;
+        }
+        Entry &secondary = secondary_[SecondaryHash(jsHclass, key)];
+        if ((secondary.hclass_ == jsHclass) && (secondary.key_ == key)) {
+            hitCount_++;
+            return secondary.handler_;
+        }
+        missCount_++;
+        return JSTaggedValue::Hole();
+    }
+
+    inline void Set(JSHClass *jsHclass, JSTaggedValue key, JSTaggedValue handler)
+    {
+        Entry &primary = primary_[PrimaryHash(jsHclass, key)];
+        if (primary.hclass_ != nullptr && (primary.hclass_ != jsHclass || primary.key_ != key)) {
+            secondary_[SecondaryHash(primary.hclass_, primary.key_)] = primary;
+        }
+        primary.hclass_ = jsHclass;
+        primary.key_ = key;
+        primary.handler_ = handler;
+    }
+
+    inline void Clear()
+    {
+        for (auto &entry : primary_) {
+            entry.hclass_ = nullptr;
+        }
+        for (auto &entry : secondary_) {
+            entry.hclass_ = nullptr;
+        }
+    }
+
+    uint64_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    uint64_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+    void ResetCount()
+    {
+        hitCount_ = 0;
+        missCount_ = 0;
+    }
+
+private:
+    MegaICCache() = default;
+    ~MegaICCache() = default;
+
+    struct Entry {
+        JSHClass *hclass_ {nullptr};
+        JSTaggedValue key_ {JSTaggedValue::Hole()};
+        JSTaggedValue handler_ {JSTaggedValue::Hole()};
+    };
+
+    static inline uint32_t ClassHash(JSHClass *cls)
+    {
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(cls)) >> 3U;  // skip 8bytes
+    }
+
+    static inline uint32_t PrimaryHash(JSHClass *cls, JSTaggedValue key)
+    {
+        return (ClassHash(cls) ^ key.GetKeyHashCode()) & PRIMARY_LENGTH_MASK;
+    }
+
+    static inline uint32_t SecondaryHash(JSHClass *cls, JSTaggedValue key)
+    {
+        // a different mix than the primary hash, entries colliding there are spread here
+        uint32_t hash = ClassHash(cls) + key.GetKeyHashCode() * SECONDARY_HASH_MULTIPLIER;
+        return (hash >> SECONDARY_HASH_SHIFT) & SECONDARY_LENGTH_MASK;
+    }
+
+    static const uint32_t PRIMARY_LENGTH_BIT = 10;
+    static const uint32_t PRIMARY_LENGTH = (1U << PRIMARY_LENGTH_BIT);
+    static const uint32_t PRIMARY_LENGTH_MASK = PRIMARY_LENGTH - 1;
+    static const uint32_t SECONDARY_LENGTH_BIT = 8;
+    static const uint32_t SECONDARY_LENGTH = (1U << SECONDARY_LENGTH_BIT);
+    static const uint32_t SECONDARY_LENGTH_MASK = SECONDARY_LENGTH - 1;
+    static const uint32_t SECONDARY_HASH_MULTIPLIER = 0x9E3779B1U;  // golden ratio
+    static const uint32_t SECONDARY_HASH_SHIFT = 4;
+
+    std::array<Entry, PRIMARY_LENGTH> primary_ {};
+    std::array<Entry, SECONDARY_LENGTH> secondary_ {};
+    uint64_t hitCount_ {0};
+    uint64_t missCount_ {0};
+
+    friend class JSThread;
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_IC_MEGA_IC_CACHE_H
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <unordered_map>
+
+#include "ecmascript/ecma_string-inl.h"
+#include "ecmascript/ic/ic_runtime.h"
+#include "ecmascript/ic/mega_ic_cache.h"
+#include "ecmascript/global_env.h"
+#include "ecmascript/js_object.h"
+#include "ecmascript/object_factory.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class MegaICCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        TestHelper::CreateEcmaVMWithScope(instance, thread, scope);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    EcmaVM *instance {nullptr};
+    EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+};
+
+/**
+ * @tc.name: SetAndGet
+ * @tc.desc: A handler set for (hclass, key) is found again, other pairs miss and Clear drops everything.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(MegaICCacheTest, SetAndGet)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> objFun = env->GetObjectFunction();
+    JSHandle<JSObject> obj = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    JSHandle<JSTaggedValue> key1(factory->NewFromASCII("key1"));
+    JSHandle<JSTaggedValue> key2(factory->NewFromASCII("key2"));
+    JSHClass *hclass = obj->GetJSHClass();
+
+    MegaICCache *cache = thread->GetLoadMegaICCache();
+    cache->Clear();
+    cache->ResetCount();
+    cache->Set(hclass, key1.GetTaggedValue(), JSTaggedValue(1));
+    EXPECT_EQ(cache->Get(hclass, key1.GetTaggedValue()), JSTaggedValue(1));
+    EXPECT_TRUE(cache->Get(hclass, key2.GetTaggedValue()).IsHole());
+    EXPECT_EQ(cache->GetHitCount(), 1U);
+    EXPECT_EQ(cache->GetMissCount(), 1U);
+
+    cache->Clear();
+    EXPECT_TRUE(cache->Get(hclass, key1.GetTaggedValue()).IsHole());
+    cache->ResetCount();
+    EXPECT_EQ(cache->GetHitCount(), 0U);
+    EXPECT_EQ(cache->GetMissCount(), 0U);
+}
+
+/**
+ * @tc.name: KeepEvictedEntry
+ * @tc.desc: Two keys on one hclass collide in the primary table, the evicted one is still found.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(MegaICCacheTest, KeepEvictedEntry)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> objFun = env->GetObjectFunction();
+    JSHandle<JSObject> obj = factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun);
+    JSHClass *hclass = obj->GetJSHClass();
+
+    // with a fixed hclass the primary index only depends on the low bits of the key hash
+    constexpr uint32_t primaryMask = 1023;
+    JSMutableHandle<JSTaggedValue> first(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> second(thread, JSTaggedValue::Undefined());
+    std::unordered_map<uint32_t, uint32_t> seen;
+    for (uint32_t i = 0; second->IsUndefined(); i++) {
+        JSHandle<EcmaString> str = factory->NewFromStdString("key" + std::to_string(i));
+        uint32_t index = EcmaStringAccessor(str).GetHashcode() & primaryMask;
+        auto iter = seen.find(index);
+        if (iter == seen.end()) {
+            seen.emplace(index, i);
+            continue;
+        }
+        first.Update(factory->NewFromStdString("key" + std::to_string(iter->second)).GetTaggedValue());
+        second.Update(str.GetTaggedValue());
+    }
+
+    MegaICCache *cache = thread->GetLoadMegaICCache();
+    cache->Clear();
+    cache->Set(hclass, first.GetTaggedValue(), JSTaggedValue(10)); // 10: handler of the first key
+    cache->Set(hclass, second.GetTaggedValue(), JSTaggedValue(20)); // 20: handler of the second key
+    EXPECT_EQ(cache->Get(hclass, second.GetTaggedValue()), JSTaggedValue(20)); // 20: handler of the second key
+    EXPECT_EQ(cache->Get(hclass, first.GetTaggedValue()), JSTaggedValue(10)); // 10: handler of the first key
+    cache->Clear();
+}
+
+/**
+ * @tc.name: FillFromMegamorphicIC
+ * @tc.desc: Updating a named load IC which is already megamorphic records the handler in the thread cache.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(MegaICCacheTest, FillFromMegamorphicIC)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSHandle<GlobalEnv> env = thread->GetEcmaVM()->GetGlobalEnv();
+    JSHandle<JSTaggedValue> objFun = env->GetObjectFunction();
+    JSHandle<JSTaggedValue> receiver(factory->NewJSObjectByConstructor(JSHandle<JSFunction>(objFun), objFun));
+    JSHandle<JSTaggedValue> key(factory->NewFromASCII("key"));
+    JSHandle<JSTaggedValue> value(thread, JSTaggedValue(2)); // 2: property value
+    JSObject::SetProperty(thread, receiver, key, value);
+
+    JSHandle<TaggedArray> array = factory->NewTaggedArray(2); // 2: one slot and its extra slot
+    JSHandle<ProfileTypeInfo> profileTypeInfo = JSHandle<ProfileTypeInfo>::Cast(array);
+    array->Set(thread, 0, JSTaggedValue::Hole());
+    array->Set(thread, 1, JSTaggedValue::Hole());
+
+    MegaICCache *cache = thread->GetLoadMegaICCache();
+    cache->Clear();
+    JSHClass *hclass = JSHandle<JSObject>::Cast(receiver)->GetJSHClass();
+    EXPECT_TRUE(cache->Get(hclass, key.GetTaggedValue()).IsHole());
+
+    LoadICRuntime loadICRuntime(thread, profileTypeInfo, 0, ICKind::NamedLoadIC);
+    EXPECT_EQ(loadICRuntime.LoadMiss(receiver, key), value.GetTaggedValue());
+    EXPECT_TRUE(array->Get(0).IsHole());
+    EXPECT_FALSE(cache->Get(hclass, key.GetTaggedValue()).IsHole());
+    cache->Clear();
+}
+}  // namespace panda::test
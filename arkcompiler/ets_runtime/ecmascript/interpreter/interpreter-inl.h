@@ -2732,6 +2732,22 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 RESTORE_ACC();
                 DISPATCH(STOBJBYNAME_IMM8_ID16_V8);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                uint16_t stringId = READ_INST_16_1();
+                SAVE_ACC();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                RESTORE_ACC();
+                value = GET_ACC();
+                receiver = GET_VREG_VALUE(v0);
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::StoreMegaICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    RESTORE_ACC();
+                    DISPATCH(STOBJBYNAME_IMM8_ID16_V8);
+                }
             }
         }
 #endif
@@ -2805,6 +2821,21 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 RESTORE_ACC();
                 DISPATCH(STOBJBYNAME_IMM16_ID16_V8);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                SAVE_ACC();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                RESTORE_ACC();
+                value = GET_ACC();
+                receiver = GET_VREG_VALUE(v0);
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::StoreMegaICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    RESTORE_ACC();
+                    DISPATCH(STOBJBYNAME_IMM16_ID16_V8);
+                }
             }
         }
 #endif
@@ -5988,6 +6019,21 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 SET_ACC(res);
                 DISPATCH(LDOBJBYNAME_IMM8_ID16);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                uint16_t stringId = READ_INST_16_1();
+                SAVE_ACC();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                RESTORE_ACC();
+                receiver = GET_ACC();
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::LoadMegaICByName(thread, profileTypeArray, receiver, propKey, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    SET_ACC(res);
+                    DISPATCH(LDOBJBYNAME_IMM8_ID16);
+                }
             }
         }
 #endif
@@ -6050,6 +6096,21 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 SET_ACC(res);
                 DISPATCH(LDOBJBYNAME_IMM16_ID16);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                uint16_t stringId = READ_INST_16_2();
+                SAVE_ACC();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                RESTORE_ACC();
+                receiver = GET_ACC();
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::LoadMegaICByName(thread, profileTypeArray, receiver, propKey, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    SET_ACC(res);
+                    DISPATCH(LDOBJBYNAME_IMM16_ID16);
+                }
             }
         }
 #endif
@@ -6801,6 +6862,19 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 SET_ACC(res);
                 DISPATCH(LDTHISBYNAME_IMM8_ID16);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                uint16_t stringId = READ_INST_16_1();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                receiver = GetThis(sp);
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::LoadMegaICByName(thread, profileTypeArray, receiver, propKey, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    SET_ACC(res);
+                    DISPATCH(LDTHISBYNAME_IMM8_ID16);
+                }
             }
         }
 #endif
@@ -6859,6 +6933,19 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 SET_ACC(res);
                 DISPATCH(LDTHISBYNAME_IMM16_ID16);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                uint16_t stringId = READ_INST_16_2();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                receiver = GetThis(sp);
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::LoadMegaICByName(thread, profileTypeArray, receiver, propKey, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    SET_ACC(res);
+                    DISPATCH(LDTHISBYNAME_IMM16_ID16);
+                }
             }
         }
 #endif
@@ -6922,6 +7009,22 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 RESTORE_ACC();
                 DISPATCH(STTHISBYNAME_IMM8_ID16);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                uint16_t stringId = READ_INST_16_1();
+                SAVE_ACC();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                RESTORE_ACC();
+                value = GET_ACC();
+                receiver = GetThis(sp);
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::StoreMegaICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    RESTORE_ACC();
+                    DISPATCH(STTHISBYNAME_IMM8_ID16);
+                }
             }
         }
 #endif
@@ -6994,6 +7097,22 @@ NO_UB_SANITIZE void EcmaInterpreter::RunInternal(JSThread *thread, const uint8_t
                 INTERPRETER_RETURN_IF_ABRUPT(res);
                 RESTORE_ACC();
                 DISPATCH(STTHISBYNAME_IMM16_ID16);
+            } else {  // megamorphic, try the cache shared by all the megamorphic sites
+                uint16_t stringId = READ_INST_16_2();
+                SAVE_ACC();
+                auto constpool = GetConstantPool(sp);
+                JSTaggedValue propKey = GET_STR_FROM_CACHE(stringId);
+                RESTORE_ACC();
+                value = GET_ACC();
+                receiver = GetThis(sp);
+                profileTypeInfo = GetRuntimeProfileTypeInfo(sp);
+                profileTypeArray = ProfileTypeInfo::Cast(profileTypeInfo.GetTaggedObject());
+                res = ICRuntimeStub::StoreMegaICByName(thread, profileTypeArray, receiver, propKey, value, slotId);
+                if (!res.IsHole()) {
+                    INTERPRETER_RETURN_IF_ABRUPT(res);
+                    RESTORE_ACC();
+                    DISPATCH(STTHISBYNAME_IMM16_ID16);
+                }
             }
         }
 #endif
@@ -15,8 +15,11 @@
 
 #include "ecmascript/js_array.h"
 
+#include <algorithm>
+
 #include "ecmascript/accessor_data.h"
 #include "ecmascript/base/array_helper.h"
+#include "ecmascript/base/tim_sort.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/js_tagged_value-inl.h"
@@ -388,46 +391,87 @@ void JSArray::Sort(JSThread *thread, const JSHandle<JSObject> &obj, const JSHand
     }
 
     // 2. Let len be ToLength(Get(obj, "length")).
-    int64_t len = base::ArrayHelper::GetArrayLength(thread, JSHandle<JSTaggedValue>(obj));
+    JSHandle<JSTaggedValue> objVal(obj);
+    int64_t len = base::ArrayHelper::GetArrayLength(thread, objVal);
     // 3. ReturnIfAbrupt(len).
     RETURN_IF_ABRUPT_COMPLETION(thread);
 
-    JSMutableHandle<JSTaggedValue> presentValue(thread, JSTaggedValue::Undefined());
-    JSMutableHandle<JSTaggedValue> middleValue(thread, JSTaggedValue::Undefined());
-    JSMutableHandle<JSTaggedValue> previousValue(thread, JSTaggedValue::Undefined());
-    for (int64_t i = 1; i < len; i++) {
-        int64_t beginIndex = 0;
-        int64_t endIndex = i;
-        presentValue.Update(ObjectFastOperator::FastGetPropertyByIndex<true>(thread, obj.GetTaggedValue(), i));
-        RETURN_IF_ABRUPT_COMPLETION(thread);
-        while (beginIndex < endIndex) {
-            int64_t middleIndex = (beginIndex + endIndex) / 2; // 2 : half
-            middleValue.Update(
-                ObjectFastOperator::FastGetPropertyByIndex<true>(thread, obj.GetTaggedValue(), middleIndex));
+    // Collect the present values except undefined, those are the only ones handed to the comparator.
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    JSMutableHandle<TaggedArray> items(thread, JSTaggedValue::Undefined());
+    JSMutableHandle<JSTaggedValue> key(thread, JSTaggedValue::Undefined());
+    uint32_t itemCount = 0;
+    int64_t undefinedCount = 0;
+    if (objVal->IsStableJSArray(thread)) {
+        JSHandle<TaggedArray> elements(thread, obj->GetElements());
+        auto scanLength = static_cast<uint32_t>(std::min(static_cast<int64_t>(elements->GetLength()), len));
+        items.Update(factory->NewTaggedArray(scanLength));
+        for (uint32_t k = 0; k < scanLength; k++) {
+            JSTaggedValue value = elements->Get(k);
+            if (value.IsUndefined()) {
+                undefinedCount++;
+            } else if (!value.IsHole()) {
+                items->Set(thread, itemCount++, value);
+            }
+        }
+    } else {
+        items.Update(factory->NewTaggedArray(static_cast<uint32_t>(std::min(len, SORT_INITIAL_CAPACITY))));
+        for (int64_t k = 0; k < len; k++) {
+            key.Update(JSTaggedValue(k));
+            bool exists = JSTaggedValue::HasProperty(thread, objVal, key);
             RETURN_IF_ABRUPT_COMPLETION(thread);
-            int32_t compareResult = base::ArrayHelper::SortCompare(thread, fn, middleValue, presentValue);
+            if (!exists) {
+                continue;
+            }
+            JSHandle<JSTaggedValue> value = JSTaggedValue::GetProperty(thread, objVal, key).GetValue();
             RETURN_IF_ABRUPT_COMPLETION(thread);
-            if (compareResult > 0) {
-                endIndex = middleIndex;
-            } else {
-                beginIndex = middleIndex + 1;
+            if (value->IsUndefined()) {
+                undefinedCount++;
+                continue;
+            }
+            if (itemCount == items->GetLength()) {
+                items.Update(factory->CopyArray(items, itemCount, itemCount + (itemCount >> 1) + 1));
             }
+            items->Set(thread, itemCount++, value.GetTaggedValue());
         }
+    }
 
-        if (endIndex >= 0 && endIndex < i) {
-            for (int64_t j = i; j > endIndex; j--) {
-                previousValue.Update(
-                    ObjectFastOperator::FastGetPropertyByIndex<true>(thread, obj.GetTaggedValue(), j - 1));
-                RETURN_IF_ABRUPT_COMPLETION(thread);
-                ObjectFastOperator::FastSetPropertyByIndex(thread, obj.GetTaggedValue(), j,
-                                                           previousValue.GetTaggedValue());
-                RETURN_IF_ABRUPT_COMPLETION(thread);
+    base::TimSort::Sort(thread, items, itemCount, fn);
+    RETURN_IF_ABRUPT_COMPLETION(thread);
+
+    // Write back the sorted values followed by the undefined ones, and delete what is left up to len.
+    int64_t writeEnd = itemCount + undefinedCount;
+    if (objVal->IsStableJSArray(thread)) {
+        JSArray::CheckAndCopyArray(thread, JSHandle<JSArray>::Cast(obj));
+        TaggedArray *elements = TaggedArray::Cast(obj->GetElements().GetTaggedObject());
+        // The comparator may have truncated the array, the elements store keeps its capacity then and nothing may be
+        // written at or above the current length. Growing the array again is left to SetProperty.
+        int64_t currentLen = static_cast<int64_t>(JSArray::Cast(*obj)->GetArrayLength());
+        int64_t end = std::min({ static_cast<int64_t>(elements->GetLength()), len, currentLen });
+        if (end >= writeEnd) {
+            for (uint32_t k = 0; k < itemCount; k++) {
+                elements->Set(thread, k, items->Get(k));
             }
-            ObjectFastOperator::FastSetPropertyByIndex(thread, obj.GetTaggedValue(), endIndex,
-                                                       presentValue.GetTaggedValue());
-            RETURN_IF_ABRUPT_COMPLETION(thread);
+            for (int64_t k = itemCount; k < writeEnd; k++) {
+                elements->Set(thread, k, JSTaggedValue::Undefined());
+            }
+            for (int64_t k = writeEnd; k < end; k++) {
+                elements->Set(thread, k, JSTaggedValue::Hole());
+            }
+            return;
         }
     }
+    JSMutableHandle<JSTaggedValue> value(thread, JSTaggedValue::Undefined());
+    for (int64_t k = 0; k < len; k++) {
+        key.Update(JSTaggedValue(k));
+        if (k < writeEnd) {
+            value.Update(k < itemCount ? items->Get(k) : JSTaggedValue::Undefined());
+            JSTaggedValue::SetProperty(thread, objVal, key, value, true);
+        } else {
+            JSTaggedValue::DeletePropertyOrThrow(thread, objVal, key);
+        }
+        RETURN_IF_ABRUPT_COMPLETION(thread);
+    }
 }
 
 bool JSArray::IncludeInSortedValue(JSThread *thread, const JSHandle<JSTaggedValue> &obj,
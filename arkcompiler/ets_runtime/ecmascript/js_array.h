@@ -94,6 +94,8 @@ public:
     static JSHandle<TaggedArray> ToTaggedArray(JSThread *thread, const JSHandle<JSTaggedValue> &obj);
     static void CheckAndCopyArray(const JSThread *thread, JSHandle<JSArray> obj);
 private:
+    static constexpr int64_t SORT_INITIAL_CAPACITY = 16;
+
     static void SetCapacity(JSThread *thread, const JSHandle<JSObject> &array, uint32_t oldLen, uint32_t newLen);
 };
 }  // namespace panda::ecmascript
@@ -513,7 +513,7 @@ JSTaggedValue JSDate::Parse(EcmaRuntimeCallInfo *argv)
         return JSTaggedValue(base::NAN_VALUE);
     }
     int len = static_cast<int>(strAccessor.GetLength());
-    auto data = reinterpret_cast<const char *>(strAccessor.GetDataUtf8());
+    auto data = reinterpret_cast<const char *>(strAccessor.ToUtf8Span(tmpBuf).data());
     return GetTimeFromString(data, len);
 }
 
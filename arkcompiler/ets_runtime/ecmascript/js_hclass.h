@@ -182,7 +182,8 @@ class ProtoChangeDetails;
         JS_PROXY, /* ECMA_OBJECT_LAST ////////////////////////////////////////////////////////////////////////////// */\
                                                                                                                        \
         HCLASS,       /* //////////////////////////////////////////////////////////////////////////////////-PADDING */ \
-        STRING,       /* //////////////////////////////////////////////////////////////////////////////////-PADDING */ \
+        STRING,       /* STRING_FIRST /////////////////////////////////////////////////////////////////////-PADDING */ \
+        TREE_STRING,  /* STRING_LAST //////////////////////////////////////////////////////////////////////-PADDING */ \
         BIGINT,       /* //////////////////////////////////////////////////////////////////////////////////-PADDING */ \
         TAGGED_ARRAY, /* //////////////////////////////////////////////////////////////////////////////////-PADDING */ \
         BYTE_ARRAY,   /* //////////////////////////////////////////////////////////////////////////////////-PADDING */ \
@@ -267,6 +268,9 @@ class ProtoChangeDetails;
         JS_TYPED_ARRAY_FIRST = JS_TYPED_ARRAY, /* /////////////////////////////////////////////////////////-PADDING */ \
         JS_TYPED_ARRAY_LAST = JS_BIGUINT64_ARRAY, /* ///////////////////////////////////////////////////////-PADDING */\
                                                                                                                        \
+        STRING_FIRST = STRING, /* /////////////////////////////////////////////////////////////////////////-PADDING */ \
+        STRING_LAST = TREE_STRING, /* /////////////////////////////////////////////////////////////////////-PADDING */ \
+                                                                                                                       \
         MODULE_RECORD_FIRST = MODULE_RECORD, /* ///////////////////////////////////////////////////////////-PADDING */ \
         MODULE_RECORD_LAST = SOURCE_TEXT_MODULE_RECORD, /* ////////////////////////////////////////////////-PADDING */ \
                                                                                                                        \
@@ -452,7 +456,13 @@ public:
 
     inline bool IsString() const
     {
-        return GetObjectType() == JSType::STRING;
+        JSType jsType = GetObjectType();
+        return (JSType::STRING_FIRST <= jsType && jsType <= JSType::STRING_LAST);
+    }
+
+    inline bool IsTreeString() const
+    {
+        return GetObjectType() == JSType::TREE_STRING;
     }
 
     inline bool IsBigInt() const
@@ -468,7 +478,7 @@ public:
     inline bool IsStringOrSymbol() const
     {
         JSType jsType = GetObjectType();
-        return (jsType == JSType::STRING) || (jsType == JSType::SYMBOL);
+        return (JSType::STRING_FIRST <= jsType && jsType <= JSType::STRING_LAST) || (jsType == JSType::SYMBOL);
     }
 
     inline bool IsTaggedArray() const
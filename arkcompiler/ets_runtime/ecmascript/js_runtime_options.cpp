@@ -54,6 +54,8 @@ const std::string PUBLIC_API HELP_OPTION_MSG =
     "       Default: \"none\"\n"
     "--compiler-log-methods: specific method list for compiler log output, only used when compiler-log."
                             "Default: \"none\"\n"
+    "--compiler-thread-num: Number of methods the aot compiler verifies and schedules concurrently on the "
+                           "taskpool. 1: compile methods one at a time. Default: 1\n"
     "--enable-ark-tools: Enable ark tools to debug. Default: false\n"
     "--trace-bc: enable tracing bytecode for aot runtime. Default: false\n"
     "--trace-deopt: enable tracing deopt for aot runtime. Default: false\n"
@@ -124,6 +126,7 @@ bool JSRuntimeOptions::ParseCommand(const int argc, const char **argv)
         {"compiler-log-methods", required_argument, nullptr, OPTION_COMPILER_LOG_METHODS},
         {"compiler-log-snapshot", required_argument, nullptr, OPTION_COMPILER_LOG_SNAPSHOT},
         {"compiler-log-time", required_argument, nullptr, OPTION_COMPILER_LOG_TIME},
+        {"compiler-thread-num", required_argument, nullptr, OPTION_COMPILER_THREAD_NUM},
         {"enable-ark-tools", required_argument, nullptr, OPTION_ENABLE_ARK_TOOLS},
         {"trace-bc", required_argument, nullptr, OPTION_TRACE_BC},
         {"trace-deopt", required_argument, nullptr, OPTION_TRACE_DEOPT},
@@ -261,6 +264,14 @@ bool JSRuntimeOptions::ParseCommand(const int argc, const char **argv)
                     return false;
                 }
                 break;
+            case OPTION_COMPILER_THREAD_NUM:
+                ret = ParseUint32Param("compiler-thread-num", &argUint32);
+                if (ret) {
+                    SetCompilerThreadNum(argUint32);
+                } else {
+                    return false;
+                }
+                break;
             case OPTION_ENABLE_ARK_TOOLS:
                 ret = ParseBoolParam(&argBool);
                 if (ret) {
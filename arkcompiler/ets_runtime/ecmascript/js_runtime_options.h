@@ -28,7 +28,7 @@
 namespace panda::ecmascript {
 using arg_list_t = std::vector<std::string>;
 enum ArkProperties {
-    DEFAULT = -1,  // default value 1000001011100
+    DEFAULT = -1,  // default value 1001000001011100
     OPTIONAL_LOG = 1,
     GC_STATS_PRINT = 1 << 1,
     PARALLEL_GC = 1 << 2,  // default enable
@@ -44,6 +44,7 @@ enum ArkProperties {
     ENABLE_IDLE_GC = 1 << 12,  // default enable
     CPU_PROFILER = 1 << 13,
     ENABLE_CPU_PROFILER_VM_TAG = 1 << 14,
+    INCREMENTAL_MARK = 1 << 15,  // default enable
 };
 
 // asm interpreter control parsed option
@@ -109,6 +110,7 @@ enum CommandValues {
     OPTION_HELP,
     OPTION_PGO_PROFILER_PATH,
     OPTION_PGO_HOTNESS_THRESHOLD,
+    OPTION_COMPILER_THREAD_NUM,
     OPTION_ENABLE_PGO_PROFILER,
     OPTION_OPTIONS,
     OPTION_PRINT_EXECUTE_TIME
@@ -281,7 +283,7 @@ public:
     int GetDefaultProperties()
     {
         return ArkProperties::PARALLEL_GC | ArkProperties::CONCURRENT_MARK | ArkProperties::CONCURRENT_SWEEP
-            | ArkProperties::ENABLE_ARKTOOLS | ArkProperties::ENABLE_IDLE_GC;
+            | ArkProperties::ENABLE_ARKTOOLS | ArkProperties::ENABLE_IDLE_GC | ArkProperties::INCREMENTAL_MARK;
     }
 
     int GetArkProperties()
@@ -314,6 +316,11 @@ public:
         return (static_cast<uint32_t>(arkProperties_) & ArkProperties::CONCURRENT_MARK) != 0;
     }
 
+    bool EnableIncrementalMark() const
+    {
+        return (static_cast<uint32_t>(arkProperties_) & ArkProperties::INCREMENTAL_MARK) != 0;
+    }
+
     bool EnableExceptionBacktrace() const
     {
         return (static_cast<uint32_t>(arkProperties_) & ArkProperties::EXCEPTION_BACKTRACE) != 0;
@@ -836,6 +843,16 @@ public:
         pgoHotnessThreshold_ = threshold;
     }
 
+    uint32_t GetCompilerThreadNum() const
+    {
+        return compilerThreadNum_;
+    }
+
+    void SetCompilerThreadNum(uint32_t num)
+    {
+        compilerThreadNum_ = num;
+    }
+
     std::string GetPGOProfilerPath() const
     {
         return pgoProfilerPath_;
@@ -956,6 +973,7 @@ private:
     bool enablePrintExecuteTime_ {false};
     bool enablePGOProfiler_ {false};
     uint32_t pgoHotnessThreshold_ {2};
+    uint32_t compilerThreadNum_ {1};
     std::string pgoProfilerPath_ {""};
     bool traceDeopt_ {false};
     uint8_t deoptThreshold_ {10};
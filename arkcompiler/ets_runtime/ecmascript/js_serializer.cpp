@@ -215,6 +215,7 @@ std::pair<uint8_t *, size_t> JSSerializer::ReleaseBuffer()
     bufferSize_ = 0;
     bufferCapacity_ = 0;
     objectId_ = 0;
+    stringMap_.clear();
     return res;
 }
 
@@ -244,6 +245,34 @@ bool JSSerializer::WriteIfSerialized(uintptr_t addr)
     return true;
 }
 
+bool JSSerializer::WriteIfSameStringSerialized(const JSHandle<JSTaggedValue> &value, uintptr_t addr)
+{
+    EcmaString *string = EcmaStringAccessor::Flatten(thread_->GetEcmaVM(), JSHandle<EcmaString>::Cast(value));
+    EcmaStringAccessor stringAccessor(string);
+    uint32_t length = stringAccessor.GetLength();
+    if (length == 0) {
+        return false;
+    }
+    bool isUtf8 = stringAccessor.IsUtf8();
+    size_t dataSize = isUtf8 ? length : length * sizeof(uint16_t);
+    const void *data = isUtf8 ? static_cast<const void *>(stringAccessor.GetDataUtf8()) :
+                                static_cast<const void *>(stringAccessor.GetDataUtf16());
+    auto range = stringMap_.equal_range(stringAccessor.GetHashcode());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        const SerializedString &serialized = iter->second;
+        if (serialized.isUtf8 != isUtf8 || serialized.length != length ||
+            serialized.dataOffset + dataSize > bufferSize_) {
+            continue;
+        }
+        if (memcmp(buffer_ + serialized.dataOffset, data, dataSize) != 0) {
+            continue;
+        }
+        referenceMap_.emplace(addr, serialized.objectId);
+        return WriteIfSerialized(addr);
+    }
+    return false;
+}
+
 // Write HeapObject
 bool JSSerializer::WriteTaggedObject(const JSHandle<JSTaggedValue> &value)
 {
@@ -252,6 +281,9 @@ bool JSSerializer::WriteTaggedObject(const JSHandle<JSTaggedValue> &value)
     if (serialized) {
         return WriteIfSerialized(addr);
     }
+    if (value->IsString() && WriteIfSameStringSerialized(value, addr)) {
+        return true;
+    }
     referenceMap_.emplace(addr, objectId_);
     objectId_++;
 
@@ -304,6 +336,7 @@ bool JSSerializer::WriteTaggedObject(const JSHandle<JSTaggedValue> &value)
         case JSType::JS_SHARED_ARRAY_BUFFER:
             return WriteJSArrayBuffer(value);
         case JSType::STRING:
+        case JSType::TREE_STRING:
             return WriteEcmaString(value);
         case JSType::JS_OBJECT:
             return WritePlainObject(value);
@@ -586,7 +619,7 @@ bool JSSerializer::WriteJSArray(const JSHandle<JSTaggedValue> &value)
 
 bool JSSerializer::WriteEcmaString(const JSHandle<JSTaggedValue> &value)
 {
-    JSHandle<EcmaString> string = JSHandle<EcmaString>::Cast(value);
+    EcmaString *string = EcmaStringAccessor::Flatten(thread_->GetEcmaVM(), JSHandle<EcmaString>::Cast(value));
     size_t oldSize = bufferSize_;
     if (!WriteType(SerializationUID::ECMASTRING)) {
         return false;
@@ -606,6 +639,11 @@ bool JSSerializer::WriteEcmaString(const JSHandle<JSTaggedValue> &value)
     if (length == 0) {
         return true;
     }
+    auto iter = referenceMap_.find(reinterpret_cast<uintptr_t>(value.GetTaggedValue().GetTaggedObject()));
+    if (iter != referenceMap_.end()) {
+        SerializedString serialized {iter->second, bufferSize_, static_cast<uint32_t>(length), isUtf8};
+        stringMap_.emplace(EcmaStringAccessor(string).GetHashcode(), serialized);
+    }
     if (isUtf8) {
         const uint8_t *data = EcmaStringAccessor(string).GetDataUtf8();
         const uint8_t strEnd = '\0';
@@ -943,6 +981,19 @@ bool JSSerializer::WritePlainObject(const JSHandle<JSTaggedValue> &objValue)
     }
 
     uint32_t elementsLength = obj->GetNumberOfElements();
+    // Dense elements are all default data properties at indices [0, length), so only the values are written
+    bool isDense = IsDenseElements(obj, elementsLength);
+    if (!WriteBoolean(isDense)) {
+        bufferSize_ = oldSize;
+        return false;
+    }
+    if (isDense) {
+        if (!WriteDenseElements(obj, elementsLength)) {
+            bufferSize_ = oldSize;
+            return false;
+        }
+        return true;
+    }
     if (!WriteInt(static_cast<int32_t>(elementsLength))) {
         bufferSize_ = oldSize;
         return false;
@@ -971,6 +1022,39 @@ bool JSSerializer::WritePlainObject(const JSHandle<JSTaggedValue> &objValue)
     return true;
 }
 
+bool JSSerializer::IsDenseElements(const JSHandle<JSObject> &obj, uint32_t elementsLength) const
+{
+    if (elementsLength == 0 || obj->GetJSHClass()->IsDictionaryElement()) {
+        return false;
+    }
+    TaggedArray *elements = TaggedArray::Cast(obj->GetElements().GetTaggedObject());
+    if (elements->GetLength() < elementsLength) {
+        return false;
+    }
+    for (uint32_t i = 0; i < elementsLength; i++) {
+        if (elements->Get(i).IsHole()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JSSerializer::WriteDenseElements(const JSHandle<JSObject> &obj, uint32_t elementsLength)
+{
+    if (!WriteInt(static_cast<int32_t>(elementsLength))) {
+        return false;
+    }
+    JSMutableHandle<JSTaggedValue> element(thread_, JSTaggedValue::Undefined());
+    for (uint32_t i = 0; i < elementsLength; i++) {
+        // reload elements every time since serializing a value may trigger gc
+        element.Update(TaggedArray::Cast(obj->GetElements().GetTaggedObject())->Get(i));
+        if (!SerializeJSTaggedValue(element)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool JSSerializer::WriteNativeBindingObject(const JSHandle<JSTaggedValue> &objValue)
 {
     JSHandle<JSObject> obj = JSHandle<JSObject>::Cast(objValue);
@@ -1027,6 +1111,19 @@ bool JSSerializer::WriteNativeBindingObject(const JSHandle<JSTaggedValue> &objVa
 bool JSSerializer::WriteDesc(const PropertyDescriptor &desc)
 {
     size_t oldSize = bufferSize_;
+    // Most properties are plain writable, enumerable and configurable data, write only the value for them
+    bool isDefaultData = desc.HasWritable() && desc.IsWritable() && desc.HasEnumerable() && desc.IsEnumerable() &&
+        desc.HasConfigurable() && desc.IsConfigurable();
+    if (!WriteBoolean(isDefaultData)) {
+        return false;
+    }
+    if (isDefaultData) {
+        if (!SerializeJSTaggedValue(desc.GetValue())) {
+            bufferSize_ = oldSize;
+            return false;
+        }
+        return true;
+    }
     bool isWritable = desc.IsWritable();
     if (!WriteBoolean(isWritable)) {
         bufferSize_ = oldSize;
@@ -1869,6 +1966,13 @@ bool JSDeserializer::DefinePropertiesAndElements(const JSHandle<JSTaggedValue> &
         }
     }
 
+    bool isDense = false;
+    if (!ReadBoolean(&isDense)) {
+        return false;
+    }
+    if (isDense) {
+        return ReadDenseElements(obj);
+    }
     int32_t elementLength;
     if (!JudgeType(SerializationUID::INT32) || !ReadInt(&elementLength)) {
         return false;
@@ -1889,8 +1993,42 @@ bool JSDeserializer::DefinePropertiesAndElements(const JSHandle<JSTaggedValue> &
     return true;
 }
 
+bool JSDeserializer::ReadDenseElements(const JSHandle<JSTaggedValue> &obj)
+{
+    int32_t elementLength;
+    if (!JudgeType(SerializationUID::INT32) || !ReadInt(&elementLength) || elementLength <= 0) {
+        return false;
+    }
+    // Fill a fresh backing store directly instead of defining the elements one by one
+    JSHandle<TaggedArray> elements = factory_->NewTaggedArray(static_cast<uint32_t>(elementLength));
+    for (int32_t i = 0; i < elementLength; i++) {
+        JSHandle<JSTaggedValue> value = DeserializeJSTaggedValue();
+        if (value.IsEmpty()) {
+            return false;
+        }
+        elements->Set(thread_, i, value);
+    }
+    JSHandle<JSObject>::Cast(obj)->SetElements(thread_, elements);
+    return true;
+}
+
 bool JSDeserializer::ReadDesc(PropertyDescriptor *desc)
 {
+    bool isDefaultData = false;
+    if (!ReadBoolean(&isDefaultData)) {
+        return false;
+    }
+    if (isDefaultData) {
+        JSHandle<JSTaggedValue> value = DeserializeJSTaggedValue();
+        if (value.IsEmpty()) {
+            return false;
+        }
+        desc->SetValue(value);
+        desc->SetWritable(true);
+        desc->SetEnumerable(true);
+        desc->SetConfigurable(true);
+        return true;
+    }
     bool isWritable = false;
     if (!ReadBoolean(&isWritable)) {
         return false;
@@ -17,6 +17,7 @@
 #define ECMASCRIPT_JS_SERIALIZER_H
 
 #include <map>
+#include <unordered_map>
 
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/js_date.h"
@@ -147,6 +148,9 @@ private:
     bool IsTargetSymbol(JSTaggedValue symbolVal);
     bool IsSerialized(uintptr_t addr) const;
     bool WriteIfSerialized(uintptr_t addr);
+    bool WriteIfSameStringSerialized(const JSHandle<JSTaggedValue> &value, uintptr_t addr);
+    bool IsDenseElements(const JSHandle<JSObject> &obj, uint32_t elementsLength) const;
+    bool WriteDenseElements(const JSHandle<JSObject> &obj, uint32_t elementsLength);
     uint32_t GetDataViewTypeIndex(const DataViewType dataViewType);
 
     NO_MOVE_SEMANTIC(JSSerializer);
@@ -161,6 +165,15 @@ private:
     // Reference map works only if no gc happens during serialization
     std::map<uintptr_t, uint64_t> referenceMap_;
     uint64_t objectId_ = 0;
+    // Strings are immutable, so content-equal strings are written once and referenced afterwards.
+    // Entries point into buffer_ instead of the heap, so they stay valid if gc moves the strings.
+    struct SerializedString {
+        uint64_t objectId;
+        size_t dataOffset;
+        uint32_t length;
+        bool isUtf8;
+    };
+    std::unordered_multimap<uint32_t, SerializedString> stringMap_;
 };
 
 class JSDeserializer {
@@ -205,6 +218,7 @@ private:
     bool ReadNativePointer(uintptr_t *pointer);
     bool DefinePropertiesAndElements(const JSHandle<JSTaggedValue> &obj);
     bool ReadDesc(PropertyDescriptor *desc);
+    bool ReadDenseElements(const JSHandle<JSTaggedValue> &obj);
     bool ReadBoolean(bool *value);
     DataViewType GetDataViewTypeByIndex(uint32_t viewTypeIndex);
 
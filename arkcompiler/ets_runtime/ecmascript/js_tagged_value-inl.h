@@ -462,6 +462,11 @@ inline bool JSTaggedValue::IsString() const
     return IsHeapObject() && GetTaggedObject()->GetClass()->IsString();
 }
 
+inline bool JSTaggedValue::IsTreeString() const
+{
+    return IsHeapObject() && GetTaggedObject()->GetClass()->IsTreeString();
+}
+
 inline bool JSTaggedValue::IsBigInt() const
 {
     return IsHeapObject() && GetTaggedObject()->GetClass()->IsBigInt();
@@ -155,8 +155,8 @@ bool JSTaggedValue::Equal(JSThread *thread, const JSHandle<JSTaggedValue> &x, co
 
     if (x->IsString()) {
         if (y->IsString()) {
-            return EcmaStringAccessor::StringsAreEqual(static_cast<EcmaString *>(x->GetTaggedObject()),
-                                                       static_cast<EcmaString *>(y->GetTaggedObject()));
+            return EcmaStringAccessor::StringsAreEqual(thread->GetEcmaVM(), JSHandle<EcmaString>(x),
+                                                       JSHandle<EcmaString>(y));
         }
         if (y->IsNumber()) {
             JSTaggedNumber xNumber = ToNumber(thread, x);
@@ -274,9 +274,8 @@ ComparisonResult JSTaggedValue::Compare(JSThread *thread, const JSHandle<JSTagge
     JSHandle<JSTaggedValue> primY(thread, ToPrimitive(thread, y));
     RETURN_VALUE_IF_ABRUPT_COMPLETION(thread, ComparisonResult::UNDEFINED);
     if (primX->IsString() && primY->IsString()) {
-        auto xString = static_cast<EcmaString *>(primX->GetTaggedObject());
-        auto yString = static_cast<EcmaString *>(primY->GetTaggedObject());
-        int result = EcmaStringAccessor::Compare(xString, yString);
+        int result = EcmaStringAccessor::Compare(thread->GetEcmaVM(), JSHandle<EcmaString>(primX),
+                                                 JSHandle<EcmaString>(primY));
         if (result < 0) {
             return ComparisonResult::LESS;
         }
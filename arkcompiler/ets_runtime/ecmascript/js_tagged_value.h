@@ -505,6 +505,7 @@ public:
     bool IsNumber() const;
     bool IsBigInt() const;
     bool IsString() const;
+    bool IsTreeString() const;
     bool IsStringOrSymbol() const;
     bool IsTaggedArray() const;
     bool IsByteArray() const;
@@ -22,8 +22,10 @@
 #include "ecmascript/ecma_global_storage.h"
 #include "ecmascript/ecma_param_configuration.h"
 #include "ecmascript/global_env_constants-inl.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/ic/properties_cache.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
+#include "ecmascript/mem/incremental_marker.h"
 #include "ecmascript/mem/mark_word.h"
 #include "ecmascript/stackmap/llvm_stackmap_parser.h"
 
@@ -81,6 +83,8 @@ JSThread::JSThread(EcmaVM *vm) : id_(os::thread::GetCurrentThreadId()), vm_(vm)
         isWeak_ = std::bind(&EcmaGlobalStorage<DebugNode>::IsWeak, globalDebugStorage_, std::placeholders::_1);
     }
     propertiesCache_ = new PropertiesCache();
+    loadMegaICCache_ = new MegaICCache();
+    storeMegaICCache_ = new MegaICCache();
     vmThreadControl_ = new VmThreadControl();
 }
 
@@ -111,6 +115,14 @@ JSThread::~JSThread()
         delete propertiesCache_;
         propertiesCache_ = nullptr;
     }
+    if (loadMegaICCache_ != nullptr) {
+        delete loadMegaICCache_;
+        loadMegaICCache_ = nullptr;
+    }
+    if (storeMegaICCache_ != nullptr) {
+        delete storeMegaICCache_;
+        storeMegaICCache_ = nullptr;
+    }
     if (vmThreadControl_ != nullptr) {
         delete vmThreadControl_;
         vmThreadControl_ = nullptr;
@@ -211,6 +223,12 @@ void JSThread::Iterate(const RootVisitor &visitor, const RootRangeVisitor &range
     if (propertiesCache_ != nullptr) {
         propertiesCache_->Clear();
     }
+    if (loadMegaICCache_ != nullptr) {
+        loadMegaICCache_->Clear();
+    }
+    if (storeMegaICCache_ != nullptr) {
+        storeMegaICCache_->Clear();
+    }
 
     if (!glueData_.exception_.IsHole()) {
         visitor(Root::ROOT_VM, ObjectSlot(ToUintPtr(&glueData_.exception_)));
@@ -468,8 +486,9 @@ bool JSThread::CheckSafepoint() const
         return true;
     }
 #endif
-    if (IsMarkFinished()) {
-        auto heap = GetEcmaVM()->GetHeap();
+    auto heap = GetEcmaVM()->GetHeap();
+    // incremental marking is finished in idle time, see Heap::TriggerIdleCollection
+    if (IsMarkFinished() && !heap->GetIncrementalMarker()->IsTriggeredIncrementalMark()) {
         heap->GetConcurrentMarker()->HandleMarkingFinished();
         return true;
     }
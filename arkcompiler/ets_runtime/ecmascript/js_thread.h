@@ -36,6 +36,7 @@ class EcmaHandleScope;
 class EcmaVM;
 class HeapRegionAllocator;
 class PropertiesCache;
+class MegaICCache;
 template<typename T>
 class EcmaGlobalStorage;
 class Node;
@@ -437,6 +438,16 @@ public:
         return propertiesCache_;
     }
 
+    MegaICCache *GetLoadMegaICCache() const
+    {
+        return loadMegaICCache_;
+    }
+
+    MegaICCache *GetStoreMegaICCache() const
+    {
+        return storeMegaICCache_;
+    }
+
     void SetMarkStatus(MarkStatus status)
     {
         MarkStatusBits::Set(status, &glueData_.threadStateBitField_);
@@ -826,6 +837,8 @@ private:
     std::vector<std::pair<WeakClearCallback, void *>> weakNodeSecondPassCallbacks_ {};
 
     PropertiesCache *propertiesCache_ {nullptr};
+    MegaICCache *loadMegaICCache_ {nullptr};
+    MegaICCache *storeMegaICCache_ {nullptr};
     EcmaGlobalStorage<Node> *globalStorage_ {nullptr};
     EcmaGlobalStorage<DebugNode> *globalDebugStorage_ {nullptr};
     int32_t stackTraceFd_ {-1};
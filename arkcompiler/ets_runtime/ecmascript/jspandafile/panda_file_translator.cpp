@@ -16,6 +16,7 @@
 #include "ecmascript/jspandafile/panda_file_translator.h"
 
 #include "ecmascript/aot_file_manager.h"
+#include "ecmascript/ecma_string_table.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
 #include "ecmascript/jspandafile/class_info_extractor.h"
@@ -163,6 +164,8 @@ JSHandle<ConstantPool> PandaFileTranslator::ParseConstPool(EcmaVM *vm, const JSP
     [[maybe_unused]] EcmaHandleScope handleScope(thread);
     const CUnorderedMap<uint32_t, uint64_t> &constpoolMap = jsPandaFile->GetConstpoolMap();
     const panda_file::File *pf = jsPandaFile->GetPandaFile();
+    // the entries are mostly strings, make room for all of them at once instead of growing the table repeatedly
+    vm->GetEcmaStringTable()->Reserve(constpoolMap.size());
 
     for (const auto &it : constpoolMap) {
         ConstPoolValue value(it.second);
@@ -18,6 +18,7 @@
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/clock_scope.h"
 #include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/incremental_marker.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem.h"
 #include "ecmascript/mem/parallel_marker-inl.h"
@@ -36,6 +37,10 @@ void FullGC::RunPhases()
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), FullGC_RunPhases);
     ClockScope clockScope;
 
+    if (heap_->GetIncrementalMarker()->IsTriggeredIncrementalMark()) {
+        LOG_GC(DEBUG) << "FullGC after IncrementalMarking";
+        heap_->GetIncrementalMarker()->Reset();
+    }
     if (heap_->CheckOngoingConcurrentMarking()) {
         LOG_GC(DEBUG) << "FullGC after ConcurrentMarking";
         heap_->GetConcurrentMarker()->Reset();  // HPPGC use mark result to move TaggedObject.
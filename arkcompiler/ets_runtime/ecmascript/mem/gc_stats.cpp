@@ -25,6 +25,7 @@ void GCStats::PrintStatisticResult(bool force)
     PrintSemiStatisticResult(force);
     PrintPartialStatisticResult(force);
     PrintCompressStatisticResult(force);
+    PrintIncrementalStatisticResult(force);
     PrintHeapStatisticResult(force);
 }
 
@@ -117,6 +118,22 @@ void GCStats::PrintCompressStatisticResult(bool force)
     }
 }
 
+void GCStats::PrintIncrementalStatisticResult(bool force)
+{
+    if ((force && incrementalMarkSliceCount_ != 0) ||
+            (!force && incrementalMarkSliceCount_ != lastIncrementalMarkSliceCount_)) {
+        lastIncrementalMarkSliceCount_ = incrementalMarkSliceCount_;
+        LOG_GC(INFO) << " IncrementalMark statistic: total mark slice count " << incrementalMarkSliceCount_;
+        LOG_GC(INFO) << " MIN slice time: " << PrintTimeMilliseconds(incrementalMarkSliceMinPause_) << "ms"
+                            << " MAX slice time: " << PrintTimeMilliseconds(incrementalMarkSliceMaxPause_) << "ms"
+                            << " total slice time: " << PrintTimeMilliseconds(incrementalMarkSliceTotalPause_) << "ms"
+                            << " average slice time: "
+                            << PrintTimeMilliseconds(incrementalMarkSliceTotalPause_ / incrementalMarkSliceCount_)
+                            << "ms"
+                            << " last remark pause time: " << PrintTimeMilliseconds(incrementalRemarkPause_) << "ms";
+    }
+}
+
 void GCStats::PrintHeapStatisticResult(bool force)
 {
     if (force && heap_ != nullptr) {
@@ -231,6 +248,7 @@ void GCStats::CheckIfLongTimePause()
         PrintSemiStatisticResult(true);
         PrintPartialStatisticResult(true);
         PrintCompressStatisticResult(true);
+        PrintIncrementalStatisticResult(true);
         PrintHeapStatisticResult(true);
     }
 }
@@ -254,4 +272,24 @@ void GCStats::StatisticConcurrentRemark(Duration time)
 {
     partialConcurrentMarkRemarkPause_ = TimeToMicroseconds(time);
 }
+
+void GCStats::StatisticIncrementalMarkSlice(Duration time)
+{
+    auto timeInMS = TimeToMicroseconds(time);
+    if (incrementalMarkSliceCount_ == 0) {
+        incrementalMarkSliceMinPause_ = timeInMS;
+        incrementalMarkSliceMaxPause_ = timeInMS;
+    } else {
+        incrementalMarkSliceMinPause_ = std::min(incrementalMarkSliceMinPause_, timeInMS);
+        incrementalMarkSliceMaxPause_ = std::max(incrementalMarkSliceMaxPause_, timeInMS);
+    }
+    incrementalMarkSliceTotalPause_ += timeInMS;
+    incrementalMarkLastSlicePause_ = timeInMS;
+    incrementalMarkSliceCount_++;
+}
+
+void GCStats::StatisticIncrementalRemark(Duration time)
+{
+    incrementalRemarkPause_ = TimeToMicroseconds(time);
+}
 }  // namespace panda::ecmascript
@@ -45,12 +45,31 @@ public:
     void StatisticConcurrentMarkWait(Duration time);
     void StatisticConcurrentRemark(Duration time);
     void StatisticConcurrentEvacuate(Duration time);
+    void StatisticIncrementalMarkSlice(Duration time);
+    void StatisticIncrementalRemark(Duration time);
+
+    size_t GetIncrementalMarkSliceCount() const
+    {
+        return incrementalMarkSliceCount_;
+    }
+
+    // in microseconds
+    size_t GetLastIncrementalMarkSlicePause() const
+    {
+        return incrementalMarkLastSlicePause_;
+    }
+
+    size_t GetMaxIncrementalMarkSlicePause() const
+    {
+        return incrementalMarkSliceMaxPause_;
+    }
 
     void CheckIfLongTimePause();
 private:
     void PrintSemiStatisticResult(bool force);
     void PrintPartialStatisticResult(bool force);
     void PrintCompressStatisticResult(bool force);
+    void PrintIncrementalStatisticResult(bool force);
 
     size_t TimeToMicroseconds(Duration time)
     {
@@ -95,6 +114,14 @@ private:
     size_t partialConcurrentMarkGCTotalPause_ = 0;
     size_t partialOldSpaceConcurrentMarkFreeSize_ = 0;
 
+    size_t lastIncrementalMarkSliceCount_ = 0;
+    size_t incrementalMarkSliceCount_ = 0;
+    size_t incrementalMarkSliceMinPause_ = 0;
+    size_t incrementalMarkSliceMaxPause_ = 0;
+    size_t incrementalMarkSliceTotalPause_ = 0;
+    size_t incrementalMarkLastSlicePause_ = 0;
+    size_t incrementalRemarkPause_ = 0;
+
     size_t lastFullGCCount_ = 0;
     size_t fullGCCount_ = 0;
     size_t fullGCMinPause_ = 0;
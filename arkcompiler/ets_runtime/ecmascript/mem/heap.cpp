@@ -24,6 +24,7 @@
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/mem/concurrent_sweeper.h"
 #include "ecmascript/mem/full_gc.h"
+#include "ecmascript/mem/incremental_marker.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem_controller.h"
 #include "ecmascript/mem/partial_gc.h"
@@ -116,6 +117,7 @@ void Heap::Initialize()
         EnableConcurrentSweepType::ENABLE : EnableConcurrentSweepType::CONFIG_DISABLE);
     concurrentMarker_ = new ConcurrentMarker(this, concurrentMarkerEnabled ? EnableConcurrentMarkType::ENABLE :
         EnableConcurrentMarkType::CONFIG_DISABLE);
+    incrementalMarker_ = new IncrementalMarker(this, ecmaVm_->GetJSOptions().EnableIncrementalMark());
     nonMovableMarker_ = new NonMovableMarker(this);
     semiGCMarker_ = new SemiGCMarker(this);
     compressGCMarker_ = new CompressGCMarker(this);
@@ -209,6 +211,10 @@ void Heap::Destroy()
         delete concurrentMarker_;
         concurrentMarker_ = nullptr;
     }
+    if (incrementalMarker_ != nullptr) {
+        delete incrementalMarker_;
+        incrementalMarker_ = nullptr;
+    }
     if (nonMovableMarker_ != nullptr) {
         delete nonMovableMarker_;
         nonMovableMarker_ = nullptr;
@@ -322,6 +328,10 @@ TriggerGCType Heap::SelectGCType() const
     if (concurrentMarker_->IsEnabled() && !thread_->IsReadyToMark()) {
         return YOUNG_GC;
     }
+    // The partial gc finishes the full mark started by the incremental marker.
+    if (incrementalMarker_->IsTriggeredIncrementalMark()) {
+        return YOUNG_GC;
+    }
     if (!OldSpaceExceedLimit() && !OldSpaceExceedCapacity(activeSemiSpace_->GetCommittedSize()) &&
         GetHeapObjectSize() <= globalSpaceAllocLimit_) {
         return YOUNG_GC;
@@ -359,7 +369,7 @@ void Heap::CollectGarbage(TriggerGCType gcType)
     switch (gcType) {
         case TriggerGCType::YOUNG_GC:
             // Use partial GC for young generation.
-            if (!concurrentMarker_->IsEnabled()) {
+            if (!concurrentMarker_->IsEnabled() && !incrementalMarker_->IsTriggeredIncrementalMark()) {
                 SetMarkType(MarkType::MARK_YOUNG);
             }
             partialGC_->RunPhases();
@@ -631,6 +641,10 @@ void Heap::CheckAndTriggerOldGC(size_t size)
 
 bool Heap::CheckOngoingConcurrentMarking()
 {
+    if (incrementalMarker_->IsTriggeredIncrementalMark()) {
+        // The marking runs on this thread, what is left is traced by the remark.
+        return true;
+    }
     if (concurrentMarker_->IsEnabled() && !thread_->IsReadyToMark()) {
         if (thread_->IsMarking()) {
             [[maybe_unused]] ClockScope clockScope;
@@ -782,6 +796,25 @@ void Heap::TriggerConcurrentMarking()
     }
 }
 
+bool Heap::TryTriggerIncrementalMarking()
+{
+    // Concurrent marking is preferred as long as it can get a gc thread.
+    if (!incrementalMarker_->IsEnabled() || !thread_->IsReadyToMark() || fullGCRequested_) {
+        return false;
+    }
+    if (concurrentMarker_->IsEnabled() && Taskpool::GetCurrentTaskpool()->GetTotalThreadNum() > 1) {
+        return false;
+    }
+    size_t oldSpaceHeapObjectSize = oldSpace_->GetHeapObjectSize() + hugeObjectSpace_->GetHeapObjectSize();
+    if (oldSpaceHeapObjectSize < oldSpace_->GetInitialCapacity() * INCREMENTAL_MARK_TRIGGER_RATE &&
+        GetHeapObjectSize() < globalSpaceAllocLimit_ * INCREMENTAL_MARK_TRIGGER_RATE) {
+        return false;
+    }
+    OPTIONAL_LOG(ecmaVm_, INFO) << "Trigger incremental mark";
+    incrementalMarker_->TriggerIncrementalMark();
+    return true;
+}
+
 void Heap::WaitRunningTaskFinished()
 {
     os::memory::LockHolder holder(waitTaskFinishedMutex_);
@@ -803,7 +836,7 @@ void Heap::WaitAllTasksFinished()
     WaitRunningTaskFinished();
     sweeper_->EnsureAllTaskFinished();
     WaitClearTaskFinished();
-    if (concurrentMarker_->IsEnabled() && thread_->IsMarking()) {
+    if (concurrentMarker_->IsEnabled() && thread_->IsMarking() && !incrementalMarker_->IsTriggeredIncrementalMark()) {
         concurrentMarker_->WaitMarkingFinished();
     }
 }
@@ -870,7 +903,22 @@ void Heap::TriggerIdleCollection([[maybe_unused]] int idleMicroSec)
     }
 
     if (idleMicroSec >= IDLE_TIME_REMARK && thread_->IsMarkFinished()) {
-        concurrentMarker_->HandleMarkingFinished();
+        if (incrementalMarker_->IsTriggeredIncrementalMark()) {
+            CollectGarbage(TriggerGCType::OLD_GC);
+        } else {
+            concurrentMarker_->HandleMarkingFinished();
+        }
+        return;
+    }
+
+    if (incrementalMarker_->IsTriggeredIncrementalMark()) {
+        if (idleMicroSec >= IDLE_TIME_INCREMENTAL_MARK) {
+            incrementalMarker_->Mark(static_cast<float>(idleMicroSec));
+        }
+        return;
+    }
+
+    if (idleMicroSec >= IDLE_TIME_INCREMENTAL_MARK && TryTriggerIncrementalMarking()) {
         return;
     }
 
@@ -32,6 +32,7 @@ class EcmaVM;
 class FullGC;
 class HeapRegionAllocator;
 class HeapTracker;
+class IncrementalMarker;
 class Marker;
 class MemController;
 class NativeAreaAllocator;
@@ -216,6 +217,11 @@ public:
         return concurrentMarker_;
     }
 
+    IncrementalMarker *GetIncrementalMarker() const
+    {
+        return incrementalMarker_;
+    }
+
     Marker *GetNonMovableMarker() const
     {
         return nonMovableMarker_;
@@ -316,6 +322,7 @@ public:
     void TryTriggerConcurrentMarking();
     void AdjustBySurvivalRate(size_t originalNewSpaceSize);
     void TriggerConcurrentMarking();
+    bool TryTriggerIncrementalMarking();
 
     /*
      * Wait for existing concurrent marking tasks to be finished (if any).
@@ -506,6 +513,9 @@ private:
     static constexpr int64_t WAIT_FOR_APP_START_UP = 200;
     static constexpr int IDLE_TIME_REMARK = 10;
     static constexpr int IDLE_TIME_LIMIT = 15;  // if idle time over 15ms we can do something
+    static constexpr int IDLE_TIME_INCREMENTAL_MARK = 2;  // shorter idle periods are not worth a mark slice
+    // start incremental marking once the old space reaches this part of its limit
+    static constexpr double INCREMENTAL_MARK_TRIGGER_RATE = 0.8;
     static constexpr int MIN_OLD_GC_LIMIT = 10000;  // 10s
     static constexpr int REST_HEAP_GROWTH_LIMIT = 2_MB;
     void FatalOutOfMemoryError(size_t size, std::string functionName);
@@ -527,6 +537,12 @@ private:
         ~ParallelGCTask() override = default;
         bool Run(uint32_t threadIndex) override;
 
+        // most phases run inside a gc pause which waits for them
+        TaskPriority GetPriority() const override
+        {
+            return TaskPriority::HIGH;
+        }
+
         NO_COPY_SEMANTIC(ParallelGCTask);
         NO_MOVE_SEMANTIC(ParallelGCTask);
 
@@ -542,6 +558,11 @@ private:
         ~AsyncClearTask() override = default;
         bool Run(uint32_t threadIndex) override;
 
+        TaskPriority GetPriority() const override
+        {
+            return TaskPriority::LOW;
+        }
+
         NO_COPY_SEMANTIC(AsyncClearTask);
         NO_MOVE_SEMANTIC(AsyncClearTask);
     private:
@@ -596,6 +617,9 @@ private:
     // Concurrent marker which coordinates actions of GC markers and mutators.
     ConcurrentMarker *concurrentMarker_ {nullptr};
 
+    // Incremental marker which marks on the js thread in idle time when concurrent marking is unavailable.
+    IncrementalMarker *incrementalMarker_ {nullptr};
+
     // Concurrent sweeper which coordinates actions of sweepers (in spaces excluding young semi spaces) and mutators.
     ConcurrentSweeper *sweeper_ {nullptr};
 
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/mem/incremental_marker.h"
+
+#include "ecmascript/mem/clock_scope.h"
+#include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/heap-inl.h"
+#include "ecmascript/mem/parallel_marker-inl.h"
+#include "ecmascript/mem/space-inl.h"
+#include "ecmascript/runtime_call_id.h"
+
+namespace panda::ecmascript {
+IncrementalMarker::IncrementalMarker(Heap *heap, bool enabled)
+    : heap_(heap),
+      vm_(heap->GetEcmaVM()),
+      thread_(vm_->GetJSThread()),
+      workManager_(heap->GetWorkManager()),
+      enabled_(enabled)
+{
+}
+
+void IncrementalMarker::TriggerIncrementalMark()
+{
+    LOG_GC(DEBUG) << "IncrementalMarker: Incremental Marking Begin";
+    ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "IncrementalMarker::TriggerIncrementalMark");
+    ClockScope scope;
+    InitializeMarking();
+    vm_->GetEcmaGCStats()->StatisticIncrementalMarkSlice(scope.GetPauseTime());
+}
+
+bool IncrementalMarker::Mark(float budgetTime)
+{
+    ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "IncrementalMarker::Mark");
+    MEM_ALLOCATE_AND_GC_TRACE(vm_, IncrementalMarking);
+    ClockScope scope;
+    Marker *nonMovableMarker = heap_->GetNonMovableMarker();
+    bool drained = false;
+    do {
+        drained = nonMovableMarker->ProcessIncrementalMarkStack(MAIN_THREAD_INDEX, MARK_STEP_SIZE);
+    } while (!drained && scope.TotalSpentTime() < budgetTime);
+    if (drained) {
+        // The barrier may still grey objects, they are traced by the next slice or the remark.
+        thread_->SetMarkStatus(MarkStatus::MARK_FINISHED);
+    }
+    vm_->GetEcmaGCStats()->StatisticIncrementalMarkSlice(scope.GetPauseTime());
+    return drained;
+}
+
+void IncrementalMarker::ReMark()
+{
+    LOG_GC(DEBUG) << "IncrementalMarker: Remarking Begin";
+    MEM_ALLOCATE_AND_GC_TRACE(vm_, IncrementalReMarking);
+    ClockScope scope;
+    Marker *nonMovableMarker = heap_->GetNonMovableMarker();
+    nonMovableMarker->MarkRoots(MAIN_THREAD_INDEX);
+    nonMovableMarker->ProcessMarkStack(MAIN_THREAD_INDEX);
+    heap_->WaitRunningTaskFinished();
+    vm_->GetEcmaGCStats()->StatisticIncrementalRemark(scope.GetPauseTime());
+}
+
+void IncrementalMarker::Reset(bool revertCSet)
+{
+    heap_->WaitRunningTaskFinished();
+    workManager_->Finish();
+    thread_->SetMarkStatus(MarkStatus::READY_TO_MARK);
+    isIncrementalMarking_ = false;
+    if (revertCSet) {
+        // Partial gc clear cset when evacuation allocator finalize
+        heap_->GetOldSpace()->RevertCSet();
+        heap_->EnumerateRegions([](Region *region) {
+            region->ClearMarkGCBitset();
+            region->ClearCrossRegionRSet();
+            region->ResetAliveObject();
+        });
+    }
+}
+
+void IncrementalMarker::InitializeMarking()
+{
+    MEM_ALLOCATE_AND_GC_TRACE(vm_, IncrementalMarkingInitialize);
+    heap_->Prepare();
+    heap_->SetMarkType(MarkType::MARK_FULL);
+    thread_->SetMarkStatus(MarkStatus::MARKING);
+    isIncrementalMarking_ = true;
+
+    heap_->GetOldSpace()->SelectCSet();
+    heap_->GetAppSpawnSpace()->EnumerateRegions([](Region *current) {
+        current->ClearMarkGCBitset();
+        current->ClearCrossRegionRSet();
+    });
+    // The alive object size of Region in OldSpace will be recalculated.
+    heap_->EnumerateNonNewSpaceRegions([](Region *current) {
+        current->ResetAliveObject();
+    });
+    workManager_->Initialize(TriggerGCType::OLD_GC, ParallelGCTaskPhase::CONCURRENT_HANDLE_GLOBAL_POOL_TASK);
+    heap_->GetNonMovableMarker()->MarkRoots(MAIN_THREAD_INDEX);
+}
+}  // namespace panda::ecmascript
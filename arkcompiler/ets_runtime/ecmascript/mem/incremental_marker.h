@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_MEM_INCREMENTAL_MARKER_H
+#define ECMASCRIPT_MEM_INCREMENTAL_MARKER_H
+
+#include "ecmascript/mem/work_manager.h"
+
+namespace panda::ecmascript {
+class EcmaVM;
+class Heap;
+class JSThread;
+
+// Full marking done on the js thread in bounded slices, used when concurrent marking cannot get a gc thread.
+// It shares the mark status, the write barrier and the remark with concurrent marking: while marking the barrier
+// greys the stored values, and the partial gc finishing the cycle rescans the roots before sweeping.
+class IncrementalMarker {
+public:
+    explicit IncrementalMarker(Heap *heap, bool enabled);
+    ~IncrementalMarker() = default;
+
+    bool IsEnabled() const
+    {
+        return enabled_;
+    }
+
+    void ConfigIncrementalMark(bool enabled)
+    {
+        enabled_ = enabled;
+    }
+
+    bool IsTriggeredIncrementalMark() const
+    {
+        return isIncrementalMarking_;
+    }
+
+    // Prepare the heap for a full mark and push the roots, the objects are traced by Mark.
+    void TriggerIncrementalMark();
+    // Trace objects for at most budgetTime milliseconds. Return true if the mark stack was drained.
+    bool Mark(float budgetTime);
+    void ReMark();
+    void Reset(bool revertCSet = true);
+
+private:
+    NO_COPY_SEMANTIC(IncrementalMarker);
+    NO_MOVE_SEMANTIC(IncrementalMarker);
+
+    void InitializeMarking();
+
+    // number of objects traced between two clock checks
+    static constexpr uint32_t MARK_STEP_SIZE = 256;
+
+    Heap *heap_ {nullptr};
+    EcmaVM *vm_ {nullptr};
+    JSThread *thread_ {nullptr};
+    WorkManager *workManager_ {nullptr};
+    bool enabled_ {false};
+    bool isIncrementalMarking_ {false};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_MEM_INCREMENTAL_MARKER_H
@@ -334,6 +334,9 @@ public:
                 break;
             case JSType::STRING:
                 break;
+            case JSType::TREE_STRING:
+                TreeEcmaString::Cast(object)->VisitRangeSlot(visitor);
+                break;
             case JSType::JS_NATIVE_POINTER:
                 if (visitType == VisitType::SNAPSHOT_VISIT) {
                     JSNativePointer::Cast(object)->VisitRangeSlotForNative(visitor);
@@ -51,6 +51,12 @@ private:
         ~EvacuationTask() override;
         bool Run(uint32_t threadIndex) override;
 
+        // the js thread waits for it inside the gc pause
+        TaskPriority GetPriority() const override
+        {
+            return TaskPriority::HIGH;
+        }
+
         NO_COPY_SEMANTIC(EvacuationTask);
         NO_MOVE_SEMANTIC(EvacuationTask);
 
@@ -66,6 +72,12 @@ private:
 
         bool Run(uint32_t threadIndex) override;
 
+        // the js thread waits for it inside the gc pause
+        TaskPriority GetPriority() const override
+        {
+            return TaskPriority::HIGH;
+        }
+
         NO_COPY_SEMANTIC(UpdateReferenceTask);
         NO_MOVE_SEMANTIC(UpdateReferenceTask);
 
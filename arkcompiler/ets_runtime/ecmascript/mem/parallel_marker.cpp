@@ -14,6 +14,9 @@
  */
 
 #include "ecmascript/mem/parallel_marker-inl.h"
+
+#include <limits>
+
 #include "ecmascript/mem/visitor.h"
 
 namespace panda::ecmascript {
@@ -50,6 +53,11 @@ void Marker::ProcessSnapshotRSet(uint32_t threadId)
 }
 
 void NonMovableMarker::ProcessMarkStack(uint32_t threadId)
+{
+    ProcessIncrementalMarkStack(threadId, std::numeric_limits<uint32_t>::max());
+}
+
+bool NonMovableMarker::ProcessIncrementalMarkStack(uint32_t threadId, uint32_t markStepSize)
 {
     bool isFullMark = heap_->IsFullMark();
     auto visitor = [this, threadId, isFullMark](TaggedObject *root, ObjectSlot start, ObjectSlot end,
@@ -77,16 +85,17 @@ void NonMovableMarker::ProcessMarkStack(uint32_t threadId)
         }
     };
     TaggedObject *obj = nullptr;
-    while (true) {
+    for (uint32_t count = 0; count < markStepSize; count++) {
         obj = nullptr;
         if (!workManager_->Pop(threadId, &obj)) {
-            break;
+            return true;
         }
 
         JSHClass *jsHclass = obj->GetClass();
         MarkObject(threadId, jsHclass);
         objXRay_.VisitObjectBody<VisitType::OLD_GC_VISIT>(obj, jsHclass, visitor);
     }
+    return false;
 }
 
 void SemiGCMarker::Initialize()
@@ -49,6 +49,14 @@ public:
         LOG_GC(FATAL) << "can not call this method";
     }
 
+    // Trace at most markStepSize objects, return true if the mark stack is empty.
+    virtual bool ProcessIncrementalMarkStack([[maybe_unused]] uint32_t threadId,
+                                             [[maybe_unused]] uint32_t markStepSize)
+    {
+        LOG_GC(FATAL) << "can not call this method";
+        return true;
+    }
+
 protected:
     // non move
     virtual inline void MarkObject([[maybe_unused]] uint32_t threadId, [[maybe_unused]] TaggedObject *object)
@@ -87,6 +95,7 @@ public:
 
 protected:
     void ProcessMarkStack(uint32_t threadId) override;
+    bool ProcessIncrementalMarkStack(uint32_t threadId, uint32_t markStepSize) override;
     inline void MarkObject(uint32_t threadId, TaggedObject *object) override;
     inline void HandleRoots(uint32_t threadId, [[maybe_unused]] Root type, ObjectSlot slot) override;
     inline void HandleRangeRoots(uint32_t threadId, [[maybe_unused]] Root type, ObjectSlot start,
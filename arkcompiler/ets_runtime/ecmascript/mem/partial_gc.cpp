@@ -19,6 +19,7 @@
 #include "ecmascript/mem/barriers-inl.h"
 #include "ecmascript/mem/clock_scope.h"
 #include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/incremental_marker.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem.h"
@@ -39,6 +40,7 @@ void PartialGC::RunPhases()
     MEM_ALLOCATE_AND_GC_TRACE(heap_->GetEcmaVM(), PartialGC_RunPhases);
     ClockScope clockScope;
 
+    incrementalMarking_ = heap_->GetIncrementalMarker()->IsTriggeredIncrementalMark();
     markingInProgress_ = heap_->CheckOngoingConcurrentMarking();
 
     LOG_GC(DEBUG) << "markingInProgress_" << markingInProgress_;
@@ -47,7 +49,8 @@ void PartialGC::RunPhases()
     Sweep();
     Evacuate();
     Finish();
-    heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticPartialGC(markingInProgress_, clockScope.GetPauseTime(), freeSize_);
+    heap_->GetEcmaVM()->GetEcmaGCStats()->StatisticPartialGC(markingInProgress_ && !incrementalMarking_,
+                                                             clockScope.GetPauseTime(), freeSize_);
     LOG_GC(DEBUG) << "PartialGC::RunPhases " << clockScope.TotalSpentTime();
 }
 
@@ -79,7 +82,9 @@ void PartialGC::Initialize()
 void PartialGC::Finish()
 {
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "PartialGC::Finish");
-    if (markingInProgress_) {
+    if (incrementalMarking_) {
+        heap_->GetIncrementalMarker()->Reset(false);
+    } else if (markingInProgress_) {
         auto marker = heap_->GetConcurrentMarker();
         marker->Reset(false);
     } else {
@@ -93,6 +98,10 @@ void PartialGC::Finish()
 void PartialGC::Mark()
 {
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "PartialGC::Mark");
+    if (incrementalMarking_) {
+        heap_->GetIncrementalMarker()->ReMark();
+        return;
+    }
     if (markingInProgress_) {
         heap_->GetConcurrentMarker()->ReMark();
         return;
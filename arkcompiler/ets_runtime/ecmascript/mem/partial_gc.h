@@ -58,6 +58,7 @@ private:
     size_t oldSpaceCommitSize_ = 0;
     size_t nonMoveSpaceCommitSize_ = 0;
     bool markingInProgress_ {false};
+    bool incrementalMarking_ {false};
     // Obtained from the shared heap instance.
     WorkManager *workManager_ {nullptr};
 
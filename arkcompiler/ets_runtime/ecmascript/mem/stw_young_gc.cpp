@@ -18,6 +18,7 @@
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/clock_scope.h"
 #include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/incremental_marker.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/mark_stack.h"
 #include "ecmascript/mem/mem.h"
@@ -41,6 +42,10 @@ void STWYoungGC::RunPhases()
     [[maybe_unused]] ClockScope clockScope;
 
     ECMA_BYTRACE_NAME(HITRACE_TAG_ARK, "STWYoungGC::RunPhases");
+    if (heap_->GetIncrementalMarker()->IsTriggeredIncrementalMark()) {
+        LOG_GC(DEBUG) << "STWYoungGC after IncrementalMarking";
+        heap_->GetIncrementalMarker()->Reset();
+    }
     if (heap_->CheckOngoingConcurrentMarking()) {
         LOG_GC(DEBUG) << "STWYoungGC after ConcurrentMarking";
         heap_->GetConcurrentMarker()->Reset();  // HPPGC use mark result to move TaggedObject.
@@ -17,11 +17,13 @@
 
 #include "ecmascript/base/block_hook_scope.h"
 #include "ecmascript/dfx/hprof/heap_profiler.h"
+#include "ecmascript/dfx/hprof/heap_snapshot_binary_serializer.h"
 #include "ecmascript/dfx/stackinfo/js_stackinfo.h"
 #include "ecmascript/ecma_vm.h"
 #include "ecmascript/mem/c_string.h"
 #include "ecmascript/mem/heap-inl.h"
 #include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/regexp/regexp_parser_cache.h"
 #include "ecmascript/dfx/hprof/file_stream.h"
 
 #if defined(ECMASCRIPT_SUPPORT_CPUPROFILER)
@@ -92,6 +94,21 @@ void DFXJSNApi::DumpHeapSnapshot([[maybe_unused]] const EcmaVM *vm, [[maybe_unus
 #endif
 }
 
+bool DFXJSNApi::ConvertHeapSnapshotToJSON(const std::string &binaryPath, const std::string &jsonPath)
+{
+    std::ifstream input(binaryPath, std::ios::in | std::ios::binary);
+    if (!input.good()) {
+        LOG_ECMA(ERROR) << "ConvertHeapSnapshotToJSON open binary snapshot failed: " << binaryPath;
+        return false;
+    }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    FileStream stream(jsonPath);
+    if (!stream.Good()) {
+        return false;
+    }
+    return ecmascript::HeapSnapshotBinarySerializer::ConvertToJSON(data.data(), data.size(), &stream);
+}
+
 bool DFXJSNApi::BuildNativeAndJsStackTrace(const EcmaVM *vm, std::string &stackTraceStr)
 {
     LOG_ECMA(INFO) <<"BuildJsStackInfoList start";
@@ -188,6 +205,26 @@ size_t DFXJSNApi::GetHeapUsedSize(const EcmaVM *vm)
     return vm->GetHeap()->GetHeapObjectSize();
 }
 
+size_t DFXJSNApi::GetRegExpCacheHitCount(const EcmaVM *vm)
+{
+    return vm->GetRegExpParserCache()->GetHitCount();
+}
+
+size_t DFXJSNApi::GetRegExpCacheMissCount(const EcmaVM *vm)
+{
+    return vm->GetRegExpParserCache()->GetMissCount();
+}
+
+size_t DFXJSNApi::GetRegExpCacheEvictionCount(const EcmaVM *vm)
+{
+    return vm->GetRegExpParserCache()->GetEvictionCount();
+}
+
+size_t DFXJSNApi::GetRegExpCacheSize(const EcmaVM *vm)
+{
+    return vm->GetRegExpParserCache()->GetCachedBytes();
+}
+
 void DFXJSNApi::NotifyApplicationState(EcmaVM *vm, bool inBackground)
 {
     const_cast<ecmascript::Heap *>(vm->GetHeap())->ChangeGCParams(inBackground);
@@ -51,6 +51,8 @@ public:
     static void DumpHeapSnapshot(const EcmaVM *vm, int dumpFormat, Stream *stream, Progress *progress = nullptr,
                                  bool isVmMode = true, bool isPrivate = false);
     static void DumpHeapSnapshot(const EcmaVM *vm, int dumpFormat, bool isVmMode = true, bool isPrivate = false);
+    // convert a snapshot dumped in the binary format into the JSON format that DevTools loads
+    static bool ConvertHeapSnapshotToJSON(const std::string &binaryPath, const std::string &jsonPath);
 
     static bool BuildNativeAndJsStackTrace(const EcmaVM *vm, std::string &stackTraceStr);
     static bool BuildJsStackTrace(const EcmaVM *vm, std::string &stackTraceStr);
@@ -65,6 +67,10 @@ public:
     static size_t GetArrayBufferSize(const EcmaVM *vm);
     static size_t GetHeapTotalSize(const EcmaVM *vm);
     static size_t GetHeapUsedSize(const EcmaVM *vm);
+    static size_t GetRegExpCacheHitCount(const EcmaVM *vm);
+    static size_t GetRegExpCacheMissCount(const EcmaVM *vm);
+    static size_t GetRegExpCacheEvictionCount(const EcmaVM *vm);
+    static size_t GetRegExpCacheSize(const EcmaVM *vm);
     static void NotifyApplicationState(EcmaVM *vm, bool inBackground);
     static void NotifyIdleTime(const EcmaVM *vm, int idleMicroSec);
     static void NotifyMemoryPressure(EcmaVM *vm, bool inHighMemoryPressure);
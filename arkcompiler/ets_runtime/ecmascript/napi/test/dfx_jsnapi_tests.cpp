@@ -19,6 +19,7 @@
 #include "ecmascript/mem/heap.h"
 #include "ecmascript/mem/concurrent_marker.h"
 #include "ecmascript/napi/include/dfx_jsnapi.h"
+#include "ecmascript/regexp/regexp_parser_cache.h"
 #include "ecmascript/tests/test_helper.h"
 
 using namespace panda;
@@ -274,6 +275,15 @@ HWTEST_F_L0(DFXJSNApiTests, GetArrayBufferSize_GetHeapTotalSize_GetHeapUsedSize)
     EXPECT_EQ(heapUsedSize, expectHeapUsedSize);
 }
 
+HWTEST_F_L0(DFXJSNApiTests, GetRegExpCacheStats)
+{
+    auto regExpParserCache = vm_->GetRegExpParserCache();
+    EXPECT_EQ(DFXJSNApi::GetRegExpCacheHitCount(vm_), regExpParserCache->GetHitCount());
+    EXPECT_EQ(DFXJSNApi::GetRegExpCacheMissCount(vm_), regExpParserCache->GetMissCount());
+    EXPECT_EQ(DFXJSNApi::GetRegExpCacheEvictionCount(vm_), regExpParserCache->GetEvictionCount());
+    EXPECT_EQ(DFXJSNApi::GetRegExpCacheSize(vm_), regExpParserCache->GetCachedBytes());
+}
+
 HWTEST_F_L0(DFXJSNApiTests, NotifyApplicationState)
 {
     auto heap = vm_->GetHeap();
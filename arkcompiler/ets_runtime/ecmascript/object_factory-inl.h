@@ -47,6 +47,13 @@ EcmaString *ObjectFactory::AllocOldSpaceStringObject(size_t size)
         JSHClass::Cast(thread_->GlobalConstants()->GetStringClass().GetTaggedObject()), size));
 }
 
+EcmaString *ObjectFactory::AllocTreeStringObject()
+{
+    NewObjectHook();
+    return reinterpret_cast<EcmaString *>(heap_->AllocateYoungOrHugeObject(
+        JSHClass::Cast(thread_->GlobalConstants()->GetTreeStringClass().GetTaggedObject()), TreeEcmaString::SIZE));
+}
+
 JSHandle<JSNativePointer> ObjectFactory::NewJSNativePointer(void *externalPointer,
                                                             const DeleteEntryPoint &callBack,
                                                             void *data,
@@ -677,6 +677,7 @@ private:
     inline EcmaString *AllocStringObject(size_t size);
     inline EcmaString *AllocOldSpaceStringObject(size_t size);
     inline EcmaString *AllocNonMovableStringObject(size_t size);
+    inline EcmaString *AllocTreeStringObject();
     JSHandle<TaggedArray> NewEmptyArray();  // only used for EcmaVM.
 
     JSHandle<JSHClass> CreateJSArguments();
@@ -460,7 +460,7 @@ JSTaggedValue ObjectFastOperator::FastParseDate(const EcmaString *str)
     CVector<uint8_t> tmpBuf;
     EcmaStringAccessor strAccessor(const_cast<EcmaString *>(str));
     int len = static_cast<int>(strAccessor.GetLength());
-    auto data = reinterpret_cast<const char *>(strAccessor.GetDataUtf8());
+    auto data = reinterpret_cast<const char *>(strAccessor.ToUtf8Span(tmpBuf).data());
     if (!GetNumFromString(data, len, &index, &year)) {
         return JSTaggedValue::Hole();
     }
@@ -15,10 +15,123 @@
 
 #include "ecmascript/pgo_profiler/pgo_profiler.h"
 
+#include "ecmascript/global_env.h"
+#include "ecmascript/ic/profile_type_info.h"
+#include "ecmascript/interpreter/interpreter.h"
 #include "ecmascript/js_function.h"
 #include "ecmascript/pgo_profiler/pgo_profiler_manager.h"
+#include "ecmascript/tagged_array-inl.h"
 
 namespace panda::ecmascript {
+namespace {
+// The ic slot of a property access bytecode, or false for other bytecodes.
+bool GetPropertyICSlot(const BytecodeInstruction &bcIns, uint16_t &slotId)
+{
+    using Format = BytecodeInstruction::Format;
+    switch (bcIns.GetOpcode()) {
+        case EcmaOpcode::LDOBJBYNAME_IMM8_ID16:
+        case EcmaOpcode::LDTHISBYNAME_IMM8_ID16:
+        case EcmaOpcode::STTHISBYNAME_IMM8_ID16:
+            slotId = static_cast<uint8_t>(bcIns.GetImm<Format::IMM8_ID16>());
+            return true;
+        case EcmaOpcode::STOBJBYNAME_IMM8_ID16_V8:
+            slotId = static_cast<uint8_t>(bcIns.GetImm<Format::IMM8_ID16_V8>());
+            return true;
+        case EcmaOpcode::LDOBJBYVALUE_IMM8_V8:
+        case EcmaOpcode::STTHISBYVALUE_IMM8_V8:
+            slotId = static_cast<uint8_t>(bcIns.GetImm<Format::IMM8_V8>());
+            return true;
+        case EcmaOpcode::LDTHISBYVALUE_IMM8:
+            slotId = static_cast<uint8_t>(bcIns.GetImm<Format::IMM8>());
+            return true;
+        case EcmaOpcode::STOBJBYVALUE_IMM8_V8_V8:
+            slotId = static_cast<uint8_t>(bcIns.GetImm<Format::IMM8_V8_V8>());
+            return true;
+        case EcmaOpcode::LDOBJBYNAME_IMM16_ID16:
+        case EcmaOpcode::LDTHISBYNAME_IMM16_ID16:
+        case EcmaOpcode::STTHISBYNAME_IMM16_ID16:
+            slotId = static_cast<uint16_t>(bcIns.GetImm<Format::IMM16_ID16>());
+            return true;
+        case EcmaOpcode::STOBJBYNAME_IMM16_ID16_V8:
+            slotId = static_cast<uint16_t>(bcIns.GetImm<Format::IMM16_ID16_V8>());
+            return true;
+        case EcmaOpcode::LDOBJBYVALUE_IMM16_V8:
+        case EcmaOpcode::STTHISBYVALUE_IMM16_V8:
+            slotId = static_cast<uint16_t>(bcIns.GetImm<Format::IMM16_V8>());
+            return true;
+        case EcmaOpcode::LDTHISBYVALUE_IMM16:
+            slotId = static_cast<uint16_t>(bcIns.GetImm<Format::IMM16>());
+            return true;
+        case EcmaOpcode::STOBJBYVALUE_IMM16_V8_V8:
+            slotId = static_cast<uint16_t>(bcIns.GetImm<Format::IMM16_V8_V8>());
+            return true;
+        default:
+            return false;
+    }
+}
+
+PGOObjectKind GetObjectKind(JSTaggedValue hclassValue, JSTaggedValue initialArrayHClass)
+{
+    if (hclassValue == initialArrayHClass) {
+        return PGOObjectKind::INITIAL_ARRAY;
+    }
+    auto hclass = JSHClass::Cast(hclassValue.GetTaggedObject());
+    if (hclass->IsJSArray()) {
+        return PGOObjectKind::ARRAY;
+    }
+    if (hclass->IsTypedArray()) {
+        return PGOObjectKind::TYPED_ARRAY;
+    }
+    if (hclass->IsJSObject()) {
+        return PGOObjectKind::OBJECT;
+    }
+    return PGOObjectKind::OTHER;
+}
+
+// Named ics and element ics keep a weak hclass with its handler in the slot, or an array of such pairs with a hole
+// in the next slot once polymorphic, and holes in both slots once megamorphic. Uninitialized slots and value ics
+// keyed by a property name are skipped.
+bool ReadSite(ProfileTypeInfo *profileTypeInfo, uint16_t slotId, JSTaggedValue initialArrayHClass,
+              PGOSiteInfo &site)
+{
+    if (static_cast<uint32_t>(slotId) + 1 >= profileTypeInfo->GetLength()) {
+        return false;
+    }
+    JSTaggedValue first = profileTypeInfo->Get(slotId);
+    JSTaggedValue second = profileTypeInfo->Get(slotId + 1);
+    if (first.IsHole() && second.IsHole()) {
+        site = PGOSiteInfo(slotId, PGOSiteInfo::MEGA_HCLASS_NUM, 0);
+        return true;
+    }
+    if (first.IsWeak()) {
+        JSTaggedValue hclass(first.GetWeakReferent());
+        site = PGOSiteInfo(slotId, 1, static_cast<uint8_t>(GetObjectKind(hclass, initialArrayHClass)));
+        return true;
+    }
+    if (!first.IsTaggedArray() || !second.IsHole()) {
+        return false;
+    }
+    TaggedArray *cases = TaggedArray::Cast(first.GetTaggedObject());
+    uint8_t hclassNum = 0;
+    uint8_t kinds = 0;
+    const uint32_t step = 2;
+    for (uint32_t i = 0; i < cases->GetLength(); i += step) {
+        JSTaggedValue weakHClass = cases->Get(i);
+        if (!weakHClass.IsWeak()) {
+            continue;
+        }
+        JSTaggedValue hclass(weakHClass.GetWeakReferent());
+        hclassNum++;
+        kinds |= static_cast<uint8_t>(GetObjectKind(hclass, initialArrayHClass));
+    }
+    if (hclassNum == 0) {
+        return false;
+    }
+    site = PGOSiteInfo(slotId, hclassNum, kinds);
+    return true;
+}
+}  // namespace
+
 void PGOProfiler::Sample(JSTaggedType value, SampleMode mode)
 {
     if (!isEnable_) {
@@ -36,6 +149,10 @@ void PGOProfiler::Sample(JSTaggedType value, SampleMode mode)
         if (recordInfos_->AddMethod(recordName, jsMethod->GetMethodId(), jsMethod->GetMethodName(), mode)) {
             methodCount_++;
         }
+        uint32_t count = recordInfos_->GetMethodCount(recordName, jsMethod->GetMethodId());
+        if (count >= PROFILE_SITES_MIN_COUNT && helpers::math::IsPowerOfTwo(count)) {
+            ProfileSites(recordName, jsMethod);
+        }
         // Merged every 10 methods
         if (methodCount_ >= MERGED_EVERY_COUNT) {
             LOG_ECMA(DEBUG) << "Sample: post task to save profiler";
@@ -45,4 +162,29 @@ void PGOProfiler::Sample(JSTaggedType value, SampleMode mode)
         }
     }
 }
+
+void PGOProfiler::ProfileSites(const CString &recordName, Method *method)
+{
+    JSTaggedValue profileTypeInfoValue = method->GetProfileTypeInfo();
+    if (!profileTypeInfoValue.IsTaggedArray()) {
+        return;
+    }
+    auto profileTypeInfo = ProfileTypeInfo::Cast(profileTypeInfoValue.GetTaggedObject());
+    JSTaggedValue arrayFunction = vm_->GetGlobalEnv()->GetArrayFunction().GetTaggedValue();
+    JSTaggedValue initialArrayHClass = JSFunction::Cast(arrayFunction.GetTaggedObject())->GetProtoOrHClass();
+
+    PGOMethodSiteInfos siteInfos;
+    const uint8_t *start = method->GetBytecodeArray();
+    const uint8_t *end = start + method->GetCodeSize();
+    for (BytecodeInstruction bcIns(start); bcIns.GetAddress() < end; bcIns = bcIns.GetNext()) {
+        uint16_t slotId = 0;
+        PGOSiteInfo site;
+        if (GetPropertyICSlot(bcIns, slotId) && ReadSite(profileTypeInfo, slotId, initialArrayHClass, site)) {
+            siteInfos.AddSite(site);
+        }
+    }
+    if (!siteInfos.Empty()) {
+        recordInfos_->AddSites(recordName, method->GetMethodId(), siteInfos);
+    }
+}
 } // namespace panda::ecmascript
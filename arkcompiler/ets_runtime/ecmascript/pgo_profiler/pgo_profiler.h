@@ -30,8 +30,10 @@ public:
     void Sample(JSTaggedType value, SampleMode mode = SampleMode::CALL_MODE);
 private:
     static constexpr uint32_t MERGED_EVERY_COUNT = 10;
+    // the inline caches of a method are read again each time its sample count doubles from here
+    static constexpr uint32_t PROFILE_SITES_MIN_COUNT = 2;
 
-    PGOProfiler([[maybe_unused]] EcmaVM *vm, bool isEnable) : isEnable_(isEnable)
+    PGOProfiler(EcmaVM *vm, bool isEnable) : vm_(vm), isEnable_(isEnable)
     {
         if (isEnable_) {
             recordInfos_ = std::make_unique<PGORecordDetailInfos>(0);
@@ -56,6 +58,10 @@ private:
         }
     }
 
+    // Records the receiver kinds seen by the inline caches of the property access bytecodes of the method.
+    void ProfileSites(const CString &recordName, Method *method);
+
+    EcmaVM *vm_ {nullptr};
     bool isEnable_ {false};
     uint32_t methodCount_ {0};
     std::unique_ptr<PGORecordDetailInfos> recordInfos_;
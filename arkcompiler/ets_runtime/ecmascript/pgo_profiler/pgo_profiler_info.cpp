@@ -24,6 +24,8 @@ static const std::string BLOCK_SEPARATOR = ",";
 static const std::string BLOCK_START = ":";
 static const std::string ARRAY_START = "[";
 static const std::string ARRAY_END = "]";
+static const std::string SITE_SEPARATOR = ";";
+static const std::string SITE_ELEMENT_SEPARATOR = "-";
 static const std::string NEW_LINE = "\n";
 static const std::string SPACE = " ";
 static const std::string BLOCK_AND_ARRAY_START = BLOCK_START + SPACE + ARRAY_START + SPACE;
@@ -171,6 +173,112 @@ void PGOMethodInfo::ProcessToText(std::string &text) const
     text += GetMethodName();
 }
 
+void PGOSiteInfo::ProcessToText(std::string &text) const
+{
+    text += std::to_string(slotId_);
+    text += SITE_ELEMENT_SEPARATOR;
+    text += std::to_string(hclassNum_);
+    text += SITE_ELEMENT_SEPARATOR;
+    text += std::to_string(kinds_);
+}
+
+bool PGOSiteInfo::ParseFromText(const std::string &infoString)
+{
+    constexpr size_t SITE_ELEMENT_COUNT = 3;
+    std::vector<std::string> elements = base::StringHelper::SplitString(infoString, SITE_ELEMENT_SEPARATOR);
+    if (elements.size() != SITE_ELEMENT_COUNT) {
+        return false;
+    }
+    uint32_t values[SITE_ELEMENT_COUNT];
+    for (size_t i = 0; i < SITE_ELEMENT_COUNT; i++) {
+        if (!base::StringHelper::StrToUInt32(elements[i].c_str(), &values[i])) {
+            return false;
+        }
+    }
+    slotId_ = static_cast<uint16_t>(values[0]);
+    hclassNum_ = static_cast<uint8_t>(values[1]);
+    kinds_ = static_cast<uint8_t>(values[2]);  // 2: kinds
+    return true;
+}
+
+void PGOMethodSiteInfos::AddSite(const PGOSiteInfo &site)
+{
+    auto result = sites_.emplace(site.GetSlotId(), site);
+    if (!result.second) {
+        result.first->second.Merge(site);
+    }
+}
+
+void PGOMethodSiteInfos::Merge(const PGOMethodSiteInfos &siteInfos)
+{
+    for (auto &iter : siteInfos.sites_) {
+        AddSite(iter.second);
+    }
+}
+
+const PGOSiteInfo *PGOMethodSiteInfos::GetSite(uint16_t slotId) const
+{
+    auto iter = sites_.find(slotId);
+    if (iter == sites_.end()) {
+        return nullptr;
+    }
+    return &iter->second;
+}
+
+EntityId PGOMethodSiteInfos::ParseFromBinary(void **buffer)
+{
+    EntityId methodId(*reinterpret_cast<uint32_t *>(*buffer));
+    *buffer = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(*buffer) + sizeof(uint32_t));
+    SectionInfo secInfo = base::ReadBuffer<SectionInfo>(buffer);
+    auto sites = reinterpret_cast<PGOSiteInfo *>(*buffer);
+    for (uint32_t i = 0; i < secInfo.number_; i++) {
+        AddSite(sites[i]);
+    }
+    *buffer = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(*buffer) + secInfo.size_);
+    return methodId;
+}
+
+void PGOMethodSiteInfos::ProcessToBinary(EntityId methodId, std::stringstream &stream) const
+{
+    uint32_t id = methodId.GetOffset();
+    SectionInfo secInfo;
+    secInfo.offset_ = sizeof(SectionInfo);
+    secInfo.number_ = sites_.size();
+    secInfo.size_ = secInfo.number_ * sizeof(PGOSiteInfo);
+    stream.write(reinterpret_cast<char *>(&id), sizeof(uint32_t));
+    stream.write(reinterpret_cast<char *>(&secInfo), sizeof(SectionInfo));
+    for (auto &iter : sites_) {
+        stream.write(reinterpret_cast<const char *>(&iter.second), sizeof(PGOSiteInfo));
+    }
+}
+
+bool PGOMethodSiteInfos::ParseFromText(const std::string &content)
+{
+    std::vector<std::string> siteStrings = base::StringHelper::SplitString(content, SITE_SEPARATOR);
+    for (auto &siteString : siteStrings) {
+        PGOSiteInfo site;
+        if (!site.ParseFromText(siteString)) {
+            LOG_ECMA(ERROR) << "site info: " << siteString << " parse failed";
+            return false;
+        }
+        AddSite(site);
+    }
+    return true;
+}
+
+void PGOMethodSiteInfos::ProcessToText(std::string &text) const
+{
+    bool isFirst = true;
+    for (auto &iter : sites_) {
+        if (!isFirst) {
+            text += SITE_SEPARATOR;
+        } else {
+            isFirst = false;
+        }
+        iter.second.ProcessToText(text);
+    }
+}
+
 std::vector<std::string> PGOMethodInfo::ParseFromText(const std::string &infoString)
 {
     std::vector<std::string> infoStrings = base::StringHelper::SplitString(infoString, ELEMENT_SEPARATOR);
@@ -195,8 +303,27 @@ bool PGOMethodInfoMap::AddMethod(Chunk *chunk, EntityId methodId, const CString
     }
 }
 
+void PGOMethodInfoMap::AddSites(EntityId methodId, const PGOMethodSiteInfos &siteInfos)
+{
+    siteInfos_[methodId].Merge(siteInfos);
+}
+
+uint32_t PGOMethodInfoMap::GetMethodCount(EntityId methodId) const
+{
+    auto result = methodInfos_.find(methodId);
+    if (result == methodInfos_.end()) {
+        return 0;
+    }
+    return result->second->GetCount();
+}
+
 void PGOMethodInfoMap::Merge(Chunk *chunk, PGOMethodInfoMap *methodInfos)
 {
+    for (auto &iter : methodInfos->siteInfos_) {
+        siteInfos_[iter.first].Merge(iter.second);
+    }
+    methodInfos->siteInfos_.clear();
+
     for (auto iter = methodInfos->methodInfos_.begin(); iter != methodInfos->methodInfos_.end(); iter++) {
         auto methodId = iter->first;
         auto fromMethodInfo = iter->second;
@@ -263,6 +390,44 @@ bool PGOMethodInfoMap::ProcessToBinary(uint32_t threshold, const CString &record
     return false;
 }
 
+void PGOMethodInfoMap::ParseSitesFromBinary(void **buffer)
+{
+    SectionInfo secInfo = base::ReadBuffer<SectionInfo>(buffer);
+    for (uint32_t j = 0; j < secInfo.number_; j++) {
+        PGOMethodSiteInfos siteInfos;
+        EntityId methodId = siteInfos.ParseFromBinary(buffer);
+        siteInfos_[methodId].Merge(siteInfos);
+    }
+}
+
+bool PGOMethodInfoMap::ProcessSitesToBinary(uint32_t threshold, const CString &recordName,
+    const SaveTask *task, std::ofstream &stream) const
+{
+    SectionInfo secInfo;
+    std::stringstream siteStream;
+    for (auto iter = siteInfos_.begin(); iter != siteInfos_.end(); iter++) {
+        if (task && task->IsTerminate()) {
+            LOG_ECMA(INFO) << "ProcessProfile: task is already terminate";
+            return false;
+        }
+        auto methodInfo = methodInfos_.find(iter->first);
+        if (methodInfo == methodInfos_.end() || methodInfo->second->IsFilter(threshold) || iter->second.Empty()) {
+            continue;
+        }
+        iter->second.ProcessToBinary(iter->first, siteStream);
+        secInfo.number_++;
+    }
+    if (secInfo.number_ > 0) {
+        secInfo.offset_ = sizeof(SectionInfo);
+        secInfo.size_ = static_cast<uint32_t>(siteStream.tellp());
+        stream << recordName << '\0';
+        stream.write(reinterpret_cast<char *>(&secInfo), sizeof(SectionInfo));
+        stream << siteStream.rdbuf();
+        return true;
+    }
+    return false;
+}
+
 bool PGOMethodInfoMap::ParseFromText(Chunk *chunk, uint32_t threshold, const std::vector<std::string> &content)
 {
     for (auto infoString : content) {
@@ -295,6 +460,13 @@ bool PGOMethodInfoMap::ParseFromText(Chunk *chunk, uint32_t threshold, const std
         void *infoAddr = chunk->Allocate(PGOMethodInfo::Size(len));
         auto info = new (infoAddr) PGOMethodInfo(EntityId(methodId), count, mode, methodName.c_str());
         methodInfos_.emplace(methodId, info);
+        if (infoStrings.size() > PGOMethodInfo::METHOD_SITES_INDEX) {
+            PGOMethodSiteInfos siteInfos;
+            if (!siteInfos.ParseFromText(infoStrings[PGOMethodInfo::METHOD_SITES_INDEX])) {
+                return false;
+            }
+            AddSites(EntityId(methodId), siteInfos);
+        }
     }
 
     return true;
@@ -318,6 +490,11 @@ void PGOMethodInfoMap::ProcessToText(uint32_t threshold, const CString &recordNa
             profilerString += BLOCK_SEPARATOR + SPACE;
         }
         methodInfo->ProcessToText(profilerString);
+        auto siteInfos = siteInfos_.find(methodInfoIter.first);
+        if (siteInfos != siteInfos_.end() && !siteInfos->second.Empty()) {
+            profilerString += ELEMENT_SEPARATOR;
+            siteInfos->second.ProcessToText(profilerString);
+        }
     }
     if (!isFirst) {
         profilerString += (SPACE + ARRAY_END + NEW_LINE);
@@ -341,6 +518,18 @@ bool PGOMethodIdSet::ParseFromBinary(uint32_t threshold, void **buffer)
     return methodIdSet_.size() != 0;
 }
 
+void PGOMethodIdSet::ParseSitesFromBinary(void **buffer)
+{
+    SectionInfo secInfo = base::ReadBuffer<SectionInfo>(buffer);
+    for (uint32_t j = 0; j < secInfo.number_; j++) {
+        PGOMethodSiteInfos siteInfos;
+        EntityId methodId = siteInfos.ParseFromBinary(buffer);
+        if (Match(methodId)) {
+            siteInfos_[methodId].Merge(siteInfos);
+        }
+    }
+}
+
 bool PGORecordDetailInfos::AddMethod(const CString &recordName, EntityId methodId,
     const CString &methodName, SampleMode mode)
 {
@@ -355,6 +544,25 @@ bool PGORecordDetailInfos::AddMethod(const CString &recordName, EntityId methodI
     return curMethodInfos->AddMethod(chunk_.get(), methodId, methodName, mode);
 }
 
+void PGORecordDetailInfos::AddSites(const CString &recordName, EntityId methodId,
+    const PGOMethodSiteInfos &siteInfos)
+{
+    auto iter = recordInfos_.find(recordName);
+    if (iter == recordInfos_.end()) {
+        return;
+    }
+    iter->second->AddSites(methodId, siteInfos);
+}
+
+uint32_t PGORecordDetailInfos::GetMethodCount(const CString &recordName, EntityId methodId) const
+{
+    auto iter = recordInfos_.find(recordName);
+    if (iter == recordInfos_.end()) {
+        return 0;
+    }
+    return iter->second->GetMethodCount(methodId);
+}
+
 void PGORecordDetailInfos::Merge(const PGORecordDetailInfos &recordInfos)
 {
     for (auto iter = recordInfos.recordInfos_.begin(); iter != recordInfos.recordInfos_.end(); iter++) {
@@ -400,6 +608,37 @@ void PGORecordDetailInfos::ProcessToBinary(const SaveTask *task, std::ofstream &
     info->size_ = static_cast<uint32_t>(fileStream.tellp()) - info->offset_;
 }
 
+void PGORecordDetailInfos::ParseSitesFromBinary(void *buffer, SectionInfo *const info)
+{
+    void *addr = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(buffer) + info->offset_);
+    for (uint32_t i = 0; i < info->number_; i++) {
+        auto recordName = base::ReadBuffer(&addr);
+        auto iter = recordInfos_.find(recordName);
+        if (iter != recordInfos_.end()) {
+            iter->second->ParseSitesFromBinary(&addr);
+        } else {
+            // skip the sites of a record whose methods are all filtered
+            PGOMethodInfoMap methodInfos;
+            methodInfos.ParseSitesFromBinary(&addr);
+        }
+    }
+}
+
+void PGORecordDetailInfos::ProcessSitesToBinary(const SaveTask *task, std::ofstream &fileStream,
+    SectionInfo *info) const
+{
+    info->number_ = 0;
+    info->offset_ = static_cast<uint32_t>(fileStream.tellp());
+    for (auto iter = recordInfos_.begin(); iter != recordInfos_.end(); iter++) {
+        auto recordName = iter->first;
+        auto curMethodInfos = iter->second;
+        if (curMethodInfos->ProcessSitesToBinary(hotnessThreshold_, recordName, task, fileStream)) {
+            info->number_++;
+        }
+    }
+    info->size_ = static_cast<uint32_t>(fileStream.tellp()) - info->offset_;
+}
+
 bool PGORecordDetailInfos::ParseFromText(std::ifstream &stream)
 {
     std::string details;
@@ -468,4 +707,28 @@ void PGORecordSimpleInfos::ParseFromBinary(void *buffer, SectionInfo *const info
         }
     }
 }
+
+const PGOSiteInfo *PGORecordSimpleInfos::GetSite(const CString &recordName, EntityId methodId, uint16_t slotId) const
+{
+    auto methodIdsIter = methodIds_.find(recordName);
+    if (methodIdsIter == methodIds_.end()) {
+        return nullptr;
+    }
+    return methodIdsIter->second->GetSite(methodId, slotId);
+}
+
+void PGORecordSimpleInfos::ParseSitesFromBinary(void *buffer, SectionInfo *const info)
+{
+    void *addr = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(buffer) + info->offset_);
+    for (uint32_t i = 0; i < info->number_; i++) {
+        auto recordName = base::ReadBuffer(&addr);
+        auto methodIdsIter = methodIds_.find(recordName);
+        if (methodIdsIter != methodIds_.end()) {
+            methodIdsIter->second->ParseSitesFromBinary(&addr);
+        } else {
+            PGOMethodIdSet methodIds;
+            methodIds.ParseSitesFromBinary(&addr);
+        }
+    }
+}
 } // namespace panda::ecmascript
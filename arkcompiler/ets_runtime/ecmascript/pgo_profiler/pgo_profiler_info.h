@@ -16,6 +16,10 @@
 #ifndef ECMASCRIPT_PGO_PROFILER_INFO_H
 #define ECMASCRIPT_PGO_PROFILER_INFO_H
 
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string.h>
@@ -54,6 +58,10 @@ static constexpr size_t ALIGN_SIZE = 4;
  * |------------offset
  * |------------size (reserve)
  * |------------number
+ * |--------TYPE_INFO_SECTION_INFO (since version 0.0.0.2)
+ * |------------offset
+ * |------------size (reserve)
+ * |------------number
  * |----PGOPandaFileInfos
  * |--------SIZE
  * |--------CHECK_SUM
@@ -71,13 +79,23 @@ static constexpr size_t ALIGN_SIZE = 4;
  * |--------PGOMethodIdSet
  * |------------id
  * |------------...
+ * |----PGORecordTypeInfos
+ * |--------PGOMethodSiteInfos
+ * |------------id
+ * |------------siteNumber
+ * |------------PGOSiteInfo
+ * |----------------slotId
+ * |----------------hclassNumber
+ * |----------------kinds
+ * |----------------...
  */
 class PGOProfilerHeader : public base::FileHeader {
 public:
-    static constexpr VersionType LAST_VERSION = {0, 0, 0, 1};
-    static constexpr size_t SECTION_SIZE = 2;
+    static constexpr VersionType LAST_VERSION = {0, 0, 0, 2};
+    static constexpr size_t SECTION_SIZE = 3;
     static constexpr size_t PANDA_FILE_SECTION_INDEX = 0;
     static constexpr size_t RECORD_INFO_SECTION_INDEX = 1;
+    static constexpr size_t TYPE_INFO_SECTION_INDEX = 2;
 
     PGOProfilerHeader() : base::FileHeader(LAST_VERSION), sectionNumber_(SECTION_SIZE)
     {
@@ -130,13 +148,19 @@ public:
         return GetSectionInfo(RECORD_INFO_SECTION_INDEX);
     }
 
+    // nullptr for files of version 0.0.0.1, which have no type info
+    SectionInfo *GetTypeInfoSection() const
+    {
+        return GetSectionInfo(TYPE_INFO_SECTION_INDEX);
+    }
+
     NO_COPY_SEMANTIC(PGOProfilerHeader);
     NO_MOVE_SEMANTIC(PGOProfilerHeader);
 
 private:
     SectionInfo *GetSectionInfo(size_t index) const
     {
-        if (index >= SECTION_SIZE) {
+        if (index >= sectionNumber_) {
             return nullptr;
         }
         return const_cast<SectionInfo *>(&sectionInfos_) + index;
@@ -207,6 +231,8 @@ public:
     static constexpr int METHOD_COUNT_INDEX = 1;
     static constexpr int METHOD_MODE_INDEX = 2;
     static constexpr int METHOD_NAME_INDEX = 3;
+    // optional, only written for methods with inline cache feedback
+    static constexpr int METHOD_SITES_INDEX = 4;
 
     PGOMethodInfo(EntityId id) : id_(id) {}
 
@@ -333,6 +359,101 @@ private:
     char methodName_;
 };
 
+// Kinds of the receivers an inline cache has seen. They are bits, so the kinds of a polymorphic site can be merged.
+enum class PGOObjectKind : uint8_t {
+    OBJECT = 1U << 0,
+    // JSArray with the initial hclass of the Array function, the one ArrayCheck and StableArrayCheck accept
+    INITIAL_ARRAY = 1U << 1,
+    ARRAY = 1U << 2,
+    TYPED_ARRAY = 1U << 3,
+    OTHER = 1U << 4,
+};
+
+// Inline cache feedback of one property access bytecode, identified by its ic slot id.
+class PGOSiteInfo {
+public:
+    static constexpr uint8_t MEGA_HCLASS_NUM = std::numeric_limits<uint8_t>::max();
+
+    PGOSiteInfo() = default;
+    PGOSiteInfo(uint16_t slotId, uint8_t hclassNum, uint8_t kinds)
+        : slotId_(slotId), hclassNum_(hclassNum), kinds_(kinds) {}
+
+    uint16_t GetSlotId() const
+    {
+        return slotId_;
+    }
+
+    uint8_t GetHClassNum() const
+    {
+        return hclassNum_;
+    }
+
+    uint8_t GetKinds() const
+    {
+        return kinds_;
+    }
+
+    bool IsMegamorphic() const
+    {
+        return hclassNum_ == MEGA_HCLASS_NUM;
+    }
+
+    // Every receiver seen at the site has the given kind.
+    bool IsOnlyKind(PGOObjectKind kind) const
+    {
+        return !IsMegamorphic() && kinds_ == static_cast<uint8_t>(kind);
+    }
+
+    void Merge(const PGOSiteInfo &info)
+    {
+        kinds_ |= info.GetKinds();
+        if (IsMegamorphic() || info.IsMegamorphic()) {
+            hclassNum_ = MEGA_HCLASS_NUM;
+        } else {
+            // receivers of different kinds never share an hclass
+            uint8_t kindNum = static_cast<uint8_t>(std::bitset<sizeof(kinds_) * CHAR_BIT>(kinds_).count());
+            hclassNum_ = std::max({hclassNum_, info.GetHClassNum(), kindNum});
+        }
+    }
+
+    void ProcessToText(std::string &text) const;
+    bool ParseFromText(const std::string &infoString);
+
+private:
+    uint16_t slotId_ {0};
+    uint8_t hclassNum_ {0};
+    uint8_t kinds_ {0};
+};
+
+class PGOMethodSiteInfos {
+public:
+    PGOMethodSiteInfos() = default;
+
+    bool Empty() const
+    {
+        return sites_.empty();
+    }
+
+    void Clear()
+    {
+        sites_.clear();
+    }
+
+    void AddSite(const PGOSiteInfo &site);
+    void Merge(const PGOMethodSiteInfos &siteInfos);
+    const PGOSiteInfo *GetSite(uint16_t slotId) const;
+
+    // returns the id of the method the sites belong to
+    EntityId ParseFromBinary(void **buffer);
+    void ProcessToBinary(EntityId methodId, std::stringstream &stream) const;
+
+    bool ParseFromText(const std::string &content);
+    void ProcessToText(std::string &text) const;
+
+private:
+    CMap<uint16_t, PGOSiteInfo> sites_;
+};
+
 class PGOMethodInfoMap {
 public:
     PGOMethodInfoMap() = default;
@@ -341,15 +462,22 @@ public:
     {
         // PGOMethodInfo release by chunk
         methodInfos_.clear();
+        siteInfos_.clear();
     }
 
     bool AddMethod(Chunk *chunk, EntityId methodId, const CString &methodName, SampleMode mode);
+    void AddSites(EntityId methodId, const PGOMethodSiteInfos &siteInfos);
+    uint32_t GetMethodCount(EntityId methodId) const;
     void Merge(Chunk *chunk, PGOMethodInfoMap *methodInfos);
 
     bool ParseFromBinary(uint32_t threshold, void **buffer);
     bool ProcessToBinary(uint32_t threshold, const CString &recordName, const SaveTask *task,
         std::ofstream &fileStream) const;
 
+    void ParseSitesFromBinary(void **buffer);
+    bool ProcessSitesToBinary(uint32_t threshold, const CString &recordName, const SaveTask *task,
+        std::ofstream &fileStream) const;
+
     bool ParseFromText(Chunk *chunk, uint32_t threshold, const std::vector<std::string> &content);
     void ProcessToText(uint32_t threshold, const CString &recordName, std::ofstream &stream) const;
 
@@ -358,6 +486,7 @@ public:
 
 private:
     CMap<EntityId, PGOMethodInfo *> methodInfos_;
+    CMap<EntityId, PGOMethodSiteInfos> siteInfos_;
 };
 
 class PGOMethodIdSet {
@@ -380,12 +509,23 @@ public:
         return false;
     }
 
+    const PGOSiteInfo *GetSite(EntityId methodId, uint16_t slotId) const
+    {
+        auto iter = siteInfos_.find(methodId);
+        if (iter == siteInfos_.end()) {
+            return nullptr;
+        }
+        return iter->second.GetSite(slotId);
+    }
+
     bool ParseFromBinary(uint32_t threshold, void **buffer);
+    void ParseSitesFromBinary(void **buffer);
 
     NO_COPY_SEMANTIC(PGOMethodIdSet);
     NO_MOVE_SEMANTIC(PGOMethodIdSet);
 private:
     std::unordered_set<EntityId> methodIdSet_;
+    CMap<EntityId, PGOMethodSiteInfos> siteInfos_;
 };
 
 class PGORecordDetailInfos {
@@ -412,11 +552,17 @@ public:
 
     // If it is a new method, return true.
     bool AddMethod(const CString &recordName, EntityId methodId, const CString &methodName, SampleMode mode);
+    // The method must have been added.
+    void AddSites(const CString &recordName, EntityId methodId, const PGOMethodSiteInfos &siteInfos);
+    uint32_t GetMethodCount(const CString &recordName, EntityId methodId) const;
     void Merge(const PGORecordDetailInfos &recordInfos);
 
     void ParseFromBinary(void *buffer, SectionInfo *const info);
     void ProcessToBinary(const SaveTask *task, std::ofstream &fileStream, SectionInfo *info) const;
 
+    void ParseSitesFromBinary(void *buffer, SectionInfo *const info);
+    void ProcessSitesToBinary(const SaveTask *task, std::ofstream &fileStream, SectionInfo *info) const;
+
     bool ParseFromText(std::ifstream &stream);
     void ProcessToText(std::ofstream &stream) const;
 
@@ -446,6 +592,7 @@ public:
     }
 
     bool Match(const CString &recordName, EntityId methodId);
+    const PGOSiteInfo *GetSite(const CString &recordName, EntityId methodId, uint16_t slotId) const;
     template <typename Callback>
     void Update(Callback callback)
     {
@@ -473,6 +620,8 @@ public:
     }
 
     void ParseFromBinary(void *buffer, SectionInfo *const info);
+    // Only keeps the sites of the records and methods parsed by ParseFromBinary.
+    void ParseSitesFromBinary(void *buffer, SectionInfo *const info);
 
     NO_COPY_SEMANTIC(PGORecordSimpleInfos);
     NO_MOVE_SEMANTIC(PGORecordSimpleInfos);
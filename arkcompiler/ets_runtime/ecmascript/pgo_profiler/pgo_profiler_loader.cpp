@@ -40,6 +40,9 @@ bool PGOProfilerLoader::Load()
         recordSimpleInfos_ = std::make_unique<PGORecordSimpleInfos>(hotnessThreshold_);
     }
     recordSimpleInfos_->ParseFromBinary(addr, header_->GetRecordInfoSection());
+    if (header_->GetTypeInfoSection() != nullptr) {
+        recordSimpleInfos_->ParseSitesFromBinary(addr, header_->GetTypeInfoSection());
+    }
     UnLoadAPBinaryFile();
 
     isLoaded_ = true;
@@ -89,6 +92,9 @@ bool PGOProfilerLoader::LoadFull()
         recordDetailInfos_ = std::make_unique<PGORecordDetailInfos>(hotnessThreshold_);
     }
     recordDetailInfos_->ParseFromBinary(addr, header_->GetRecordInfoSection());
+    if (header_->GetTypeInfoSection() != nullptr) {
+        recordDetailInfos_->ParseSitesFromBinary(addr, header_->GetTypeInfoSection());
+    }
 
     isLoaded_ = true;
     return true;
@@ -164,6 +170,15 @@ void PGOProfilerLoader::Clear()
     }
 }
 
+const PGOSiteInfo *PGOProfilerLoader::GetSiteInfo(const CString &recordName, EntityId methodId,
+    uint16_t slotId) const
+{
+    if (!isLoaded_ || !isVerifySuccess_) {
+        return nullptr;
+    }
+    return recordSimpleInfos_->GetSite(recordName, methodId, slotId);
+}
+
 bool PGOProfilerLoader::Match(const CString &recordName, EntityId methodId)
 {
     if (!isLoaded_) {
@@ -32,6 +32,8 @@ public:
     NO_MOVE_SEMANTIC(PGOProfilerLoader);
 
     bool PUBLIC_API Match(const CString &recordName, EntityId methodId);
+    // Inline cache feedback of the bytecode with the given ic slot, nullptr if it was not profiled.
+    const PGOSiteInfo* PUBLIC_API GetSiteInfo(const CString &recordName, EntityId methodId, uint16_t slotId) const;
 
     bool PUBLIC_API LoadAndVerify(uint32_t checksum);
     bool PUBLIC_API LoadFull();
@@ -82,6 +82,7 @@ void PGOProfilerSaver::SaveProfiler(const SaveTask *task)
     }
     pandaFileInfos_->ProcessToBinary(fileStream, header_->GetPandaInfoSection());
     globalRecordInfos_->ProcessToBinary(task, fileStream, header_->GetRecordInfoSection());
+    globalRecordInfos_->ProcessSitesToBinary(task, fileStream, header_->GetTypeInfoSection());
     header_->ProcessToBinary(fileStream);
     fileStream.close();
 }
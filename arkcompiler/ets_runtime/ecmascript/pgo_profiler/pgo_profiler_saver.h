@@ -77,6 +77,11 @@ public:
         return TaskType::PGO_SAVE_TASK;
     }
 
+    TaskPriority GetPriority() const override
+    {
+        return TaskPriority::LOW;
+    }
+
     NO_COPY_SEMANTIC(SaveTask);
     NO_MOVE_SEMANTIC(SaveTask);
 private:
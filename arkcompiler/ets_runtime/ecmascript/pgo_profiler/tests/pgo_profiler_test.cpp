@@ -482,6 +482,61 @@ HWTEST_F_L0(PGOProfilerTest, TextRecover)
     rmdir("ark-profiler11");
 }
 
+HWTEST_F_L0(PGOProfilerTest, SiteInfos)
+{
+    mkdir("ark-profiler13/", S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+    std::ofstream file("ark-profiler13/modules.ap");
+
+    PGOProfilerHeader *header = nullptr;
+    PGOProfilerHeader::Build(&header, PGOProfilerHeader::LastSize());
+    std::unique_ptr<PGOPandaFileInfos> pandaFileInfos = std::make_unique<PGOPandaFileInfos>();
+    std::unique_ptr<PGORecordDetailInfos> recordInfos = std::make_unique<PGORecordDetailInfos>(2);
+    pandaFileInfos->Sample(0x34556738);
+    for (int i = 0; i < 3; i++) {
+        recordInfos->AddMethod("test", EntityId(23), "test", SampleMode::CALL_MODE);
+    }
+    PGOMethodSiteInfos siteInfos;
+    siteInfos.AddSite(PGOSiteInfo(1, 1, static_cast<uint8_t>(PGOObjectKind::INITIAL_ARRAY)));
+    siteInfos.AddSite(PGOSiteInfo(3, 1, static_cast<uint8_t>(PGOObjectKind::OBJECT)));
+    siteInfos.AddSite(PGOSiteInfo(3, 1, static_cast<uint8_t>(PGOObjectKind::ARRAY)));
+    siteInfos.AddSite(PGOSiteInfo(5, PGOSiteInfo::MEGA_HCLASS_NUM, 0));
+    recordInfos->AddSites("test", EntityId(23), siteInfos);
+
+    pandaFileInfos->ProcessToBinary(file, header->GetPandaInfoSection());
+    recordInfos->ProcessToBinary(nullptr, file, header->GetRecordInfoSection());
+    recordInfos->ProcessSitesToBinary(nullptr, file, header->GetTypeInfoSection());
+    header->ProcessToBinary(file);
+    file.close();
+    PGOProfilerHeader::Destroy(&header);
+
+    ASSERT_TRUE(PGOProfilerManager::GetInstance()->BinaryToText(
+        "ark-profiler13/modules.ap", "ark-profiler13/modules.text", 2));
+    unlink("ark-profiler13/modules.ap");
+    // the sites must survive the text format as well
+    ASSERT_TRUE(PGOProfilerManager::GetInstance()->TextToBinary("ark-profiler13/modules.text", "ark-profiler13/", 2));
+
+    PGOProfilerLoader loader("ark-profiler13/modules.ap", 2);
+    ASSERT_TRUE(loader.LoadAndVerify(0x34556738));
+    const PGOSiteInfo *site = loader.GetSiteInfo("test", EntityId(23), 1);
+    ASSERT_TRUE(site != nullptr);
+    EXPECT_TRUE(site->IsOnlyKind(PGOObjectKind::INITIAL_ARRAY));
+    site = loader.GetSiteInfo("test", EntityId(23), 3);
+    ASSERT_TRUE(site != nullptr);
+    EXPECT_EQ(site->GetHClassNum(), 2);
+    EXPECT_FALSE(site->IsOnlyKind(PGOObjectKind::OBJECT));
+    EXPECT_FALSE(site->IsOnlyKind(PGOObjectKind::ARRAY));
+    site = loader.GetSiteInfo("test", EntityId(23), 5);
+    ASSERT_TRUE(site != nullptr);
+    EXPECT_TRUE(site->IsMegamorphic());
+    EXPECT_TRUE(loader.GetSiteInfo("test", EntityId(23), 2) == nullptr);
+    EXPECT_TRUE(loader.GetSiteInfo("test", EntityId(24), 1) == nullptr);
+
+    unlink("ark-profiler13/modules.ap");
+    unlink("ark-profiler13/modules.text");
+    rmdir("ark-profiler13");
+}
+
 HWTEST_F_L0(PGOProfilerTest, FailResetProfilerInWorker)
 {
     mkdir("ark-profiler12/", S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
@@ -89,6 +89,10 @@ MemMap FileMap(const char *fileName, int flag, int prot, int64_t offset)
 
     void *addr = mmap(nullptr, size, prot, MAP_PRIVATE, fd, offset);
     close(fd);
+    if (addr == MAP_FAILED) {
+        LOG_ECMA(ERROR) << fileName << " file mmap failed";
+        return MemMap();
+    }
     return MemMap(addr, size);
 }
 
@@ -105,6 +105,9 @@ MemMap FileMap(const char *fileName, int flag, int prot, int64_t offset)
         return MemMap();
     }
     int accessor = (prot == PAGE_PROT_READ) ? FILE_MAP_READ : FILE_MAP_WRITE;
+    if (prot == PAGE_PROT_EXEC_READ) {
+        accessor = FILE_MAP_READ | FILE_MAP_EXECUTE;
+    }
     void *addr = MapViewOfFile(extra, accessor, offset >> 32, offset & 0xffffffff, size);
     CloseHandle(extra);
     CloseHandle(fd);
@@ -34,6 +34,7 @@ bool RegExpExecutor::Execute(const uint8_t *input, uint32_t lastIndex, uint32_t
     nStack_ = buffer.GetU32(RegExpParser::NUM_STACK_OFFSET);
     flags_ = buffer.GetU32(RegExpParser::FLAGS_OFFSET);
     isWideChar_ = isWideChar;
+    ReadPrefilter(buffer, size);
 
     uint32_t captureResultSize = sizeof(CaptureState) * nCapture_;
     uint32_t stackSize = sizeof(uintptr_t) * nStack_;
@@ -60,11 +61,109 @@ bool RegExpExecutor::Execute(const uint8_t *input, uint32_t lastIndex, uint32_t
 
     // first split
     if ((flags_ & RegExpParser::FLAG_STICKY) == 0) {
+        if (!SkipToMatchStart()) {
+            return false;
+        }
         PushRegExpState(STATE_SPLIT, RegExpParser::OP_START_OFFSET);
     }
     return ExecuteInternal(buffer, size);
 }
 
+void RegExpExecutor::ReadPrefilter(const DynChunk &byteCode, uint32_t prefilterPc)
+{
+    prefilterKind_ = static_cast<uint8_t>(byteCode.GetU8(prefilterPc));
+    if (prefilterKind_ == RegExpParser::PREFILTER_LITERAL) {
+        prefilterLiteralLength_ = byteCode.GetU16(prefilterPc + 1);
+        prefilterLiteral_ = chunk_->NewArray<uint16_t>(prefilterLiteralLength_);
+        uint32_t charPc = prefilterPc + 1 + sizeof(uint16_t);
+        for (uint32_t i = 0; i < prefilterLiteralLength_; i++) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            prefilterLiteral_[i] = static_cast<uint16_t>(byteCode.GetU16(charPc + i * sizeof(uint16_t)));
+        }
+    } else if (prefilterKind_ == RegExpParser::PREFILTER_FIRST_CHARS) {
+        prefilterHasWideChars_ = byteCode.GetU8(prefilterPc + 1) != 0;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        prefilterBitmap_ = byteCode.GetBegin() + prefilterPc + 2;  // 2: kind and has wide chars
+    }
+}
+
+// Moves to the first position from the current one where a match may start, returns false if there is none.
+bool RegExpExecutor::SkipToMatchStart()
+{
+    switch (prefilterKind_) {
+        case RegExpParser::PREFILTER_LITERAL:
+            return SkipToLiteral();
+        case RegExpParser::PREFILTER_FIRST_CHARS:
+            return SkipToFirstChar();
+        default:
+            return true;
+    }
+}
+
+bool RegExpExecutor::SkipToLiteral()
+{
+    const uint8_t *ptr = currentPtr_;
+    if (!isWideChar_) {
+        for (uint32_t i = 0; i < prefilterLiteralLength_; i++) {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (prefilterLiteral_[i] > UINT8_MAX) {
+                return false;
+            }
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto first = static_cast<uint8_t>(prefilterLiteral_[0]);
+        while (inputEnd_ - ptr >= static_cast<ptrdiff_t>(prefilterLiteralLength_)) {
+            size_t length = static_cast<size_t>(inputEnd_ - ptr) - prefilterLiteralLength_ + 1;
+            ptr = reinterpret_cast<const uint8_t *>(memchr(ptr, first, length));
+            if (ptr == nullptr) {
+                return false;
+            }
+            uint32_t i = 1;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            while (i < prefilterLiteralLength_ && ptr[i] == prefilterLiteral_[i]) {
+                i++;
+            }
+            if (i == prefilterLiteralLength_) {
+                currentPtr_ = ptr;
+                return true;
+            }
+            ptr++;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+        return false;
+    }
+    auto literalSize = static_cast<ptrdiff_t>(prefilterLiteralLength_ * WIDE_CHAR_SIZE);
+    while (inputEnd_ - ptr >= literalSize) {
+        auto chars = reinterpret_cast<const uint16_t *>(ptr);
+        uint32_t i = 0;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        while (i < prefilterLiteralLength_ && chars[i] == prefilterLiteral_[i]) {
+            i++;
+        }
+        if (i == prefilterLiteralLength_) {
+            currentPtr_ = ptr;
+            return true;
+        }
+        ptr += WIDE_CHAR_SIZE;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return false;
+}
+
+// the lead surrogate of a pair is above the bitmap, so a match is never started in the middle of a pair
+bool RegExpExecutor::SkipToFirstChar()
+{
+    const uint8_t *ptr = currentPtr_;
+    size_t charSize = isWideChar_ ? WIDE_CHAR_SIZE : CHAR_SIZE;
+    while (ptr < inputEnd_) {
+        uint32_t c = isWideChar_ ? *reinterpret_cast<const uint16_t *>(ptr) : *ptr;
+        if (IsFirstChar(c)) {
+            currentPtr_ = ptr;
+            return true;
+        }
+        ptr += charSize;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    return false;
+}
+
 bool RegExpExecutor::MatchFailed(bool isMatched)
 {
     while (true) {
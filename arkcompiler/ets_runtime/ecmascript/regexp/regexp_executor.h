@@ -72,6 +72,9 @@ public:
                 }
             } else {
                 AdvanceCurrentPtr();
+                if (!SkipToMatchStart()) {
+                    return false;
+                }
                 PushRegExpState(STATE_SPLIT, RegExpParser::OP_START_OFFSET);
             }
         }
@@ -589,6 +592,20 @@ public:
 
     bool MatchFailed(bool isMatched = false);
 
+    void ReadPrefilter(const DynChunk &byteCode, uint32_t prefilterPc);
+    bool SkipToMatchStart();
+    bool SkipToLiteral();
+    bool SkipToFirstChar();
+
+    inline bool IsFirstChar(uint32_t c) const
+    {
+        if (c >= RegExpParser::PREFILTER_BITMAP_CHARS) {
+            return prefilterHasWideChars_;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return (prefilterBitmap_[c / 8] & (1U << (c % 8))) != 0;  // 8: bits of a byte
+    }
+
     void SetCurrentPC(uint32_t pc)
     {
         currentPc_ = pc;
@@ -724,6 +741,11 @@ private:
     uint32_t stateStackSize_ = 0;
     uint32_t stateSize_ = 0;
     uint8_t *stateStack_ = nullptr;
+    uint8_t prefilterKind_ = RegExpParser::PREFILTER_NONE;
+    uint16_t *prefilterLiteral_ = nullptr;
+    uint32_t prefilterLiteralLength_ = 0;
+    const uint8_t *prefilterBitmap_ = nullptr;
+    bool prefilterHasWideChars_ = false;
     Chunk *chunk_ = nullptr;
 };
 }  // namespace panda::ecmascript
@@ -112,10 +112,12 @@ void RegExpOpCode::DumpRegExpOpCode(std::ostream &out, const DynChunk &buf)
 {
     out << "OpCode:\t" << std::endl;
     uint32_t pc = RegExpParser::OP_START_OFFSET;
+    // the prefilter after the byte code is not counted in its size
+    uint32_t pcEnd = buf.GetU32(0);
     do {
         RegExpOpCode *byteCode = GetRegExpOpCode(buf, pc);
         pc = byteCode->DumpOpCode(out, buf, pc);
-    } while (pc < buf.size_);
+    } while (pc < pcEnd);
 }
 
 uint32_t SaveStartOpCode::EmitOpCode(DynChunk *buf, uint32_t para) const
@@ -15,6 +15,8 @@
 
 #include "ecmascript/regexp/regexp_parser.h"
 
+#include <array>
+
 #include "ecmascript/base/string_helper.h"
 #include "ecmascript/ecma_macros.h"
 #include "ecmascript/regexp/regexp_opcode.h"
@@ -102,11 +104,157 @@ void RegExpParser::Parse()
     buffer_.PutU32(NUM_CAPTURE__OFFSET, captureCount_);
     buffer_.PutU32(NUM_STACK_OFFSET, stackCount_);
     buffer_.PutU32(FLAGS_OFFSET, flags_);
+    EmitPrefilter();
 #ifndef _NO_DEBUG_
     RegExpOpCode::DumpRegExpOpCode(std::cout, buffer_);
 #endif
 }
 
+// Tells the executor where a match can start, so that it skips the positions where it cannot instead of
+// running the byte code at each of them. The prefilter is emitted after the byte code, whose size in the
+// header does not include it.
+void RegExpParser::EmitPrefilter()
+{
+    CVector<uint16_t> literal;
+    CollectLiteralPrefix(&literal);
+    if (!literal.empty()) {
+        buffer_.EmitChar(PREFILTER_LITERAL);
+        buffer_.EmitU16(static_cast<uint16_t>(literal.size()));
+        for (auto c : literal) {
+            buffer_.EmitU16(c);
+        }
+        return;
+    }
+    CVector<std::pair<uint32_t, uint32_t>> firstChars;
+    if (!CollectFirstChars(&firstChars)) {
+        buffer_.EmitChar(PREFILTER_NONE);
+        return;
+    }
+    // the executor canonicalizes the input before comparing it, so test the canonical form of each char
+    std::array<uint8_t, PREFILTER_BITMAP_SIZE> bitmap {};
+    bool hasWideChars = IsIgnoreCase();
+    for (const auto &range : firstChars) {
+        hasWideChars = hasWideChars || range.second >= PREFILTER_BITMAP_CHARS;
+    }
+    for (uint32_t c = 0; c < PREFILTER_BITMAP_CHARS; c++) {
+        uint32_t key = IsIgnoreCase() ? static_cast<uint32_t>(Canonicalize(static_cast<int>(c), IsUtf16())) : c;
+        for (const auto &range : firstChars) {
+            if (key >= range.first && key <= range.second) {
+                bitmap[c / 8] |= 1U << (c % 8);  // 8: bits of a byte
+                break;
+            }
+        }
+    }
+    buffer_.EmitChar(PREFILTER_FIRST_CHARS);
+    buffer_.EmitChar(hasWideChars ? 1 : 0);
+    buffer_.Emit(bitmap.data(), bitmap.size());
+}
+
+// chars every match starts with, only straight line code is followed from the start of the byte code
+void RegExpParser::CollectLiteralPrefix(CVector<uint16_t> *literal) const
+{
+    if (IsIgnoreCase()) {
+        return;
+    }
+    uint32_t pcEnd = buffer_.GetU32(0);
+    uint32_t pc = OP_START_OFFSET;
+    while (pc < pcEnd && literal->size() < PREFILTER_LITERAL_MAX) {
+        uint8_t opCode = buffer_.GetU8(pc);
+        if (opCode == RegExpOpCode::OP_CHAR) {
+            uint32_t c = buffer_.GetU16(pc + 1);
+            // a surrogate in a unicode pattern does not match half of a pair
+            if (U16_IS_SURROGATE(c)) {
+                break;
+            }
+            literal->emplace_back(static_cast<uint16_t>(c));
+        } else if (opCode != RegExpOpCode::OP_SAVE_START && opCode != RegExpOpCode::OP_SAVE_END) {
+            break;
+        }
+        pc += RegExpOpCode::GetRegExpOpCode(opCode)->GetSize();
+    }
+}
+
+// Collects the chars the first char of a match can be compared with, following every path from the start of
+// the byte code to an op consuming a char. Returns false if a match may start with any char or consume none,
+// or if the pattern looks around or refers back.
+bool RegExpParser::CollectFirstChars(CVector<std::pair<uint32_t, uint32_t>> *firstChars) const
+{
+    uint32_t pcEnd = buffer_.GetU32(0);
+    CVector<uint8_t> visited(pcEnd, 0);
+    CVector<uint32_t> workList {OP_START_OFFSET};
+    while (!workList.empty()) {
+        uint32_t pc = workList.back();
+        workList.pop_back();
+        if (pc >= pcEnd) {
+            return false;
+        }
+        if (visited[pc] != 0) {
+            continue;
+        }
+        visited[pc] = 1;
+        uint8_t opCode = buffer_.GetU8(pc);
+        uint32_t nextPc = pc + RegExpOpCode::GetRegExpOpCode(opCode)->GetSize();
+        switch (opCode) {
+            // assertions only reject positions, they can be treated as if they always hold
+            case RegExpOpCode::OP_SAVE_START:
+            case RegExpOpCode::OP_SAVE_END:
+            case RegExpOpCode::OP_SAVE_RESET:
+            case RegExpOpCode::OP_PUSH:
+            case RegExpOpCode::OP_POP:
+            case RegExpOpCode::OP_PUSH_CHAR:
+            case RegExpOpCode::OP_LINE_START:
+            case RegExpOpCode::OP_LINE_END:
+            case RegExpOpCode::OP_WORD_BOUNDARY:
+            case RegExpOpCode::OP_NOT_WORD_BOUNDARY:
+                workList.emplace_back(nextPc);
+                break;
+            case RegExpOpCode::OP_GOTO:
+                workList.emplace_back(nextPc + buffer_.GetU32(pc + 1));
+                break;
+            case RegExpOpCode::OP_SPLIT_FIRST:
+            case RegExpOpCode::OP_SPLIT_NEXT:
+            case RegExpOpCode::OP_CHECK_CHAR:
+            case RegExpOpCode::OP_LOOP:
+            case RegExpOpCode::OP_LOOP_GREEDY:
+                // all of them keep the offset of their other branch right after the op code
+                workList.emplace_back(nextPc);
+                workList.emplace_back(nextPc + buffer_.GetU32(pc + 1));
+                break;
+            case RegExpOpCode::OP_CHAR: {
+                uint32_t c = buffer_.GetU16(pc + 1);
+                firstChars->emplace_back(c, c);
+                break;
+            }
+            case RegExpOpCode::OP_CHAR32: {
+                uint32_t c = buffer_.GetU32(pc + 1);
+                firstChars->emplace_back(c, c);
+                break;
+            }
+            case RegExpOpCode::OP_RANGE: {
+                uint32_t rangeCount = buffer_.GetU16(pc + 1);
+                for (uint32_t i = 0; i < rangeCount; i++) {
+                    uint32_t rangePc = pc + RegExpOpCode::OP_SIZE_THREE + i * RegExpOpCode::OP_SIZE_FOUR;
+                    firstChars->emplace_back(buffer_.GetU16(rangePc),
+                                             buffer_.GetU16(rangePc + RegExpOpCode::OP_SIZE_TWO));
+                }
+                break;
+            }
+            case RegExpOpCode::OP_RANGE32: {
+                uint32_t rangeCount = buffer_.GetU16(pc + 1);
+                for (uint32_t i = 0; i < rangeCount; i++) {
+                    uint32_t rangePc = pc + RegExpOpCode::OP_SIZE_THREE + i * RegExpOpCode::OP_SIZE_EIGHT;
+                    firstChars->emplace_back(buffer_.GetU32(rangePc),
+                                             buffer_.GetU32(rangePc + RegExpOpCode::OP_SIZE_FOUR));
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
 void RegExpParser::ParseDisjunction(bool isBackward)
 {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
@@ -54,6 +54,13 @@ public:
     static constexpr uint32_t UNICODE_HEX_ADVANCE = 2;
     static constexpr uint32_t CAPTURE_CONUT_ADVANCE = 3;
     static constexpr uint32_t UTF8_CHAR_LEN_MAX = 6;
+    // the prefilter follows the byte code: [kind][literal length, chars] or [kind][has wide chars, bitmap]
+    static constexpr uint8_t PREFILTER_NONE = 0;
+    static constexpr uint8_t PREFILTER_LITERAL = 1;
+    static constexpr uint8_t PREFILTER_FIRST_CHARS = 2;
+    static constexpr uint32_t PREFILTER_LITERAL_MAX = 16;
+    static constexpr uint32_t PREFILTER_BITMAP_CHARS = 256;
+    static constexpr uint32_t PREFILTER_BITMAP_SIZE = PREFILTER_BITMAP_CHARS / 8;
 
     explicit RegExpParser(Chunk *chunk)
         : base_(nullptr),
@@ -112,6 +119,9 @@ public:
     int ParseEscape(const uint8_t **pp, int isUtf16);
     int RecountCaptures();
     int IsIdentFirst(uint32_t c);
+    void EmitPrefilter();
+    void CollectLiteralPrefix(CVector<uint16_t> *literal) const;
+    bool CollectFirstChars(CVector<std::pair<uint32_t, uint32_t>> *firstChars) const;
 
     inline CVector<CString> GetGroupNames() const
     {
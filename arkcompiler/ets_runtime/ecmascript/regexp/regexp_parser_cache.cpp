@@ -16,54 +16,66 @@
 #include "ecmascript/regexp/regexp_parser_cache.h"
 
 namespace panda::ecmascript {
-RegExpParserCache::RegExpParserCache()
+std::pair<const uint8_t *, size_t> RegExpParserCache::GetCache(const CString &pattern, const uint32_t flags,
+                                                               CVector<CString> &groupName)
 {
-    Clear();
-}
-
-RegExpParserCache::~RegExpParserCache()
-{
-    Clear();
+    auto it = index_.find(ParserKey {pattern, flags});
+    if (it == index_.end()) {
+        missCount_++;
+        return std::pair<const uint8_t *, size_t>(nullptr, 0);
+    }
+    hitCount_++;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    const ParserEntry &entry = *it->second;
+    groupName = entry.newGroupNames_;
+    return std::pair<const uint8_t *, size_t>(entry.codeBuffer_.data(), entry.codeBuffer_.size());
 }
 
-void RegExpParserCache::Clear()
+void RegExpParserCache::SetCache(const CString &pattern, const uint32_t flags, const uint8_t *codeBuffer,
+                                 const size_t bufferSize, const CVector<CString> &groupName)
 {
-    for (ParserKey &info : info_) {
-        info.pattern_ = nullptr;
-        info.flags_ = UINT32_MAX; // flags cannot be UINT32_MAX, so it means invalid.
-        info.codeBuffer_ = JSTaggedValue::Hole();
-        info.bufferSize_ = 0;
+    ParserKey key {pattern, flags};
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        cachedBytes_ -= GetEntryBytes(*it->second);
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+    ParserEntry entry {key, CVector<uint8_t>(codeBuffer, codeBuffer + bufferSize), groupName};
+    size_t entryBytes = GetEntryBytes(entry);
+    if (entryBytes > bytesLimit_) {
+        return;
     }
+    EvictUntil(bytesLimit_ - entryBytes);
+    entries_.emplace_front(std::move(entry));
+    index_.emplace(std::move(key), entries_.begin());
+    cachedBytes_ += entryBytes;
 }
 
-size_t RegExpParserCache::GetHash(EcmaString *pattern, const uint32_t flags)
+void RegExpParserCache::Clear()
 {
-    auto hashcode = EcmaStringAccessor(pattern).GetHashcode();
-    return (hashcode ^ flags) % CACHE_SIZE;
+    index_.clear();
+    entries_.clear();
+    cachedBytes_ = 0;
 }
 
-std::pair<JSTaggedValue, size_t> RegExpParserCache::GetCache(EcmaString *pattern, const uint32_t flags,
-                                                             CVector<CString> &groupName)
+size_t RegExpParserCache::GetEntryBytes(const ParserEntry &entry)
 {
-    size_t hash = GetHash(pattern, flags);
-    ParserKey &info = info_[hash];
-    if (info.flags_ != flags || !EcmaStringAccessor::StringsAreEqual(info.pattern_, pattern)) {
-        return std::pair<JSTaggedValue, size_t>(JSTaggedValue::Hole(), 0);
+    size_t bytes = sizeof(ParserEntry) + entry.key_.pattern_.size() + entry.codeBuffer_.size();
+    for (const auto &name : entry.newGroupNames_) {
+        bytes += sizeof(CString) + name.size();
     }
-    groupName = info.newGroupNames_;
-    return std::pair<JSTaggedValue, size_t>(info.codeBuffer_, info.bufferSize_);
+    return bytes;
 }
 
-void RegExpParserCache::SetCache(EcmaString *pattern, const uint32_t flags,
-                                 const JSTaggedValue codeBuffer, const size_t bufferSize,
-                                 CVector<CString> groupName)
+void RegExpParserCache::EvictUntil(size_t bytesLimit)
 {
-    size_t hash = GetHash(pattern, flags);
-    ParserKey &info = info_[hash];
-    info.pattern_ = pattern;
-    info.flags_ = flags;
-    info.codeBuffer_ = codeBuffer;
-    info.bufferSize_ = bufferSize;
-    info.newGroupNames_ = groupName;
+    while (cachedBytes_ > bytesLimit && !entries_.empty()) {
+        const ParserEntry &entry = entries_.back();
+        cachedBytes_ -= GetEntryBytes(entry);
+        index_.erase(entry.key_);
+        entries_.pop_back();
+        evictionCount_++;
+    }
 }
-}  // namespace panda::ecmascript
\ No newline at end of file
+}  // namespace panda::ecmascript
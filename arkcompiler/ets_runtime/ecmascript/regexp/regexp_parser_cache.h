@@ -16,38 +16,94 @@
 #ifndef ECMASCRIPT_REGEXP_PARSER_CACHE_H
 #define ECMASCRIPT_REGEXP_PARSER_CACHE_H
 
-#include <array>
+#include <string_view>
 
-#include "ecmascript/ecma_string.h"
 #include "ecmascript/mem/c_containers.h"
-#include "ecmascript/js_tagged_value.h"
+#include "ecmascript/mem/c_string.h"
+#include "libpandabase/macros.h"
 
 namespace panda::ecmascript {
+// Byte code of the patterns compiled by the vm, shared by all its realms. Entries own a copy of the byte code
+// and do not refer to the heap, so they survive garbage collections. When the cached byte code outgrows the
+// limit, the least recently used patterns are dropped.
 class RegExpParserCache {
 public:
-    RegExpParserCache();
-    ~RegExpParserCache();
-    static constexpr size_t CACHE_SIZE = 128;
-
-    bool IsInCache(EcmaString *pattern, const uint32_t flags);
-    std::pair<JSTaggedValue, size_t> GetCache(EcmaString *pattern, const uint32_t flags,
-                                              CVector<CString> &groupName);
-    void SetCache(EcmaString *pattern, const uint32_t flags, const JSTaggedValue codeBuffer,
-                  const size_t bufferSize, CVector<CString> groupName);
+    static constexpr size_t CACHE_BYTES_LIMIT = 512 * 1024;
+
+    explicit RegExpParserCache(size_t bytesLimit = CACHE_BYTES_LIMIT) : bytesLimit_(bytesLimit) {}
+    ~RegExpParserCache() = default;
+
+    NO_COPY_SEMANTIC(RegExpParserCache);
+    NO_MOVE_SEMANTIC(RegExpParserCache);
+
+    // returns the byte code and its size, or nullptr if the pattern is not cached
+    std::pair<const uint8_t *, size_t> GetCache(const CString &pattern, const uint32_t flags,
+                                                CVector<CString> &groupName);
+    void SetCache(const CString &pattern, const uint32_t flags, const uint8_t *codeBuffer,
+                  const size_t bufferSize, const CVector<CString> &groupName);
     void Clear();
 
-private:
-    size_t GetHash(EcmaString *pattern, const uint32_t flags);
+    size_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    size_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+    size_t GetEvictionCount() const
+    {
+        return evictionCount_;
+    }
+
+    size_t GetCachedBytes() const
+    {
+        return cachedBytes_;
+    }
+
+    size_t GetCachedCount() const
+    {
+        return entries_.size();
+    }
 
+private:
     struct ParserKey {
-        EcmaString *pattern_ {nullptr};
-        uint32_t flags_ {UINT32_MAX};
-        JSTaggedValue codeBuffer_ {JSTaggedValue::Hole()};
-        size_t bufferSize_ {0};
+        CString pattern_;
+        uint32_t flags_ {0};
+
+        bool operator==(const ParserKey &other) const
+        {
+            return flags_ == other.flags_ && pattern_ == other.pattern_;
+        }
+    };
+
+    struct ParserKeyHash {
+        size_t operator()(const ParserKey &key) const
+        {
+            return std::hash<std::string_view>()(std::string_view(key.pattern_.data(), key.pattern_.size())) ^
+                key.flags_;
+        }
+    };
+
+    struct ParserEntry {
+        ParserKey key_;
+        CVector<uint8_t> codeBuffer_;
         CVector<CString> newGroupNames_;
     };
 
-    std::array<ParserKey, CACHE_SIZE> info_ {};
+    static size_t GetEntryBytes(const ParserEntry &entry);
+    void EvictUntil(size_t bytesLimit);
+
+    size_t bytesLimit_ {0};
+    size_t cachedBytes_ {0};
+    size_t hitCount_ {0};
+    size_t missCount_ {0};
+    size_t evictionCount_ {0};
+    // most recently used first
+    CList<ParserEntry> entries_;
+    CUnorderedMap<ParserKey, CList<ParserEntry>::iterator, ParserKeyHash> index_;
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_REGEXP_PARSER_CACHE_H
@@ -1905,6 +1905,110 @@ HWTEST_F_L0(RegExpTest, ParseAndExec59)
     ASSERT_TRUE(EcmaStringAccessor::Compare(*result.captures_[0].second, *str) == 0);
 }
 
+HWTEST_F_L0(RegExpTest, PrefilterLiteral)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    RegExpParser parser = RegExpParser(chunk_);
+    CString source("abc");
+    parser.Init(const_cast<char *>(reinterpret_cast<const char *>(source.c_str())), source.size(), 0);
+    parser.Parse();
+    bool parseResult = parser.IsError();
+    ASSERT_FALSE(parseResult);
+
+    RegExpExecutor executor(chunk_);
+    CString input("xxabxabcd");
+    bool ret =
+        executor.Execute(reinterpret_cast<const uint8_t *>(input.c_str()), 0, input.size(), parser.GetOriginBuffer());
+    ASSERT_TRUE(ret);
+
+    MatchResult result = executor.GetResult(thread, ret);
+    ASSERT_EQ(result.index_, 5U);
+    JSHandle<EcmaString> str = factory->NewFromASCII("abc");
+    ASSERT_TRUE(EcmaStringAccessor::Compare(*result.captures_[0].second, *str) == 0);
+}
+
+HWTEST_F_L0(RegExpTest, PrefilterLiteralNotFound)
+{
+    RegExpParser parser = RegExpParser(chunk_);
+    CString source("abc");
+    parser.Init(const_cast<char *>(reinterpret_cast<const char *>(source.c_str())), source.size(), 0);
+    parser.Parse();
+    bool parseResult = parser.IsError();
+    ASSERT_FALSE(parseResult);
+
+    RegExpExecutor executor(chunk_);
+    CString input("xxabxab");
+    bool ret =
+        executor.Execute(reinterpret_cast<const uint8_t *>(input.c_str()), 0, input.size(), parser.GetOriginBuffer());
+    ASSERT_FALSE(ret);
+}
+
+HWTEST_F_L0(RegExpTest, PrefilterFirstChars)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    RegExpParser parser = RegExpParser(chunk_);
+    CString source("[0-9]+x|y");
+    parser.Init(const_cast<char *>(reinterpret_cast<const char *>(source.c_str())), source.size(), 0);
+    parser.Parse();
+    bool parseResult = parser.IsError();
+    ASSERT_FALSE(parseResult);
+
+    RegExpExecutor executor(chunk_);
+    CString input("a1b22x");
+    bool ret =
+        executor.Execute(reinterpret_cast<const uint8_t *>(input.c_str()), 0, input.size(), parser.GetOriginBuffer());
+    ASSERT_TRUE(ret);
+
+    MatchResult result = executor.GetResult(thread, ret);
+    ASSERT_EQ(result.index_, 3U);
+    JSHandle<EcmaString> str = factory->NewFromASCII("22x");
+    ASSERT_TRUE(EcmaStringAccessor::Compare(*result.captures_[0].second, *str) == 0);
+}
+
+HWTEST_F_L0(RegExpTest, PrefilterFirstCharsIgnoreCase)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    RegExpParser parser = RegExpParser(chunk_);
+    CString source("b|C");
+    parser.Init(const_cast<char *>(reinterpret_cast<const char *>(source.c_str())), source.size(), 2);
+    parser.Parse();
+    bool parseResult = parser.IsError();
+    ASSERT_FALSE(parseResult);
+
+    RegExpExecutor executor(chunk_);
+    CString input("aac");
+    bool ret =
+        executor.Execute(reinterpret_cast<const uint8_t *>(input.c_str()), 0, input.size(), parser.GetOriginBuffer());
+    ASSERT_TRUE(ret);
+
+    MatchResult result = executor.GetResult(thread, ret);
+    ASSERT_EQ(result.index_, 2U);
+    JSHandle<EcmaString> str = factory->NewFromASCII("c");
+    ASSERT_TRUE(EcmaStringAccessor::Compare(*result.captures_[0].second, *str) == 0);
+}
+
+HWTEST_F_L0(RegExpTest, PrefilterEmptyMatch)
+{
+    ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+    RegExpParser parser = RegExpParser(chunk_);
+    CString source("x*");
+    parser.Init(const_cast<char *>(reinterpret_cast<const char *>(source.c_str())), source.size(), 0);
+    parser.Parse();
+    bool parseResult = parser.IsError();
+    ASSERT_FALSE(parseResult);
+
+    RegExpExecutor executor(chunk_);
+    CString input("abc");
+    bool ret =
+        executor.Execute(reinterpret_cast<const uint8_t *>(input.c_str()), 0, input.size(), parser.GetOriginBuffer());
+    ASSERT_TRUE(ret);
+
+    MatchResult result = executor.GetResult(thread, ret);
+    ASSERT_EQ(result.index_, 0U);
+    JSHandle<EcmaString> str = factory->NewFromASCII("");
+    ASSERT_TRUE(EcmaStringAccessor::Compare(*result.captures_[0].second, *str) == 0);
+}
+
 HWTEST_F_L0(RegExpTest, RangeSet1)
 {
     std::list<std::pair<uint32_t, uint32_t>> listInput = {
@@ -125,11 +125,13 @@ namespace panda::ecmascript {
     V(GetCallSpreadArgs)            \
     V(TryLoadICByName)              \
     V(LoadICByName)                 \
+    V(LoadMegaICByName)             \
     V(GetPropertyByName)            \
     V(TryLoadICByValue)             \
     V(LoadICByValue)                \
     V(TryStoreICByName)             \
     V(StoreICByName)                \
+    V(StoreMegaICByName)            \
     V(TryStoreICByValue)            \
     V(StoreICByValue)               \
     V(NotifyInlineCache)            \
@@ -850,6 +852,9 @@ namespace panda::ecmascript {
     V(ConcurrentMarkingInitialize)   \
     V(WaitConcurrentMarkingFinished) \
     V(ReMarking)                     \
+    V(IncrementalMarking)            \
+    V(IncrementalMarkingInitialize)  \
+    V(IncrementalReMarking)          \
     V(ConcurrentSweepingInitialize)  \
     V(ConcurrentSweepingWait)        \
     V(ParallelEvacuationInitialize)  \
@@ -1408,10 +1408,9 @@ JSTaggedValue RuntimeStubs::RuntimeAdd2(JSThread *thread, const JSHandle<JSTagge
                                            const JSHandle<JSTaggedValue> &right)
 {
     if (left->IsString() && right->IsString()) {
-        ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
-        JSHandle<EcmaString> newString =
-            factory->ConcatFromString(JSHandle<EcmaString>(left), JSHandle<EcmaString>(right));
-        return newString.GetTaggedValue();
+        EcmaString *newString =
+            EcmaStringAccessor::Concat(thread->GetEcmaVM(), JSHandle<EcmaString>(left), JSHandle<EcmaString>(right));
+        return JSTaggedValue(newString);
     }
     JSHandle<JSTaggedValue> primitiveA0(thread, JSTaggedValue::ToPrimitive(thread, left));
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
@@ -1423,9 +1422,8 @@ JSTaggedValue RuntimeStubs::RuntimeAdd2(JSThread *thread, const JSHandle<JSTagge
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
         JSHandle<EcmaString> stringA1 = JSTaggedValue::ToString(thread, primitiveA1);
         RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
-        ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
-        JSHandle<EcmaString> newString = factory->ConcatFromString(stringA0, stringA1);
-        return newString.GetTaggedValue();
+        EcmaString *newString = EcmaStringAccessor::Concat(thread->GetEcmaVM(), stringA0, stringA1);
+        return JSTaggedValue(newString);
     }
     JSHandle<JSTaggedValue> valLeft = JSTaggedValue::ToNumeric(thread, primitiveA0);
     RETURN_EXCEPTION_IF_ABRUPT_COMPLETION(thread);
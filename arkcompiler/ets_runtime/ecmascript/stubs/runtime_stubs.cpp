@@ -29,6 +29,7 @@
 #include "ecmascript/frames.h"
 #include "ecmascript/global_env.h"
 #include "ecmascript/ic/ic_runtime.h"
+#include "ecmascript/ic/mega_ic_cache.h"
 #include "ecmascript/ic/profile_type_info.h"
 #include "ecmascript/ic/properties_cache.h"
 #include "ecmascript/interpreter/interpreter-inl.h"
@@ -1954,6 +1955,18 @@ int32_t RuntimeStubs::FindElementWithCache(uintptr_t argGlue, JSTaggedType hclas
     return index;
 }
 
+JSTaggedType RuntimeStubs::GetLoadMegaICHandler(uintptr_t argGlue, JSTaggedType hclass, JSTaggedType key)
+{
+    auto thread = JSThread::GlueToJSThread(argGlue);
+    return thread->GetLoadMegaICCache()->Get(reinterpret_cast<JSHClass *>(hclass), JSTaggedValue(key)).GetRawData();
+}
+
+JSTaggedType RuntimeStubs::GetStoreMegaICHandler(uintptr_t argGlue, JSTaggedType hclass, JSTaggedType key)
+{
+    auto thread = JSThread::GlueToJSThread(argGlue);
+    return thread->GetStoreMegaICCache()->Get(reinterpret_cast<JSHClass *>(hclass), JSTaggedValue(key)).GetRawData();
+}
+
 JSTaggedType RuntimeStubs::GetActualArgvNoGC(uintptr_t argGlue)
 {
     auto thread = JSThread::GlueToJSThread(argGlue);
@@ -2163,6 +2176,7 @@ DEF_RUNTIME_STUBS(DeoptHandler)
     deopt.CollectDeoptBundleVec(deoptBundle);
     ASSERT(!deoptBundle.empty());
     deopt.CollectVregs(deoptBundle);
+    deopt.MaterializeVirtualObjects();
 
     uintptr_t *args = reinterpret_cast<uintptr_t *>(argv);
     kungfu::DeoptType type = static_cast<kungfu::DeoptType>(args[0]);
@@ -102,6 +102,8 @@ using JSFunctionEntryType = JSTaggedValue (*)(uintptr_t glue, uint32_t argc, con
     V(FloatATan)                               \
     V(FloatFloor)                              \
     V(FindElementWithCache)                    \
+    V(GetLoadMegaICHandler)                    \
+    V(GetStoreMegaICHandler)                   \
     V(CreateArrayFromList)                     \
     V(StringsAreEquals)                        \
     V(BigIntEquals)                            \
@@ -346,6 +348,8 @@ public:
     static JSTaggedType FloatFloor(double x);
     static int32_t FindElementWithCache(uintptr_t argGlue, JSTaggedType hclass,
                                         JSTaggedType key, int32_t num);
+    static JSTaggedType GetLoadMegaICHandler(uintptr_t argGlue, JSTaggedType hclass, JSTaggedType key);
+    static JSTaggedType GetStoreMegaICHandler(uintptr_t argGlue, JSTaggedType hclass, JSTaggedType key);
     static bool StringsAreEquals(EcmaString *str1, EcmaString *str2);
     static bool BigIntEquals(JSTaggedType left, JSTaggedType right);
     static double TimeClip(double time);
@@ -377,9 +377,8 @@ protected:
                                                        const JSHandle<JSTaggedValue> valueY)
     {
         if (valueX->IsString() && valueY->IsString()) {
-            auto xString = static_cast<EcmaString *>(valueX->GetTaggedObject());
-            auto yString = static_cast<EcmaString *>(valueY->GetTaggedObject());
-            int result = EcmaStringAccessor::Compare(xString, yString);
+            int result = EcmaStringAccessor::Compare(thread->GetEcmaVM(), JSHandle<EcmaString>(valueX),
+                                                     JSHandle<EcmaString>(valueY));
             if (result < 0) {
                 return ComparisonResult::LESS;
             }
@@ -15,33 +15,74 @@
 
 #include "ecmascript/taskpool/runner.h"
 
+#include <chrono>
+
 #include "os/thread.h"
 
 namespace panda::ecmascript {
+thread_local Runner *Runner::currentRunner_ = nullptr;
+thread_local uint32_t Runner::currentThreadId_ = 0;
+
 Runner::Runner(uint32_t threadNum) : totalThreadNum_(threadNum)
 {
+    for (uint32_t i = 0; i < runningTask_.size(); i++) {
+        runningTask_[i] = nullptr;
+    }
+
     for (uint32_t i = 0; i < threadNum; i++) {
         // main thread is 0;
         std::unique_ptr<std::thread> thread = std::make_unique<std::thread>(&Runner::Run, this, i + 1);
         os::thread::SetThreadName(thread->native_handle(), "GC_WorkerThread");
         threadPool_.emplace_back(std::move(thread));
     }
+}
 
-    for (uint32_t i = 0; i < runningTask_.size(); i++) {
-        runningTask_[i] = nullptr;
+uint64_t Runner::GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Runner::PostTask(std::unique_ptr<Task> task)
+{
+    ASSERT(!terminate_);
+    task->postTime_ = GetCurrentTime();
+    postedTaskCount_.fetch_add(1, std::memory_order_relaxed);
+    // Count the task before reading the epoch, TerminateTask only drops its records while nothing is pending.
+    pendingTaskCount_.fetch_add(1, std::memory_order_seq_cst);
+    task->postEpoch_ = terminateEpoch_.load(std::memory_order_seq_cst);
+
+    uint32_t affinity = task->GetAffinity();
+    if (affinity != ANY_THREAD_AFFINITY && affinity <= totalThreadNum_) {
+        affinityQueues_[affinity].PostTask(std::move(task));
+    } else if (currentRunner_ == this && task->GetPriority() != TaskPriority::LOW) {
+        localQueues_[currentThreadId_].Push(task.release());
+    } else {
+        globalQueue_.PostTask(std::move(task));
+    }
+
+    // Pairs with the recheck in WaitTask: either the parking thread sees the pending task or we see it parking.
+    if (idleThreadCount_.load(std::memory_order_seq_cst) > 0) {
+        os::memory::LockHolder holder(idleMtx_);
+        idleCv_.Signal();
     }
 }
 
 void Runner::TerminateTask(int32_t id, TaskType type)
 {
-    taskQueue_.TerminateTask(id, type);
+    {
+        os::memory::LockHolder holder(terminateMtx_);
+        if (pendingTaskCount_.load(std::memory_order_seq_cst) == 0) {
+            terminateRecords_.clear();
+        }
+        uint64_t epoch = terminateEpoch_.load(std::memory_order_relaxed) + 1;
+        terminateRecords_.push_back({id, type, epoch});
+        terminateEpoch_.store(epoch, std::memory_order_seq_cst);
+    }
     os::memory::LockHolder holder(mtx_);
     for (uint32_t i = 0; i < runningTask_.size(); i++) {
         if (runningTask_[i] != nullptr) {
-            if (id != ALL_TASK_ID && id != runningTask_[i]->GetId()) {
-                continue;
-            }
-            if (type != TaskType::ALL && type != runningTask_[i]->GetTaskType()) {
+            if (!MatchTask(runningTask_[i], id, type)) {
                 continue;
             }
             runningTask_[i]->Terminated();
@@ -52,7 +93,11 @@ void Runner::TerminateTask(int32_t id, TaskType type)
 void Runner::TerminateThread()
 {
     TerminateTask(ALL_TASK_ID, TaskType::ALL);
-    taskQueue_.Terminate();
+    {
+        os::memory::LockHolder holder(idleMtx_);
+        terminate_ = true;
+        idleCv_.SignalAll();
+    }
 
     os::memory::LockHolder holder(mtxPool_);
     uint32_t threadNum = threadPool_.size();
@@ -62,18 +107,125 @@ void Runner::TerminateThread()
     threadPool_.clear();
 }
 
+RunnerStatistics Runner::GetStatistics() const
+{
+    RunnerStatistics statistics;
+    statistics.postedTaskCount = postedTaskCount_.load(std::memory_order_relaxed);
+    statistics.localTaskCount = localTaskCount_.load(std::memory_order_relaxed);
+    statistics.sharedTaskCount = sharedTaskCount_.load(std::memory_order_relaxed);
+    statistics.stolenTaskCount = stolenTaskCount_.load(std::memory_order_relaxed);
+    statistics.stealAbortCount = stealAbortCount_.load(std::memory_order_relaxed);
+    statistics.lockContentionCount = globalQueue_.GetContentionCount();
+    for (auto &queue : affinityQueues_) {
+        statistics.lockContentionCount += queue.GetContentionCount();
+    }
+    statistics.idleWaitCount = idleWaitCount_.load(std::memory_order_relaxed);
+    statistics.totalQueueLatency = totalQueueLatency_.load(std::memory_order_relaxed);
+    statistics.maxQueueLatency = maxQueueLatency_.load(std::memory_order_relaxed);
+    return statistics;
+}
+
 void Runner::SetRunTask(uint32_t threadId, Task *task)
 {
     os::memory::LockHolder holder(mtx_);
     runningTask_[threadId] = task;
 }
 
+void Runner::StartTask(uint32_t threadId, Task *task)
+{
+    // Publish the task before checking the epoch, a concurrent TerminateTask then either marks it as running or
+    // has already bumped the epoch.
+    SetRunTask(threadId, task);
+    if (task->postEpoch_ != terminateEpoch_.load(std::memory_order_seq_cst)) {
+        os::memory::LockHolder holder(terminateMtx_);
+        for (const auto &record : terminateRecords_) {
+            if (record.epoch > task->postEpoch_ && MatchTask(task, record.id, record.type)) {
+                task->Terminated();
+                break;
+            }
+        }
+    }
+    pendingTaskCount_.fetch_sub(1, std::memory_order_seq_cst);
+
+    uint64_t latency = GetCurrentTime() - task->postTime_;
+    totalQueueLatency_.fetch_add(latency, std::memory_order_relaxed);
+    uint64_t maxLatency = maxQueueLatency_.load(std::memory_order_relaxed);
+    while (latency > maxLatency &&
+        !maxQueueLatency_.compare_exchange_weak(maxLatency, latency, std::memory_order_relaxed)) {
+    }
+}
+
+std::unique_ptr<Task> Runner::FindTask(uint32_t threadId)
+{
+    if (Task *task = localQueues_[threadId].Pop()) {
+        localTaskCount_.fetch_add(1, std::memory_order_relaxed);
+        return std::unique_ptr<Task>(task);
+    }
+    std::unique_ptr<Task> task = affinityQueues_[threadId].PopTask();
+    if (task == nullptr) {
+        task = globalQueue_.PopTask();
+    }
+    if (task != nullptr) {
+        sharedTaskCount_.fetch_add(1, std::memory_order_relaxed);
+        return task;
+    }
+    return StealTask(threadId);
+}
+
+std::unique_ptr<Task> Runner::StealTask(uint32_t threadId)
+{
+    // start from the next thread so that the thieves do not all hit the same victim
+    for (uint32_t i = 1; i < totalThreadNum_; i++) {
+        uint32_t victim = (threadId + i - 1) % totalThreadNum_ + 1;
+        std::unique_ptr<Task> task = affinityQueues_[victim].PopTask();
+        if (task != nullptr) {
+            stolenTaskCount_.fetch_add(1, std::memory_order_relaxed);
+            return task;
+        }
+        bool aborted = false;
+        do {
+            if (Task *stolen = localQueues_[victim].Steal(&aborted)) {
+                stolenTaskCount_.fetch_add(1, std::memory_order_relaxed);
+                return std::unique_ptr<Task>(stolen);
+            }
+            if (aborted) {
+                stealAbortCount_.fetch_add(1, std::memory_order_relaxed);
+            }
+        } while (aborted);
+    }
+    return nullptr;
+}
+
+std::unique_ptr<Task> Runner::WaitTask(uint32_t threadId)
+{
+    while (true) {
+        std::unique_ptr<Task> task = FindTask(threadId);
+        if (task != nullptr) {
+            return task;
+        }
+        os::memory::LockHolder holder(idleMtx_);
+        idleThreadCount_.fetch_add(1, std::memory_order_seq_cst);
+        // A pending task may be in transit or popped but not started yet, look again instead of parking.
+        while (pendingTaskCount_.load(std::memory_order_seq_cst) == 0 && !terminate_) {
+            idleWaitCount_.fetch_add(1, std::memory_order_relaxed);
+            idleCv_.Wait(&idleMtx_);
+        }
+        idleThreadCount_.fetch_sub(1, std::memory_order_seq_cst);
+        if (terminate_ && pendingTaskCount_.load(std::memory_order_seq_cst) == 0) {
+            return nullptr;
+        }
+    }
+}
+
 void Runner::Run(uint32_t threadId)
 {
-    while (std::unique_ptr<Task> task = taskQueue_.PopTask()) {
-        SetRunTask(threadId, task.get());
+    currentRunner_ = this;
+    currentThreadId_ = threadId;
+    while (std::unique_ptr<Task> task = WaitTask(threadId)) {
+        StartTask(threadId, task.get());
         task->Run(threadId);
         SetRunTask(threadId, nullptr);
     }
+    currentRunner_ = nullptr;
 }
 }  // namespace panda::ecmascript
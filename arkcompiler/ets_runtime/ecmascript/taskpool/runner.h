@@ -17,12 +17,14 @@
 #define ECMASCRIPT_TASKPOOL_RUNNER_H
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <thread>
 #include <vector>
 
 #include "ecmascript/common.h"
 #include "ecmascript/taskpool/task_queue.h"
+#include "ecmascript/taskpool/work_stealing_queue.h"
 #include "os/mutex.h"
 
 namespace panda::ecmascript {
@@ -30,6 +32,22 @@ static constexpr uint32_t MIN_TASKPOOL_THREAD_NUM = 3;
 static constexpr uint32_t MAX_TASKPOOL_THREAD_NUM = 7;
 static constexpr uint32_t DEFAULT_TASKPOOL_THREAD_NUM = 0;
 
+struct RunnerStatistics {
+    uint64_t postedTaskCount {0};
+    uint64_t localTaskCount {0};       // popped from the work stealing queue of the running thread
+    uint64_t sharedTaskCount {0};      // popped from the global or the affinity queue of the running thread
+    uint64_t stolenTaskCount {0};
+    uint64_t stealAbortCount {0};      // lost the race for a task against another thread
+    uint64_t lockContentionCount {0};  // global and affinity queue locks found held
+    uint64_t idleWaitCount {0};
+    uint64_t totalQueueLatency {0};    // us from posting to starting, summed over all started tasks
+    uint64_t maxQueueLatency {0};      // us
+};
+
+// Every taskpool thread owns a work stealing queue, tasks posted from a taskpool thread go to its own queue and are
+// popped in LIFO order while their data is still in cache. Tasks posted from other threads go to a global queue
+// ordered by priority, tasks with an affinity hint to the affinity queue of that thread. A thread without work
+// steals from the others before it parks.
 class Runner {
 public:
     explicit Runner(uint32_t threadNum);
@@ -38,10 +56,7 @@ public:
     NO_COPY_SEMANTIC(Runner);
     NO_MOVE_SEMANTIC(Runner);
 
-    void PostTask(std::unique_ptr<Task> task)
-    {
-        taskQueue_.PostTask(std::move(task));
-    }
+    void PostTask(std::unique_ptr<Task> task);
 
     void PUBLIC_API TerminateThread();
     void TerminateTask(int32_t id, TaskType type);
@@ -62,16 +77,63 @@ public:
         return false;
     }
 
+    RunnerStatistics GetStatistics() const;
+
 private:
+    struct TerminateRecord {
+        int32_t id;
+        TaskType type;
+        uint64_t epoch;
+    };
+
     void Run(uint32_t threadId);
+    std::unique_ptr<Task> WaitTask(uint32_t threadId);
+    std::unique_ptr<Task> FindTask(uint32_t threadId);
+    std::unique_ptr<Task> StealTask(uint32_t threadId);
+    void StartTask(uint32_t threadId, Task *task);
     void SetRunTask(uint32_t threadId, Task *task);
 
+    static bool MatchTask(const Task *task, int32_t id, TaskType type)
+    {
+        return (id == ALL_TASK_ID || id == task->GetId()) && (type == TaskType::ALL || type == task->GetTaskType());
+    }
+
+    static uint64_t GetCurrentTime();
+
+    static thread_local Runner *currentRunner_;
+    static thread_local uint32_t currentThreadId_;
+
     std::vector<std::unique_ptr<std::thread>> threadPool_ {};
-    TaskQueue taskQueue_ {};
+    TaskQueue globalQueue_ {};
+    // indexed by thread id, 0 is the js thread and never used
+    std::array<WorkStealingQueue, MAX_TASKPOOL_THREAD_NUM + 1> localQueues_ {};
+    std::array<TaskQueue, MAX_TASKPOOL_THREAD_NUM + 1> affinityQueues_ {};
     std::array<Task*, MAX_TASKPOOL_THREAD_NUM + 1> runningTask_;
     uint32_t totalThreadNum_ {0};
     os::memory::Mutex mtx_;
     os::memory::Mutex mtxPool_;
+
+    // posted tasks which are not started yet, threads only park when it is zero
+    std::atomic<uint32_t> pendingTaskCount_ {0};
+    std::atomic<uint32_t> idleThreadCount_ {0};
+    std::atomic<bool> terminate_ {false};
+    os::memory::Mutex idleMtx_;
+    os::memory::ConditionVariable idleCv_;
+
+    // Queued tasks cannot be enumerated while other threads steal them, so TerminateTask records the request and
+    // the tasks posted before it are marked terminated when they are started.
+    std::atomic<uint64_t> terminateEpoch_ {0};
+    std::vector<TerminateRecord> terminateRecords_ {};
+    os::memory::Mutex terminateMtx_;
+
+    std::atomic<uint64_t> postedTaskCount_ {0};
+    std::atomic<uint64_t> localTaskCount_ {0};
+    std::atomic<uint64_t> sharedTaskCount_ {0};
+    std::atomic<uint64_t> stolenTaskCount_ {0};
+    std::atomic<uint64_t> stealAbortCount_ {0};
+    std::atomic<uint64_t> idleWaitCount_ {0};
+    std::atomic<uint64_t> totalQueueLatency_ {0};
+    std::atomic<uint64_t> maxQueueLatency_ {0};
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_TASKPOOL_RUNNER_H
@@ -24,9 +24,19 @@ enum class TaskType : uint8_t {
     ALL,
 };
 
+// Queued tasks of a higher priority are started first, they never preempt a running task.
+enum class TaskPriority : uint8_t {
+    HIGH,
+    DEFAULT,
+    LOW,
+};
+static constexpr uint32_t TASK_PRIORITY_NUM = static_cast<uint32_t>(TaskPriority::LOW) + 1;
+
 static constexpr int32_t ALL_TASK_ID = -1;
 // Tasks not managed by VM
 static constexpr int32_t GLOBAL_TASK_ID = 0;
+// Thread 0 is the js thread which never runs tasks, so it doubles as "no preferred thread"
+static constexpr uint32_t ANY_THREAD_AFFINITY = 0;
 
 class Task {
 public:
@@ -42,6 +52,17 @@ public:
         return TaskType::ALL;
     }
 
+    virtual TaskPriority GetPriority() const
+    {
+        return TaskPriority::DEFAULT;
+    }
+
+    // Taskpool thread which should preferably run the task, idle threads still take it when it is busy.
+    virtual uint32_t GetAffinity() const
+    {
+        return ANY_THREAD_AFFINITY;
+    }
+
     int32_t GetId() const
     {
         return id_;
@@ -60,6 +81,11 @@ public:
 private:
     int32_t id_ {0};
     volatile bool terminate_ {false};
+    // set by the runner when the task is posted
+    uint64_t postTime_ {0};
+    uint64_t postEpoch_ {0};
+
+    friend class Runner;
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_TASKPOOL_TASK_H
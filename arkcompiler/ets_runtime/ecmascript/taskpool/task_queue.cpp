@@ -16,49 +16,39 @@
 #include "ecmascript/taskpool/task_queue.h"
 
 namespace panda::ecmascript {
-void TaskQueue::PostTask(std::unique_ptr<Task> task)
+void TaskQueue::Lock()
 {
-    os::memory::LockHolder holder(mtx_);
-    ASSERT(!terminate_);
-    tasks_.push_back(std::move(task));
-    cv_.Signal();
+    if (!mtx_.TryLock()) {
+        contentionCount_.fetch_add(1, std::memory_order_relaxed);
+        mtx_.Lock();
+    }
 }
 
-std::unique_ptr<Task> TaskQueue::PopTask()
+void TaskQueue::PostTask(std::unique_ptr<Task> task)
 {
-    os::memory::LockHolder holder(mtx_);
-    while (true) {
-        if (!tasks_.empty()) {
-            std::unique_ptr<Task> task = std::move(tasks_.front());
-            tasks_.pop_front();
-            return task;
-        }
-        if (terminate_) {
-            cv_.SignalAll();
-            return nullptr;
-        }
-        cv_.Wait(&mtx_);
-    }
+    auto priority = static_cast<uint32_t>(task->GetPriority());
+    Lock();
+    tasks_[priority].push_back(std::move(task));
+    size_.fetch_add(1, std::memory_order_release);
+    mtx_.Unlock();
 }
 
-void TaskQueue::TerminateTask(int32_t id, TaskType type)
+std::unique_ptr<Task> TaskQueue::PopTask()
 {
-    os::memory::LockHolder holder(mtx_);
-    for (auto iter = tasks_.begin(); iter != tasks_.end(); iter++) {
-        if (id != ALL_TASK_ID && id != (*iter)->GetId()) {
-            continue;
-        }
-        if (type != TaskType::ALL && type != (*iter)->GetTaskType()) {
-            continue;
+    if (IsEmpty()) {
+        return nullptr;
+    }
+    std::unique_ptr<Task> task;
+    Lock();
+    for (auto &tasks : tasks_) {
+        if (!tasks.empty()) {
+            task = std::move(tasks.front());
+            tasks.pop_front();
+            size_.fetch_sub(1, std::memory_order_release);
+            break;
         }
-        (*iter)->Terminated();
     }
-}
-
-void TaskQueue::Terminate()
-{
-    os::memory::LockHolder holder(mtx_);
-    terminate_ = true;
-    cv_.SignalAll();
+    mtx_.Unlock();
+    return task;
 }
 }  // namespace panda::ecmascript
@@ -16,7 +16,7 @@
 #ifndef ECMASCRIPT_TASKPOOL_TASK_QUEUE_H
 #define ECMASCRIPT_TASKPOOL_TASK_QUEUE_H
 
-#include <algorithm>
+#include <array>
 #include <atomic>
 #include <deque>
 #include <memory>
@@ -25,6 +25,9 @@
 #include "os/mutex.h"
 
 namespace panda::ecmascript {
+// Locked queue for the tasks which cannot go to the work stealing queue of the posting thread. Tasks of a higher
+// priority are popped first, tasks of the same priority in posting order. Pop never blocks, the runner parks its
+// threads itself.
 class TaskQueue {
 public:
     TaskQueue() = default;
@@ -36,15 +39,24 @@ public:
     void PostTask(std::unique_ptr<Task> task);
     std::unique_ptr<Task> PopTask();
 
-    void Terminate();
-    void TerminateTask(int32_t id, TaskType type);
+    bool IsEmpty() const
+    {
+        return size_.load(std::memory_order_acquire) == 0;
+    }
+
+    // number of times the queue lock was found held by another thread
+    uint64_t GetContentionCount() const
+    {
+        return contentionCount_.load(std::memory_order_relaxed);
+    }
 
 private:
-    std::deque<std::unique_ptr<Task>> tasks_;
+    void Lock();
 
-    std::atomic_bool terminate_ = false;
+    std::array<std::deque<std::unique_ptr<Task>>, TASK_PRIORITY_NUM> tasks_ {};
+    std::atomic<uint32_t> size_ {0};
+    std::atomic<uint64_t> contentionCount_ {0};
     os::memory::Mutex mtx_;
-    os::memory::ConditionVariable cv_;
 };
 }  // namespace panda::ecmascript
 #endif  // ECMASCRIPT_TASKPOOL_TASK_QUEUE_H
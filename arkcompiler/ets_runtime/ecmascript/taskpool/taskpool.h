@@ -60,6 +60,11 @@ public:
         return runner_->IsInThreadPool(id);
     }
 
+    RunnerStatistics GetStatistics() const
+    {
+        return runner_->GetStatistics();
+    }
+
 private:
     uint32_t TheMostSuitableThreadNum(uint32_t threadNum) const;
 
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMASCRIPT_TASKPOOL_WORK_STEALING_QUEUE_H
+#define ECMASCRIPT_TASKPOOL_WORK_STEALING_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "ecmascript/taskpool/task.h"
+
+namespace panda::ecmascript {
+// Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP'13).
+// Only the owner thread pushes and pops at the bottom, any other thread may steal from the top, neither side
+// takes a lock. The queue owns the tasks it holds.
+class WorkStealingQueue {
+public:
+    WorkStealingQueue() : array_(new CircularArray(INITIAL_CAPACITY)) {}
+    ~WorkStealingQueue()
+    {
+        while (Task *task = Pop()) {
+            delete task;
+        }
+        delete array_.load(std::memory_order_relaxed);
+    }
+
+    NO_COPY_SEMANTIC(WorkStealingQueue);
+    NO_MOVE_SEMANTIC(WorkStealingQueue);
+
+    // owner only
+    void Push(Task *task)
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_acquire);
+        CircularArray *array = array_.load(std::memory_order_relaxed);
+        if (bottom - top > array->Capacity() - 1) {
+            array = Grow(array, bottom, top);
+        }
+        array->Put(bottom, task);
+        // publishes the task to the thieves, which load bottom with acquire
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    // owner only, takes the most recently pushed task
+    Task *Pop()
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        CircularArray *array = array_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Task *task = array->Get(bottom);
+        if (top == bottom) {
+            // last task, race against the thieves
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                task = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    // any thread, takes the oldest task. aborted is set when another thread won the race for it.
+    Task *Steal(bool *aborted)
+    {
+        *aborted = false;
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        CircularArray *array = array_.load(std::memory_order_acquire);
+        Task *task = array->Get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            *aborted = true;
+            return nullptr;
+        }
+        return task;
+    }
+
+    bool IsEmpty() const
+    {
+        return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+    }
+
+private:
+    class CircularArray {
+    public:
+        explicit CircularArray(int64_t capacity)
+            : capacity_(capacity), buffer_(std::make_unique<std::atomic<Task *>[]>(capacity)) {}
+        ~CircularArray() = default;
+
+        NO_COPY_SEMANTIC(CircularArray);
+        NO_MOVE_SEMANTIC(CircularArray);
+
+        int64_t Capacity() const
+        {
+            return capacity_;
+        }
+
+        Task *Get(int64_t index) const
+        {
+            return buffer_[index & (capacity_ - 1)].load(std::memory_order_relaxed);
+        }
+
+        void Put(int64_t index, Task *task)
+        {
+            buffer_[index & (capacity_ - 1)].store(task, std::memory_order_relaxed);
+        }
+
+    private:
+        int64_t capacity_ {0};
+        std::unique_ptr<std::atomic<Task *>[]> buffer_;
+    };
+
+    CircularArray *Grow(CircularArray *array, int64_t bottom, int64_t top)
+    {
+        auto *newArray = new CircularArray(array->Capacity() * 2);  // 2: double the capacity
+        for (int64_t i = top; i < bottom; i++) {
+            newArray->Put(i, array->Get(i));
+        }
+        // a thief may still read the old array, it is released together with the queue
+        retiredArrays_.emplace_back(array);
+        array_.store(newArray, std::memory_order_release);
+        return newArray;
+    }
+
+    static constexpr int64_t INITIAL_CAPACITY = 64;
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    // top is written by thieves and bottom by the owner, keep them on different cache lines
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top_ {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom_ {0};
+    std::atomic<CircularArray *> array_;
+    std::vector<std::unique_ptr<CircularArray>> retiredArrays_ {};
+};
+}  // namespace panda::ecmascript
+#endif  // ECMASCRIPT_TASKPOOL_WORK_STEALING_QUEUE_H
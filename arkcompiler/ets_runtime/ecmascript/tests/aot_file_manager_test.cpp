@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+
+#include "ecmascript/aot_file_manager.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class AOTFileManagerTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        for (size_t i = 0; i < RODATA_SIZE; i++) {
+            rodata_[i] = static_cast<uint8_t>(i);
+        }
+        for (size_t i = 0; i < TEXT_SIZE; i++) {
+            text_[i] = static_cast<uint8_t>(TEXT_SIZE - i);
+        }
+        stackMap_ = std::shared_ptr<uint8_t>(new uint8_t[STACK_MAP_SIZE], std::default_delete<uint8_t[]>());
+        for (size_t i = 0; i < STACK_MAP_SIZE; i++) {
+            stackMap_.get()[i] = static_cast<uint8_t>(i * 3);  // 3: differ from the other sections
+        }
+    }
+
+    void TearDown() override
+    {
+        std::remove(AN_FILE_NAME);
+    }
+
+    // saves one module of a rodata and a text section holding a main function and a method.
+    void SaveAnFile()
+    {
+        ModuleSectionDes des;
+        des.SetSecAddr(reinterpret_cast<uint64_t>(rodata_), ElfSecName::RODATA);
+        des.SetSecSize(RODATA_SIZE, ElfSecName::RODATA);
+        des.SetSecAddr(reinterpret_cast<uint64_t>(text_), ElfSecName::TEXT);
+        des.SetSecSize(TEXT_SIZE, ElfSecName::TEXT);
+        des.SetArkStackMapPtr(stackMap_);
+        des.SetArkStackMapSize(STACK_MAP_SIZE);
+        des.SetStartIndex(0);
+        des.SetFuncCount(FUNC_COUNT);
+
+        AnFileInfo info;
+        info.AddEntry(kungfu::CallSignature::TargetKind::JSFUNCTION, true, MAIN_METHOD_ID, 0, 0, 0, FUNC_SIZE);
+        info.AddEntry(kungfu::CallSignature::TargetKind::JSFUNCTION, false, METHOD_ID, FUNC_SIZE, 0, 0, FUNC_SIZE);
+        info.AddModuleDes(des);
+        info.Save(AN_FILE_NAME, kungfu::Triple::TRIPLE_AMD64);
+    }
+
+    static bool LoadAnFile(AnFileInfo &info, bool mapExecutable)
+    {
+        if (mapExecutable) {
+            return info.Load(AN_FILE_NAME);
+        }
+        std::string realPath;
+        if (!RealPath(AN_FILE_NAME, realPath) || !info.LoadMapped(realPath, false)) {
+            return false;
+        }
+        info.RelocateEntries();
+        return true;
+    }
+
+    static bool IsExecutableMapped(AnFileInfo &info)
+    {
+        return info.GetExeMem().fileMapped_;
+    }
+
+    void CheckLoadedAnFile(const AnFileInfo &info)
+    {
+        ASSERT_EQ(info.GetCodeUnits().size(), 1U);
+        ModuleSectionDes des = info.GetCodeUnits()[0];
+        EXPECT_EQ(des.GetSecSize(ElfSecName::RODATA), RODATA_SIZE);
+        EXPECT_EQ(des.GetSecSize(ElfSecName::TEXT), TEXT_SIZE);
+        EXPECT_EQ(des.GetArkStackMapSize(), STACK_MAP_SIZE);
+        EXPECT_EQ(des.GetFuncCount(), FUNC_COUNT);
+
+        // the sections follow each other in the code, in the order they were saved.
+        uint64_t rodataAddr = des.GetSecAddr(ElfSecName::RODATA);
+        uint64_t textAddr = des.GetSecAddr(ElfSecName::TEXT);
+        EXPECT_EQ(textAddr, rodataAddr + RODATA_SIZE);
+        EXPECT_EQ(reinterpret_cast<uint64_t>(des.GetArkStackMapRawPtr()), textAddr + TEXT_SIZE);
+        EXPECT_EQ(memcmp(reinterpret_cast<void *>(rodataAddr), rodata_, RODATA_SIZE), 0);
+        EXPECT_EQ(memcmp(reinterpret_cast<void *>(textAddr), text_, TEXT_SIZE), 0);
+        EXPECT_EQ(memcmp(des.GetArkStackMapRawPtr(), stackMap_.get(), STACK_MAP_SIZE), 0);
+
+        ASSERT_EQ(info.GetEntrySize(), 2U);
+        EXPECT_EQ(info.GetStubDes(0).codeAddr_, textAddr);
+        EXPECT_EQ(info.GetStubDes(1).codeAddr_, textAddr + FUNC_SIZE);
+        EXPECT_EQ(info.GetStubDes(1).indexInKindOrMethodId_, METHOD_ID);
+        EXPECT_EQ(info.GetMainFuncEntry(MAIN_METHOD_ID), textAddr);
+        EXPECT_EQ(info.GetMainFuncEntry(METHOD_ID), 0U);
+    }
+
+    static constexpr const char *AN_FILE_NAME = "aot_file_manager_test.an";
+    static constexpr uint32_t RODATA_SIZE = 24;
+    static constexpr uint32_t TEXT_SIZE = 128;
+    static constexpr uint32_t STACK_MAP_SIZE = 40;
+    static constexpr uint32_t FUNC_SIZE = 64;
+    static constexpr uint32_t FUNC_COUNT = 2;
+    static constexpr uint32_t MAIN_METHOD_ID = 1;
+    static constexpr uint32_t METHOD_ID = 2;
+
+    uint8_t rodata_[RODATA_SIZE] {};
+    uint8_t text_[TEXT_SIZE] {};
+    std::shared_ptr<uint8_t> stackMap_ {nullptr};
+};
+
+/**
+ * @tc.name: SaveAndLoadMapped
+ * @tc.desc: Save an AnFileInfo and load the file with its code mapped executable in place.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(AOTFileManagerTest, SaveAndLoadMapped)
+{
+    SaveAnFile();
+    AnFileInfo info;
+    ASSERT_TRUE(LoadAnFile(info, true));
+    EXPECT_TRUE(info.IsLoad());
+    EXPECT_TRUE(IsExecutableMapped(info));
+    // the code starts at an aligned file offset, so it keeps the alignment in the mapping.
+    uint64_t codeAddr = info.GetCodeUnits()[0].GetSecAddr(ElfSecName::RODATA);
+    EXPECT_EQ(codeAddr % 4_KB, 0U);
+    CheckLoadedAnFile(info);
+    info.Destroy();
+}
+
+/**
+ * @tc.name: SaveAndLoadCopied
+ * @tc.desc: Save an AnFileInfo and load the file through the read-only mapping, which copies the code out.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(AOTFileManagerTest, SaveAndLoadCopied)
+{
+    SaveAnFile();
+    AnFileInfo info;
+    ASSERT_TRUE(LoadAnFile(info, false));
+    EXPECT_FALSE(IsExecutableMapped(info));
+    CheckLoadedAnFile(info);
+    info.Destroy();
+}
+}  // namespace panda::test
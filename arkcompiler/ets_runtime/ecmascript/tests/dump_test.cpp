@@ -784,6 +784,13 @@ HWTEST_F_L0(EcmaDumpTest, HeapProfileDump)
                 DUMP_FOR_HANDLE(globalEnv->GetObjectFunction())
                 break;
             }
+            case JSType::TREE_STRING: {
+                JSHandle<EcmaString> first = factory->NewFromASCII("first part, ");
+                JSHandle<EcmaString> second = factory->NewFromASCII("second part");
+                JSHandle<EcmaString> treeString(thread, EcmaStringAccessor::Concat(thread->GetEcmaVM(), first, second));
+                DUMP_FOR_HANDLE(treeString)
+                break;
+            }
             case JSType::BIGINT: {
                 DUMP_FOR_HANDLE(globalEnv->GetBigIntFunction())
                 break;
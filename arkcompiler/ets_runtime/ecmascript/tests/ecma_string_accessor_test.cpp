@@ -14,6 +14,7 @@
  */
 
 #include "ecmascript/ecma_string-inl.h"
+#include "ecmascript/ecma_string_table.h"
 #include "ecmascript/object_factory.h"
 #include "ecmascript/tests/test_helper.h"
 
@@ -1634,4 +1635,76 @@ HWTEST_F_L0(EcmaStringAccessorTest, CanBeCompressed)
     EXPECT_TRUE(EcmaStringAccessor::CanBeCompressed(arrayU16Comp, sizeof(arrayU16Comp) / sizeof(arrayU16Comp[0])));
     EXPECT_FALSE(EcmaStringAccessor::CanBeCompressed(arrayU16NotComp, sizeof(arrayU16Comp) / sizeof(arrayU16Comp[0])));
 }
-}  // namespace panda::test
\ No newline at end of file
+
+/*
+ * @tc.name: TreeString
+ * @tc.desc: Check that concatenating long strings creates a tree string which reads, compares, hashes and flattens
+ *           like the equivalent flat string.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(EcmaStringAccessorTest, TreeString)
+{
+    ObjectFactory *factory = ecmaVMPtr->GetFactory();
+    JSHandle<EcmaString> first = factory->NewFromASCII("abcdefghij");
+    JSHandle<EcmaString> second = factory->NewFromUtf8("klmnopqrst开始");
+    JSHandle<EcmaString> flat = factory->NewFromUtf8("abcdefghijklmnopqrst开始");
+
+    JSHandle<EcmaString> shortConcat(thread, EcmaStringAccessor::Concat(ecmaVMPtr, first, factory->NewFromASCII("k")));
+    EXPECT_FALSE(EcmaStringAccessor(shortConcat).IsTreeString());
+
+    JSHandle<EcmaString> tree(thread, EcmaStringAccessor::Concat(ecmaVMPtr, first, second));
+    EXPECT_TRUE(EcmaStringAccessor(tree).IsTreeString());
+    EXPECT_FALSE(EcmaStringAccessor(tree).IsFlat());
+    EXPECT_TRUE(EcmaStringAccessor(tree).IsUtf16());
+    EXPECT_EQ(EcmaStringAccessor(tree).ObjectSize(), TreeEcmaString::SIZE);
+    EXPECT_EQ(EcmaStringAccessor(tree).GetLength(), EcmaStringAccessor(flat).GetLength());
+    for (uint32_t i = 0; i < EcmaStringAccessor(flat).GetLength(); i++) {
+        EXPECT_EQ(EcmaStringAccessor(tree).Get(i), EcmaStringAccessor(flat).Get(i));
+    }
+    EXPECT_EQ(EcmaStringAccessor(tree).ToStdString(), EcmaStringAccessor(flat).ToStdString());
+    EXPECT_TRUE(EcmaStringAccessor::StringsAreEqual(*tree, *flat));
+    EXPECT_EQ(EcmaStringAccessor::Compare(*tree, *flat), 0);
+    EXPECT_EQ(EcmaStringAccessor(tree).GetHashcode(), EcmaStringAccessor(flat).GetHashcode());
+
+    JSHandle<EcmaString> flattened(thread, EcmaStringAccessor::Flatten(ecmaVMPtr, tree));
+    EXPECT_FALSE(EcmaStringAccessor(flattened).IsTreeString());
+    EXPECT_TRUE(EcmaStringAccessor(tree).IsFlat());
+    EXPECT_TRUE(EcmaStringAccessor::StringsAreEqual(*flattened, *flat));
+    EXPECT_EQ(EcmaStringAccessor::Flatten(ecmaVMPtr, tree), *flattened);
+
+    JSHandle<EcmaString> nested(thread, EcmaStringAccessor::Concat(ecmaVMPtr, tree, tree));
+    EcmaString *interned = ecmaVMPtr->GetEcmaStringTable()->GetOrInternString(*nested);
+    EXPECT_FALSE(EcmaStringAccessor(interned).IsTreeString());
+    EXPECT_EQ(EcmaStringAccessor(interned).GetLength(), EcmaStringAccessor(flat).GetLength() * 2);
+}
+
+/*
+ * @tc.name: TreeStringCompareWithHandles
+ * @tc.desc: Check that comparing tree strings through handles flattens them once, so the raw readers of later
+ *           comparisons read the characters in place.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(EcmaStringAccessorTest, TreeStringCompareWithHandles)
+{
+    ObjectFactory *factory = ecmaVMPtr->GetFactory();
+    JSHandle<EcmaString> first = factory->NewFromASCII("abcdefghij");
+    JSHandle<EcmaString> second = factory->NewFromASCII("klmnopqrst");
+    JSHandle<EcmaString> flat = factory->NewFromASCII("abcdefghijklmnopqrst");
+    JSHandle<EcmaString> greater = factory->NewFromASCII("abcdefghijklmnopqrsu");
+
+    JSHandle<EcmaString> tree(thread, EcmaStringAccessor::Concat(ecmaVMPtr, first, second));
+    EXPECT_FALSE(EcmaStringAccessor(tree).IsFlat());
+    EXPECT_EQ(EcmaStringAccessor::Compare(ecmaVMPtr, tree, greater), -1);
+    EXPECT_TRUE(EcmaStringAccessor(tree).IsFlat());
+
+    JSHandle<EcmaString> otherTree(thread, EcmaStringAccessor::Concat(ecmaVMPtr, first, second));
+    EXPECT_FALSE(EcmaStringAccessor::StringsAreEqual(ecmaVMPtr, otherTree, first));
+    EXPECT_FALSE(EcmaStringAccessor(otherTree).IsFlat());
+    EXPECT_TRUE(EcmaStringAccessor::StringsAreEqual(ecmaVMPtr, otherTree, flat));
+    EXPECT_TRUE(EcmaStringAccessor(otherTree).IsFlat());
+    EXPECT_TRUE(EcmaStringAccessor::StringsAreEqual(ecmaVMPtr, tree, otherTree));
+    EXPECT_EQ(EcmaStringAccessor::Compare(ecmaVMPtr, greater, otherTree), 1);
+}
+}  // namespace panda::test
@@ -139,4 +139,64 @@ HWTEST_F_L0(EcmaStringTableTest, GetOrInternString_CheckStringTable)
     EcmaVM *vm = thread->GetEcmaVM();
     EXPECT_TRUE(vm->GetEcmaStringTable()->CheckStringTableValidity());
 }
+
+/**
+ * @tc.name: GetOrInternString_Resize
+ * @tc.desc: Intern enough strings to resize the table several times, every string must still be found while the
+             slots are moved and afterwards.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(EcmaStringTableTest, GetOrInternString_Resize)
+{
+    EcmaVM *vm = thread->GetEcmaVM();
+    EcmaStringTable *table = vm->GetEcmaStringTable();
+    size_t initialCapacity = table->GetCapacity();
+    size_t initialCount = table->GetStringCount();
+
+    constexpr uint32_t count = 10000;
+    JSHandle<TaggedArray> strings = vm->GetFactory()->NewTaggedArray(count);
+    for (uint32_t i = 0; i < count; i++) {
+        std::string str = "resize_" + std::to_string(i);
+        EcmaString *interned = table->GetOrInternString(reinterpret_cast<const uint8_t *>(str.c_str()),
+                                                        str.length(), true);
+        strings->Set(thread, i, JSTaggedValue(interned));
+        // the strings interned so far stay reachable while the table is being resized
+        uint32_t probe = i / 2;  // 2: look up an earlier string
+        std::string earlier = "resize_" + std::to_string(probe);
+        EXPECT_EQ(table->GetOrInternString(reinterpret_cast<const uint8_t *>(earlier.c_str()), earlier.length(), true),
+                  strings->Get(probe).GetTaggedObject());
+    }
+    EXPECT_GT(table->GetCapacity(), initialCapacity);
+    EXPECT_EQ(table->GetStringCount(), initialCount + count);
+    for (uint32_t i = 0; i < count; i++) {
+        std::string str = "resize_" + std::to_string(i);
+        EXPECT_EQ(table->GetOrInternString(reinterpret_cast<const uint8_t *>(str.c_str()), str.length(), true),
+                  strings->Get(i).GetTaggedObject());
+    }
+    EXPECT_TRUE(table->CheckStringTableValidity());
+}
+
+/**
+ * @tc.name: Reserve
+ * @tc.desc: Reserving room for strings grows the table up front, so interning them does not resize it again.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(EcmaStringTableTest, Reserve)
+{
+    EcmaVM *vm = thread->GetEcmaVM();
+    EcmaStringTable *table = vm->GetEcmaStringTable();
+
+    constexpr uint32_t count = 5000;
+    table->Reserve(count);
+    size_t capacity = table->GetCapacity();
+    EXPECT_GE(capacity * 3, (table->GetStringCount() + count) * 4);  // 3 / 4: maximum load of the table
+    for (uint32_t i = 0; i < count; i++) {
+        std::string str = "reserve_" + std::to_string(i);
+        table->GetOrInternString(reinterpret_cast<const uint8_t *>(str.c_str()), str.length(), true);
+    }
+    EXPECT_EQ(table->GetCapacity(), capacity);
+    EXPECT_TRUE(table->CheckStringTableValidity());
+}
 }  // namespace panda::test
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecmascript/tests/test_helper.h"
+
+#include "ecmascript/ecma_vm.h"
+#include "ecmascript/js_handle.h"
+#include "ecmascript/mem/concurrent_marker.h"
+#include "ecmascript/mem/gc_stats.h"
+#include "ecmascript/mem/incremental_marker.h"
+#include "ecmascript/mem/verification.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class IncrementalMarkingTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    void SetUp() override
+    {
+        JSRuntimeOptions options;
+        instance = JSNApi::CreateEcmaVM(options);
+        ASSERT_TRUE(instance != nullptr) << "Cannot create EcmaVM";
+        thread = instance->GetJSThread();
+        scope = new EcmaHandleScope(thread);
+        instance->SetEnableForceGC(false);
+        heap = const_cast<Heap *>(thread->GetEcmaVM()->GetHeap());
+        // behave like a device on which concurrent marking cannot get a gc thread
+        heap->GetConcurrentMarker()->ConfigConcurrentMark(false);
+        heap->GetIncrementalMarker()->ConfigIncrementalMark(true);
+    }
+
+    void TearDown() override
+    {
+        TestHelper::DestroyEcmaVMWithScope(instance, scope);
+    }
+
+    JSHandle<TaggedArray> CreateTaggedArray(uint32_t length, JSTaggedValue initVal, MemSpaceType spaceType)
+    {
+        ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
+        return factory->NewTaggedArray(length, initVal, spaceType);
+    }
+
+    EcmaVM *instance {nullptr};
+    ecmascript::EcmaHandleScope *scope {nullptr};
+    JSThread *thread {nullptr};
+    Heap *heap {nullptr};
+};
+
+/**
+ * @tc.name: MarkInSlices
+ * @tc.desc: Mark a large old space graph in short slices while the mutator keeps replacing its nodes, the objects
+ *           stored between two slices must survive the partial gc which finishes the marking.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(IncrementalMarkingTest, MarkInSlices)
+{
+    constexpr uint32_t length = 1_KB;
+    constexpr uint32_t childLength = 64;
+    constexpr float sliceTime = 0.1;  // 0.1: milliseconds
+    JSHandle<TaggedArray> rootArray = CreateTaggedArray(length, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+    for (uint32_t i = 0; i < length; i++) {
+        auto array = CreateTaggedArray(childLength, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+        rootArray->Set(thread, i, array);
+    }
+
+    IncrementalMarker *marker = heap->GetIncrementalMarker();
+    GCStats *stats = thread->GetEcmaVM()->GetEcmaGCStats();
+    size_t sliceCount = stats->GetIncrementalMarkSliceCount();
+    marker->TriggerIncrementalMark();
+    EXPECT_TRUE(marker->IsTriggeredIncrementalMark());
+    EXPECT_TRUE(thread->IsMarking());
+
+    uint32_t index = 0;
+    while (!marker->Mark(sliceTime)) {
+        // the old children become garbage, the new ones are only reachable through the write barrier
+        auto array = CreateTaggedArray(childLength, JSTaggedValue(static_cast<int>(index)), MemSpaceType::OLD_SPACE);
+        rootArray->Set(thread, index % length, array);
+        index++;
+    }
+    EXPECT_TRUE(thread->IsMarkFinished());
+    EXPECT_GT(stats->GetIncrementalMarkSliceCount(), sliceCount + 1);
+
+    heap->CollectGarbage(TriggerGCType::OLD_GC);
+    EXPECT_FALSE(marker->IsTriggeredIncrementalMark());
+    EXPECT_TRUE(thread->IsReadyToMark());
+    for (uint32_t i = 0; i < length; i++) {
+        JSTaggedValue child = rootArray->Get(i);
+        ASSERT_TRUE(child.IsTaggedArray());
+        EXPECT_EQ(TaggedArray::Cast(child.GetTaggedObject())->GetLength(), childLength);
+    }
+    EXPECT_EQ(Verification(heap).VerifyAll(), 0U);
+}
+
+/**
+ * @tc.name: FullGCDropsIncrementalMark
+ * @tc.desc: A full gc requested in the middle of incremental marking discards the partial mark result.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(IncrementalMarkingTest, FullGCDropsIncrementalMark)
+{
+    constexpr uint32_t length = 1_KB;
+    JSHandle<TaggedArray> rootArray = CreateTaggedArray(length, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+    for (uint32_t i = 0; i < length; i++) {
+        auto array = CreateTaggedArray(length, JSTaggedValue::Undefined(), MemSpaceType::OLD_SPACE);
+        rootArray->Set(thread, i, array);
+    }
+
+    IncrementalMarker *marker = heap->GetIncrementalMarker();
+    marker->TriggerIncrementalMark();
+    marker->Mark(0);
+    heap->CollectGarbage(TriggerGCType::FULL_GC);
+    EXPECT_FALSE(marker->IsTriggeredIncrementalMark());
+    EXPECT_TRUE(thread->IsReadyToMark());
+    for (uint32_t i = 0; i < length; i++) {
+        EXPECT_TRUE(rootArray->Get(i).IsTaggedArray());
+    }
+    EXPECT_EQ(Verification(heap).VerifyAll(), 0U);
+}
+}  // namespace panda::test
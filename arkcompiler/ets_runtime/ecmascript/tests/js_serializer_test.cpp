@@ -673,6 +673,27 @@ public:
         Destroy();
     }
 
+    void DenseArrayTest(std::pair<uint8_t *, size_t> data)
+    {
+        Init();
+        JSDeserializer deserializer(thread, data.first, data.second);
+        JSHandle<JSTaggedValue> res = deserializer.DeserializeJSTaggedValue();
+        EXPECT_TRUE(!res.IsEmpty()) << "[Empty] Deserialize dense JSArray fail";
+        EXPECT_TRUE(res->IsJSArray()) << "[NotJSArray] Deserialize dense JSArray fail";
+        JSHandle<JSArray> array = JSHandle<JSArray>::Cast(res);
+        EXPECT_EQ(array->GetArrayLength(), 100U); // 100 : test case
+        for (int i = 0; i < 100; i += 2) { // 100 : test case
+            JSHandle<JSTaggedValue> str = JSArray::FastGetPropertyByValue(thread, res, i);
+            EXPECT_TRUE(str->IsString());
+            EXPECT_EQ(std::strcmp(EcmaStringAccessor(str.GetObject<EcmaString>()).ToCString().c_str(), "status"), 0);
+            // content-equal strings are shared after deserialization
+            EXPECT_EQ(str.GetTaggedValue(), JSArray::FastGetPropertyByValue(thread, res, 0).GetTaggedValue());
+            JSHandle<JSTaggedValue> num = JSArray::FastGetPropertyByValue(thread, res, i + 1);
+            EXPECT_EQ(num->GetInt(), i + 1);
+        }
+        Destroy();
+    }
+
 private:
     EcmaVM *ecmaVm = nullptr;
     EcmaHandleScope *scope = nullptr;
@@ -1416,6 +1437,29 @@ HWTEST_F_L0(JSSerializerTest, SerializeTaggedArray)
     delete serializer;
 };
 
+HWTEST_F_L0(JSSerializerTest, SerializeDenseArrayWithRepeatedStrings)
+{
+    ObjectFactory *factory = ecmaVm->GetFactory();
+    JSHandle<JSArray> array = factory->NewJSArray();
+    for (int i = 0; i < 100; i += 2) { // 100 : test case
+        JSHandle<JSTaggedValue> str(factory->NewFromASCII("status"));
+        JSHandle<JSTaggedValue> num(thread, JSTaggedValue(i + 1));
+        JSArray::FastSetPropertyByValue(thread, JSHandle<JSTaggedValue>::Cast(array), i, str);
+        JSArray::FastSetPropertyByValue(thread, JSHandle<JSTaggedValue>::Cast(array), i + 1, num);
+    }
+
+    JSSerializer *serializer = new JSSerializer(thread);
+    bool success = serializer->SerializeJSTaggedValue(JSHandle<JSTaggedValue>::Cast(array));
+    EXPECT_TRUE(success);
+    std::pair<uint8_t *, size_t> data = serializer->ReleaseBuffer();
+    // each element value is written without its key and descriptor, and "status" is written only once
+    EXPECT_TRUE(data.second < 100 * 16); // 100 : elements, 16 : upper bound of bytes per element
+    JSDeserializerTest jsDeserializerTest;
+    std::thread t1(&JSDeserializerTest::DenseArrayTest, jsDeserializerTest, data);
+    t1.join();
+    delete serializer;
+};
+
 HWTEST_F_L0(JSSerializerTest, SerializeFunction)
 {
     ObjectFactory *factory = thread->GetEcmaVM()->GetFactory();
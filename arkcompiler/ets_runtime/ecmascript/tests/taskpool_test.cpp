@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ecmascript/taskpool/runner.h"
+#include "ecmascript/taskpool/work_stealing_queue.h"
+#include "ecmascript/tests/test_helper.h"
+
+using namespace panda::ecmascript;
+
+namespace panda::test {
+class TaskpoolTest : public testing::Test {
+public:
+    static void SetUpTestCase()
+    {
+        GTEST_LOG_(INFO) << "SetUpTestCase";
+    }
+
+    static void TearDownTestCase()
+    {
+        GTEST_LOG_(INFO) << "TearDownCase";
+    }
+
+    static void WaitUntil(const std::atomic<uint32_t> &counter, uint32_t expected)
+    {
+        while (counter.load() < expected) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+// Posts children from the taskpool thread running it, so they land in its work stealing queue.
+class SpawnTask : public Task {
+public:
+    SpawnTask(Runner *runner, uint32_t depth, std::atomic<uint32_t> *finished)
+        : Task(GLOBAL_TASK_ID), runner_(runner), depth_(depth), finished_(finished) {}
+    ~SpawnTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        if (depth_ > 0) {
+            runner_->PostTask(std::make_unique<SpawnTask>(runner_, depth_ - 1, finished_));
+            runner_->PostTask(std::make_unique<SpawnTask>(runner_, depth_ - 1, finished_));
+        }
+        finished_->fetch_add(1);
+        return true;
+    }
+
+    NO_COPY_SEMANTIC(SpawnTask);
+    NO_MOVE_SEMANTIC(SpawnTask);
+
+private:
+    Runner *runner_ {nullptr};
+    uint32_t depth_ {0};
+    std::atomic<uint32_t> *finished_ {nullptr};
+};
+
+// Keeps its thread busy until released.
+class BlockTask : public Task {
+public:
+    BlockTask(std::atomic<bool> *release, std::atomic<uint32_t> *started)
+        : Task(GLOBAL_TASK_ID), release_(release), started_(started) {}
+    ~BlockTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        started_->fetch_add(1);
+        while (!release_->load()) {
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    NO_COPY_SEMANTIC(BlockTask);
+    NO_MOVE_SEMANTIC(BlockTask);
+
+private:
+    std::atomic<bool> *release_ {nullptr};
+    std::atomic<uint32_t> *started_ {nullptr};
+};
+
+class RecordTask : public Task {
+public:
+    RecordTask(int32_t id, uint32_t tag, TaskPriority priority, std::vector<uint32_t> *order,
+        std::vector<uint32_t> *terminated, std::atomic<uint32_t> *finished)
+        : Task(id), tag_(tag), priority_(priority), order_(order), terminated_(terminated), finished_(finished) {}
+    ~RecordTask() override = default;
+
+    bool Run([[maybe_unused]] uint32_t threadIndex) override
+    {
+        // only used with a single taskpool thread
+        if (IsTerminate()) {
+            terminated_->push_back(tag_);
+        } else {
+            order_->push_back(tag_);
+        }
+        finished_->fetch_add(1);
+        return true;
+    }
+
+    TaskPriority GetPriority() const override
+    {
+        return priority_;
+    }
+
+    NO_COPY_SEMANTIC(RecordTask);
+    NO_MOVE_SEMANTIC(RecordTask);
+
+private:
+    uint32_t tag_ {0};
+    TaskPriority priority_ {TaskPriority::DEFAULT};
+    std::vector<uint32_t> *order_ {nullptr};
+    std::vector<uint32_t> *terminated_ {nullptr};
+    std::atomic<uint32_t> *finished_ {nullptr};
+};
+
+/**
+ * @tc.name: RunNestedTasks
+ * @tc.desc: Tasks posted from taskpool threads go to their own queues and are spread to the other threads by
+ *           stealing, every task runs exactly once.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TaskpoolTest, RunNestedTasks)
+{
+    constexpr uint32_t threadNum = 4;
+    constexpr uint32_t depth = 10;
+    constexpr uint32_t rootNum = 4;
+    constexpr uint32_t tasksPerRoot = (1U << (depth + 1)) - 1;
+    Runner runner(threadNum);
+    std::atomic<uint32_t> finished {0};
+    for (uint32_t i = 0; i < rootNum; i++) {
+        runner.PostTask(std::make_unique<SpawnTask>(&runner, depth, &finished));
+    }
+    WaitUntil(finished, rootNum * tasksPerRoot);
+    runner.TerminateThread();
+
+    EXPECT_EQ(finished.load(), rootNum * tasksPerRoot);
+    RunnerStatistics statistics = runner.GetStatistics();
+    EXPECT_EQ(statistics.postedTaskCount, rootNum * tasksPerRoot);
+    EXPECT_EQ(statistics.localTaskCount + statistics.sharedTaskCount + statistics.stolenTaskCount,
+        statistics.postedTaskCount);
+    EXPECT_GE(statistics.sharedTaskCount, rootNum);
+    EXPECT_GE(statistics.totalQueueLatency, statistics.maxQueueLatency);
+}
+
+/**
+ * @tc.name: PriorityOrder
+ * @tc.desc: Queued tasks are started by priority, tasks of the same priority in posting order.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TaskpoolTest, PriorityOrder)
+{
+    Runner runner(1);
+    std::atomic<bool> release {false};
+    std::atomic<uint32_t> started {0};
+    std::atomic<uint32_t> finished {0};
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> terminated;
+    runner.PostTask(std::make_unique<BlockTask>(&release, &started));
+    WaitUntil(started, 1);
+
+    runner.PostTask(std::make_unique<RecordTask>(1, 0, TaskPriority::LOW, &order, &terminated, &finished));
+    runner.PostTask(std::make_unique<RecordTask>(1, 1, TaskPriority::DEFAULT, &order, &terminated, &finished));
+    runner.PostTask(std::make_unique<RecordTask>(1, 2, TaskPriority::HIGH, &order, &terminated, &finished));
+    runner.PostTask(std::make_unique<RecordTask>(1, 3, TaskPriority::DEFAULT, &order, &terminated, &finished));
+    release = true;
+    WaitUntil(finished, 4);  // 4: record tasks
+    runner.TerminateThread();
+
+    std::vector<uint32_t> expected {2, 1, 3, 0};
+    EXPECT_EQ(order, expected);
+    EXPECT_TRUE(terminated.empty());
+}
+
+/**
+ * @tc.name: TerminateQueuedTask
+ * @tc.desc: TerminateTask marks the matching tasks which are queued, tasks posted later are not affected.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TaskpoolTest, TerminateQueuedTask)
+{
+    Runner runner(1);
+    std::atomic<bool> release {false};
+    std::atomic<uint32_t> started {0};
+    std::atomic<uint32_t> finished {0};
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> terminated;
+    runner.PostTask(std::make_unique<BlockTask>(&release, &started));
+    WaitUntil(started, 1);
+
+    runner.PostTask(std::make_unique<RecordTask>(1, 0, TaskPriority::DEFAULT, &order, &terminated, &finished));
+    runner.PostTask(std::make_unique<RecordTask>(2, 1, TaskPriority::DEFAULT, &order, &terminated, &finished));
+    runner.TerminateTask(1, TaskType::ALL);
+    runner.PostTask(std::make_unique<RecordTask>(1, 2, TaskPriority::DEFAULT, &order, &terminated, &finished));
+    release = true;
+    WaitUntil(finished, 3);  // 3: record tasks
+    runner.TerminateThread();
+
+    std::vector<uint32_t> expectedOrder {1, 2};
+    std::vector<uint32_t> expectedTerminated {0};
+    EXPECT_EQ(order, expectedOrder);
+    EXPECT_EQ(terminated, expectedTerminated);
+}
+
+/**
+ * @tc.name: WorkStealingQueueGrow
+ * @tc.desc: The owner pops the newest task and a thief the oldest one, also after the queue grew.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F_L0(TaskpoolTest, WorkStealingQueueGrow)
+{
+    constexpr uint32_t taskNum = 200;
+    std::atomic<uint32_t> finished {0};
+    std::vector<Task *> tasks;
+    WorkStealingQueue queue;
+    for (uint32_t i = 0; i < taskNum; i++) {
+        Task *task = new SpawnTask(nullptr, 0, &finished);
+        tasks.push_back(task);
+        queue.Push(task);
+    }
+    bool aborted = false;
+    Task *stolen = queue.Steal(&aborted);
+    EXPECT_FALSE(aborted);
+    EXPECT_EQ(stolen, tasks.front());
+    delete stolen;
+    for (uint32_t i = taskNum - 1; i > 0; i--) {
+        Task *task = queue.Pop();
+        EXPECT_EQ(task, tasks[i]);
+        delete task;
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+    EXPECT_EQ(queue.Pop(), nullptr);
+    EXPECT_EQ(queue.Steal(&aborted), nullptr);
+}
+}  // namespace panda::test
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+#coding: utf-8
+
+"""
+Copyright (c) 2023 Huawei Device Co., Ltd.
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+Description: compare files
+    expect_file is compared byte for byte with every file of compare_files,
+    stamp_file is written when all of them are identical
+"""
+
+import argparse
+import filecmp
+
+
+def parse_args():
+    """parse arguments."""
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--expect-file', help='file the others must be identical to')
+    parser.add_argument('--compare-files', nargs='+', help='files to compare with expect file')
+    parser.add_argument('--stamp-file', help='file written when all files are identical')
+    args = parser.parse_args()
+    return args
+
+
+def compare_files(args):
+    """compare every file with expect file."""
+    for compare_file in args.compare_files:
+        if not filecmp.cmp(args.expect_file, compare_file, shallow=False):
+            raise RuntimeError("[" + compare_file + "] differs from [" + args.expect_file + "]")
+    with open(args.stamp_file, 'w') as stamp:
+        stamp.write("identical\n")
+
+
+if __name__ == '__main__':
+    input_args = parse_args()
+    compare_files(input_args)
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+declare function print(arg:any):void;
+
+// the allocations below are only kept alive by frame states, the deoptimizer has to create them again
+function tryClosure(v: number): void {
+    let a: number = 1;
+    let f = function (): number {
+        return a;
+    };
+    let ret: number = a + v;
+    print(ret);
+}
+
+tryClosure(<number><Object>'a');
+
+function tryLiterals(v: number): void {
+    let a: number = 1;
+    let obj = {};
+    let arr = [];
+    let ret: number = a + v;
+    print(ret);
+}
+
+tryLiterals(<number><Object>'a');
+
+function tryLiteralsInLoop(v: number, n: number): void {
+    let ret: number = 0;
+    for (let i = 0; i < n; i++) {
+        let obj = {};
+        ret = ret + v;
+    }
+    print(ret);
+}
+
+tryLiteralsInLoop(<number><Object>'a', 2);
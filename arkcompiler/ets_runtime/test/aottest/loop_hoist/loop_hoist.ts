@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+declare function print(arg:any):void;
+
+// the type checks of arr and scale do not depend on the iteration and run once before the loop
+function sumArray(arr: number[], scale: number): number {
+    let sum: number = 0;
+    for (let i: number = 0; i < arr.length; i++) {
+        sum += arr[i] * scale;
+    }
+    return sum;
+}
+
+print(sumArray([1, 2, 3], 2));
+// the hoisted check fails and the loop runs in the interpreter from its first iteration
+print(sumArray([1, 2, 3], <number><Object>'2'));
+
+function scaleArray(ta: Float32Array, scale: number): void {
+    for (let i: number = 0; i < ta.length; i++) {
+        ta[i] = ta[i] * scale;
+    }
+}
+
+let ta1 = new Float32Array([1.5, 2, 3]);
+scaleArray(ta1, 2);
+print(ta1[0] + ta1[1] + ta1[2]);
+let ta2 = new Float32Array([1.5, 2, 3]);
+scaleArray(ta2, <number><Object>'3');
+print(ta2[0] + ta2[1] + ta2[2]);
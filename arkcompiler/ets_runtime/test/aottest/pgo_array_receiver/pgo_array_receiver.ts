@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+declare function print(arg:any):void;
+
+// the receivers have no static type, only the profile says they are arrays
+function getLength(a: any): any {
+    return a.length;
+}
+
+function getFirst(a: any): any {
+    return a[0];
+}
+
+let arr = [1, 2, 3];
+let sum = 0;
+for (let i = 0; i < 10000; i++) {
+    sum += getLength(arr) + getFirst(arr);
+}
+print(sum);
+
+// receivers which are not heap objects deopt before their hclass is loaded
+print(getLength(5));
+print(getFirst(1.5));
+print(getLength(true));
+// a heap object which is not an array fails the array check
+print(getFirst("xyz"));
+print(getLength([4, 5]));
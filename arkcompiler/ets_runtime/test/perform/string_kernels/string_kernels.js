@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// long inputs for the scanning and copying kernels of EcmaString, ascii strings are stored compressed and strings
+// with a character above 0xff are stored as utf16.
+function repeat(unit, count) {
+    let str = unit;
+    while (str.length < count) {
+        str += str;
+    }
+    return str.substring(0, count);
+}
+
+const LENGTH = 4096;
+const ascii = repeat("The quick brown fox jumps over the lazy dog. ", LENGTH);
+const wide = repeat("你好, the quick brown fox. ", LENGTH);
+// ascii text inside a utf16 string, substrings of it can be stored compressed again
+const mixed = "你" + ascii + "好";
+
+{
+    const codes = [];
+    for (let i = 0; i < 256; i++) {
+        codes.push(0x41 + i % 26);
+    }
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        String.fromCharCode.apply(null, codes);
+    }
+    const time2 = Date.now()
+    print("string CanBeCompressed utf16 to ascii : " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        mixed.substring(1, LENGTH + 1);
+    }
+    const time2 = Date.now()
+    print("string narrow utf16 to utf8 : " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        (ascii + "你").charCodeAt(0);
+    }
+    const time2 = Date.now()
+    print("string widen utf8 to utf16 : " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        ascii.indexOf("#");
+    }
+    const time2 = Date.now()
+    print("string indexOf ascii : " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        wide.indexOf("#");
+    }
+    const time2 = Date.now()
+    print("string indexOf utf16 : " + (time2 - time1));
+}
+
+{
+    const other = ascii.substring(0, LENGTH - 1) + "!";
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        ascii < other;
+    }
+    const time2 = Date.now()
+    print("string compare ascii : " + (time2 - time1));
+}
+
+{
+    const other = wide.substring(0, LENGTH - 1) + "!";
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        wide < other;
+    }
+    const time2 = Date.now()
+    print("string compare utf16 : " + (time2 - time1));
+}
+
+{
+    // every substring is a new string, its hash code is computed again
+    const map = new Map();
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        map.set(ascii.substring(i % 16, LENGTH), i);
+    }
+    const time2 = Date.now()
+    print("string hash ascii : " + (time2 - time1));
+}
+
+{
+    const map = new Map();
+    const time1 = Date.now()
+    for (let i = 0; i < 10000; ++i) {
+        map.set(wide.substring(i % 16, LENGTH), i);
+    }
+    const time2 = Date.now()
+    print("string hash utf16 : " + (time2 - time1));
+}
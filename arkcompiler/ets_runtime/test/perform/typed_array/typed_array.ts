@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+declare function print(arg:any):string;
+
+// numeric kernels over typed arrays, compiled ahead of time with the checks hoisted out of their loops
+const LENGTH: number = 10000;
+const ROUNDS: number = 1000;
+
+function scale(ta: Float32Array, factor: number): void {
+    for (let i: number = 0; i < ta.length; i++) {
+        ta[i] = ta[i] * factor;
+    }
+}
+
+function saxpy(a: number, x: Float32Array, y: Float32Array): void {
+    for (let i: number = 0; i < x.length; i++) {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+function dot(x: Float32Array, y: Float32Array): number {
+    let sum: number = 0;
+    for (let i: number = 0; i < x.length; i++) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+function prefixSum(ta: Float32Array): void {
+    for (let i: number = 1; i < ta.length; i++) {
+        ta[i] = ta[i] + ta[i - 1];
+    }
+}
+
+function sumArray(arr: number[]): number {
+    let sum: number = 0;
+    for (let i: number = 0; i < arr.length; i++) {
+        sum += arr[i];
+    }
+    return sum;
+}
+
+let x = new Float32Array(LENGTH);
+let y = new Float32Array(LENGTH);
+let arr: number[] = [];
+for (let i: number = 0; i < LENGTH; i++) {
+    x[i] = i % 10;
+    y[i] = 1;
+    arr.push(i % 10);
+}
+
+{
+    const time1 = Date.now();
+    for (let i: number = 0; i < ROUNDS; i++) {
+        scale(x, 1);
+    }
+    const time2 = Date.now();
+    print("Float32Array scale: " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now();
+    for (let i: number = 0; i < ROUNDS; i++) {
+        saxpy(0, x, y);
+    }
+    const time2 = Date.now();
+    print("Float32Array saxpy: " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now();
+    for (let i: number = 0; i < ROUNDS; i++) {
+        dot(x, y);
+    }
+    const time2 = Date.now();
+    print("Float32Array dot: " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now();
+    for (let i: number = 0; i < ROUNDS; i++) {
+        prefixSum(y);
+        y.fill(1);
+    }
+    const time2 = Date.now();
+    print("Float32Array prefix sum: " + (time2 - time1));
+}
+
+{
+    const time1 = Date.now();
+    for (let i: number = 0; i < ROUNDS; i++) {
+        sumArray(arr);
+    }
+    const time2 = Date.now();
+    print("Array sum: " + (time2 - time1));
+}
@@ -26,11 +26,21 @@ bool CpuFeaturesHasCrc32()
     // NOLINTNEXTLINE(hicpp-signed-bitwise)
     return (hwcaps & HWCAP_CRC32) != 0;
 }
+
+bool CpuFeaturesHasAvx2()
+{
+    return false;
+}
 #elif PANDA_TARGET_WINDOWS
 bool CpuFeaturesHasCrc32()
 {
     return false;
 }
+
+bool CpuFeaturesHasAvx2()
+{
+    return false;
+}
 #else
 #error "Unsupported target"
 #endif
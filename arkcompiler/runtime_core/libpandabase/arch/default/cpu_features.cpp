@@ -20,4 +20,13 @@ bool CpuFeaturesHasCrc32()
 {
     return false;
 }
+
+bool CpuFeaturesHasAvx2()
+{
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    return __builtin_cpu_supports("avx2") != 0;
+#else
+    return false;
+#endif
+}
 }  // namespace panda::compiler
@@ -17,6 +17,7 @@
 
 namespace panda::compiler {
 bool CpuFeaturesHasCrc32();
+bool CpuFeaturesHasAvx2();
 }  // namespace panda::compiler
 
 #endif  // PANDA_CPU_FEATURES_H_
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <memory>
 #include <string>
 #include <unzip.h>
 #include "res_desc.h"
@@ -27,6 +28,61 @@
 namespace OHOS {
 namespace Global {
 namespace Resource {
+/**
+ * Bytes of a resources.index. The file, or the hap entry when it is stored uncompressed, is mapped read only so
+ * that it is neither copied nor kept on the heap; otherwise the bytes are read into memory.
+ */
+class IndexBuffer {
+public:
+    IndexBuffer() = default;
+
+    ~IndexBuffer();
+
+    /**
+     * Map a range of a file
+     * @param path   the file path
+     * @param offset the offset of the range in the file
+     * @param len    the length of the range in bytes
+     * @return OK if the range is mapped, else UNKNOWN_ERROR. Always fails on platforms without mmap
+     */
+    int32_t MapFile(const char *path, size_t offset, size_t len);
+
+    /**
+     * Take over bytes which were read into memory
+     * @param buffer the bytes
+     * @param len    length in bytes
+     */
+    void Attach(std::unique_ptr<uint8_t[]> buffer, size_t len);
+
+    const char *GetData() const
+    {
+        return data_;
+    }
+
+    size_t GetLength() const
+    {
+        return len_;
+    }
+
+    bool IsMapped() const
+    {
+        return mapAddr_ != nullptr;
+    }
+
+private:
+    IndexBuffer(const IndexBuffer &) = delete;
+    IndexBuffer &operator=(const IndexBuffer &) = delete;
+
+    void Release();
+
+    std::unique_ptr<uint8_t[]> buffer_;
+    // the mapping starts at a page boundary, data_ points into it
+    void *mapAddr_ = nullptr;
+    size_t mapLen_ = 0;
+    const char *data_ = nullptr;
+    size_t len_ = 0;
+};
+
 class HapParser {
 public:
     /**
@@ -49,6 +105,14 @@ public:
      */
     static int32_t ReadIndexFromFile(const char *zipFile, std::unique_ptr<uint8_t[]> &buffer, size_t &bufLen);
 
+    /**
+     * Map resource.index in hap, read it when the entry is compressed
+     * @param zipFile hap file path
+     * @param buffer  holds the bytes of the index
+     * @return OK if success, else UNKNOWN_ERROR
+     */
+    static int32_t ReadIndexFromFile(const char *zipFile, IndexBuffer &buffer);
+
     /**
      * Read rawfile from hap
      * @param zipFile hap file path
@@ -17,8 +17,11 @@
 
 #include <map>
 #include <string>
+#include <string_view>
 #include <time.h>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include "res_desc.h"
 #include "res_config_impl.h"
 
@@ -222,7 +225,7 @@ public:
 
     size_t IdSize() const
     {
-        return idValuesMap_.size();
+        return idValuesTable_.size();
     }
 
 private:
@@ -232,6 +235,8 @@ private:
 
     void UpdateOverlayInfo(std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> &nameTypeId);
 
+    const IdValues *FindIdValuesByName(std::string_view name, const ResType resType) const;
+
     // must call Init() after constructor
     bool Init(bool system = false);
 
@@ -250,11 +255,12 @@ private:
     // resource information stored in resDesc_
     ResDesc *resDesc_;
 
-    std::map<uint32_t, IdValues *> idValuesMap_;
+    // sorted by id, looked up by binary search
+    std::vector<std::pair<uint32_t, IdValues *>> idValuesTable_;
 
-    // the key is name, each restype holds one map
-    // name may conflict in same restype !
-    std::vector<std::map<std::string, IdValues *> *> idValuesNameMap_;
+    // the names of each restype, sorted. The names point into resDesc_.
+    // name may conflict in same restype ! the id which comes first in the index keeps the name.
+    std::vector<std::vector<std::pair<std::string_view, IdValues *>>> idValuesNameTable_;
 
     // default resconfig
     const ResConfig *defaultConfig_;
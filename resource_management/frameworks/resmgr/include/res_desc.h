@@ -103,11 +103,11 @@ private:
 
 class IdParam {
 public:
-    ~IdParam();
     std::string ToString() const;
 
     uint32_t id_;
     uint32_t offset_;
+    // points into ResId::idItems_
     IdItem *idItem_;
 };
 
@@ -116,12 +116,13 @@ public:
     static const uint32_t RESID_HEADER_LEN = 8;
     static const uint32_t IDPARAM_HEADER_LEN = 8;
 
-    ~ResId();
     std::string ToString() const;
 
     char tag_[4];
     uint32_t count_; // ID count
-    std::vector<IdParam *> idParams_;
+    std::vector<IdParam> idParams_;
+    // the items of idParams_, sized once when parsed so that the pointers to them stay valid
+    std::vector<IdItem> idItems_;
 };
 
 /**
@@ -88,21 +88,13 @@ HapResource::~HapResource()
         delete (resDesc_);
         resDesc_ = nullptr;
     }
-    std::map<uint32_t, IdValues *>::iterator iter;
-    for (iter = idValuesMap_.begin(); iter != idValuesMap_.end(); ++iter) {
+    for (auto iter = idValuesTable_.begin(); iter != idValuesTable_.end(); ++iter) {
         if (iter->second != nullptr) {
             IdValues *ptr = iter->second;
             delete (ptr);
             iter->second = nullptr;
         }
     }
-
-    for (size_t i = 0; i < idValuesNameMap_.size(); ++i) {
-        if (idValuesNameMap_[i] != nullptr) {
-            delete (idValuesNameMap_[i]);
-            idValuesNameMap_[i] = nullptr;
-        }
-    }
     lastModTime_ = 0;
     // defaultConfig_ was passed by constructor, we do not delete it here
     defaultConfig_ = nullptr;
@@ -143,47 +135,53 @@ const HapResource* HapResource::Load(const char *path, const ResConfigImpl* defa
     }
 }
 
-const HapResource* HapResource::LoadFromIndex(const char *path, const ResConfigImpl *defaultConfig, bool system)
+int32_t ReadIndex(const char *path, IndexBuffer &buffer)
 {
-    char outPath[PATH_MAX + 1] = {0};
-    CanonicalizePath(path, outPath, PATH_MAX);
-    std::ifstream inFile(outPath, std::ios::binary | std::ios::in);
+    std::ifstream inFile(path, std::ios::binary | std::ios::in);
     if (!inFile.good()) {
-        return nullptr;
+        return UNKNOWN_ERROR;
     }
     inFile.seekg(0, std::ios::end);
     int bufLen = inFile.tellg();
     if (bufLen <= 0) {
         HILOG_ERROR("file size is zero");
         inFile.close();
-        return nullptr;
+        return UNKNOWN_ERROR;
     }
-    void *buf = malloc(bufLen);
-    if (buf == nullptr) {
-        HILOG_ERROR("Error allocating memory");
+    if (buffer.MapFile(path, 0, bufLen) == OK) {
         inFile.close();
-        return nullptr;
+        return OK;
     }
+    std::unique_ptr<uint8_t[]> buf = std::make_unique<uint8_t[]>(bufLen);
     inFile.seekg(0, std::ios::beg);
-    inFile.read(static_cast<char *>(buf), bufLen);
+    inFile.read(reinterpret_cast<char *>(buf.get()), bufLen);
     inFile.close();
+    buffer.Attach(std::move(buf), bufLen);
+    return OK;
+}
 
-    HILOG_DEBUG("extract success, bufLen:%d", bufLen);
+const HapResource* HapResource::LoadFromIndex(const char *path, const ResConfigImpl *defaultConfig, bool system)
+{
+    char outPath[PATH_MAX + 1] = {0};
+    CanonicalizePath(path, outPath, PATH_MAX);
+    IndexBuffer buffer;
+    if (ReadIndex(outPath, buffer) != OK) {
+        return nullptr;
+    }
+
+    HILOG_DEBUG("extract success, bufLen:%zu, mapped:%d", buffer.GetLength(), buffer.IsMapped());
 
     ResDesc *resDesc = new (std::nothrow) ResDesc();
     if (resDesc == nullptr) {
         HILOG_ERROR("new ResDesc failed when LoadFromIndex");
-        free(buf);
         return nullptr;
     }
-    int32_t out = HapParser::ParseResHex(static_cast<char *>(buf), bufLen, *resDesc, defaultConfig);
+    int32_t out = HapParser::ParseResHex(buffer.GetData(), buffer.GetLength(), *resDesc, defaultConfig);
     if (out != OK) {
         delete (resDesc);
-        free(buf);
         HILOG_ERROR("ParseResHex failed! retcode:%d", out);
         return nullptr;
     }
-    free(buf);
 
     HapResource *pResource = new (std::nothrow) HapResource(std::string(path), 0, defaultConfig, resDesc);
     if (pResource == nullptr) {
@@ -200,9 +198,8 @@ const HapResource* HapResource::LoadFromIndex(const char *path, const ResConfigI
 
 const HapResource* HapResource::LoadFromHap(const char *path, const ResConfigImpl *defaultConfig, bool system)
 {
-    std::unique_ptr<uint8_t[]> tmpBuf;
-    size_t tmpLen;
-    int32_t ret = HapParser::ReadIndexFromFile(path, tmpBuf, tmpLen);
+    IndexBuffer buffer;
+    int32_t ret = HapParser::ReadIndexFromFile(path, buffer);
     if (ret != OK) {
         HILOG_ERROR("read Index from file failed");
         return nullptr;
@@ -212,7 +209,7 @@ const HapResource* HapResource::LoadFromHap(const char *path, const ResConfigImp
         HILOG_ERROR("new ResDesc failed when LoadFromHap");
         return nullptr;
     }
-    int32_t out = HapParser::ParseResHex(reinterpret_cast<char *>(tmpBuf.get()), tmpLen, *resDesc, defaultConfig);
+    int32_t out = HapParser::ParseResHex(buffer.GetData(), buffer.GetLength(), *resDesc, defaultConfig);
     if (out != OK) {
         HILOG_ERROR("ParseResHex failed! retcode:%d", out);
         delete (resDesc);
@@ -279,7 +276,7 @@ const std::unordered_map<std::string, HapResource *> HapResource::LoadOverlays(c
 std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> HapResource::BuildNameTypeIdMapping() const
 {
     std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> result;
-    for (auto iter = idValuesMap_.begin(); iter != idValuesMap_.end(); iter++) {
+    for (auto iter = idValuesTable_.begin(); iter != idValuesTable_.end(); iter++) {
         const std::vector<ValueUnderQualifierDir *> &limitPaths = iter->second->GetLimitPathsConst();
         if (limitPaths.size() > 0) {
             ValueUnderQualifierDir* value = limitPaths[0];
@@ -291,8 +288,8 @@ std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> HapResour
 
 void HapResource::UpdateOverlayInfo(std::unordered_map<std::string, std::unordered_map<ResType, uint32_t>> &nameTypeId)
 {
-    std::map<uint32_t, IdValues *> newIdValuesMap;
-    for (auto iter = idValuesMap_.begin(); iter != idValuesMap_.end(); iter++) {
+    std::vector<std::pair<uint32_t, IdValues *>> newIdValuesTable;
+    for (auto iter = idValuesTable_.begin(); iter != idValuesTable_.end(); iter++) {
         const std::vector<ValueUnderQualifierDir *> &limitPaths = iter->second->GetLimitPathsConst();
         if (limitPaths.size() > 0) {
             ValueUnderQualifierDir *value = limitPaths[0];
@@ -310,10 +307,20 @@ void HapResource::UpdateOverlayInfo(std::unordered_map<std::string, std::unorder
                 item->idItem_->id_ = newId;
                 item->isOverlay_ = true;
             });
-            newIdValuesMap[newId] = iter->second;
+            newIdValuesTable.emplace_back(newId, iter->second);
+        }
+    }
+    std::stable_sort(newIdValuesTable.begin(), newIdValuesTable.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; });
+    // when two ids map to the same new id the later one wins
+    idValuesTable_.clear();
+    for (auto &entry : newIdValuesTable) {
+        if (!idValuesTable_.empty() && idValuesTable_.back().first == entry.first) {
+            idValuesTable_.back() = entry;
+        } else {
+            idValuesTable_.push_back(entry);
         }
     }
-    idValuesMap_.swap(newIdValuesMap);
 }
 
 bool HapResource::Init(bool system)
@@ -341,14 +348,6 @@ bool HapResource::Init(bool system)
     }
     resourcePath_ = indexPath_.substr(0, index + 1);
 #endif
-    for (int i = 0; i < ResType::MAX_RES_TYPE; ++i) {
-        auto mptr = new (std::nothrow) std::map<std::string, IdValues *>();
-        if (mptr == nullptr) {
-            HILOG_ERROR("new std::map failed in HapResource::Init");
-            return false;
-        }
-        idValuesNameMap_.push_back(mptr);
-    }
     return InitIdList(system);
 }
 
@@ -358,39 +357,63 @@ bool HapResource::InitIdList(bool system)
         HILOG_ERROR("resDesc_ is null ! InitIdList failed");
         return false;
     }
-    for (size_t i = 0; i < resDesc_->keys_.size(); i++) {
-        ResKey *resKey = resDesc_->keys_[i];
-
-        for (size_t j = 0; j < resKey->resId_->idParams_.size(); ++j) {
-            IdParam *idParam = resKey->resId_->idParams_[j];
-            uint32_t id = idParam->id_;
-            std::map<uint32_t, IdValues *>::iterator iter = idValuesMap_.find(id);
-            if (iter == idValuesMap_.end()) {
-                auto idValues = new (std::nothrow) HapResource::IdValues();
-                if (idValues == nullptr) {
-                    HILOG_ERROR("new IdValues failed in HapResource::InitIdList");
-                    return false;
-                }
-                auto limitPath = new (std::nothrow) HapResource::ValueUnderQualifierDir(resKey->keyParams_,
-                    idParam->idItem_, this, false, system);
-                if (limitPath == nullptr) {
-                    HILOG_ERROR("new ValueUnderQualifierDir failed in HapResource::InitIdList");
-                    delete (idValues);
-                    return false;
-                }
-                idValues->AddLimitPath(limitPath);
-                idValuesMap_.insert(std::make_pair(id, idValues));
-                std::string name = std::string(idParam->idItem_->name_);
-                idValuesNameMap_[idParam->idItem_->resType_]->insert(std::make_pair(name, idValues));
-            } else {
-                HapResource::IdValues *idValues = iter->second;
-                auto limitPath = new (std::nothrow) HapResource::ValueUnderQualifierDir(resKey->keyParams_,
-                    idParam->idItem_, this, false, system);
-                if (limitPath == nullptr) {
-                    HILOG_ERROR("new ValueUnderQualifierDir failed in HapResource::InitIdList");
-                    return false;
-                }
-                idValues->AddLimitPath(limitPath);
+    // every (key, id) pair in index order, stable sorting them by id keeps the limit paths of an id in key order
+    struct IdEntry {
+        uint32_t id;
+        uint32_t keyIndex;
+        uint32_t paramIndex;
+        uint32_t order;
+    };
+    std::vector<IdEntry> entries;
+    for (uint32_t i = 0; i < resDesc_->keys_.size(); i++) {
+        const ResId *resId = resDesc_->keys_[i]->resId_;
+        for (uint32_t j = 0; j < resId->idParams_.size(); ++j) {
+            entries.push_back({resId->idParams_[j].id_, i, j, static_cast<uint32_t>(entries.size())});
+        }
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const IdEntry &a, const IdEntry &b) { return a.id < b.id; });
+
+    struct NameEntry {
+        std::string_view name;
+        uint32_t order;
+        IdValues *idValues;
+    };
+    std::vector<std::vector<NameEntry>> names(ResType::MAX_RES_TYPE);
+    for (size_t begin = 0, end = 0; begin < entries.size(); begin = end) {
+        auto idValues = new (std::nothrow) HapResource::IdValues();
+        if (idValues == nullptr) {
+            HILOG_ERROR("new IdValues failed in HapResource::InitIdList");
+            return false;
+        }
+        idValuesTable_.emplace_back(entries[begin].id, idValues);
+        for (end = begin; end < entries.size() && entries[end].id == entries[begin].id; ++end) {
+            ResKey *resKey = resDesc_->keys_[entries[end].keyIndex];
+            IdItem *idItem = resKey->resId_->idParams_[entries[end].paramIndex].idItem_;
+            auto limitPath = new (std::nothrow) HapResource::ValueUnderQualifierDir(resKey->keyParams_,
+                idItem, this, false, system);
+            if (limitPath == nullptr) {
+                HILOG_ERROR("new ValueUnderQualifierDir failed in HapResource::InitIdList");
+                return false;
+            }
+            idValues->AddLimitPath(limitPath);
+        }
+        const IdItem *first = idValues->GetLimitPathsConst()[0]->GetIdItem();
+        if (first->resType_ >= 0 && first->resType_ < ResType::MAX_RES_TYPE) {
+            names[first->resType_].push_back({first->name_, entries[begin].order, idValues});
+        }
+    }
+
+    idValuesNameTable_.resize(ResType::MAX_RES_TYPE);
+    for (size_t type = 0; type < names.size(); ++type) {
+        std::vector<NameEntry> &typeNames = names[type];
+        std::sort(typeNames.begin(), typeNames.end(), [](const NameEntry &a, const NameEntry &b) {
+            return a.name < b.name || (a.name == b.name && a.order < b.order);
+        });
+        auto &table = idValuesNameTable_[type];
+        table.reserve(typeNames.size());
+        for (const NameEntry &entry : typeNames) {
+            if (table.empty() || table.back().first != entry.name) {
+                table.emplace_back(entry.name, entry.idValues);
             }
         }
     }
@@ -399,42 +422,51 @@ bool HapResource::InitIdList(bool system)
 
 const HapResource::IdValues *HapResource::GetIdValues(const uint32_t id) const
 {
-    if (idValuesMap_.empty()) {
-        HILOG_ERROR("idValuesMap_ is empty");
+    if (idValuesTable_.empty()) {
+        HILOG_ERROR("idValuesTable_ is empty");
         return nullptr;
     }
-    uint32_t uid = id;
-    std::map<uint32_t, IdValues *>::const_iterator iter = idValuesMap_.find(uid);
-    if (iter == idValuesMap_.end()) {
+    auto iter = std::lower_bound(idValuesTable_.begin(), idValuesTable_.end(), id,
+        [](const std::pair<uint32_t, IdValues *> &entry, uint32_t value) { return entry.first < value; });
+    if (iter == idValuesTable_.end() || iter->first != id) {
         return nullptr;
     }
 
     return iter->second;
 }
 
-const HapResource::IdValues *HapResource::GetIdValuesByName(
-    const std::string name, const ResType resType) const
+const HapResource::IdValues *HapResource::FindIdValuesByName(std::string_view name, const ResType resType) const
 {
-    const std::map<std::string, IdValues *> *map = idValuesNameMap_[resType];
-    std::map<std::string, IdValues *>::const_iterator iter = map->find(name);
-    if (iter == map->end()) {
+    if (resType < 0 || resType >= static_cast<int>(idValuesNameTable_.size())) {
+        return nullptr;
+    }
+    const auto &table = idValuesNameTable_[resType];
+    auto iter = std::lower_bound(table.begin(), table.end(), name,
+        [](const std::pair<std::string_view, IdValues *> &entry, std::string_view value) {
+            return entry.first < value;
+        });
+    if (iter == table.end() || iter->first != name) {
         return nullptr;
     }
 
     return iter->second;
 }
 
+const HapResource::IdValues *HapResource::GetIdValuesByName(
+    const std::string name, const ResType resType) const
+{
+    return FindIdValuesByName(name, resType);
+}
+
 int HapResource::GetIdByName(const char *name, const ResType resType) const
 {
     if (name == nullptr) {
         return -1;
     }
-    const std::map<std::string, IdValues *> *map = idValuesNameMap_[resType];
-    std::map<std::string, IdValues *>::const_iterator iter = map->find(name);
-    if (iter == map->end()) {
+    const IdValues *ids = FindIdValuesByName(name, resType);
+    if (ids == nullptr) {
         return OBJ_NOT_FOUND;
     }
-    const IdValues *ids = iter->second;
 
     if (ids->GetLimitPathsConst().size() == 0) {
         HILOG_ERROR("limitPaths empty");
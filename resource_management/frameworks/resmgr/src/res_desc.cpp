@@ -267,35 +267,17 @@ std::string IdItem::ToString() const
     return ret;
 }
 
-IdParam::~IdParam()
-{
-    if (idItem_ != nullptr) {
-        delete (idItem_);
-        idItem_ = nullptr;
-    }
-}
-
 std::string IdParam::ToString() const
 {
     return FormatString("[id:%u, offset:%u, data:%s]", id_, offset_,
         idItem_->ToString().c_str());
 }
 
-ResId::~ResId()
-{
-    for (size_t i = 0; i < idParams_.size(); ++i) {
-        if (idParams_[i] != nullptr) {
-            delete idParams_[i];
-            idParams_[i] = nullptr;
-        }
-    }
-}
-
 std::string ResId::ToString() const
 {
     std::string ret = FormatString("idcount:%u, ", count_);
     for (size_t i = 0; i < idParams_.size(); ++i) {
-        ret.append(idParams_[i]->ToString());
+        ret.append(idParams_[i].ToString());
     }
     return ret;
 }
@@ -20,6 +20,10 @@
 #include <fcntl.h>
 #include <unzip.h>
 #include <unistd.h>
+#if !defined(__WINNT__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include "hilog_wrapper.h"
 #include "locale_matcher.h"
@@ -37,6 +41,71 @@ namespace Global {
 namespace Resource {
 const char *HapParser::RES_FILE_NAME = "/resources.index";
 
+IndexBuffer::~IndexBuffer()
+{
+    Release();
+}
+
+void IndexBuffer::Release()
+{
+#if !defined(__WINNT__)
+    if (mapAddr_ != nullptr) {
+        munmap(mapAddr_, mapLen_);
+    }
+#endif
+    mapAddr_ = nullptr;
+    mapLen_ = 0;
+    buffer_.reset();
+    data_ = nullptr;
+    len_ = 0;
+}
+
+int32_t IndexBuffer::MapFile(const char *path, size_t offset, size_t len)
+{
+#if defined(__WINNT__)
+    return UNKNOWN_ERROR;
+#else
+    if (path == nullptr || len == 0) {
+        return UNKNOWN_ERROR;
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        HILOG_ERROR("open %{public}s failed in MapFile, errno:%{public}d", path, errno);
+        return UNKNOWN_ERROR;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || static_cast<uint64_t>(fileStat.st_size) < offset + len) {
+        HILOG_ERROR("the range to map exceeds %{public}s", path);
+        close(fd);
+        return UNKNOWN_ERROR;
+    }
+    // mmap offset must be page aligned
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t pageOffset = offset % pageSize;
+    size_t mapLen = len + pageOffset;
+    void *addr = mmap(nullptr, mapLen, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset - pageOffset));
+    close(fd);
+    if (addr == MAP_FAILED) {
+        HILOG_ERROR("mmap %{public}s failed, errno:%{public}d", path, errno);
+        return UNKNOWN_ERROR;
+    }
+    Release();
+    mapAddr_ = addr;
+    mapLen_ = mapLen;
+    data_ = static_cast<const char *>(addr) + pageOffset;
+    len_ = len;
+    return OK;
+#endif
+}
+
+void IndexBuffer::Attach(std::unique_ptr<uint8_t[]> buffer, size_t len)
+{
+    Release();
+    buffer_ = std::move(buffer);
+    data_ = reinterpret_cast<const char *>(buffer_.get());
+    len_ = len;
+}
+
 int32_t LocateFile(unzFile &uf, const char *fileName)
 {
     if (unzLocateFile2(uf, fileName, 1)) { // try to locate file inside zip, 1 = case sensitive
@@ -185,6 +254,47 @@ int32_t HapParser::ReadIndexFromFile(const char *zipFile, std::unique_ptr<uint8_
     return ReadFileInfoFromZip(uf, indexFilePath.c_str(), buffer, bufLen);
 }
 
+int32_t MapFileInfoFromZip(const char *zipFile, unzFile &uf, const char *fileName, IndexBuffer &buffer)
+{
+    unz_file_info fileInfo;
+    if (LocateFile(uf, fileName) != OK || GetCurrentFileInfo(uf, fileInfo) != OK) {
+        unzClose(uf);
+        return UNKNOWN_ERROR;
+    }
+    // a stored and unencrypted entry is a plain byte range of the hap, map it in place
+    if (fileInfo.compression_method == 0 && (fileInfo.flag & 1) == 0 && unzOpenCurrentFile(uf) == UNZ_OK) {
+        ZPOS64_T pos = unzGetCurrentFileZStreamPos64(uf);
+        unzCloseCurrentFile(uf);
+        if (buffer.MapFile(zipFile, pos, fileInfo.uncompressed_size) == OK) {
+            unzClose(uf);
+            return OK;
+        }
+    }
+    std::unique_ptr<uint8_t[]> tmpBuf;
+    size_t tmpLen = 0;
+    int32_t ret = ReadCurrentFile(uf, fileInfo, tmpBuf, tmpLen);
+    unzClose(uf);
+    if (ret != OK) {
+        return UNKNOWN_ERROR;
+    }
+    buffer.Attach(std::move(tmpBuf), tmpLen);
+    return OK;
+}
+
+int32_t HapParser::ReadIndexFromFile(const char *zipFile, IndexBuffer &buffer)
+{
+    unzFile uf = unzOpen64(zipFile);
+    if (uf == nullptr) {
+        HILOG_ERROR("Error open %{public}s in ReadIndexFromFile %{public}d", zipFile, errno);
+        return UNKNOWN_ERROR;
+    } // file is open
+    if (IsStageMode(uf)) {
+        return MapFileInfoFromZip(zipFile, uf, "resources.index", buffer);
+    }
+    std::string indexFilePath = GetIndexFilePath(uf);
+    return MapFileInfoFromZip(zipFile, uf, indexFilePath.c_str(), buffer);
+}
+
 int32_t ReadRawFileInfoFromHap(const char *zipFile, unzFile &uf, const char *fileName,
     std::unique_ptr<uint8_t[]> &buffer, size_t &bufLen, std::unique_ptr<ResourceManager::RawFile> &rawFile)
 {
@@ -330,7 +440,7 @@ int32_t ParseIdItem(const char *buffer, uint32_t &offset, IdItem *idItem)
     return OK;
 }
 
-int32_t ParseId(const char *buffer, uint32_t &offset, ResId *id)
+int32_t ParseId(const char *buffer, const size_t bufLen, uint32_t &offset, ResId *id)
 {
     errno_t eret = memcpy_s(id, sizeof(ResId), buffer + offset, ResId::RESID_HEADER_LEN);
     if (eret != OK) {
@@ -341,33 +451,27 @@ int32_t ParseId(const char *buffer, uint32_t &offset, ResId *id)
         || id->tag_[2] != 'S' || id->tag_[3] != 'S') {
         return -1;
     }
+    if (offset > bufLen || static_cast<uint64_t>(id->count_) * ResId::IDPARAM_HEADER_LEN > bufLen - offset) {
+        HILOG_ERROR("id count %u exceeds the index file", id->count_);
+        return SYS_ERROR;
+    }
+    // one allocation for all the ids of a key, the items never move once the vector is sized
+    id->idParams_.resize(id->count_);
+    id->idItems_.resize(id->count_);
     for (uint32_t i = 0; i < id->count_; ++i) {
-        IdParam *ip = new (std::nothrow) IdParam();
-        if (ip == nullptr) {
-            HILOG_ERROR("new IdParam failed when ParseId");
-            return SYS_ERROR;
-        }
+        IdParam *ip = &id->idParams_[i];
         errno_t eret = memcpy_s(ip, sizeof(IdParam), buffer + offset, ResId::IDPARAM_HEADER_LEN);
         if (eret != OK) {
-            delete (ip);
             return SYS_ERROR;
         }
         offset += ResId::IDPARAM_HEADER_LEN;
-        IdItem *idItem = new (std::nothrow) IdItem();
-        if (idItem == nullptr) {
-            HILOG_ERROR("new IdItem failed when ParseId");
-            delete (ip);
-            return SYS_ERROR;
-        }
+        IdItem *idItem = &id->idItems_[i];
         uint32_t ipOffset = ip->offset_;
         int32_t ret = ParseIdItem(buffer, ipOffset, idItem);
         if (ret != OK) {
-            delete (ip);
-            delete (idItem);
             return ret;
         }
         ip->idItem_ = idItem;
-        id->idParams_.push_back(ip);
     }
 
     return OK;
@@ -391,7 +495,7 @@ bool IsLocaleMatch(const ResConfigImpl *defaultConfig, const std::vector<KeyPara
     return false;
 }
 
-int32_t ParseKey(const char *buffer, uint32_t &offset,  ResKey *key,
+int32_t ParseKey(const char *buffer, const size_t bufLen, uint32_t &offset,  ResKey *key,
                  bool &match, const ResConfigImpl *defaultConfig)
 {
     errno_t eret = memcpy_s(key, sizeof(ResKey), buffer + offset, ResKey::RESKEY_HEADER_LEN);
@@ -428,7 +532,7 @@ int32_t ParseKey(const char *buffer, uint32_t &offset,  ResKey *key,
         HILOG_ERROR("new ResId failed when ParseKey");
         return SYS_ERROR;
     }
-    int32_t ret = ParseId(buffer, idOffset, id);
+    int32_t ret = ParseId(buffer, bufLen, idOffset, id);
     if (ret != OK) {
         delete (id);
         return ret;
@@ -466,7 +570,7 @@ int32_t HapParser::ParseResHex(const char *buffer, const size_t bufLen, ResDesc
             return SYS_ERROR;
         }
         bool match = true;
-        int32_t ret = ParseKey(buffer, offset, key, match, defaultConfig);
+        int32_t ret = ParseKey(buffer, bufLen, offset, key, match, defaultConfig);
         if (ret != OK) {
             delete (key);
             return ret;
@@ -16,6 +16,7 @@
 #include "hap_resource_test.h"
 
 #include <climits>
+#include <fstream>
 #include <gtest/gtest.h>
 
 #include "hap_parser.h"
@@ -302,4 +303,114 @@ HWTEST_F(HapResourceTest, HapResourceFuncTest004, TestSize.Level1)
     resDesc = LoadFromHap(FormatFullPath("err-config.json-2.hap").c_str(), nullptr);
     ASSERT_TRUE(resDesc == nullptr);
 }
+
+/*
+ * @tc.name: HapResourceFuncTest005
+ * @tc.desc: Test HapParser::ReadIndexFromFile with IndexBuffer, the index parses the same as the copied one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, HapResourceFuncTest005, TestSize.Level1)
+{
+    std::string hapPath = FormatFullPath("all.hap");
+    std::unique_ptr<uint8_t[]> buf;
+    size_t bufLen;
+    ASSERT_EQ(OK, HapParser::ReadIndexFromFile(hapPath.c_str(), buf, bufLen));
+    IndexBuffer buffer;
+    ASSERT_EQ(OK, HapParser::ReadIndexFromFile(hapPath.c_str(), buffer));
+    ASSERT_EQ(bufLen, buffer.GetLength());
+    EXPECT_EQ(0, memcmp(buf.get(), buffer.GetData(), bufLen));
+
+    ResDesc copied;
+    ResDesc mapped;
+    ASSERT_EQ(OK, HapParser::ParseResHex(reinterpret_cast<char *>(buf.get()), bufLen, copied, nullptr));
+    ASSERT_EQ(OK, HapParser::ParseResHex(buffer.GetData(), buffer.GetLength(), mapped, nullptr));
+    EXPECT_EQ(copied.ToString(), mapped.ToString());
+
+    // a truncated index is rejected instead of read past its end
+    ResDesc truncated;
+    EXPECT_NE(OK, HapParser::ParseResHex(buffer.GetData(), buffer.GetLength() / 2, truncated, nullptr));
+}
+
+/*
+ * @tc.name: HapResourceFuncTest006
+ * @tc.desc: Test the lookups by id and by name agree.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, HapResourceFuncTest006, TestSize.Level1)
+{
+    const HapResource *pResource = HapResource::LoadFromIndex(FormatFullPath(g_resFilePath).c_str(), nullptr);
+    ASSERT_TRUE(pResource != nullptr);
+    ASSERT_GT(pResource->IdSize(), 0);
+
+    std::vector<std::pair<std::string, ResType>> names = {
+        {"integer_ref", ResType::INTEGER}, {"string_ref", ResType::STRING}, {"boolean_ref", ResType::BOOLEAN},
+        {"color_ref", ResType::COLOR}, {"float_ref", ResType::FLOAT}, {"intarray_1", ResType::INTARRAY},
+        {"child", ResType::PATTERN},
+    };
+    for (auto &name : names) {
+        const HapResource::IdValues *idv = pResource->GetIdValuesByName(name.first, name.second);
+        ASSERT_TRUE(idv != nullptr);
+        int id = pResource->GetIdByName(name.first.c_str(), name.second);
+        ASSERT_GT(id, 0);
+        EXPECT_EQ(idv, pResource->GetIdValues(id));
+        EXPECT_EQ(name.first, idv->GetLimitPathsConst()[0]->GetIdItem()->name_);
+    }
+    EXPECT_TRUE(pResource->GetIdValues(0) == nullptr);
+    EXPECT_TRUE(pResource->GetIdValuesByName(std::string("no_such_name"), ResType::STRING) == nullptr);
+    EXPECT_EQ(OBJ_NOT_FOUND, pResource->GetIdByName("no_such_name", ResType::STRING));
+    delete pResource;
+}
+
+/*
+ * @tc.name: HapResourceFuncTest007
+ * @tc.desc: Test IndexBuffer maps resources.index, and the read buffer used when mapping fails parses the same.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapResourceTest, HapResourceFuncTest007, TestSize.Level1)
+{
+    std::string path = FormatFullPath(g_resFilePath);
+    std::ifstream inFile(path, std::ios::binary | std::ios::in);
+    ASSERT_TRUE(inFile.good());
+    inFile.seekg(0, std::ios::end);
+    size_t bufLen = static_cast<size_t>(inFile.tellg());
+    ASSERT_GT(bufLen, static_cast<size_t>(0));
+    std::unique_ptr<uint8_t[]> buf = std::make_unique<uint8_t[]>(bufLen);
+    inFile.seekg(0, std::ios::beg);
+    inFile.read(reinterpret_cast<char *>(buf.get()), bufLen);
+    inFile.close();
+
+    // 1. the whole file is mapped
+    IndexBuffer mapped;
+    ASSERT_EQ(OK, mapped.MapFile(path.c_str(), 0, bufLen));
+    EXPECT_TRUE(mapped.IsMapped());
+    ASSERT_EQ(bufLen, mapped.GetLength());
+    EXPECT_EQ(0, memcmp(buf.get(), mapped.GetData(), bufLen));
+
+    // 2. mapping fails, the bytes read from the file are attached instead
+    IndexBuffer copied;
+    EXPECT_NE(OK, copied.MapFile(path.c_str(), 0, bufLen + 1));
+    EXPECT_NE(OK, copied.MapFile(nullptr, 0, bufLen));
+    EXPECT_FALSE(copied.IsMapped());
+    EXPECT_TRUE(copied.GetData() == nullptr);
+    std::unique_ptr<uint8_t[]> copy = std::make_unique<uint8_t[]>(bufLen);
+    memcpy(copy.get(), buf.get(), bufLen);
+    copied.Attach(std::move(copy), bufLen);
+    EXPECT_FALSE(copied.IsMapped());
+    ASSERT_EQ(bufLen, copied.GetLength());
+
+    ResDesc fromMap;
+    ResDesc fromCopy;
+    ASSERT_EQ(OK, HapParser::ParseResHex(mapped.GetData(), mapped.GetLength(), fromMap, nullptr));
+    ASSERT_EQ(OK, HapParser::ParseResHex(copied.GetData(), copied.GetLength(), fromCopy, nullptr));
+    EXPECT_EQ(fromMap.ToString(), fromCopy.ToString());
+
+    // 3. a failed remap keeps the mapping it already holds
+    EXPECT_NE(OK, mapped.MapFile(path.c_str(), bufLen, bufLen));
+    EXPECT_TRUE(mapped.IsMapped());
+    EXPECT_EQ(bufLen, mapped.GetLength());
+
+    const HapResource *pResource = HapResource::LoadFromIndex(path.c_str(), nullptr);
+    ASSERT_TRUE(pResource != nullptr);
+    delete pResource;
+}
 }